@@ -233,6 +233,41 @@ void testHMAC(Hash *hash, size_t keyLen)
         Serial.println("Failed");
 }
 
+// BLAKE2b holds back its last full 128-byte block, so check the
+// empty-message fallback and messages that end on and just past a
+// block boundary against hmac<BLAKE2b>().
+void testHMACContext(size_t keyLen)
+{
+    static size_t const lengths[] = {0, 1, 128, 129};
+    HMAC<BLAKE2b> mac;
+    uint8_t key[BLOCK_SIZE + 1];
+    uint8_t expected[HASH_SIZE];
+    uint8_t actual[HASH_SIZE];
+    bool ok = true;
+
+    Serial.print("HMAC<BLAKE2b> keysize=");
+    Serial.print(keyLen);
+    Serial.print(" ... ");
+
+    memset(key, (uint8_t)keyLen, keyLen);
+    mac.setKey(key, keyLen);
+    for (uint8_t index = 0; index < 4; ++index) {
+        size_t len = lengths[index];
+        memset(buffer, 0xBA, len);
+        hmac<BLAKE2b>(expected, HASH_SIZE, key, keyLen, buffer, len);
+        mac.update(buffer, len / 2);
+        mac.update(buffer + len / 2, len - len / 2);
+        mac.finalize(actual, HASH_SIZE);
+        if (memcmp(expected, actual, HASH_SIZE) != 0)
+            ok = false;
+    }
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
 // Deterministic sequences (Fibonacci generator).  From RFC 7693.
 static void selftest_seq(uint8_t *out, size_t len, uint32_t seed)
 {
@@ -395,6 +430,8 @@ void setup()
     testHMAC(&blake2b, BLOCK_SIZE);
     testHMAC(&blake2b, BLOCK_SIZE + 1);
     testHMAC(&blake2b, BLOCK_SIZE + 2);
+    testHMACContext(HASH_SIZE);
+    testHMACContext(BLOCK_SIZE + 1);
     testRFC7693();
 
     Serial.println();
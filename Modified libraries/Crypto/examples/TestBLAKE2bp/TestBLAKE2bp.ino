@@ -0,0 +1,415 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+This example runs tests on the BLAKE2bp implementation to verify correct behaviour.
+*/
+
+#include <Crypto.h>
+#include <BLAKE2bp.h>
+#include <string.h>
+
+#define HASH_SIZE 64
+#define BLOCK_SIZE 128
+
+struct TestHashVector
+{
+    const char *name;
+    const char *data;
+    uint8_t hash[HASH_SIZE];
+};
+
+struct TestKeyedVector
+{
+    const char *name;
+    size_t dataLen;
+    uint8_t hash[HASH_SIZE];
+};
+
+// Test vectors generated with the reference implementation of BLAKE2bp.
+static TestHashVector const testVectorBLAKE2bp_1 = {
+    "BLAKE2bp #1",
+    "",
+    {0xb5, 0xef, 0x81, 0x1a, 0x80, 0x38, 0xf7, 0x0b,
+     0x62, 0x8f, 0xa8, 0xb2, 0x94, 0xda, 0xae, 0x74,
+     0x92, 0xb1, 0xeb, 0xe3, 0x43, 0xa8, 0x0e, 0xaa,
+     0xbb, 0xf1, 0xf6, 0xae, 0x66, 0x4d, 0xd6, 0x7b,
+     0x9d, 0x90, 0xb0, 0x12, 0x07, 0x91, 0xea, 0xb8,
+     0x1d, 0xc9, 0x69, 0x85, 0xf2, 0x88, 0x49, 0xf6,
+     0xa3, 0x05, 0x18, 0x6a, 0x85, 0x50, 0x1b, 0x40,
+     0x51, 0x14, 0xbf, 0xa6, 0x78, 0xdf, 0x93, 0x80}
+};
+static TestHashVector const testVectorBLAKE2bp_2 = {
+    "BLAKE2bp #2",
+    "abc",
+    {0xb9, 0x1a, 0x6b, 0x66, 0xae, 0x87, 0x52, 0x6c,
+     0x40, 0x0b, 0x0a, 0x8b, 0x53, 0x77, 0x4d, 0xc6,
+     0x52, 0x84, 0xad, 0x8f, 0x65, 0x75, 0xf8, 0x14,
+     0x8f, 0xf9, 0x3d, 0xff, 0x94, 0x3a, 0x6e, 0xcd,
+     0x83, 0x62, 0x13, 0x0f, 0x22, 0xd6, 0xda, 0xe6,
+     0x33, 0xaa, 0x0f, 0x91, 0xdf, 0x4a, 0xc8, 0x9a,
+     0xaf, 0xf3, 0x1d, 0x0f, 0x1b, 0x92, 0x3c, 0x89,
+     0x8e, 0x82, 0x02, 0x5d, 0xed, 0xbd, 0xad, 0x6e}
+};
+static TestHashVector const testVectorBLAKE2bp_3 = {
+    "BLAKE2bp #3",
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+    {0xc5, 0xa0, 0x34, 0x1e, 0xeb, 0xb6, 0x15, 0x50,
+     0x3e, 0x22, 0x93, 0x30, 0xe0, 0x6a, 0x3d, 0xce,
+     0x88, 0x05, 0xb4, 0x34, 0xca, 0x75, 0x8e, 0x89,
+     0x9e, 0x72, 0xac, 0x40, 0xba, 0xc3, 0x6e, 0x63,
+     0x7b, 0x70, 0x09, 0x8a, 0x24, 0xae, 0x5c, 0x3c,
+     0x4d, 0x39, 0xa1, 0x83, 0xa4, 0x3e, 0xb9, 0x74,
+     0x82, 0x3e, 0x3d, 0xdb, 0x5b, 0x09, 0xe0, 0x7a,
+     0xd1, 0xe5, 0x26, 0xe9, 0x05, 0xf6, 0x5b, 0xc4}
+};
+static TestHashVector const testVectorBLAKE2bp_4 = {
+    "BLAKE2bp #4",
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+    "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+    {0xba, 0x14, 0x8f, 0xde, 0x74, 0xa1, 0x39, 0x2b,
+     0x34, 0x98, 0xe2, 0x04, 0xfd, 0x60, 0x12, 0x3b,
+     0x20, 0xc3, 0x1e, 0x8c, 0x7e, 0x1b, 0x73, 0xc0,
+     0x54, 0x00, 0xa4, 0x6d, 0x31, 0xfc, 0x94, 0x7c,
+     0x27, 0x64, 0x3c, 0x83, 0x50, 0xea, 0x62, 0xb4,
+     0xaa, 0xd4, 0x24, 0x67, 0x5c, 0xd0, 0x37, 0x0e,
+     0xaa, 0xb0, 0xfe, 0x73, 0xed, 0x1f, 0x19, 0x62,
+     0xe3, 0xb1, 0x39, 0x0d, 0x0b, 0xf9, 0xc0, 0x45}
+};
+
+// Keyed test vectors from the BLAKE2bp reference implementation.  The key is
+// the bytes 0, 1, 2, ... and the data is the bytes 0, 1, 2, ... modulo 256.
+static TestKeyedVector const testVectorBLAKE2bpKeyed_1 = {
+    "BLAKE2bp Keyed #1",
+    0,
+    {0x9d, 0x94, 0x61, 0x07, 0x3e, 0x4e, 0xb6, 0x40,
+     0xa2, 0x55, 0x35, 0x7b, 0x83, 0x9f, 0x39, 0x4b,
+     0x83, 0x8c, 0x6f, 0xf5, 0x7c, 0x9b, 0x68, 0x6a,
+     0x3f, 0x76, 0x10, 0x7c, 0x10, 0x66, 0x72, 0x8f,
+     0x3c, 0x99, 0x56, 0xbd, 0x78, 0x5c, 0xbc, 0x3b,
+     0xf7, 0x9d, 0xc2, 0xab, 0x57, 0x8c, 0x5a, 0x0c,
+     0x06, 0x3b, 0x9d, 0x9c, 0x40, 0x58, 0x48, 0xde,
+     0x1d, 0xbe, 0x82, 0x1c, 0xd0, 0x5c, 0x94, 0x0a}
+};
+static TestKeyedVector const testVectorBLAKE2bpKeyed_2 = {
+    "BLAKE2bp Keyed #2",
+    1,
+    {0xff, 0x8e, 0x90, 0xa3, 0x7b, 0x94, 0x62, 0x39,
+     0x32, 0xc5, 0x9f, 0x75, 0x59, 0xf2, 0x60, 0x35,
+     0x02, 0x9c, 0x37, 0x67, 0x32, 0xcb, 0x14, 0xd4,
+     0x16, 0x02, 0x00, 0x1c, 0xbb, 0x73, 0xad, 0xb7,
+     0x92, 0x93, 0xa2, 0xdb, 0xda, 0x5f, 0x60, 0x70,
+     0x30, 0x25, 0x14, 0x4d, 0x15, 0x8e, 0x27, 0x35,
+     0x52, 0x95, 0x96, 0x25, 0x1c, 0x73, 0xc0, 0x34,
+     0x5c, 0xa6, 0xfc, 0xcb, 0x1f, 0xb1, 0xe9, 0x7e}
+};
+static TestKeyedVector const testVectorBLAKE2bpKeyed_3 = {
+    "BLAKE2bp Keyed #3",
+    64,
+    {0x22, 0xb8, 0x24, 0x9e, 0xaf, 0x72, 0x29, 0x64,
+     0xce, 0x42, 0x4f, 0x71, 0xa7, 0x4d, 0x03, 0x8f,
+     0xf9, 0xb6, 0x15, 0xfb, 0xa5, 0xc7, 0xc2, 0x2c,
+     0xb6, 0x27, 0x97, 0xf5, 0x39, 0x82, 0x24, 0xc3,
+     0xf0, 0x72, 0xeb, 0xc1, 0xda, 0xcb, 0xa3, 0x2f,
+     0xc6, 0xf6, 0x63, 0x60, 0xb3, 0xe1, 0x65, 0x8d,
+     0x0f, 0xa0, 0xda, 0x1e, 0xd1, 0xc1, 0xda, 0x66,
+     0x2a, 0x20, 0x37, 0xda, 0x82, 0x3a, 0x33, 0x83}
+};
+static TestKeyedVector const testVectorBLAKE2bpKeyed_4 = {
+    "BLAKE2bp Keyed #4",
+    255,
+    {0x96, 0xfb, 0xcb, 0xb6, 0x0b, 0xd3, 0x13, 0xb8,
+     0x84, 0x50, 0x33, 0xe5, 0xbc, 0x05, 0x8a, 0x38,
+     0x02, 0x74, 0x38, 0x57, 0x2d, 0x7e, 0x79, 0x57,
+     0xf3, 0x68, 0x4f, 0x62, 0x68, 0xaa, 0xdd, 0x3a,
+     0xd0, 0x8d, 0x21, 0x76, 0x7e, 0xd6, 0x87, 0x86,
+     0x85, 0x33, 0x1b, 0xa9, 0x85, 0x71, 0x48, 0x7e,
+     0x12, 0x47, 0x0a, 0xad, 0x66, 0x93, 0x26, 0x71,
+     0x6e, 0x46, 0x66, 0x7f, 0x69, 0xf8, 0xd7, 0xe8}
+};
+static TestKeyedVector const testVectorBLAKE2bpKeyed_5 = {
+    "BLAKE2bp Keyed #5",
+    256,
+    {0x99, 0x15, 0xa9, 0x7d, 0xc3, 0xdf, 0x81, 0x25,
+     0x1f, 0x17, 0x78, 0xdf, 0xc4, 0xfa, 0x02, 0xa2,
+     0xad, 0x8c, 0xfc, 0x8f, 0x89, 0xb5, 0x1a, 0xc1,
+     0x9e, 0x90, 0xa4, 0x5f, 0x37, 0x20, 0x69, 0x01,
+     0x5d, 0x8b, 0x4e, 0x87, 0x7b, 0x33, 0x0d, 0x7e,
+     0x53, 0xd1, 0xef, 0x63, 0x6f, 0xa7, 0xb6, 0xf8,
+     0x73, 0x6b, 0x2e, 0x04, 0x9a, 0xa9, 0x8d, 0x2f,
+     0x7c, 0x85, 0xc9, 0x61, 0x5d, 0xf9, 0xe2, 0xec}
+};
+static TestKeyedVector const testVectorBLAKE2bpKeyed_6 = {
+    "BLAKE2bp Keyed #6",
+    1500,
+    {0xcb, 0xec, 0x29, 0xe0, 0x07, 0x57, 0x44, 0x8c,
+     0x5d, 0x6e, 0x66, 0xac, 0xa7, 0x4e, 0x30, 0x53,
+     0xd4, 0x5a, 0x5c, 0xbd, 0x2d, 0xc8, 0xf7, 0x13,
+     0x8e, 0x63, 0xf3, 0x45, 0x66, 0x23, 0x7d, 0xc5,
+     0xae, 0xf8, 0xd9, 0x26, 0x75, 0xe4, 0xbc, 0xd5,
+     0x36, 0xe5, 0xd5, 0xea, 0xf5, 0x0a, 0x95, 0x5d,
+     0x3b, 0xc0, 0x84, 0x51, 0xba, 0x27, 0x88, 0xdd,
+     0xa0, 0x9d, 0x82, 0xb1, 0x25, 0xed, 0x97, 0xfb}
+};
+
+BLAKE2bp blake2bp;
+
+byte buffer[256];
+byte data[1536];
+
+bool testHash_N(Hash *hash, const struct TestHashVector *test, size_t inc)
+{
+    size_t size = strlen(test->data);
+    size_t posn, len;
+    uint8_t value[HASH_SIZE];
+
+    hash->reset();
+    for (posn = 0; posn < size; posn += inc) {
+        len = size - posn;
+        if (len > inc)
+            len = inc;
+        hash->update(test->data + posn, len);
+    }
+    hash->finalize(value, sizeof(value));
+    if (memcmp(value, test->hash, sizeof(value)) != 0)
+        return false;
+
+    return true;
+}
+
+void testHash(Hash *hash, const struct TestHashVector *test)
+{
+    bool ok;
+
+    Serial.print(test->name);
+    Serial.print(" ... ");
+
+    ok  = testHash_N(hash, test, strlen(test->data));
+    ok &= testHash_N(hash, test, 1);
+    ok &= testHash_N(hash, test, 2);
+    ok &= testHash_N(hash, test, 5);
+    ok &= testHash_N(hash, test, 8);
+    ok &= testHash_N(hash, test, 13);
+    ok &= testHash_N(hash, test, 16);
+    ok &= testHash_N(hash, test, 24);
+    ok &= testHash_N(hash, test, 63);
+    ok &= testHash_N(hash, test, 64);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+bool testKeyed_N(BLAKE2bp *hash, const struct TestKeyedVector *test, size_t inc)
+{
+    size_t posn, len;
+    uint8_t value[HASH_SIZE];
+
+    for (posn = 0; posn < HASH_SIZE; ++posn)
+        value[posn] = (uint8_t)posn;
+    hash->reset(value, HASH_SIZE);
+    for (posn = 0; posn < test->dataLen; posn += inc) {
+        len = test->dataLen - posn;
+        if (len > inc)
+            len = inc;
+        hash->update(data + posn, len);
+    }
+    hash->finalize(value, sizeof(value));
+    if (memcmp(value, test->hash, sizeof(value)) != 0)
+        return false;
+
+    return true;
+}
+
+void testKeyed(BLAKE2bp *hash, const struct TestKeyedVector *test)
+{
+    bool ok;
+
+    Serial.print(test->name);
+    Serial.print(" ... ");
+
+    for (size_t posn = 0; posn < sizeof(data); ++posn)
+        data[posn] = (uint8_t)posn;
+
+    ok  = testKeyed_N(hash, test, test->dataLen ? test->dataLen : 1);
+    ok &= testKeyed_N(hash, test, 1);
+    ok &= testKeyed_N(hash, test, 13);
+    ok &= testKeyed_N(hash, test, 64);
+    ok &= testKeyed_N(hash, test, 128);
+    ok &= testKeyed_N(hash, test, 500);
+    ok &= testKeyed_N(hash, test, 512);
+    ok &= testKeyed_N(hash, test, 1024);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void perfHash(Hash *hash)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    int count;
+
+    Serial.print("Hashing ... ");
+
+    for (size_t posn = 0; posn < sizeof(data); ++posn)
+        data[posn] = (uint8_t)posn;
+
+    hash->reset();
+    start = micros();
+    for (count = 0; count < 1000; ++count) {
+        hash->update(data, sizeof(data));
+    }
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / (sizeof(data) * 1000.0));
+    Serial.print("us per byte, ");
+    Serial.print((sizeof(data) * 1000.0 * 1000000.0) / elapsed);
+    Serial.println(" bytes per second");
+}
+
+// Very simple method for hashing a HMAC inner or outer key.
+void hashKey(Hash *hash, const uint8_t *key, size_t keyLen, uint8_t pad)
+{
+    size_t posn;
+    uint8_t buf;
+    uint8_t result[HASH_SIZE];
+    if (keyLen <= BLOCK_SIZE) {
+        hash->reset();
+        for (posn = 0; posn < BLOCK_SIZE; ++posn) {
+            if (posn < keyLen)
+                buf = key[posn] ^ pad;
+            else
+                buf = pad;
+            hash->update(&buf, 1);
+        }
+    } else {
+        hash->reset();
+        hash->update(key, keyLen);
+        hash->finalize(result, HASH_SIZE);
+        hash->reset();
+        for (posn = 0; posn < BLOCK_SIZE; ++posn) {
+            if (posn < HASH_SIZE)
+                buf = result[posn] ^ pad;
+            else
+                buf = pad;
+            hash->update(&buf, 1);
+        }
+    }
+}
+
+void testHMAC(Hash *hash, size_t keyLen)
+{
+    uint8_t result[HASH_SIZE];
+
+    Serial.print("HMAC-BLAKE2bp keysize=");
+    Serial.print(keyLen);
+    Serial.print(" ... ");
+
+    // Construct the expected result with a simple HMAC implementation.
+    memset(buffer, (uint8_t)keyLen, keyLen);
+    hashKey(hash, buffer, keyLen, 0x36);
+    memset(buffer, 0xBA, sizeof(buffer));
+    hash->update(buffer, sizeof(buffer));
+    hash->finalize(result, HASH_SIZE);
+    memset(buffer, (uint8_t)keyLen, keyLen);
+    hashKey(hash, buffer, keyLen, 0x5C);
+    hash->update(result, HASH_SIZE);
+    hash->finalize(result, HASH_SIZE);
+
+    // Now use the library to compute the HMAC.
+    hash->resetHMAC(buffer, keyLen);
+    memset(buffer, 0xBA, sizeof(buffer));
+    hash->update(buffer, sizeof(buffer));
+    memset(buffer, (uint8_t)keyLen, keyLen);
+    hash->finalizeHMAC(buffer, keyLen, buffer, HASH_SIZE);
+
+    // Check the result.
+    if (!memcmp(result, buffer, HASH_SIZE))
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void perfFinalize(Hash *hash)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    int count;
+
+    Serial.print("Finalizing ... ");
+
+    hash->reset();
+    hash->update("abc", 3);
+    start = micros();
+    for (count = 0; count < 1000; ++count) {
+        hash->finalize(buffer, hash->hashSize());
+    }
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / 1000.0);
+    Serial.print("us per op, ");
+    Serial.print((1000.0 * 1000000.0) / elapsed);
+    Serial.println(" ops per second");
+}
+
+void setup()
+{
+    Serial.begin(9600);
+
+    Serial.println();
+
+    Serial.print("State Size ... ");
+    Serial.println(sizeof(BLAKE2bp));
+    Serial.println();
+
+    Serial.println("Test Vectors:");
+    testHash(&blake2bp, &testVectorBLAKE2bp_1);
+    testHash(&blake2bp, &testVectorBLAKE2bp_2);
+    testHash(&blake2bp, &testVectorBLAKE2bp_3);
+    testHash(&blake2bp, &testVectorBLAKE2bp_4);
+    testKeyed(&blake2bp, &testVectorBLAKE2bpKeyed_1);
+    testKeyed(&blake2bp, &testVectorBLAKE2bpKeyed_2);
+    testKeyed(&blake2bp, &testVectorBLAKE2bpKeyed_3);
+    testKeyed(&blake2bp, &testVectorBLAKE2bpKeyed_4);
+    testKeyed(&blake2bp, &testVectorBLAKE2bpKeyed_5);
+    testKeyed(&blake2bp, &testVectorBLAKE2bpKeyed_6);
+    testHMAC(&blake2bp, (size_t)0);
+    testHMAC(&blake2bp, 1);
+    testHMAC(&blake2bp, HASH_SIZE);
+    testHMAC(&blake2bp, BLOCK_SIZE);
+    testHMAC(&blake2bp, BLOCK_SIZE + 1);
+    testHMAC(&blake2bp, sizeof(buffer));
+
+    Serial.println();
+
+    Serial.println("Performance Tests:");
+    perfHash(&blake2bp);
+    perfFinalize(&blake2bp);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,375 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+This example runs tests on the BLAKE2sp implementation to verify correct behaviour.
+*/
+
+#include <Crypto.h>
+#include <BLAKE2sp.h>
+#include <string.h>
+
+#define HASH_SIZE 32
+#define BLOCK_SIZE 64
+
+struct TestHashVector
+{
+    const char *name;
+    const char *data;
+    uint8_t hash[HASH_SIZE];
+};
+
+struct TestKeyedVector
+{
+    const char *name;
+    size_t dataLen;
+    uint8_t hash[HASH_SIZE];
+};
+
+// Test vectors generated with the reference implementation of BLAKE2sp.
+static TestHashVector const testVectorBLAKE2sp_1 = {
+    "BLAKE2sp #1",
+    "",
+    {0xdd, 0x0e, 0x89, 0x17, 0x76, 0x93, 0x3f, 0x43,
+     0xc7, 0xd0, 0x32, 0xb0, 0x8a, 0x91, 0x7e, 0x25,
+     0x74, 0x1f, 0x8a, 0xa9, 0xa1, 0x2c, 0x12, 0xe1,
+     0xca, 0xc8, 0x80, 0x15, 0x00, 0xf2, 0xca, 0x4f}
+};
+static TestHashVector const testVectorBLAKE2sp_2 = {
+    "BLAKE2sp #2",
+    "abc",
+    {0x70, 0xf7, 0x5b, 0x58, 0xf1, 0xfe, 0xca, 0xb8,
+     0x21, 0xdb, 0x43, 0xc8, 0x8a, 0xd8, 0x4e, 0xdd,
+     0xe5, 0xa5, 0x26, 0x00, 0x61, 0x6c, 0xd2, 0x25,
+     0x17, 0xb7, 0xbb, 0x14, 0xd4, 0x40, 0xa7, 0xd5}
+};
+static TestHashVector const testVectorBLAKE2sp_3 = {
+    "BLAKE2sp #3",
+    "abcdbcdecdefdefgefghfghighijhijkijkljklmklmnlmnomnopnopq",
+    {0x3d, 0x10, 0x7e, 0x42, 0xf1, 0x7c, 0x13, 0xc8,
+     0x2b, 0x43, 0x6e, 0xbb, 0x65, 0x1a, 0x48, 0xde,
+     0xf6, 0x7e, 0x77, 0x72, 0xfa, 0x06, 0xf4, 0x73,
+     0x8e, 0xe9, 0x68, 0xc7, 0xf4, 0xd8, 0xb4, 0x8b}
+};
+static TestHashVector const testVectorBLAKE2sp_4 = {
+    "BLAKE2sp #4",
+    "abcdefghbcdefghicdefghijdefghijkefghijklfghijklmghijklmn"
+    "hijklmnoijklmnopjklmnopqklmnopqrlmnopqrsmnopqrstnopqrstu",
+    {0xb2, 0xe3, 0xf1, 0xee, 0xc2, 0x5b, 0xf8, 0x89,
+     0x7a, 0x33, 0xa3, 0xa6, 0xf2, 0x34, 0xa0, 0xa5,
+     0x89, 0xff, 0x21, 0xcf, 0x34, 0x27, 0x85, 0x18,
+     0x98, 0x75, 0xb5, 0xa9, 0x88, 0x99, 0x12, 0x7d}
+};
+
+// Keyed test vectors from the BLAKE2sp reference implementation.  The key is
+// the bytes 0, 1, 2, ... and the data is the bytes 0, 1, 2, ... modulo 256.
+static TestKeyedVector const testVectorBLAKE2spKeyed_1 = {
+    "BLAKE2sp Keyed #1",
+    0,
+    {0x71, 0x5c, 0xb1, 0x38, 0x95, 0xae, 0xb6, 0x78,
+     0xf6, 0x12, 0x41, 0x60, 0xbf, 0xf2, 0x14, 0x65,
+     0xb3, 0x0f, 0x4f, 0x68, 0x74, 0x19, 0x3f, 0xc8,
+     0x51, 0xb4, 0x62, 0x10, 0x43, 0xf0, 0x9c, 0xc6}
+};
+static TestKeyedVector const testVectorBLAKE2spKeyed_2 = {
+    "BLAKE2sp Keyed #2",
+    1,
+    {0x40, 0x57, 0x8f, 0xfa, 0x52, 0xbf, 0x51, 0xae,
+     0x18, 0x66, 0xf4, 0x28, 0x4d, 0x3a, 0x15, 0x7f,
+     0xc1, 0xbc, 0xd3, 0x6a, 0xc1, 0x3c, 0xbd, 0xcb,
+     0x03, 0x77, 0xe4, 0xd0, 0xcd, 0x0b, 0x66, 0x03}
+};
+static TestKeyedVector const testVectorBLAKE2spKeyed_3 = {
+    "BLAKE2sp Keyed #3",
+    64,
+    {0x1d, 0x37, 0x01, 0xa5, 0x66, 0x1b, 0xd3, 0x1a,
+     0xb2, 0x05, 0x62, 0xbd, 0x07, 0xb7, 0x4d, 0xd1,
+     0x9a, 0xc8, 0xf3, 0x52, 0x4b, 0x73, 0xce, 0x7b,
+     0xc9, 0x96, 0xb7, 0x88, 0xaf, 0xd2, 0xf3, 0x17}
+};
+static TestKeyedVector const testVectorBLAKE2spKeyed_4 = {
+    "BLAKE2sp Keyed #4",
+    255,
+    {0x0c, 0x8a, 0x36, 0x59, 0x7d, 0x74, 0x61, 0xc6,
+     0x3a, 0x94, 0x73, 0x28, 0x21, 0xc9, 0x41, 0x85,
+     0x6c, 0x66, 0x83, 0x76, 0x60, 0x6c, 0x86, 0xa5,
+     0x2d, 0xe0, 0xee, 0x41, 0x04, 0xc6, 0x15, 0xdb}
+};
+static TestKeyedVector const testVectorBLAKE2spKeyed_5 = {
+    "BLAKE2sp Keyed #5",
+    256,
+    {0xe5, 0xf4, 0x67, 0x51, 0xed, 0x88, 0x8c, 0x5f,
+     0xb7, 0x43, 0x6c, 0x30, 0x88, 0xde, 0xa8, 0xd3,
+     0x98, 0x06, 0x6a, 0x43, 0xe5, 0x21, 0xcb, 0x13,
+     0x13, 0x34, 0x38, 0xf2, 0xc8, 0x0e, 0x60, 0xe5}
+};
+static TestKeyedVector const testVectorBLAKE2spKeyed_6 = {
+    "BLAKE2sp Keyed #6",
+    1500,
+    {0x39, 0xac, 0xf1, 0xbc, 0x0f, 0x55, 0xa2, 0x7a,
+     0xf8, 0xb0, 0x02, 0x49, 0x5a, 0x68, 0x39, 0x6a,
+     0x6d, 0x0f, 0x29, 0x60, 0x92, 0xf7, 0x2d, 0x8a,
+     0x18, 0xe7, 0x24, 0x10, 0xe8, 0x22, 0x21, 0x1f}
+};
+
+BLAKE2sp blake2sp;
+
+byte buffer[128];
+byte data[1536];
+
+bool testHash_N(Hash *hash, const struct TestHashVector *test, size_t inc)
+{
+    size_t size = strlen(test->data);
+    size_t posn, len;
+    uint8_t value[HASH_SIZE];
+
+    hash->reset();
+    for (posn = 0; posn < size; posn += inc) {
+        len = size - posn;
+        if (len > inc)
+            len = inc;
+        hash->update(test->data + posn, len);
+    }
+    hash->finalize(value, sizeof(value));
+    if (memcmp(value, test->hash, sizeof(value)) != 0)
+        return false;
+
+    return true;
+}
+
+void testHash(Hash *hash, const struct TestHashVector *test)
+{
+    bool ok;
+
+    Serial.print(test->name);
+    Serial.print(" ... ");
+
+    ok  = testHash_N(hash, test, strlen(test->data));
+    ok &= testHash_N(hash, test, 1);
+    ok &= testHash_N(hash, test, 2);
+    ok &= testHash_N(hash, test, 5);
+    ok &= testHash_N(hash, test, 8);
+    ok &= testHash_N(hash, test, 13);
+    ok &= testHash_N(hash, test, 16);
+    ok &= testHash_N(hash, test, 24);
+    ok &= testHash_N(hash, test, 63);
+    ok &= testHash_N(hash, test, 64);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+bool testKeyed_N(BLAKE2sp *hash, const struct TestKeyedVector *test, size_t inc)
+{
+    size_t posn, len;
+    uint8_t value[HASH_SIZE];
+
+    for (posn = 0; posn < HASH_SIZE; ++posn)
+        value[posn] = (uint8_t)posn;
+    hash->reset(value, HASH_SIZE);
+    for (posn = 0; posn < test->dataLen; posn += inc) {
+        len = test->dataLen - posn;
+        if (len > inc)
+            len = inc;
+        hash->update(data + posn, len);
+    }
+    hash->finalize(value, sizeof(value));
+    if (memcmp(value, test->hash, sizeof(value)) != 0)
+        return false;
+
+    return true;
+}
+
+void testKeyed(BLAKE2sp *hash, const struct TestKeyedVector *test)
+{
+    bool ok;
+
+    Serial.print(test->name);
+    Serial.print(" ... ");
+
+    for (size_t posn = 0; posn < sizeof(data); ++posn)
+        data[posn] = (uint8_t)posn;
+
+    ok  = testKeyed_N(hash, test, test->dataLen ? test->dataLen : 1);
+    ok &= testKeyed_N(hash, test, 1);
+    ok &= testKeyed_N(hash, test, 13);
+    ok &= testKeyed_N(hash, test, 64);
+    ok &= testKeyed_N(hash, test, 128);
+    ok &= testKeyed_N(hash, test, 500);
+    ok &= testKeyed_N(hash, test, 512);
+    ok &= testKeyed_N(hash, test, 1024);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void perfHash(Hash *hash)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    int count;
+
+    Serial.print("Hashing ... ");
+
+    for (size_t posn = 0; posn < sizeof(data); ++posn)
+        data[posn] = (uint8_t)posn;
+
+    hash->reset();
+    start = micros();
+    for (count = 0; count < 1000; ++count) {
+        hash->update(data, sizeof(data));
+    }
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / (sizeof(data) * 1000.0));
+    Serial.print("us per byte, ");
+    Serial.print((sizeof(data) * 1000.0 * 1000000.0) / elapsed);
+    Serial.println(" bytes per second");
+}
+
+// Very simple method for hashing a HMAC inner or outer key.
+void hashKey(Hash *hash, const uint8_t *key, size_t keyLen, uint8_t pad)
+{
+    size_t posn;
+    uint8_t buf;
+    uint8_t result[HASH_SIZE];
+    if (keyLen <= BLOCK_SIZE) {
+        hash->reset();
+        for (posn = 0; posn < BLOCK_SIZE; ++posn) {
+            if (posn < keyLen)
+                buf = key[posn] ^ pad;
+            else
+                buf = pad;
+            hash->update(&buf, 1);
+        }
+    } else {
+        hash->reset();
+        hash->update(key, keyLen);
+        hash->finalize(result, HASH_SIZE);
+        hash->reset();
+        for (posn = 0; posn < BLOCK_SIZE; ++posn) {
+            if (posn < HASH_SIZE)
+                buf = result[posn] ^ pad;
+            else
+                buf = pad;
+            hash->update(&buf, 1);
+        }
+    }
+}
+
+void testHMAC(Hash *hash, size_t keyLen)
+{
+    uint8_t result[HASH_SIZE];
+
+    Serial.print("HMAC-BLAKE2sp keysize=");
+    Serial.print(keyLen);
+    Serial.print(" ... ");
+
+    // Construct the expected result with a simple HMAC implementation.
+    memset(buffer, (uint8_t)keyLen, keyLen);
+    hashKey(hash, buffer, keyLen, 0x36);
+    memset(buffer, 0xBA, sizeof(buffer));
+    hash->update(buffer, sizeof(buffer));
+    hash->finalize(result, HASH_SIZE);
+    memset(buffer, (uint8_t)keyLen, keyLen);
+    hashKey(hash, buffer, keyLen, 0x5C);
+    hash->update(result, HASH_SIZE);
+    hash->finalize(result, HASH_SIZE);
+
+    // Now use the library to compute the HMAC.
+    hash->resetHMAC(buffer, keyLen);
+    memset(buffer, 0xBA, sizeof(buffer));
+    hash->update(buffer, sizeof(buffer));
+    memset(buffer, (uint8_t)keyLen, keyLen);
+    hash->finalizeHMAC(buffer, keyLen, buffer, HASH_SIZE);
+
+    // Check the result.
+    if (!memcmp(result, buffer, HASH_SIZE))
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void perfFinalize(Hash *hash)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    int count;
+
+    Serial.print("Finalizing ... ");
+
+    hash->reset();
+    hash->update("abc", 3);
+    start = micros();
+    for (count = 0; count < 1000; ++count) {
+        hash->finalize(buffer, hash->hashSize());
+    }
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / 1000.0);
+    Serial.print("us per op, ");
+    Serial.print((1000.0 * 1000000.0) / elapsed);
+    Serial.println(" ops per second");
+}
+
+void setup()
+{
+    Serial.begin(9600);
+
+    Serial.println();
+
+    Serial.print("State Size ... ");
+    Serial.println(sizeof(BLAKE2sp));
+    Serial.println();
+
+    Serial.println("Test Vectors:");
+    testHash(&blake2sp, &testVectorBLAKE2sp_1);
+    testHash(&blake2sp, &testVectorBLAKE2sp_2);
+    testHash(&blake2sp, &testVectorBLAKE2sp_3);
+    testHash(&blake2sp, &testVectorBLAKE2sp_4);
+    testKeyed(&blake2sp, &testVectorBLAKE2spKeyed_1);
+    testKeyed(&blake2sp, &testVectorBLAKE2spKeyed_2);
+    testKeyed(&blake2sp, &testVectorBLAKE2spKeyed_3);
+    testKeyed(&blake2sp, &testVectorBLAKE2spKeyed_4);
+    testKeyed(&blake2sp, &testVectorBLAKE2spKeyed_5);
+    testKeyed(&blake2sp, &testVectorBLAKE2spKeyed_6);
+    testHMAC(&blake2sp, (size_t)0);
+    testHMAC(&blake2sp, 1);
+    testHMAC(&blake2sp, HASH_SIZE);
+    testHMAC(&blake2sp, BLOCK_SIZE);
+    testHMAC(&blake2sp, BLOCK_SIZE + 1);
+    testHMAC(&blake2sp, sizeof(buffer));
+
+    Serial.println();
+
+    Serial.println("Performance Tests:");
+    perfHash(&blake2sp);
+    perfFinalize(&blake2sp);
+}
+
+void loop()
+{
+}
@@ -0,0 +1,141 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+This example runs tests on the CRC functions to verify correct behaviour.
+*/
+
+#include <Crypto.h>
+#include <string.h>
+
+// Check values over the ASCII string "123456789" from the catalogue at:
+// https://reveng.sourceforge.io/crc-catalogue/
+#define CHECK_STRING    "123456789"
+#define CHECK_CRC8      0xB4        // CRC-8/SAE-J1850 without the final XOR
+#define CHECK_CRC16     0x29B1      // CRC-16/CCITT-FALSE
+#define CHECK_CRC32C    0xE3069283  // CRC-32C
+
+byte buffer[128];
+
+void testCheckValues()
+{
+    bool ok;
+
+    Serial.print("CRC-8 ... ");
+    ok = crypto_crc8(0, CHECK_STRING, 9) == CHECK_CRC8 &&
+         crypto_crc8_update(0xFF, CHECK_STRING, 9) == CHECK_CRC8;
+    Serial.println(ok ? "Passed" : "Failed");
+
+    Serial.print("CRC-16-CCITT ... ");
+    ok = crypto_crc16_ccitt(0xFFFF, CHECK_STRING, 9) == CHECK_CRC16;
+    Serial.println(ok ? "Passed" : "Failed");
+
+    Serial.print("CRC-32C ... ");
+    ok = crypto_crc32c(0, CHECK_STRING, 9) == CHECK_CRC32C;
+    Serial.println(ok ? "Passed" : "Failed");
+}
+
+void testIncremental()
+{
+    bool ok = true;
+    size_t posn;
+
+    Serial.print("Incremental ... ");
+
+    for (posn = 0; posn < sizeof(buffer); ++posn)
+        buffer[posn] = (uint8_t)(posn * 37 + 11);
+
+    // Splitting the data at any point must give the same answer.
+    uint8_t crc8 = crypto_crc8('S', buffer, sizeof(buffer));
+    uint16_t crc16 = crypto_crc16_ccitt(0xFFFF, buffer, sizeof(buffer));
+    uint32_t crc32 = crypto_crc32c(0, buffer, sizeof(buffer));
+    for (posn = 0; posn <= sizeof(buffer); posn += 3) {
+        size_t rest = sizeof(buffer) - posn;
+        if (crypto_crc8(0xFF ^ crypto_crc8('S', buffer, posn),
+                        buffer + posn, rest) != crc8)
+            ok = false;
+        if (crypto_crc8_update(crypto_crc8('S', buffer, posn),
+                               buffer + posn, rest) != crc8)
+            ok = false;
+        if (crypto_crc16_ccitt(crypto_crc16_ccitt(0xFFFF, buffer, posn),
+                               buffer + posn, rest) != crc16)
+            ok = false;
+        if (crypto_crc32c(crypto_crc32c(0, buffer, posn),
+                          buffer + posn, rest) != crc32)
+            ok = false;
+    }
+
+    Serial.println(ok ? "Passed" : "Failed");
+}
+
+void perfCRC(const char *name, uint8_t which)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    uint32_t crc = 0;
+    int count;
+
+    Serial.print(name);
+    Serial.print(" ... ");
+
+    for (size_t posn = 0; posn < sizeof(buffer); ++posn)
+        buffer[posn] = (uint8_t)posn;
+
+    start = micros();
+    for (count = 0; count < 500; ++count) {
+        if (which == 0)
+            crc += crypto_crc8(0, buffer, sizeof(buffer));
+        else if (which == 1)
+            crc += crypto_crc16_ccitt(0xFFFF, buffer, sizeof(buffer));
+        else
+            crc += crypto_crc32c(0, buffer, sizeof(buffer));
+    }
+    elapsed = micros() - start;
+    buffer[0] = (uint8_t)crc; // Keep the compiler from removing the loop.
+
+    Serial.print(elapsed / (sizeof(buffer) * 500.0));
+    Serial.print("us per byte, ");
+    Serial.print((sizeof(buffer) * 500.0 * 1000000.0) / elapsed);
+    Serial.println(" bytes per second");
+}
+
+void setup()
+{
+    Serial.begin(9600);
+
+    Serial.println();
+
+    Serial.println("Test Vectors:");
+    testCheckValues();
+    testIncremental();
+
+    Serial.println();
+
+    Serial.println("Performance Tests:");
+    perfCRC("CRC-8", 0);
+    perfCRC("CRC-16-CCITT", 1);
+    perfCRC("CRC-32C", 2);
+}
+
+void loop()
+{
+}
@@ -91,6 +91,7 @@ static TestVector const testVectorAES128CTR3 = {
 };
 
 CTR<AES128> ctraes128;
+StaticCTR<AES128> staticctraes128;
 
 byte buffer[128];
 
@@ -218,12 +219,17 @@ void setup()
     testCipher(&ctraes128, &testVectorAES128CTR1);
     testCipher(&ctraes128, &testVectorAES128CTR2);
     testCipher(&ctraes128, &testVectorAES128CTR3);
+    testCipher(&staticctraes128, &testVectorAES128CTR1);
+    testCipher(&staticctraes128, &testVectorAES128CTR2);
+    testCipher(&staticctraes128, &testVectorAES128CTR3);
 
     Serial.println();
 
     Serial.println("Performance Tests:");
     perfCipherEncrypt("AES-128-CTR Encrypt", &ctraes128, &testVectorAES128CTR1);
     perfCipherDecrypt("AES-128-CTR Decrypt", &ctraes128, &testVectorAES128CTR1);
+    perfCipherEncrypt("AES-128-CTR Static Encrypt", &staticctraes128, &testVectorAES128CTR1);
+    perfCipherDecrypt("AES-128-CTR Static Decrypt", &staticctraes128, &testVectorAES128CTR1);
 }
 
 void loop()
@@ -200,6 +200,65 @@ void testDH()
         Serial.println("failed");
 }
 
+#define BATCH_SIZE 4
+
+void testDHBatch()
+{
+    static uint8_t batch_k[BATCH_SIZE][32];
+    static uint8_t batch_f[BATCH_SIZE][32];
+    uint8_t result[32];
+
+    Serial.print("Generate random k/f in a batch ... ");
+    Serial.flush();
+    unsigned long start = micros();
+    Curve25519::dh1Batch(batch_k, batch_f, BATCH_SIZE);
+    unsigned long elapsed = micros() - start;
+    Serial.print("elapsed ");
+    Serial.print(elapsed);
+    Serial.println(" us");
+
+    Serial.print("Check the batch against eval() ... ");
+    bool ok = true;
+    for (uint8_t posn = 0; posn < BATCH_SIZE; ++posn) {
+        Curve25519::eval(result, batch_f[posn], 0);
+        if (memcmp(result, batch_k[posn], 32) != 0)
+            ok = false;
+    }
+    if (ok)
+        Serial.println("ok");
+    else
+        Serial.println("failed");
+
+    // Exchange keys with the next entry in the batch.
+    static uint8_t batch_s[BATCH_SIZE][32];
+    static uint8_t batch_g[BATCH_SIZE][32];
+    for (uint8_t posn = 0; posn < BATCH_SIZE; ++posn) {
+        memcpy(batch_s[posn], batch_k[(posn + 1) % BATCH_SIZE], 32);
+        memcpy(batch_g[posn], batch_f[posn], 32);
+    }
+    Serial.print("Generate shared secrets in a batch ... ");
+    Serial.flush();
+    start = micros();
+    ok = Curve25519::dh2Batch(batch_s, batch_g, BATCH_SIZE);
+    elapsed = micros() - start;
+    Serial.print("elapsed ");
+    Serial.print(elapsed);
+    Serial.println(" us");
+
+    Serial.print("Check the batch against dh2() ... ");
+    for (uint8_t posn = 0; posn < BATCH_SIZE; ++posn) {
+        memcpy(result, batch_k[(posn + 1) % BATCH_SIZE], 32);
+        if (!Curve25519::dh2(result, batch_f[posn]))
+            ok = false;
+        if (memcmp(result, batch_s[posn], 32) != 0)
+            ok = false;
+    }
+    if (ok)
+        Serial.println("ok");
+    else
+        Serial.println("failed");
+}
+
 void setup()
 {
     Serial.begin(9600);
@@ -213,6 +272,7 @@ void setup()
     testEval();
     Serial.println();
     testDH();
+    testDHBatch();
     Serial.println();
 }
 
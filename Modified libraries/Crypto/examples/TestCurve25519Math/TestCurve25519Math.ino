@@ -52,6 +52,8 @@ limb_t arg2[NUM_LIMBS];
 limb_t result[NUM_LIMBS];
 limb_t result2[NUM_LIMBS * 2 + 1];
 limb_t temp[NUM_LIMBS];
+limb_t field1[NUM_LIMBS_FIELD25519];
+limb_t field2[NUM_LIMBS_FIELD25519];
 
 // Convert a decimal string in program memory into a number.
 void fromString(limb_t *x, uint8_t size, const char *str)
@@ -460,6 +462,17 @@ void testMul(const char *x, const char *y)
     simpleMul(result2, arg1, arg2);
     simpleMod(result2);
 
+    // Repeat the calculation using the field representation.
+    if (compare(result, result2) == 0) {
+        Curve25519::fieldUnpack(field1, arg1);
+        Curve25519::fieldUnpack(field2, arg2);
+        if (compare(arg1, arg2) != 0)
+            Curve25519::fieldMul(field1, field1, field2);
+        else
+            Curve25519::fieldSquare(field1, field1);
+        Curve25519::fieldPack(result, field1);
+    }
+
     if (compare(result, result2) == 0) {
         Serial.println("ok");
     } else {
@@ -495,6 +508,13 @@ void testMulA24(const char *x)
     simpleMul(result2, arg1, arg2);
     simpleMod(result2);
 
+    // Repeat the calculation using the field representation.
+    if (compare(result, result2) == 0) {
+        Curve25519::fieldUnpack(field1, arg1);
+        Curve25519::fieldMulA24(field1, field1);
+        Curve25519::fieldPack(result, field1);
+    }
+
     if (compare(result, result2) == 0) {
         Serial.println("ok");
     } else {
@@ -241,6 +241,7 @@ EAX<AES128> *eax;
 EAX<AES256> *eax256;
 EAX<Speck> *eaxSpeck;
 EAX<SpeckTiny> *eaxSpeckTiny;
+StaticEAX<AES128> *staticEax;
 
 byte buffer[128];
 
@@ -533,6 +534,17 @@ void setup()
     testCipher(eax, &testVectorEAX8);
     testCipher(eax, &testVectorEAX9);
     testCipher(eax, &testVectorEAX10);
+    staticEax = new StaticEAX<AES128>();
+    testCipher(staticEax, &testVectorEAX1);
+    testCipher(staticEax, &testVectorEAX2);
+    testCipher(staticEax, &testVectorEAX3);
+    testCipher(staticEax, &testVectorEAX4);
+    testCipher(staticEax, &testVectorEAX5);
+    testCipher(staticEax, &testVectorEAX6);
+    testCipher(staticEax, &testVectorEAX7);
+    testCipher(staticEax, &testVectorEAX8);
+    testCipher(staticEax, &testVectorEAX9);
+    testCipher(staticEax, &testVectorEAX10);
 
     Serial.println();
 
@@ -540,6 +552,9 @@ void setup()
     perfCipher(eax, &testVectorEAX1, "AES-128");
     Serial.println();
     delete eax;
+    perfCipher(staticEax, &testVectorEAX1, "Static AES-128");
+    Serial.println();
+    delete staticEax;
     eax256 = new EAX<AES256>();
     perfCipher(eax256, &testVectorEAX1, "AES-256");
     Serial.println();
@@ -125,6 +125,27 @@ void testFixedVectors(const struct TestVector *test)
     Serial.print(elapsed);
     Serial.println(" us)");
 
+    // Sign using an expanded private key.
+    Serial.print(test->name);
+    Serial.print(" sign prepared ... ");
+    Serial.flush();
+    Ed25519::PrivateKey expanded;
+    expanded.setKey(test->privateKey);
+    start = micros();
+    Ed25519::sign(signature, expanded, test->message, test->len);
+    elapsed = micros() - start;
+    if (memcmp(signature, test->signature, 64) == 0 &&
+            memcmp(expanded.publicKey(), test->publicKey, 32) == 0) {
+        Serial.print("ok");
+    } else {
+        Serial.println("failed");
+        printNumber("actual  ", signature, 64);
+        printNumber("expected", test->signature, 64);
+    }
+    Serial.print(" (elapsed ");
+    Serial.print(elapsed);
+    Serial.println(" us)");
+
     // Verify using the test vector.
     Serial.print(test->name);
     Serial.print(" verify ... ");
@@ -141,6 +162,34 @@ void testFixedVectors(const struct TestVector *test)
     Serial.print(elapsed);
     Serial.println(" us)");
 
+    // Verify using a prepared public key.
+    Serial.print(test->name);
+    Serial.print(" verify prepared ... ");
+    Serial.flush();
+    Ed25519::PublicKey prepared;
+    start = micros();
+    verified = prepared.setKey(test->publicKey);
+    elapsed = micros() - start;
+    unsigned long start2 = micros();
+    if (verified)
+        verified = Ed25519::verify(signature, prepared, test->message, test->len);
+    unsigned long elapsed2 = micros() - start2;
+    if (verified) {
+        signature[0] ^= 0x01;
+        verified = !Ed25519::verify(signature, prepared, test->message, test->len);
+        signature[0] ^= 0x01;
+    }
+    if (verified) {
+        Serial.print("ok");
+    } else {
+        Serial.println("failed");
+    }
+    Serial.print(" (setKey ");
+    Serial.print(elapsed);
+    Serial.print(" us, verify ");
+    Serial.print(elapsed2);
+    Serial.println(" us)");
+
     // Check derivation of the public key from the private key.
     Serial.print(test->name);
     Serial.print(" derive public key ... ");
@@ -166,6 +215,72 @@ void testFixedVectors()
     testFixedVectors(&testVectorEd25519_2);
 }
 
+#define BATCH_SIZE 8
+
+static uint8_t batchPublicKeys[BATCH_SIZE][32];
+static uint8_t batchSignatures[BATCH_SIZE][64];
+static uint8_t batchMessages[BATCH_SIZE][16];
+
+bool checkBatch(bool expected, uint8_t bad)
+{
+    const uint8_t *signatures[BATCH_SIZE];
+    const uint8_t *publicKeys[BATCH_SIZE];
+    const void *messages[BATCH_SIZE];
+    size_t lens[BATCH_SIZE];
+    bool results[BATCH_SIZE];
+    uint8_t posn;
+
+    for (posn = 0; posn < BATCH_SIZE; ++posn) {
+        signatures[posn] = batchSignatures[posn];
+        publicKeys[posn] = batchPublicKeys[posn];
+        messages[posn] = batchMessages[posn];
+        lens[posn] = 9 + posn;
+    }
+    unsigned long start = micros();
+    bool verified = Ed25519::verifyBatch
+        (signatures, publicKeys, messages, lens, BATCH_SIZE, results);
+    unsigned long elapsed = micros() - start;
+    if (verified != expected) {
+        Serial.println("failed");
+        return false;
+    }
+    for (posn = 0; posn < BATCH_SIZE; ++posn) {
+        if (results[posn] != (posn != bad)) {
+            Serial.println("failed");
+            return false;
+        }
+    }
+    Serial.print("ok (elapsed ");
+    Serial.print(elapsed);
+    Serial.println(" us)");
+    return true;
+}
+
+void testBatch()
+{
+    uint8_t privateKey[32];
+
+    // Sign random messages with random keys.
+    for (uint8_t posn = 0; posn < BATCH_SIZE; ++posn) {
+        Ed25519::generatePrivateKey(privateKey);
+        Ed25519::derivePublicKey(batchPublicKeys[posn], privateKey);
+        RNG.rand(batchMessages[posn], sizeof(batchMessages[posn]));
+        Ed25519::sign(batchSignatures[posn], privateKey, batchPublicKeys[posn],
+                      batchMessages[posn], 9 + posn);
+    }
+
+    // Verify all of the signatures at once.
+    Serial.print("Ed25519 batch verify ... ");
+    Serial.flush();
+    checkBatch(true, BATCH_SIZE);
+
+    // Corrupt one of the signatures and check that it is identified.
+    Serial.print("Ed25519 batch verify bad signature ... ");
+    Serial.flush();
+    batchSignatures[5][40] ^= 0x01;
+    checkBatch(false, 5);
+}
+
 void setup()
 {
     Serial.begin(9600);
@@ -177,6 +292,7 @@ void setup()
 
     // Perform the tests.
     testFixedVectors();
+    testBatch();
     Serial.println();
 }
 
@@ -267,6 +267,8 @@ GCM<AES192> *gcmaes192 = 0;
 GCM<AES256> *gcmaes256 = 0;
 GCM<Speck> *gcmspeck = 0;
 GCM<SpeckTiny> *gcmspecklm = 0;
+StaticGCM<AES128> *staticgcmaes128 = 0;
+StaticGCM<AES256> *staticgcmaes256 = 0;
 
 byte buffer[128];
 
@@ -554,6 +556,18 @@ void setup()
     gcmaes256 = new GCM<AES256>();
     testCipher(gcmaes256, &testVectorGCM16);
     delete gcmaes256;
+    staticgcmaes128 = new StaticGCM<AES128>();
+    testCipher(staticgcmaes128, &testVectorGCM1);
+#ifndef TEST_SPECK
+    testCipher(staticgcmaes128, &testVectorGCM2);
+    testCipher(staticgcmaes128, &testVectorGCM3);
+    testCipher(staticgcmaes128, &testVectorGCM4);
+    testCipher(staticgcmaes128, &testVectorGCM5);
+#endif
+    delete staticgcmaes128;
+    staticgcmaes256 = new StaticGCM<AES256>();
+    testCipher(staticgcmaes256, &testVectorGCM16);
+    delete staticgcmaes256;
 
     Serial.println();
 
@@ -568,6 +582,9 @@ void setup()
     gcmaes256 = new GCM<AES256>();
     perfCipher(gcmaes256, &testVectorGCM16, testVectorGCM16.name);
     delete gcmaes256;
+    staticgcmaes128 = new StaticGCM<AES128>();
+    perfCipher(staticgcmaes128, &testVectorGCM1, "StaticGCM-AES-128");
+    delete staticgcmaes128;
 #endif
 #if defined(TEST_SPECK) || !defined(__AVR__)
     gcmspeck = new GCM<Speck>();
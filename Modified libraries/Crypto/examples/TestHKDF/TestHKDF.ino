@@ -78,10 +78,14 @@ static TestHKDFVector const testVectorHKDF_1 = {
 };
 
 HKDF<SHA256> hkdf_context;
+StaticHKDF<SHA256> static_hkdf_context;
 
 uint8_t buffer[128];
 
-bool testHKDF_N(HKDFCommon *hkdf, const TestHKDFVector *test, size_t inc)
+// setKey() and extract() are not virtual, so the tests are templates
+// to call the StaticHKDF versions directly.
+template <typename H>
+bool testHKDF_N(H *hkdf, const TestHKDFVector *test, size_t inc)
 {
     size_t size = test->out_len;
     size_t posn, len;
@@ -99,10 +103,12 @@ bool testHKDF_N(HKDFCommon *hkdf, const TestHKDFVector *test, size_t inc)
     return true;
 }
 
-void testHKDF(HKDFCommon *hkdf, const TestHKDFVector *test)
+template <typename H>
+void testHKDF(H *hkdf, const TestHKDFVector *test, const char *prefix = "")
 {
     bool ok;
 
+    Serial.print(prefix);
     Serial.print(test->name);
     Serial.print(" ... ");
 
@@ -137,6 +143,7 @@ void setup()
 
     Serial.println("Test Vectors:");
     testHKDF(&hkdf_context, &testVectorHKDF_1);
+    testHKDF(&static_hkdf_context, &testVectorHKDF_1, "Static ");
     Serial.println();
 }
 
@@ -0,0 +1,444 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+This example runs tests on the TurboSHAKE and KangarooTwelve
+implementations to verify correct behaviour.
+*/
+
+#include <Crypto.h>
+#include <TurboSHAKE.h>
+#include <KangarooTwelve.h>
+#include <string.h>
+#if defined(__AVR__)
+#include <avr/pgmspace.h>
+#else
+#define PROGMEM
+#define memcpy_P(d, s, l)   memcpy((d), (s), (l))
+#endif
+
+// The inputs of the test vectors are the repeating pattern 00 01 02 ...
+// F9 FA from RFC 9861.  On hosts, a larger copy of the pattern lets
+// KangarooTwelve hash several chunks in a single update() call.
+#define PATTERN_PERIOD      251
+#if defined(__AVR__)
+#define PATTERN_SIZE        PATTERN_PERIOD
+#else
+#define PATTERN_SIZE        (PATTERN_PERIOD * 200)
+#endif
+#define CHECK_SIZE          32
+#define OUTPUT_BLOCK        64
+
+struct TestVectorK12
+{
+    const char *name;
+    uint32_t msgLen;
+    uint8_t msgFF;          // Message is msgLen 0xFF bytes instead of pattern.
+    uint32_t customLen;
+    uint8_t domain;
+    uint32_t outLen;
+    uint8_t output[CHECK_SIZE]; // Last CHECK_SIZE bytes of the output.
+};
+
+// Test vectors based on those in RFC 9861.
+static TestVectorK12 const testVectorTurboSHAKE128_1 PROGMEM = {
+    "TurboSHAKE128 #1",
+    0, 0, 0, 0x1F, 32,
+    {0x1E, 0x41, 0x5F, 0x1C, 0x59, 0x83, 0xAF, 0xF2,
+     0x16, 0x92, 0x17, 0x27, 0x7D, 0x17, 0xBB, 0x53,
+     0x8C, 0xD9, 0x45, 0xA3, 0x97, 0xDD, 0xEC, 0x54,
+     0x1F, 0x1C, 0xE4, 0x1A, 0xF2, 0xC1, 0xB7, 0x4C}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_2 PROGMEM = {
+    "TurboSHAKE128 #2",
+    0, 0, 0, 0x1F, 10032,
+    {0xA3, 0xB9, 0xB0, 0x38, 0x59, 0x00, 0xCE, 0x76,
+     0x1F, 0x22, 0xAE, 0xD5, 0x48, 0xE7, 0x54, 0xDA,
+     0x10, 0xA5, 0x24, 0x2D, 0x62, 0xE8, 0xC6, 0x58,
+     0xE3, 0xF3, 0xA9, 0x23, 0xA7, 0x55, 0x56, 0x07}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_3 PROGMEM = {
+    "TurboSHAKE128 #3",
+    17, 0, 0, 0x1F, 32,
+    {0x9C, 0x97, 0xD0, 0x36, 0xA3, 0xBA, 0xC8, 0x19,
+     0xDB, 0x70, 0xED, 0xE0, 0xCA, 0x55, 0x4E, 0xC6,
+     0xE4, 0xC2, 0xA1, 0xA4, 0xFF, 0xBF, 0xD9, 0xEC,
+     0x26, 0x9C, 0xA6, 0xA1, 0x11, 0x16, 0x12, 0x33}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_4 PROGMEM = {
+    "TurboSHAKE128 #4",
+    289, 0, 0, 0x1F, 32,
+    {0x96, 0xC7, 0x7C, 0x27, 0x9E, 0x01, 0x26, 0xF7,
+     0xFC, 0x07, 0xC9, 0xB0, 0x7F, 0x5C, 0xDA, 0xE1,
+     0xE0, 0xBE, 0x60, 0xBD, 0xBE, 0x10, 0x62, 0x00,
+     0x40, 0xE7, 0x5D, 0x72, 0x23, 0xA6, 0x24, 0xD2}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_5 PROGMEM = {
+    "TurboSHAKE128 #5",
+    4913, 0, 0, 0x1F, 32,
+    {0xD4, 0x97, 0x6E, 0xB5, 0x6B, 0xCF, 0x11, 0x85,
+     0x20, 0x58, 0x2B, 0x70, 0x9F, 0x73, 0xE1, 0xD6,
+     0x85, 0x3E, 0x00, 0x1F, 0xDA, 0xF8, 0x0E, 0x1B,
+     0x13, 0xE0, 0xD0, 0x59, 0x9D, 0x5F, 0xB3, 0x72}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_6 PROGMEM = {
+    "TurboSHAKE128 #6",
+    1, 1, 0, 0x01, 32,
+    {0x01, 0x2A, 0xD6, 0x64, 0x92, 0x2C, 0xE3, 0xF8,
+     0x1B, 0x05, 0x87, 0x35, 0xB5, 0x0A, 0xAC, 0xBD,
+     0xE3, 0x83, 0xF1, 0xA9, 0xA7, 0x51, 0x80, 0xB4,
+     0xB9, 0xF9, 0x29, 0x55, 0x0A, 0x55, 0x52, 0xB5}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_7 PROGMEM = {
+    "TurboSHAKE128 #7",
+    3, 1, 0, 0x06, 32,
+    {0x3D, 0x03, 0x98, 0x8B, 0xB5, 0x9E, 0x68, 0x18,
+     0x51, 0xA1, 0x92, 0xF4, 0x29, 0xAE, 0x03, 0x98,
+     0x8E, 0x8F, 0x44, 0x4B, 0xC0, 0x60, 0x36, 0xA3,
+     0xF1, 0xA7, 0xD2, 0xCC, 0xD7, 0x58, 0xD1, 0x74}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_8 PROGMEM = {
+    "TurboSHAKE128 #8",
+    7, 1, 0, 0x0B, 32,
+    {0x8D, 0xEE, 0xAA, 0x1A, 0xEC, 0x47, 0xCC, 0xEE,
+     0x56, 0x9F, 0x65, 0x9C, 0x21, 0xDF, 0xA8, 0xE1,
+     0x12, 0xDB, 0x3C, 0xEE, 0x37, 0xB1, 0x81, 0x78,
+     0xB2, 0xAC, 0xD8, 0x05, 0xB7, 0x99, 0xCC, 0x37}
+};
+static TestVectorK12 const testVectorTurboSHAKE128_9 PROGMEM = {
+    "TurboSHAKE128 #9",
+    3, 1, 0, 0x7F, 32,
+    {0x16, 0x27, 0x4C, 0xC6, 0x56, 0xD4, 0x4C, 0xEF,
+     0xD4, 0x22, 0x39, 0x5D, 0x0F, 0x90, 0x53, 0xBD,
+     0xA6, 0xD2, 0x8E, 0x12, 0x2A, 0xBA, 0x15, 0xC7,
+     0x65, 0xE5, 0xAD, 0x0E, 0x6E, 0xAF, 0x26, 0xF9}
+};
+static TestVectorK12 const testVectorTurboSHAKE256_1 PROGMEM = {
+    "TurboSHAKE256 #1",
+    0, 0, 0, 0x1F, 64,
+    {0x11, 0xED, 0xC0, 0xE1, 0x2E, 0x91, 0xEA, 0x60,
+     0xEB, 0x6B, 0x32, 0xDF, 0x06, 0xDD, 0x7F, 0x00,
+     0x2F, 0xBA, 0xFA, 0xBB, 0x6E, 0x13, 0xEC, 0x1C,
+     0xC2, 0x0D, 0x99, 0x55, 0x47, 0x60, 0x0D, 0xB0}
+};
+static TestVectorK12 const testVectorTurboSHAKE256_2 PROGMEM = {
+    "TurboSHAKE256 #2",
+    0, 0, 0, 0x1F, 10032,
+    {0xAB, 0xEF, 0xA1, 0x16, 0x30, 0xC6, 0x61, 0x26,
+     0x92, 0x49, 0x74, 0x26, 0x85, 0xEC, 0x08, 0x2F,
+     0x20, 0x72, 0x65, 0xDC, 0xCF, 0x2F, 0x43, 0x53,
+     0x4E, 0x9C, 0x61, 0xBA, 0x0C, 0x9D, 0x1D, 0x75}
+};
+static TestVectorK12 const testVectorTurboSHAKE256_3 PROGMEM = {
+    "TurboSHAKE256 #3",
+    289, 0, 0, 0x1F, 64,
+    {0xE3, 0x5E, 0x7B, 0x83, 0xE8, 0xB7, 0xE6, 0xEB,
+     0x4B, 0x78, 0x60, 0x58, 0x80, 0x11, 0x63, 0x16,
+     0xFE, 0x2C, 0x07, 0x8A, 0x09, 0xB9, 0x4A, 0xD7,
+     0xB8, 0x21, 0x3C, 0x0A, 0x73, 0x8B, 0x65, 0xC0}
+};
+static TestVectorK12 const testVectorTurboSHAKE256_4 PROGMEM = {
+    "TurboSHAKE256 #4",
+    3, 1, 0, 0x06, 64,
+    {0x35, 0xEF, 0x27, 0x28, 0x43, 0x0A, 0x9E, 0x31,
+     0x70, 0x04, 0xF8, 0x36, 0xC9, 0xA2, 0x38, 0xEF,
+     0x35, 0x37, 0x02, 0x80, 0xD0, 0x3D, 0xCE, 0x7F,
+     0x06, 0x12, 0xF0, 0x31, 0x5B, 0x3C, 0xBF, 0x63}
+};
+static TestVectorK12 const testVectorK12_1 PROGMEM = {
+    "KangarooTwelve #1",
+    0, 0, 0, 0x00, 32,
+    {0x1A, 0xC2, 0xD4, 0x50, 0xFC, 0x3B, 0x42, 0x05,
+     0xD1, 0x9D, 0xA7, 0xBF, 0xCA, 0x1B, 0x37, 0x51,
+     0x3C, 0x08, 0x03, 0x57, 0x7A, 0xC7, 0x16, 0x7F,
+     0x06, 0xFE, 0x2C, 0xE1, 0xF0, 0xEF, 0x39, 0xE5}
+};
+static TestVectorK12 const testVectorK12_2 PROGMEM = {
+    "KangarooTwelve #2",
+    0, 0, 0, 0x00, 10032,
+    {0xE8, 0xDC, 0x56, 0x36, 0x42, 0xF7, 0x22, 0x8C,
+     0x84, 0x68, 0x4C, 0x89, 0x84, 0x05, 0xD3, 0xA8,
+     0x34, 0x79, 0x91, 0x58, 0xC0, 0x79, 0xB1, 0x28,
+     0x80, 0x27, 0x7A, 0x1D, 0x28, 0xE2, 0xFF, 0x6D}
+};
+static TestVectorK12 const testVectorK12_3 PROGMEM = {
+    "KangarooTwelve #3",
+    17, 0, 0, 0x00, 32,
+    {0x6B, 0xF7, 0x5F, 0xA2, 0x23, 0x91, 0x98, 0xDB,
+     0x47, 0x72, 0xE3, 0x64, 0x78, 0xF8, 0xE1, 0x9B,
+     0x0F, 0x37, 0x12, 0x05, 0xF6, 0xA9, 0xA9, 0x3A,
+     0x27, 0x3F, 0x51, 0xDF, 0x37, 0x12, 0x28, 0x88}
+};
+static TestVectorK12 const testVectorK12_4 PROGMEM = {
+    "KangarooTwelve #4",
+    4913, 0, 0, 0x00, 32,
+    {0xCB, 0x55, 0x2E, 0x2E, 0xC7, 0x7D, 0x99, 0x10,
+     0x70, 0x1D, 0x57, 0x8B, 0x45, 0x7D, 0xDF, 0x77,
+     0x2C, 0x12, 0xE3, 0x22, 0xE4, 0xEE, 0x7F, 0xE4,
+     0x17, 0xF9, 0x2C, 0x75, 0x8F, 0x0D, 0x59, 0xD0}
+};
+static TestVectorK12 const testVectorK12_5 PROGMEM = {
+    "KangarooTwelve #5",
+    83521, 0, 0, 0x00, 32,
+    {0x87, 0x01, 0x04, 0x5E, 0x22, 0x20, 0x53, 0x45,
+     0xFF, 0x4D, 0xDA, 0x05, 0x55, 0x5C, 0xBB, 0x5C,
+     0x3A, 0xF1, 0xA7, 0x71, 0xC2, 0xB8, 0x9B, 0xAE,
+     0xF3, 0x7D, 0xB4, 0x3D, 0x99, 0x98, 0xB9, 0xFE}
+};
+static TestVectorK12 const testVectorK12_6 PROGMEM = {
+    "KangarooTwelve #6",
+    0, 0, 1, 0x00, 32,
+    {0xFA, 0xB6, 0x58, 0xDB, 0x63, 0xE9, 0x4A, 0x24,
+     0x61, 0x88, 0xBF, 0x7A, 0xF6, 0x9A, 0x13, 0x30,
+     0x45, 0xF4, 0x6E, 0xE9, 0x84, 0xC5, 0x6E, 0x3C,
+     0x33, 0x28, 0xCA, 0xAF, 0x1A, 0xA1, 0xA5, 0x83}
+};
+static TestVectorK12 const testVectorK12_7 PROGMEM = {
+    "KangarooTwelve #7",
+    1, 1, 41, 0x00, 32,
+    {0xD8, 0x48, 0xC5, 0x06, 0x8C, 0xED, 0x73, 0x6F,
+     0x44, 0x62, 0x15, 0x9B, 0x98, 0x67, 0xFD, 0x4C,
+     0x20, 0xB8, 0x08, 0xAC, 0xC3, 0xD5, 0xBC, 0x48,
+     0xE0, 0xB0, 0x6B, 0xA0, 0xA3, 0x76, 0x2E, 0xC4}
+};
+static TestVectorK12 const testVectorK12_8 PROGMEM = {
+    "KangarooTwelve #8",
+    3, 1, 1681, 0x00, 32,
+    {0xC3, 0x89, 0xE5, 0x00, 0x9A, 0xE5, 0x71, 0x20,
+     0x85, 0x4C, 0x2E, 0x8C, 0x64, 0x67, 0x0A, 0xC0,
+     0x13, 0x58, 0xCF, 0x4C, 0x1B, 0xAF, 0x89, 0x44,
+     0x7A, 0x72, 0x42, 0x34, 0xDC, 0x7C, 0xED, 0x74}
+};
+static TestVectorK12 const testVectorK12_9 PROGMEM = {
+    "KangarooTwelve #9",
+    7, 1, 68921, 0x00, 32,
+    {0x75, 0xD2, 0xF8, 0x6A, 0x2E, 0x64, 0x45, 0x66,
+     0x72, 0x6B, 0x4F, 0xBC, 0xFC, 0x56, 0x57, 0xB9,
+     0xDB, 0xCF, 0x07, 0x0C, 0x7B, 0x0D, 0xCA, 0x06,
+     0x45, 0x0A, 0xB2, 0x91, 0xD7, 0x44, 0x3B, 0xCF}
+};
+static TestVectorK12 const testVectorK12_10 PROGMEM = {
+    "KangarooTwelve #10",
+    8191, 0, 0, 0x00, 32,
+    {0x1B, 0x57, 0x76, 0x36, 0xF7, 0x23, 0x64, 0x3E,
+     0x99, 0x0C, 0xC7, 0xD6, 0xA6, 0x59, 0x83, 0x74,
+     0x36, 0xFD, 0x6A, 0x10, 0x36, 0x26, 0x60, 0x0E,
+     0xB8, 0x30, 0x1C, 0xD1, 0xDB, 0xE5, 0x53, 0xD6}
+};
+static TestVectorK12 const testVectorK12_11 PROGMEM = {
+    "KangarooTwelve #11",
+    8192, 0, 0, 0x00, 32,
+    {0x48, 0xF2, 0x56, 0xF6, 0x77, 0x2F, 0x9E, 0xDF,
+     0xB6, 0xA8, 0xB6, 0x61, 0xEC, 0x92, 0xDC, 0x93,
+     0xB9, 0x5E, 0xBD, 0x05, 0xA0, 0x8A, 0x17, 0xB3,
+     0x9A, 0xE3, 0x49, 0x08, 0x70, 0xC9, 0x26, 0xC3}
+};
+static TestVectorK12 const testVectorK12_12 PROGMEM = {
+    "KangarooTwelve #12",
+    8192, 0, 8189, 0x00, 32,
+    {0x3E, 0xD1, 0x2F, 0x70, 0xFB, 0x05, 0xDD, 0xB5,
+     0x86, 0x89, 0x51, 0x0A, 0xB3, 0xE4, 0xD2, 0x3C,
+     0x6C, 0x60, 0x33, 0x84, 0x9A, 0xA0, 0x1E, 0x1D,
+     0x8C, 0x22, 0x0A, 0x29, 0x7F, 0xED, 0xCD, 0x0B}
+};
+static TestVectorK12 const testVectorK12_13 PROGMEM = {
+    "KangarooTwelve #13",
+    8192, 0, 8190, 0x00, 32,
+    {0x6A, 0x7C, 0x1B, 0x6A, 0x5C, 0xD0, 0xD8, 0xC9,
+     0xCA, 0x94, 0x3A, 0x4A, 0x21, 0x6C, 0xC6, 0x46,
+     0x04, 0x55, 0x9A, 0x2E, 0xA4, 0x5F, 0x78, 0x57,
+     0x0A, 0x15, 0x25, 0x3D, 0x67, 0xBA, 0x00, 0xAE}
+};
+static TestVectorK12 const testVectorK12_14 PROGMEM = {
+    "KangarooTwelve #14",
+    200000, 0, 0, 0x00, 32,
+    {0x39, 0xB4, 0xA1, 0x98, 0xB0, 0xEC, 0x9D, 0x7A,
+     0xC9, 0xA8, 0x41, 0x66, 0xE8, 0x60, 0x22, 0xA4,
+     0x2C, 0x43, 0xA8, 0x59, 0xC8, 0x33, 0x48, 0xAB,
+     0x3B, 0x59, 0x19, 0xD5, 0x65, 0x4A, 0x46, 0xBB}
+};
+
+TurboSHAKE128 turboshake128;
+TurboSHAKE256 turboshake256;
+KangarooTwelve k12;
+TestVectorK12 tst;
+uint8_t pattern[PATTERN_SIZE];
+uint8_t output[OUTPUT_BLOCK];
+
+void absorbInput(XOF *xof, bool custom, uint32_t len, size_t inc)
+{
+    static uint8_t const ff[8] = {
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF
+    };
+    size_t posn = 0;
+    while (len > 0) {
+        size_t size;
+        if (!custom && tst.msgFF) {
+            size = sizeof(ff);
+            if (size > len)
+                size = len;
+            xof->update(ff, size);
+        } else {
+            size = (inc / PATTERN_PERIOD) * PATTERN_PERIOD;
+            if (!size)
+                size = inc;
+            if (size > len)
+                size = len;
+            if (size > (PATTERN_SIZE - posn))
+                size = PATTERN_SIZE - posn;
+            if (custom)
+                ((KangarooTwelve *)xof)->customize(pattern + posn, size);
+            else
+                xof->update(pattern + posn, size);
+            posn = (posn + size) % PATTERN_PERIOD;
+        }
+        len -= size;
+    }
+}
+
+bool testK12_N(XOF *xof, const struct TestVectorK12 *test, bool isK12,
+               size_t inc, bool printName = false)
+{
+    uint32_t len;
+
+    // Copy the test case out of program memory.
+    memcpy_P(&tst, test, sizeof(tst));
+    test = &tst;
+
+    // Print the test name if necessary.
+    if (printName) {
+        Serial.print(test->name);
+        Serial.print(" ... ");
+    }
+
+    // Absorb the message and the customization string.
+    if (isK12)
+        xof->reset();
+    else
+        ((TurboSHAKE *)xof)->reset(test->domain);
+    absorbInput(xof, false, test->msgLen, inc);
+    if (isK12)
+        absorbInput(xof, true, test->customLen, inc);
+
+    // Squeeze the output and check the last bytes.
+    len = test->outLen;
+    while (len > OUTPUT_BLOCK) {
+        xof->extend(output, OUTPUT_BLOCK);
+        len -= OUTPUT_BLOCK;
+    }
+    xof->extend(output, len);
+    return memcmp(output + len - CHECK_SIZE, test->output, CHECK_SIZE) == 0;
+}
+
+void testK12(XOF *xof, const struct TestVectorK12 *test, bool isK12 = false)
+{
+    bool ok;
+
+    ok  = testK12_N(xof, test, isK12, PATTERN_SIZE, true);
+    ok &= testK12_N(xof, test, isK12, 1);
+    ok &= testK12_N(xof, test, isK12, 13);
+    ok &= testK12_N(xof, test, isK12, 200);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void perfUpdate(const char *name, XOF *xof)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    int count;
+
+    Serial.print(name);
+    Serial.print(" updating ... ");
+
+    xof->reset();
+    start = micros();
+    for (count = 0; count < 100; ++count) {
+        xof->update(pattern, PATTERN_SIZE);
+    }
+    xof->extend(output, 0);     // Force a finalize after the update.
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / (PATTERN_SIZE * 100.0));
+    Serial.print("us per byte, ");
+    Serial.print((PATTERN_SIZE * 100.0 * 1000000.0) / elapsed);
+    Serial.println(" bytes per second");
+}
+
+void setup()
+{
+    Serial.begin(9600);
+
+    Serial.println();
+
+    for (size_t posn = 0; posn < PATTERN_SIZE; ++posn)
+        pattern[posn] = (uint8_t)(posn % PATTERN_PERIOD);
+
+    Serial.print("State Sizes ... TurboSHAKE128: ");
+    Serial.print(sizeof(TurboSHAKE128));
+    Serial.print(", KangarooTwelve: ");
+    Serial.println(sizeof(KangarooTwelve));
+    Serial.println();
+
+    Serial.println("Test Vectors:");
+    testK12(&turboshake128, &testVectorTurboSHAKE128_1);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_2);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_3);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_4);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_5);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_6);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_7);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_8);
+    testK12(&turboshake128, &testVectorTurboSHAKE128_9);
+    testK12(&turboshake256, &testVectorTurboSHAKE256_1);
+    testK12(&turboshake256, &testVectorTurboSHAKE256_2);
+    testK12(&turboshake256, &testVectorTurboSHAKE256_3);
+    testK12(&turboshake256, &testVectorTurboSHAKE256_4);
+    testK12(&k12, &testVectorK12_1, true);
+    testK12(&k12, &testVectorK12_2, true);
+    testK12(&k12, &testVectorK12_3, true);
+    testK12(&k12, &testVectorK12_4, true);
+    testK12(&k12, &testVectorK12_5, true);
+    testK12(&k12, &testVectorK12_6, true);
+    testK12(&k12, &testVectorK12_7, true);
+    testK12(&k12, &testVectorK12_8, true);
+    testK12(&k12, &testVectorK12_9, true);
+    testK12(&k12, &testVectorK12_10, true);
+    testK12(&k12, &testVectorK12_11, true);
+    testK12(&k12, &testVectorK12_12, true);
+    testK12(&k12, &testVectorK12_13, true);
+    testK12(&k12, &testVectorK12_14, true);
+
+    Serial.println();
+
+    Serial.println("Performance Tests:");
+    perfUpdate("TurboSHAKE128", &turboshake128);
+    perfUpdate("TurboSHAKE256", &turboshake256);
+    perfUpdate("KangarooTwelve", &k12);
+}
+
+void loop()
+{
+}
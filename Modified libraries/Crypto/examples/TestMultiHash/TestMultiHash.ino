@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+This example runs tests on the multi-buffer hash implementations to verify
+that they produce the same results as the single-message hash classes.
+*/
+
+#include <Crypto.h>
+#include <MultiHash.h>
+#include <SHA256.h>
+#include <SHA512.h>
+#include <BLAKE2s.h>
+#include <SHA3.h>
+#include <SHAKE.h>
+#include <string.h>
+
+#define MAX_MESSAGES    20
+#define MAX_MESSAGE_LEN 300
+#define MAX_HASH_SIZE   200
+#define XOF_OUTPUT_LEN  200
+
+byte messages[MAX_MESSAGES][MAX_MESSAGE_LEN];
+byte hashes[MAX_MESSAGES][MAX_HASH_SIZE];
+byte expected[MAX_HASH_SIZE];
+
+const void *dataPtrs[MAX_MESSAGES];
+uint8_t *hashPtrs[MAX_MESSAGES];
+size_t lens[MAX_MESSAGES];
+
+typedef void (*MultiHashFunc)(uint8_t *const *hashes, const void *const *data,
+                              const size_t *lens, size_t count);
+typedef void (*MultiXOFFunc)(uint8_t *const *outputs, size_t outLen,
+                             const void *const *data, const size_t *lens,
+                             size_t count);
+
+void setupMessages(size_t count, size_t baseLen)
+{
+    for (size_t posn = 0; posn < count; ++posn) {
+        for (size_t index = 0; index < MAX_MESSAGE_LEN; ++index)
+            messages[posn][index] = (uint8_t)(posn * 7 + index);
+        dataPtrs[posn] = messages[posn];
+        hashPtrs[posn] = hashes[posn];
+        lens[posn] = (baseLen + posn * 13) % (MAX_MESSAGE_LEN + 1);
+    }
+}
+
+bool testMultiHash_N(MultiHashFunc func, Hash *hash, size_t count, size_t baseLen)
+{
+    size_t hashSize = hash->hashSize();
+    setupMessages(count, baseLen);
+    memset(hashes, 0xAA, sizeof(hashes));
+    (*func)(hashPtrs, dataPtrs, lens, count);
+    for (size_t posn = 0; posn < count; ++posn) {
+        hash->reset();
+        hash->update(messages[posn], lens[posn]);
+        hash->finalize(expected, hashSize);
+        if (memcmp(hashes[posn], expected, hashSize) != 0)
+            return false;
+    }
+    return true;
+}
+
+void testMultiHash(const char *name, MultiHashFunc func, Hash *hash)
+{
+    bool ok;
+
+    Serial.print(name);
+    Serial.print(" ... ");
+
+    ok  = testMultiHash_N(func, hash, 1, 0);
+    ok &= testMultiHash_N(func, hash, 3, 55);
+    ok &= testMultiHash_N(func, hash, 4, 64);
+    ok &= testMultiHash_N(func, hash, 8, 111);
+    ok &= testMultiHash_N(func, hash, 16, 128);
+    ok &= testMultiHash_N(func, hash, MAX_MESSAGES, 1);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+bool testMultiXOF_N(MultiXOFFunc func, XOF *xof, size_t count, size_t baseLen)
+{
+    setupMessages(count, baseLen);
+    memset(hashes, 0xAA, sizeof(hashes));
+    (*func)(hashPtrs, XOF_OUTPUT_LEN, dataPtrs, lens, count);
+    for (size_t posn = 0; posn < count; ++posn) {
+        xof->reset();
+        xof->update(messages[posn], lens[posn]);
+        xof->extend(expected, XOF_OUTPUT_LEN);
+        if (memcmp(hashes[posn], expected, XOF_OUTPUT_LEN) != 0)
+            return false;
+    }
+    return true;
+}
+
+void testMultiXOF(const char *name, MultiXOFFunc func, XOF *xof)
+{
+    bool ok;
+
+    Serial.print(name);
+    Serial.print(" ... ");
+
+    ok  = testMultiXOF_N(func, xof, 1, 0);
+    ok &= testMultiXOF_N(func, xof, 3, 135);
+    ok &= testMultiXOF_N(func, xof, 4, 168);
+    ok &= testMultiXOF_N(func, xof, 7, 111);
+    ok &= testMultiXOF_N(func, xof, MAX_MESSAGES, 1);
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void perfMultiHash(const char *name, MultiHashFunc func, Hash *hash)
+{
+    unsigned long start;
+    unsigned long elapsed;
+    int count;
+
+    Serial.print(name);
+    Serial.print(" batch of 16 x 64 bytes ... ");
+
+    setupMessages(16, 64);
+    for (size_t posn = 0; posn < 16; ++posn)
+        lens[posn] = 64;
+    start = micros();
+    for (count = 0; count < 1000; ++count)
+        (*func)(hashPtrs, dataPtrs, lens, 16);
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / 16000.0);
+    Serial.print("us per message, single: ");
+
+    start = micros();
+    for (count = 0; count < 1000; ++count) {
+        for (size_t posn = 0; posn < 16; ++posn) {
+            hash->reset();
+            hash->update(messages[posn], 64);
+            hash->finalize(hashes[posn], hash->hashSize());
+        }
+    }
+    elapsed = micros() - start;
+
+    Serial.print(elapsed / 16000.0);
+    Serial.println("us per message");
+}
+
+SHA256 sha256;
+SHA512 sha512;
+BLAKE2s blake2s;
+SHA3_256 sha3_256;
+SHAKE128 shake128;
+SHAKE256 shake256;
+
+void setup()
+{
+    Serial.begin(9600);
+
+    Serial.println();
+
+    Serial.print("Lanes ... SHA256: ");
+    Serial.print(SHA256Multi::lanes());
+    Serial.print(", SHA512: ");
+    Serial.print(SHA512Multi::lanes());
+    Serial.print(", BLAKE2s: ");
+    Serial.print(BLAKE2sMulti::lanes());
+    Serial.print(", SHA3-256: ");
+    Serial.print(SHA3_256Multi::lanes());
+    Serial.print(", SHAKE: ");
+    Serial.println(SHAKE128Multi::lanes());
+    Serial.println();
+
+    Serial.println("Test Vectors:");
+    testMultiHash("SHA256Multi", SHA256Multi::hash, &sha256);
+    testMultiHash("SHA512Multi", SHA512Multi::hash, &sha512);
+    testMultiHash("BLAKE2sMulti", BLAKE2sMulti::hash, &blake2s);
+    testMultiHash("SHA3_256Multi", SHA3_256Multi::hash, &sha3_256);
+    testMultiXOF("SHAKE128Multi", SHAKE128Multi::extend, &shake128);
+    testMultiXOF("SHAKE256Multi", SHAKE256Multi::extend, &shake256);
+
+    Serial.println();
+
+    Serial.println("Performance Tests:");
+    perfMultiHash("SHA256Multi", SHA256Multi::hash, &sha256);
+    perfMultiHash("SHA512Multi", SHA512Multi::hash, &sha512);
+    perfMultiHash("BLAKE2sMulti", BLAKE2sMulti::hash, &blake2s);
+    perfMultiHash("SHA3_256Multi", SHA3_256Multi::hash, &sha3_256);
+}
+
+void loop()
+{
+}
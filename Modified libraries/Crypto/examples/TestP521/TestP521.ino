@@ -451,6 +451,35 @@ void testSignCommon(const struct TestSignVector *_test, Hash *hash)
     Serial.print(elapsed);
     Serial.print(" us ... ");
 
+    if (verified)
+        Serial.println("ok");
+    else
+        Serial.println("failed");
+
+    Serial.print(test.name);
+    Serial.print(" Verify Prepared ... ");
+    Serial.flush();
+
+    static P521::PublicKey key;
+    start = micros();
+    verified = key.setKey(publicKey);
+    elapsed = micros() - start;
+    Serial.print(elapsed);
+    Serial.print(" us, ");
+
+    start = micros();
+    verified = verified && P521::verify
+        (test.signature, key, test.data, strlen(test.data), hash);
+    elapsed = micros() - start;
+    Serial.print(elapsed);
+    Serial.print(" us ... ");
+
+    memcpy(sig, test.signature, 132);
+    sig[131] ^= 0x01;
+    if (P521::verify(sig, key, test.data, strlen(test.data), hash))
+        verified = false;
+    key.clear();
+
     if (verified)
         Serial.println("ok");
     else
@@ -491,6 +520,59 @@ void testSignSHA512(const struct TestSignVector *test)
     testSignCommon(test, &hash);
 }
 
+// Private keys 1, 2, and q - 1 put the public key on a multiple of the
+// base point, so verification sometimes needs to add a point to itself.
+// The messages below were chosen to hit that case for each key.
+static uint8_t const smallKeyValues[] PROGMEM = {1, 2, 0};
+static const char * const smallKeyMessages[] = {"2", "3", "265"};
+
+void testSignSmallKeys()
+{
+    static uint8_t const orderMinus1[66] PROGMEM = {
+        0x01, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF, 0xFF,
+        0xFF, 0xFA, 0x51, 0x86, 0x87, 0x83, 0xBF, 0x2F,
+        0x96, 0x6B, 0x7F, 0xCC, 0x01, 0x48, 0xF7, 0x09,
+        0xA5, 0xD0, 0x3B, 0xB5, 0xC9, 0xB8, 0x89, 0x9C,
+        0x47, 0xAE, 0xBB, 0x6F, 0xB7, 0x1E, 0x91, 0x38,
+        0x64, 0x08
+    };
+    uint8_t *privateKey = alice_f;
+    uint8_t *publicKey = alice_k;
+    uint8_t *sig = bob_k;
+
+    for (uint8_t index = 0; index < sizeof(smallKeyValues); ++index) {
+        uint8_t value = pgm_read_byte(&(smallKeyValues[index]));
+        if (value) {
+            memset(privateKey, 0, 66);
+            privateKey[65] = value;
+            Serial.print("Small Key ");
+            Serial.print(value);
+        } else {
+            memcpy_P(privateKey, orderMinus1, 66);
+            Serial.print("Small Key q-1");
+        }
+        Serial.print(" ... ");
+        Serial.flush();
+
+        P521::derivePublicKey(publicKey, privateKey);
+        bool ok = true;
+        for (uint8_t msg = 0; msg < 3; ++msg) {
+            const char *data = smallKeyMessages[msg];
+            P521::sign(sig, privateKey, data, strlen(data));
+            if (!P521::verify(sig, publicKey, data, strlen(data)))
+                ok = false;
+        }
+
+        if (ok)
+            Serial.println("ok");
+        else
+            Serial.println("failed");
+    }
+}
+
 void testSign()
 {
     Serial.println("Digital signatures:");
@@ -498,6 +580,7 @@ void testSign()
     testSignSHA512(&testVectorP521_2);
     testSignSHA256(&testVectorP521_3);
     testSignSHA512(&testVectorP521_4);
+    testSignSmallKeys();
 }
 
 void setup()
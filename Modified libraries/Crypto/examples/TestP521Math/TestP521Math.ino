@@ -52,6 +52,8 @@ limb_t arg2[NUM_LIMBS];
 limb_t result[NUM_LIMBS];
 limb_t result2[NUM_LIMBS * 2 + 1];
 limb_t temp[NUM_LIMBS];
+limb_t field1[NUM_LIMBS];
+limb_t field2[NUM_LIMBS];
 
 // Convert a decimal string in program memory into a number.
 void fromString(limb_t *x, uint8_t size, const char *str)
@@ -412,6 +414,14 @@ void testAdd(const char *x, const char *y)
 
     simpleAdd(result2, arg1, arg2);
 
+    // Repeat the calculation using the field representation.
+    if (compare(result, result2) == 0) {
+        P521::fieldUnpack(field1, arg1);
+        P521::fieldUnpack(field2, arg2);
+        P521::fieldAdd(field1, field1, field2);
+        P521::fieldPack(result, field1);
+    }
+
     if (compare(result, result2) == 0) {
         Serial.println("ok");
     } else {
@@ -455,6 +465,14 @@ void testSub(const char *x, const char *y)
         simpleAdd(result2, arg1, result2);
     }
 
+    // Repeat the calculation using the field representation.
+    if (compare(result, result2) == 0) {
+        P521::fieldUnpack(field1, arg1);
+        P521::fieldUnpack(field2, arg2);
+        P521::fieldSub(field1, field1, field2);
+        P521::fieldPack(result, field1);
+    }
+
     if (compare(result, result2) == 0) {
         Serial.println("ok");
     } else {
@@ -494,6 +512,17 @@ void testMul(const char *x, const char *y)
     simpleMul(result2, arg1, arg2);
     simpleMod(result2);
 
+    // Repeat the calculation using the field representation.
+    if (compare(result, result2) == 0) {
+        P521::fieldUnpack(field1, arg1);
+        P521::fieldUnpack(field2, arg2);
+        if (compare(arg1, arg2) != 0)
+            P521::fieldMul(field1, field1, field2);
+        else
+            P521::fieldSquare(field1, field1);
+        P521::fieldPack(result, field1);
+    }
+
     if (compare(result, result2) == 0) {
         Serial.println("ok");
     } else {
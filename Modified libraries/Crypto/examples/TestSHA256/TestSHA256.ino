@@ -187,6 +187,41 @@ void testHMAC(Hash *hash, size_t keyLen)
         Serial.println("Failed");
 }
 
+// Check a reused HMAC<SHA256> context against hmac<SHA256>() for
+// messages either side of 55 bytes, the most that fits in the final
+// block with the padding and the 64-bit bit count.
+void testHMACContext(size_t keyLen)
+{
+    static size_t const lengths[] = {0, 55, 56, 64};
+    HMAC<SHA256> mac;
+    uint8_t key[BLOCK_SIZE + 1];
+    uint8_t expected[HASH_SIZE];
+    uint8_t actual[HASH_SIZE];
+    bool ok = true;
+
+    Serial.print("HMAC<SHA256> keysize=");
+    Serial.print(keyLen);
+    Serial.print(" ... ");
+
+    memset(key, (uint8_t)keyLen, keyLen);
+    mac.setKey(key, keyLen);
+    for (uint8_t index = 0; index < 4; ++index) {
+        size_t len = lengths[index];
+        memset(buffer, 0xBA, len);
+        hmac<SHA256>(expected, HASH_SIZE, key, keyLen, buffer, len);
+        mac.update(buffer, len / 2);
+        mac.update(buffer + len / 2, len - len / 2);
+        mac.finalize(actual, HASH_SIZE);
+        if (memcmp(expected, actual, HASH_SIZE) != 0)
+            ok = false;
+    }
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
 void testHMAC(Hash *hash, const struct TestHashVector *test)
 {
     uint8_t result[HASH_SIZE];
@@ -316,6 +351,8 @@ void setup()
     testHMAC(&sha256, BLOCK_SIZE);
     testHMAC(&sha256, BLOCK_SIZE + 1);
     testHMAC(&sha256, sizeof(buffer));
+    testHMACContext(HASH_SIZE);
+    testHMACContext(BLOCK_SIZE + 1);
 
     Serial.println();
 
@@ -259,6 +259,43 @@ void testHMAC(Hash *hash, size_t keyLen)
         Serial.println("Failed");
 }
 
+// Check a reused HMAC<SHA3_256> context against hmac<SHA3_256>() for
+// messages around the 136-byte rate, where the padding byte either
+// shares the last block with the data or starts a new one.
+void testHMACContext(size_t keyLen)
+{
+    static size_t const lengths[] = {0, 135, 136, 137};
+    HMAC<SHA3_256> mac;
+    uint8_t key[BLOCK_SIZE + 1];
+    uint8_t expected[HASH_SIZE];
+    uint8_t actual[HASH_SIZE];
+    // Reuse one of the test vectors as a large temporary buffer.
+    uint8_t *buffer = (uint8_t *)&testVectorSHA3_256_5;
+    bool ok = true;
+
+    Serial.print("HMAC<SHA3_256> keysize=");
+    Serial.print(keyLen);
+    Serial.print(" ... ");
+
+    memset(key, (uint8_t)keyLen, keyLen);
+    mac.setKey(key, keyLen);
+    for (uint8_t index = 0; index < 4; ++index) {
+        size_t len = lengths[index];
+        memset(buffer, 0xBA, len);
+        hmac<SHA3_256>(expected, HASH_SIZE, key, keyLen, buffer, len);
+        mac.update(buffer, len / 2);
+        mac.update(buffer + len / 2, len - len / 2);
+        mac.finalize(actual, HASH_SIZE);
+        if (memcmp(expected, actual, HASH_SIZE) != 0)
+            ok = false;
+    }
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
 void perfFinalize(Hash *hash)
 {
     unsigned long start;
@@ -305,6 +342,8 @@ void setup()
     testHMAC(&sha3_256, BLOCK_SIZE);
     testHMAC(&sha3_256, BLOCK_SIZE + 1);
     testHMAC(&sha3_256, BLOCK_SIZE + 2);
+    testHMACContext(HASH_SIZE);
+    testHMACContext(BLOCK_SIZE + 1);
 
     Serial.println();
 
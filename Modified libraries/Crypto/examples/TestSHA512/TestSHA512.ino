@@ -211,6 +211,41 @@ void testHMAC(Hash *hash, size_t keyLen)
         Serial.println("Failed");
 }
 
+// Check a reused HMAC<SHA512> context against hmac<SHA512>() for
+// messages either side of 111 bytes, after which the 128-bit length
+// pushes the padding into another block.
+void testHMACContext(size_t keyLen)
+{
+    static size_t const lengths[] = {0, 111, 112, 128};
+    HMAC<SHA512> mac;
+    uint8_t key[BLOCK_SIZE + 1];
+    uint8_t expected[HASH_SIZE];
+    uint8_t actual[HASH_SIZE];
+    bool ok = true;
+
+    Serial.print("HMAC<SHA512> keysize=");
+    Serial.print(keyLen);
+    Serial.print(" ... ");
+
+    memset(key, (uint8_t)keyLen, keyLen);
+    mac.setKey(key, keyLen);
+    for (uint8_t index = 0; index < 4; ++index) {
+        size_t len = lengths[index];
+        memset(buffer, 0xBA, len);
+        hmac<SHA512>(expected, HASH_SIZE, key, keyLen, buffer, len);
+        mac.update(buffer, len / 2);
+        mac.update(buffer + len / 2, len - len / 2);
+        mac.finalize(actual, HASH_SIZE);
+        if (memcmp(expected, actual, HASH_SIZE) != 0)
+            ok = false;
+    }
+
+    if (ok)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
 void perfFinalize(Hash *hash)
 {
     unsigned long start;
@@ -253,6 +288,8 @@ void setup()
     testHMAC(&sha512, BLOCK_SIZE);
     testHMAC(&sha512, BLOCK_SIZE + 1);
     testHMAC(&sha512, BLOCK_SIZE + 2);
+    testHMACContext(HASH_SIZE);
+    testHMACContext(BLOCK_SIZE + 1);
 
     Serial.println();
 
@@ -0,0 +1,179 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+/*
+This example runs tests on the per-thread random number generators in
+ThreadRNG.  It checks that different threads and processes get different
+output, and that reseed() and clear() cause the next request to reseed
+from the global RNG object.
+*/
+
+#include <Crypto.h>
+#include <RNG.h>
+#include <string.h>
+
+#if defined(RNG_THREAD_LOCAL)
+
+#include <pthread.h>
+#include <unistd.h>
+#include <sys/wait.h>
+
+uint8_t data1[64];
+uint8_t data2[64];
+
+// Generates 64 bytes into the buffer passed as the argument.
+void *threadRand(void *arg)
+{
+    ThreadRNG::rand((uint8_t *)arg, 64);
+    return 0;
+}
+
+// Tops up the entropy credits in the global RNG object.  Seeding a
+// thread state takes 48 bytes from the global RNG object, which uses
+// up all of the credits.  That lets us tell if a request reseeded.
+void fillCredits()
+{
+    uint8_t seed[48];
+    memset(seed, 0xA5, sizeof(seed));
+    RNG.stir(seed, sizeof(seed), sizeof(seed) * 8);
+}
+
+bool reseeded()
+{
+    uint8_t data[16];
+    fillCredits();
+    ThreadRNG::rand(data, sizeof(data));
+    return !RNG.available(48);
+}
+
+void testThreads()
+{
+    pthread_t thread1, thread2;
+
+    Serial.print("Threads ... ");
+    memset(data1, 0, sizeof(data1));
+    memset(data2, 0, sizeof(data2));
+    if (pthread_create(&thread1, 0, threadRand, data1) != 0 ||
+            pthread_create(&thread2, 0, threadRand, data2) != 0) {
+        Serial.println("Failed");
+        return;
+    }
+    pthread_join(thread1, 0);
+    pthread_join(thread2, 0);
+    if (memcmp(data1, data2, 64) != 0)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+void testReseed()
+{
+    Serial.print("No Reseed ... ");
+    ThreadRNG::rand(data1, sizeof(data1));
+    if (!reseeded())
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+
+    Serial.print("Reseed ... ");
+    ThreadRNG::reseed();
+    if (reseeded())
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+
+    Serial.print("Clear ... ");
+    ThreadRNG::clear();
+    if (reseeded())
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+// Generates 32 bytes from ThreadRNG and 32 bytes from the global RNG.
+void forkRand(uint8_t *data)
+{
+    ThreadRNG::rand(data, 32);
+    RNG.rand(data + 32, 32);
+}
+
+void testFork()
+{
+    int fds[2];
+    pid_t pid;
+    int status;
+
+    Serial.print("Fork ... ");
+    ThreadRNG::rand(data1, sizeof(data1));
+    if (pipe(fds) != 0) {
+        Serial.println("Failed");
+        return;
+    }
+    pid = fork();
+    if (pid < 0) {
+        close(fds[0]);
+        close(fds[1]);
+        Serial.println("Failed");
+        return;
+    } else if (pid == 0) {
+        // Child process: send our output to the parent.
+        close(fds[0]);
+        forkRand(data2);
+        bool ok = (write(fds[1], data2, 64) == 64);
+        close(fds[1]);
+        _exit(ok ? 0 : 1);
+    }
+    close(fds[1]);
+    forkRand(data1);
+    bool ok = (read(fds[0], data2, 64) == 64);
+    close(fds[0]);
+    ok = (waitpid(pid, &status, 0) == pid) && ok;
+    ok = ok && WIFEXITED(status) && WEXITSTATUS(status) == 0;
+    if (ok && memcmp(data1, data2, 32) != 0 &&
+            memcmp(data1 + 32, data2 + 32, 32) != 0)
+        Serial.println("Passed");
+    else
+        Serial.println("Failed");
+}
+
+#endif
+
+void setup()
+{
+    Serial.begin(9600);
+
+    Serial.println();
+
+#if defined(RNG_THREAD_LOCAL)
+    RNG.begin("TestThreadRNG 1.0");
+
+    testThreads();
+    testReseed();
+    testFork();
+#else
+    Serial.println("ThreadRNG is not supported on this platform");
+#endif
+}
+
+void loop()
+{
+}
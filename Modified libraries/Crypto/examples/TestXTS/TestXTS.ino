@@ -210,7 +210,7 @@ void _printProgMem(const char *str)
 
 #endif
 
-void testXTS(XTSCommon *cipher, const struct TestVector *test)
+void testXTS(XTSCommon *cipher, const struct TestVector *test, size_t keySize = 32)
 {
     crypto_feed_watchdog();
 
@@ -220,7 +220,7 @@ void testXTS(XTSCommon *cipher, const struct TestVector *test)
     printProgMem(" Encrypt ... ");
 
     cipher->setSectorSize(testVector.sectorSize);
-    cipher->setKey(testVector.key1, 32);
+    cipher->setKey(testVector.key1, keySize);
     cipher->setTweak(testVector.tweak, sizeof(testVector.tweak));
     cipher->encryptSector(buffer, testVector.plaintext);
 
@@ -406,6 +406,19 @@ void setup()
     testXTS(xtsaes128, &testVectorXTSAES128_4);
     testXTS(xtsaes128, &testVectorXTSAES128_15);
     testXTS(xtsaes128, &testVectorXTSAES128_16);
+    StaticXTS<AES128> *staticaes128 = new StaticXTS<AES128>();
+    testXTS(staticaes128, &testVectorXTSAES128_1);
+    testXTS(staticaes128, &testVectorXTSAES128_2);
+    testXTS(staticaes128, &testVectorXTSAES128_3);
+    testXTS(staticaes128, &testVectorXTSAES128_4);
+    testXTS(staticaes128, &testVectorXTSAES128_15);
+    testXTS(staticaes128, &testVectorXTSAES128_16);
+    delete staticaes128;
+
+    // Vector #1 uses the same key for both halves.
+    StaticXTSSingleKey<AES128> *staticsingle = new StaticXTSSingleKey<AES128>();
+    testXTS(staticsingle, &testVectorXTSAES128_1, 16);
+    delete staticsingle;
 
     Serial.println();
 
@@ -429,6 +442,13 @@ void setup()
     delete singleaes128;
     Serial.println();
 
+    printlnProgMem("StaticXTS-AES-128:");
+    StaticXTS<AES128> *staticxts = new StaticXTS<AES128>();
+    perfEncrypt("Encrypt", staticxts, &testVectorXTSAES128_4);
+    perfDecrypt("Decrypt", staticxts, &testVectorXTSAES128_4);
+    delete staticxts;
+    Serial.println();
+
     printlnProgMem("XTS-AES-256 Single Key:");
     XTSSingleKey<AES256> *xtsaes256 = new XTSSingleKey<AES256>();
     perfEncrypt("Encrypt", xtsaes256, &testVectorXTSAES128_4, 32);
@@ -0,0 +1,204 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+
+# Generates src/utility/CRCTables.h, the lookup tables for crypto_crc8(),
+# crypto_crc16_ccitt(), and crypto_crc32c() in Crypto.cpp.
+#
+# Usage: python3 gen_crc_tables.py > ../src/utility/CRCTables.h
+
+import sys
+
+# License block for the generated header.
+LICENSE = '''/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+'''
+
+# Polynomials: CRC-8 (0x1D, MSB-first), CRC-16-CCITT (0x1021, MSB-first),
+# and CRC-32C (0x1EDC6F41, bit-reflected as 0x82F63B78, LSB-first).
+
+def crc8_bits(c, bits):
+    for _ in range(bits):
+        c = ((c << 1) ^ 0x1D) & 0xFF if c & 0x80 else (c << 1) & 0xFF
+    return c
+
+def crc16_bits(c, bits):
+    for _ in range(bits):
+        c = ((c << 1) ^ 0x1021) & 0xFFFF if c & 0x8000 else (c << 1) & 0xFFFF
+    return c
+
+def crc32c_bits(c, bits):
+    for _ in range(bits):
+        c = (c >> 1) ^ 0x82F63B78 if c & 1 else c >> 1
+    return c
+
+# Nibble tables for AVR: one step is crc = (crc << 4) ^ T[crc >> 4] for
+# the MSB-first CRCs and crc = (crc >> 4) ^ T[crc & 0x0F] for CRC-32C.
+crc8_nibble = [crc8_bits(i << 4, 4) for i in range(16)]
+crc16_nibble = [crc16_bits(i << 12, 4) for i in range(16)]
+crc32c_nibble = [crc32c_bits(i, 4) for i in range(16)]
+
+# Slice-by-8 tables: entry [k][b] is the contribution of the byte b when
+# it is followed by k more bytes of input.
+crc8_slice = [[crc8_bits(i, 8) for i in range(256)]]
+crc16_slice = [[crc16_bits(i << 8, 8) for i in range(256)]]
+crc32c_slice = [[crc32c_bits(i, 8) for i in range(256)]]
+for k in range(1, 8):
+    crc8_slice.append([crc8_slice[0][crc8_slice[k - 1][i]]
+                       for i in range(256)])
+    crc16_slice.append([((crc16_slice[k - 1][i] << 8) & 0xFFFF) ^
+                        crc16_slice[0][crc16_slice[k - 1][i] >> 8]
+                        for i in range(256)])
+    crc32c_slice.append([(crc32c_slice[k - 1][i] >> 8) ^
+                         crc32c_slice[0][crc32c_slice[k - 1][i] & 0xFF]
+                         for i in range(256)])
+
+# Check the tables against the bit-at-a-time definitions.
+def bitwise(data, crc, step, width, reflected):
+    for byte in data:
+        if reflected:
+            crc = step(crc ^ byte, 8)
+        else:
+            crc = step(crc ^ (byte << (width - 8)), 8)
+    return crc
+
+def sliced(data, crc, tab, width, reflected):
+    data = bytearray(data)
+    while len(data) >= 8:
+        if reflected:
+            for i in range(4):
+                data[i] ^= (crc >> (8 * i)) & 0xFF
+            crc = 0
+        else:
+            for i in range(width // 8):
+                data[i] ^= (crc >> (width - 8 - 8 * i)) & 0xFF
+            crc = 0
+        for i in range(8):
+            crc ^= tab[7 - i][data[i]]
+        data = data[8:]
+    for byte in data:
+        if reflected:
+            crc = (crc >> 8) ^ tab[0][(crc ^ byte) & 0xFF]
+        else:
+            crc = ((crc << 8) & ((1 << width) - 1)) ^ \
+                tab[0][(crc >> (width - 8)) ^ byte]
+    return crc
+
+def nibbles(data, crc, tab, width, reflected):
+    mask = (1 << width) - 1
+    for byte in data:
+        if reflected:
+            crc ^= byte
+            crc = (crc >> 4) ^ tab[crc & 0x0F]
+            crc = (crc >> 4) ^ tab[crc & 0x0F]
+        else:
+            crc ^= byte << (width - 8)
+            crc = ((crc << 4) & mask) ^ tab[crc >> (width - 4)]
+            crc = ((crc << 4) & mask) ^ tab[crc >> (width - 4)]
+    return crc
+
+check = b'123456789'
+sample = bytes((i * 37 + 11) & 0xFF for i in range(1000))
+for data in (check, sample):
+    for step, tab, nib, width, reflected in (
+            (crc8_bits, crc8_slice, crc8_nibble, 8, False),
+            (crc16_bits, crc16_slice, crc16_nibble, 16, False),
+            (crc32c_bits, crc32c_slice, crc32c_nibble, 32, True)):
+        init = (1 << width) - 1
+        expected = bitwise(data, init, step, width, reflected)
+        assert sliced(data, init, tab, width, reflected) == expected
+        assert nibbles(data, init, nib, width, reflected) == expected
+assert bitwise(check, 0xFFFF, crc16_bits, 16, False) == 0x29B1
+assert bitwise(check, 0xFFFFFFFF, crc32c_bits, 32, True) ^ 0xFFFFFFFF == 0xE3069283
+
+def fmt(vals, width, per, indent):
+    lines = []
+    for i in range(0, len(vals), per):
+        lines.append(indent + ', '.join('0x%0*X' % (width, v)
+                                        for v in vals[i:i + per]) + ',')
+    lines[-1] = lines[-1][:-1]
+    return '\n'.join(lines)
+
+out = [LICENSE + """#ifndef CRYPTO_CRCTABLES_H
+#define CRYPTO_CRCTABLES_H
+
+#include "ProgMemUtil.h"
+#include <inttypes.h>
+
+// Lookup tables for crypto_crc8(), crypto_crc16_ccitt(), and crypto_crc32c().
+// The tables are generated by extras/gen_crc_tables.py and must not be
+// edited by hand.
+
+#if defined(__AVR__)
+
+// Remainders for the 4 bits that are shifted out of the CRC register
+// at a time.  The bits are the top bits of CRC-8 and CRC-16, and the
+// bottom bits of the bit-reflected CRC-32C.
+"""]
+for name, typ, width, tab in (('crc8_nibble', 'uint8_t', 2, crc8_nibble),
+                              ('crc16_nibble', 'uint16_t', 4, crc16_nibble),
+                              ('crc32c_nibble', 'uint32_t', 8, crc32c_nibble)):
+    out.append('static %s const %s[16] PROGMEM = {' % (typ, name))
+    out.append(fmt(tab, width, 8 if width < 8 else 4, '    '))
+    out.append('};')
+    out.append('')
+out.append("""#else // !__AVR__
+
+// Slice-by-8 tables.  Entry [k][b] is the contribution of the byte b
+// when it is followed by k more bytes of input.
+""")
+for name, typ, width, tab in (('crc8_slice', 'uint8_t', 2, crc8_slice),
+                              ('crc16_slice', 'uint16_t', 4, crc16_slice),
+                              ('crc32c_slice', 'uint32_t', 8, crc32c_slice)):
+    out.append('static %s const %s[8][256] PROGMEM = {' % (typ, name))
+    rows = []
+    for k in range(8):
+        rows.append('    {\n' + fmt(tab[k], width, {2: 12, 4: 8, 8: 6}[width],
+                                       '        ') + '\n    }')
+    out.append(',\n'.join(rows))
+    out.append('};')
+    out.append('')
+out.append('#endif // !__AVR__')
+out.append('')
+out.append('#endif')
+
+sys.stdout.write('\n'.join(out) + '\n')
@@ -0,0 +1,163 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+
+# Generates src/utility/Ed25519Tables.h, the precomputed multiples of the
+# Ed25519 base point B that are used by Ed25519::mul() and jointMul().
+#
+# Usage: python3 gen_ed25519_tables.py > ../src/utility/Ed25519Tables.h
+
+import sys
+
+# Curve parameters from RFC 8032.
+p = 2**255 - 19
+q = 2**252 + 27742317777372353535851937790883648493
+d = (-121665 * pow(121666, p - 2, p)) % p
+
+def inv(x):
+    return pow(x, p - 2, p)
+
+def xrecover(y):
+    xx = (y * y - 1) * inv(d * y * y + 1) % p
+    x = pow(xx, (p + 3) // 8, p)
+    if (x * x - xx) % p != 0:
+        x = x * pow(2, (p - 1) // 4, p) % p
+    if x % 2 != 0:
+        x = p - x
+    return x
+
+By = 4 * inv(5) % p
+B = (xrecover(By), By)
+
+# Affine point addition on the twisted Edwards curve -x^2 + y^2 = 1 + d x^2 y^2.
+def add(P, Q):
+    x1, y1 = P
+    x2, y2 = Q
+    x3 = (x1 * y2 + x2 * y1) * inv(1 + d * x1 * x2 * y1 * y2) % p
+    y3 = (y1 * y2 + x1 * x2) * inv(1 - d * x1 * x2 * y1 * y2) % p
+    return (x3, y3)
+
+def mul(k, P):
+    R = (0, 1)
+    while k:
+        if k & 1:
+            R = add(R, P)
+        P = add(P, P)
+        k >>= 1
+    return R
+
+# Convert a point into the (y + x, y - x, 2 * d * x * y) form.
+def niels(P):
+    x, y = P
+    return ((y + x) % p, (y - x) % p, 2 * d * x * y % p)
+
+# Format a 256-bit value as four LIMB_PAIR() entries over two lines.
+def limbs(v, indent):
+    w = [(v >> (64 * i)) & (2**64 - 1) for i in range(4)]
+    parts = ['LIMB_PAIR(0x%08X, 0x%08X)' % (x & 0xFFFFFFFF, x >> 32) for x in w]
+    return ('{' + parts[0] + ', ' + parts[1] + ',\n' + indent + ' ' +
+            parts[2] + ', ' + parts[3] + '}')
+
+# Sanity check the base point before generating anything from it.
+assert mul(q, B) == (0, 1)
+
+out = []
+out.append('''/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_ED25519TABLES_H
+#define CRYPTO_ED25519TABLES_H
+
+#include "LimbUtil.h"
+
+// Precomputed multiples of the Ed25519 base point B for fixed-base
+// scalar multiplication.  Every point is stored in affine form as the
+// three values (y + x, y - x, 2 * d * x * y) modulo 2^255 - 19, which
+// allows it to be added to an extended point with seven multiplications.
+//
+// The tables are generated by extras/gen_ed25519_tables.py and must not
+// be edited by hand.
+
+// Entry [i][k - 1] is the point k * 256^i * B for k = 1..8.
+''')
+
+# Comb table for Ed25519::mul(): k * 256^i * B for i = 0..31, k = 1..8.
+out.append('static limb_t const ed25519_comb[32][8][3][NUM_LIMBS_256BIT] PROGMEM = {')
+base = B
+for i in range(32):
+    out.append('    {   // (1..8) * 256^%d * B' % i)
+    P = base
+    ents = []
+    for k in range(8):
+        if k:
+            P = add(P, base)
+        n = niels(P)
+        e = '        {' + limbs(n[0], '         ') + ',\n'
+        e += '         ' + limbs(n[1], '         ') + ',\n'
+        e += '         ' + limbs(n[2], '         ') + '}'
+        ents.append(e)
+    out.append(',\n'.join(ents))
+    out.append('    }' + (',' if i < 31 else ''))
+    base = mul(256, base)
+out.append('};')
+
+# Odd multiples for jointMul(): (2 * i + 1) * B for i = 0..31.
+out.append('''
+// Odd multiples (2 * i + 1) * B for i = 0..31 in the same form, for
+// variable-time double-scalar multiplication with a width-7 NAF.
+''')
+out.append('static limb_t const ed25519_odd[32][3][NUM_LIMBS_256BIT] PROGMEM = {')
+P = B
+B2 = add(B, B)
+ents = []
+for i in range(32):
+    n = niels(P)
+    e = '    {' + limbs(n[0], '     ') + ',   // %d * B\n' % (2 * i + 1)
+    e += '     ' + limbs(n[1], '     ') + ',\n'
+    e += '     ' + limbs(n[2], '     ') + '}'
+    ents.append(e)
+    P = add(P, B2)
+out.append(',\n'.join(ents))
+out.append('};')
+out.append('')
+out.append('#endif')
+
+sys.stdout.write('\n'.join(out) + '\n')
@@ -0,0 +1,161 @@
+#!/usr/bin/env python3
+#
+# Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+#
+# Permission is hereby granted, free of charge, to any person obtaining a
+# copy of this software and associated documentation files (the "Software"),
+# to deal in the Software without restriction, including without limitation
+# the rights to use, copy, modify, merge, publish, distribute, sublicense,
+# and/or sell copies of the Software, and to permit persons to whom the
+# Software is furnished to do so, subject to the following conditions:
+#
+# The above copyright notice and this permission notice shall be included
+# in all copies or substantial portions of the Software.
+#
+# THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+# OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+# FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+# AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+# LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+# FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+# DEALINGS IN THE SOFTWARE.
+#
+
+# Generates src/utility/P521Tables.h, the precomputed multiples of the
+# P-521 generator G that are used for fixed-base scalar multiplication
+# and joint verification in P521.cpp.
+#
+# Usage: python3 gen_p521_tables.py > ../src/utility/P521Tables.h
+
+import sys
+
+# License block for the generated header.
+LICENSE = '''/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+'''
+
+# Curve parameters from FIPS 186-4, section D.1.2.5.
+p = 2**521 - 1
+a = -3
+b = 0x0051953eb9618e1c9a1f929a21a0b68540eea2da725b99b315f3b8b489918ef109e156193951ec7e937b1652c0bd3bb1bf073573df883d2c34f1ef451fd46b503f00
+n = 0x01fffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffffa51868783bf2f966b7fcc0148f709a5d03bb5c9b8899c47aebb6fb71e91386409
+Gx = 0xc6858e06b70404e9cd9e3ecb662395b4429c648139053fb521f828af606b4d3dbaa14b5e77efe75928fe1dc127a2ffa8de3348b3c1856a429bf97e7e31c2e5bd66
+Gy = 0x11839296a789a3bc0045c8a5fb42c7d1bd998f54449579b446817afbd17273e662c97ee72995ef42640c550b9013fad0761353c7086a272c24088be94769fd16650
+G = (Gx, Gy)
+
+def inv(x):
+    return pow(x, p - 2, p)
+
+# Affine point addition, with None as the point at infinity.
+def add(P, Q):
+    if P is None:
+        return Q
+    if Q is None:
+        return P
+    x1, y1 = P
+    x2, y2 = Q
+    if x1 == x2:
+        if (y1 + y2) % p == 0:
+            return None
+        l = (3 * x1 * x1 + a) * inv(2 * y1) % p
+    else:
+        l = (y2 - y1) * inv(x2 - x1) % p
+    x3 = (l * l - x1 - x2) % p
+    return (x3, (l * (x1 - x3) - y1) % p)
+
+def mul(k, P):
+    R = None
+    while k:
+        if k & 1:
+            R = add(R, P)
+        P = add(P, P)
+        k >>= 1
+    return R
+
+# Format a 521-bit value as eight LIMB_PAIR() entries and a LIMB_PARTIAL().
+def limbs(v, indent):
+    words = [(v >> (32 * i)) & 0xFFFFFFFF for i in range(16)]
+    pairs = ['LIMB_PAIR(0x%08X, 0x%08X)' % (words[2 * i], words[2 * i + 1])
+             for i in range(8)]
+    items = pairs + ['LIMB_PARTIAL(0x%03X)' % (v >> 512)]
+    lines = [', '.join(items[i:i + 2]) for i in range(0, 9, 2)]
+    return (',\n' + ' ' * indent).join(lines)
+
+def point(P, indent):
+    return ('{{' + limbs(P[0], indent + 2) + '},\n' + ' ' * (indent + 1) +
+            '{' + limbs(P[1], indent + 2) + '}}')
+
+# Sanity check the generator before generating anything from it.
+assert (Gy * Gy - (Gx * Gx * Gx + a * Gx + b)) % p == 0
+assert mul(n, G) is None
+
+out = []
+out.append(LICENSE + """#ifndef CRYPTO_P521TABLES_H
+#define CRYPTO_P521TABLES_H
+
+#include "LimbUtil.h"
+
+// Precomputed multiples of the P-521 generator G for fixed-base scalar
+// multiplication.  Every point is stored in affine form as the two values
+// (x, y) modulo 2^521 - 1, with the top partial limb expanded by the
+// LIMB_PARTIAL() macro from P521.cpp.
+//
+// The tables are generated by extras/gen_p521_tables.py and must not
+// be edited by hand.
+
+// Entry [i][k - 1] is the point k * 2^(16 * i) * G for k = 1..8.
+""")
+
+# Comb table: k * 2^(16 * i) * G for i = 0..32, k = 1..8.
+out.append('static limb_t const p521_comb[33][8][2][NUM_LIMBS_BITS(521)] PROGMEM = {')
+rows = []
+for i in range(33):
+    base = mul(2 ** (16 * i), G)
+    P = base
+    ents = []
+    for k in range(1, 9):
+        ents.append('        ' + point(P, 8))
+        P = add(P, base)
+    rows.append('    {   // (1..8) * 2^(16 * %d) * G\n' % i +
+                ',\n'.join(ents) + '\n    }')
+out.append(',\n'.join(rows))
+out.append('};')
+
+# Odd multiples for joint verification: (2 * i + 1) * G for i = 0..31.
+out.append("""
+// Odd multiples (2 * i + 1) * G for i = 0..31, for variable-time
+// double-scalar multiplication with a width-7 NAF.
+""")
+out.append('static limb_t const p521_odd[32][2][NUM_LIMBS_BITS(521)] PROGMEM = {')
+ents = []
+G2 = add(G, G)
+P = G
+for i in range(32):
+    ents.append('    ' + point(P, 4))
+    P = add(P, G2)
+out.append(',\n'.join(ents))
+out.append('};')
+out.append('')
+out.append('#endif')
+
+sys.stdout.write('\n'.join(out) + '\n')
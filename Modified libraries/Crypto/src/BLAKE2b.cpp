@@ -25,7 +25,11 @@
 #include "utility/EndianUtil.h"
 #include "utility/RotateUtil.h"
 #include "utility/ProgMemUtil.h"
+#include "utility/CpuUtil.h"
 #include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <immintrin.h>
+#endif
 
 /**
  * \class BLAKE2b BLAKE2b.h <BLAKE2b.h>
@@ -66,6 +70,10 @@
  * References: https://blake2.net/,
  * <a href="http://tools.ietf.org/html/rfc7693">RFC 7693</a>
  *
+ * On x86 hosts with AVX2, the four rows of the BLAKE2b state are held
+ * in vector registers and the columns and diagonals are processed in
+ * parallel.  The choice is made at runtime.
+ *
  * \sa BLAKE2s, SHA512, SHA3_512
  */
 
@@ -116,6 +124,11 @@ size_t BLAKE2b::blockSize() const
 #define BLAKE2b_IV6 0x1f83d9abfb41bd6bULL
 #define BLAKE2b_IV7 0x5be0cd19137e2179ULL
 
+#if defined(CRYPTO_X86_SIMD)
+static void blake2b_compress_avx2(uint64_t *h, const uint64_t *m,
+                                  uint64_t t0, uint64_t t1, uint64_t f0);
+#endif
+
 void BLAKE2b::reset()
 {
     state.h[0] = BLAKE2b_IV0 ^ 0x01010040; // Default output length of 64.
@@ -204,6 +217,24 @@ void BLAKE2b::update(const void *data, size_t len)
     // Break the input up into 1024-bit chunks and process each in turn.
     const uint8_t *d = (const uint8_t *)data;
     while (len > 0) {
+#if defined(CRYPTO_X86_SIMD)
+        // If the chunk buffer is empty, then compress whole chunks directly
+        // from the input.  The last chunk is always left in the buffer
+        // because it may need to be processed with f0 set to all-ones.
+        if (state.chunkSize == 0 && len > 128 &&
+                crypto_cpu_has(CRYPTO_CPU_AVX2)) {
+            do {
+                state.lengthLow += 128;
+                if (state.lengthLow < 128)
+                    ++state.lengthHigh;
+                blake2b_compress_avx2(state.h, (const uint64_t *)d,
+                                      state.lengthLow, state.lengthHigh, 0);
+                d += 128;
+                len -= 128;
+            } while (len > 128);
+            continue;
+        }
+#endif
         if (state.chunkSize == 128) {
             // Previous chunk was full and we know that it wasn't the
             // last chunk, so we can process it now with f0 set to zero.
@@ -265,6 +296,18 @@ void BLAKE2b::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t ha
     clean(temp);
 }
 
+/**
+ * \brief Processes the padded HMAC key block that resetHMAC() left in
+ * the chunk buffer, with f0 set to zero because more data will follow.
+ */
+void BLAKE2b::flushHMACKey()
+{
+    if (state.chunkSize == 128) {
+        processChunk(0);
+        state.chunkSize = 0;
+    }
+}
+
 // Permutation on the message input state for BLAKE2b.
 static const uint8_t sigma[12][16] PROGMEM = {
     { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
@@ -302,6 +345,14 @@ void BLAKE2b::processChunk(uint64_t f0)
     uint8_t index;
     uint64_t v[16];
 
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_AVX2)) {
+        blake2b_compress_avx2(state.h, state.m, state.lengthLow,
+                              state.lengthHigh, f0);
+        return;
+    }
+#endif
+
     // Byte-swap the message buffer into little-endian if necessary.
 #if !defined(CRYPTO_LITTLE_ENDIAN)
     for (index = 0; index < 16; ++index)
@@ -338,3 +389,88 @@ void BLAKE2b::processChunk(uint64_t f0)
     for (index = 0; index < 8; ++index)
         state.h[index] ^= (v[index] ^ v[index + 8]);
 }
+
+#if defined(CRYPTO_X86_SIMD)
+
+// Perform half of a BLAKE2b quarter round on all four columns (or
+// diagonals) at once.  The first half rotates by 32 and 24, and the
+// second half rotates by 16 and 63.
+#define blake2b_g1(m) \
+    do { \
+        row1 = _mm256_add_epi64(_mm256_add_epi64(row1, (m)), row2); \
+        row4 = _mm256_shuffle_epi32(_mm256_xor_si256(row4, row1), \
+                                    _MM_SHUFFLE(2, 3, 0, 1)); \
+        row3 = _mm256_add_epi64(row3, row4); \
+        row2 = _mm256_shuffle_epi8(_mm256_xor_si256(row2, row3), rot24); \
+    } while (0)
+#define blake2b_g2(m) \
+    do { \
+        row1 = _mm256_add_epi64(_mm256_add_epi64(row1, (m)), row2); \
+        row4 = _mm256_shuffle_epi8(_mm256_xor_si256(row4, row1), rot16); \
+        row3 = _mm256_add_epi64(row3, row4); \
+        row2 = _mm256_xor_si256(row2, row3); \
+        row2 = _mm256_or_si256(_mm256_srli_epi64(row2, 63), \
+                               _mm256_add_epi64(row2, row2)); \
+    } while (0)
+
+// Gathers four message words for a round into a vector.
+#define blake2b_msg(a, b, c, d) \
+    (_mm256_set_epi64x(m[s[(d)]], m[s[(c)]], m[s[(b)]], m[s[(a)]]))
+
+/**
+ * \brief Compresses a chunk with BLAKE2b using AVX2.
+ *
+ * \param h The hash value to update.
+ * \param m The 16 little-endian message words to compress.
+ * \param t0 Low word of the byte counter.
+ * \param t1 High word of the byte counter.
+ * \param f0 Finalization flag; all-ones for the last chunk.
+ *
+ * Each of the four rows of the state is held in a vector.  The diagonal
+ * round is performed by rotating the lanes of rows 2, 3, and 4 so that
+ * the diagonals line up as columns, and then rotating them back again.
+ */
+CRYPTO_TARGET("avx2")
+static void blake2b_compress_avx2(uint64_t *h, const uint64_t *m,
+                                  uint64_t t0, uint64_t t1, uint64_t f0)
+{
+    const __m256i rot24 = _mm256_set_epi64x
+        (0x0a09080f0e0d0c0bULL, 0x0201000706050403ULL,
+         0x0a09080f0e0d0c0bULL, 0x0201000706050403ULL);
+    const __m256i rot16 = _mm256_set_epi64x
+        (0x09080f0e0d0c0b0aULL, 0x0100070605040302ULL,
+         0x09080f0e0d0c0b0aULL, 0x0100070605040302ULL);
+    __m256i row1 = _mm256_loadu_si256((const __m256i *)h);
+    __m256i row2 = _mm256_loadu_si256((const __m256i *)(h + 4));
+    __m256i row3 = _mm256_set_epi64x
+        (BLAKE2b_IV3, BLAKE2b_IV2, BLAKE2b_IV1, BLAKE2b_IV0);
+    __m256i row4 = _mm256_set_epi64x
+        (BLAKE2b_IV7, BLAKE2b_IV6 ^ f0, BLAKE2b_IV5 ^ t1, BLAKE2b_IV4 ^ t0);
+    __m256i save1 = row1;
+    __m256i save2 = row2;
+    for (uint8_t index = 0; index < 12; ++index) {
+        const uint8_t *s = sigma[index];
+
+        // Column round.
+        blake2b_g1(blake2b_msg(0, 2, 4, 6));
+        blake2b_g2(blake2b_msg(1, 3, 5, 7));
+
+        // Diagonal round.
+        row2 = _mm256_permute4x64_epi64(row2, _MM_SHUFFLE(0, 3, 2, 1));
+        row3 = _mm256_permute4x64_epi64(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm256_permute4x64_epi64(row4, _MM_SHUFFLE(2, 1, 0, 3));
+        blake2b_g1(blake2b_msg(8, 10, 12, 14));
+        blake2b_g2(blake2b_msg(9, 11, 13, 15));
+        row2 = _mm256_permute4x64_epi64(row2, _MM_SHUFFLE(2, 1, 0, 3));
+        row3 = _mm256_permute4x64_epi64(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm256_permute4x64_epi64(row4, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    // Combine the new and old hash values.
+    _mm256_storeu_si256((__m256i *)h, _mm256_xor_si256
+        (save1, _mm256_xor_si256(row1, row3)));
+    _mm256_storeu_si256((__m256i *)(h + 4), _mm256_xor_si256
+        (save2, _mm256_xor_si256(row2, row4)));
+}
+
+#endif // CRYPTO_X86_SIMD
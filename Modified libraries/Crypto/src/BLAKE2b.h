@@ -59,6 +59,7 @@ private:
     } state;
 
     void processChunk(uint64_t f0);
+    void flushHMACKey();
 };
 
 #endif
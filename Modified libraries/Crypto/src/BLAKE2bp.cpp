@@ -0,0 +1,517 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BLAKE2bp.h"
+#include "Crypto.h"
+#include "utility/EndianUtil.h"
+#include "utility/ProgMemUtil.h"
+#include "utility/CpuUtil.h"
+#include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+/**
+ * \class BLAKE2bp BLAKE2bp.h <BLAKE2bp.h>
+ * \brief BLAKE2bp hash algorithm.
+ *
+ * BLAKE2bp is the parallel tree mode of BLAKE2b.  The input is split into
+ * 128-byte blocks that are dealt out round-robin to 4 leaf BLAKE2b
+ * instances, and the 4 leaf hashes are then hashed by a root BLAKE2b
+ * instance to produce the final 512-bit output.  The leaves are
+ * independent of each other so they can be processed in parallel.
+ *
+ * The output is not the same as BLAKE2b.  This class is intended for
+ * hashing large amounts of data on platforms with SIMD support.  On x86
+ * hosts with AVX2, all 4 leaves are compressed at once using one vector
+ * lane per leaf.  On other platforms the leaves are compressed one
+ * after the other.  The state is over 1K in size, which makes this
+ * class unsuitable for small memory devices.
+ *
+ * BLAKE2bp supports the same keyed hash and HMAC modes as BLAKE2b,
+ * with the same calling conventions.
+ *
+ * References: https://blake2.net/,
+ * <a href="https://blake2.net/blake2.pdf">BLAKE2: simpler, smaller,
+ * fast as MD5</a>
+ *
+ * \sa BLAKE2b, BLAKE2sp
+ */
+
+/**
+ * \var BLAKE2bp::HASH_SIZE
+ * \brief Constant for the size of the hash output of BLAKE2bp.
+ */
+
+/**
+ * \var BLAKE2bp::BLOCK_SIZE
+ * \brief Constant for the block size of BLAKE2bp.
+ */
+
+/**
+ * \var BLAKE2bp::LEAVES
+ * \brief Number of leaves in the BLAKE2bp hash tree.
+ */
+
+// Size of a stripe of input that contains one block for every leaf.
+#define BLAKE2bp_STRIPE 512
+
+// Number of bytes that must follow a stripe before it can be processed.
+// The last block of each leaf must be compressed with the finalization
+// flag, so we need to know that all leaves have more data to come.
+#define BLAKE2bp_HOLDBACK (BLAKE2bp_STRIPE - 128)
+
+// Initialization vectors for BLAKE2b.
+static uint64_t const iv[8] PROGMEM = {
+    0x6a09e667f3bcc908ULL, 0xbb67ae8584caa73bULL, 0x3c6ef372fe94f82bULL,
+    0xa54ff53a5f1d36f1ULL, 0x510e527fade682d1ULL, 0x9b05688c2b3e6c1fULL,
+    0x1f83d9abfb41bd6bULL, 0x5be0cd19137e2179ULL
+};
+
+// Permutation on the message input state for BLAKE2b.
+static const uint8_t sigma[12][16] PROGMEM = {
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+    {14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3},
+    {11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4},
+    { 7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8},
+    { 9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13},
+    { 2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9},
+    {12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11},
+    {13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10},
+    { 6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5},
+    {10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0},
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+    {14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3}
+};
+
+#define blake2bp_ror(x, bits) (((x) >> (bits)) | ((x) << (64 - (bits))))
+
+// Perform a BLAKE2b quarter round operation.
+#define blake2bp_g(a, b, c, d, i) \
+    do { \
+        (a) += (b) + m[pgm_read_byte(&(sigma[round][2 * (i)]))]; \
+        (d) = blake2bp_ror((d) ^ (a), 32); \
+        (c) += (d); \
+        (b) = blake2bp_ror((b) ^ (c), 24); \
+        (a) += (b) + m[pgm_read_byte(&(sigma[round][2 * (i) + 1]))]; \
+        (d) = blake2bp_ror((d) ^ (a), 16); \
+        (c) += (d); \
+        (b) = blake2bp_ror((b) ^ (c), 63); \
+    } while (0)
+
+/**
+ * \brief Runs the BLAKE2b compression function.
+ *
+ * \param h The chaining value to update.
+ * \param m The 16 words of the message block.
+ * \param length The number of bytes hashed so far, including this block.
+ * \param f0 First finalization flag; all-ones for the last block.
+ * \param f1 Second finalization flag; all-ones for the last block of
+ * the last node at each level of the tree.
+ *
+ * The type V is either uint64_t to process a single leaf, or a vector
+ * of uint64_t to process several leaves at once with the same counter.
+ * The high word of the counter is always zero because a leaf cannot
+ * be fed more than 2^64 bytes through this API.
+ */
+template <typename V>
+static inline __attribute__((always_inline))
+void blake2bp_compress(V *h, const V *m, uint64_t length,
+                       uint64_t f0, uint64_t f1)
+{
+    V v[16];
+    uint8_t index;
+    for (index = 0; index < 8; ++index) {
+        v[index] = h[index];
+        v[index + 8] = V() + pgm_read_qword(iv + index);
+    }
+    v[12] ^= length;
+    v[14] ^= f0;
+    v[15] ^= f1;
+    for (uint8_t round = 0; round < 12; ++round) {
+        // Column round.
+        blake2bp_g(v[0], v[4], v[8],  v[12], 0);
+        blake2bp_g(v[1], v[5], v[9],  v[13], 1);
+        blake2bp_g(v[2], v[6], v[10], v[14], 2);
+        blake2bp_g(v[3], v[7], v[11], v[15], 3);
+
+        // Diagonal round.
+        blake2bp_g(v[0], v[5], v[10], v[15], 4);
+        blake2bp_g(v[1], v[6], v[11], v[12], 5);
+        blake2bp_g(v[2], v[7], v[8],  v[13], 6);
+        blake2bp_g(v[3], v[4], v[9],  v[14], 7);
+    }
+    for (index = 0; index < 8; ++index)
+        h[index] ^= (v[index] ^ v[index + 8]);
+}
+
+/**
+ * \brief Loads a 128-byte block as 16 little-endian words.
+ */
+static inline void blake2bp_load(uint64_t *m, const uint8_t *data)
+{
+    memcpy(m, data, 128);
+#if !defined(CRYPTO_LITTLE_ENDIAN)
+    for (uint8_t index = 0; index < 16; ++index)
+        m[index] = le64toh(m[index]);
+#endif
+}
+
+/**
+ * \brief Compresses stripes into the leaves one leaf at a time.
+ *
+ * \param h The chaining values for the leaves, indexed by word and then leaf.
+ * \param data Points to the stripes to compress.
+ * \param count Number of stripes to compress.
+ * \param length Number of bytes that have been compressed into each
+ * leaf before the first stripe.
+ */
+static void blake2bp_stripes(uint64_t h[8][4], const uint8_t *data,
+                             size_t count, uint64_t length)
+{
+    uint64_t hl[8];
+    uint64_t m[16];
+    uint8_t leaf, index;
+    while (count > 0) {
+        length += 128;
+        for (leaf = 0; leaf < 4; ++leaf) {
+            for (index = 0; index < 8; ++index)
+                hl[index] = h[index][leaf];
+            blake2bp_load(m, data + leaf * 128);
+            blake2bp_compress<uint64_t>(hl, m, length, 0, 0);
+            for (index = 0; index < 8; ++index)
+                h[index][leaf] = hl[index];
+        }
+        data += BLAKE2bp_STRIPE;
+        --count;
+    }
+    clean(hl);
+    clean(m);
+}
+
+#if defined(CRYPTO_X86_SIMD)
+
+typedef uint64_t blake2bp_v4 __attribute__((vector_size(32)));
+
+/**
+ * \brief Compresses stripes into all 4 leaves at once using AVX2.
+ *
+ * Lane N of each vector holds the state for leaf N.  The message words
+ * for the leaves are gathered directly from the input stripe.
+ */
+CRYPTO_TARGET("avx2")
+static void blake2bp_stripes_avx2(uint64_t h[8][4], const uint8_t *data,
+                                  size_t count, uint64_t length)
+{
+    const __m128i offsets = _mm_set_epi32(48, 32, 16, 0);
+    blake2bp_v4 hv[8];
+    blake2bp_v4 m[16];
+    uint8_t index;
+    memcpy(hv, h, sizeof(hv));
+    while (count > 0) {
+        length += 128;
+        for (index = 0; index < 16; ++index) {
+            m[index] = (blake2bp_v4)_mm256_i32gather_epi64
+                ((const long long *)(data + index * 8), offsets, 8);
+        }
+        blake2bp_compress<blake2bp_v4>(hv, m, length, 0, 0);
+        data += BLAKE2bp_STRIPE;
+        --count;
+    }
+    memcpy(h, hv, sizeof(hv));
+    clean(hv);
+    clean(m);
+}
+
+#endif // CRYPTO_X86_SIMD
+
+/**
+ * \brief Compresses stripes into the leaves with the best implementation
+ * for this platform.
+ */
+static void blake2bp_process(uint64_t h[8][4], const uint8_t *data,
+                             size_t count, uint64_t length)
+{
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_AVX2)) {
+        blake2bp_stripes_avx2(h, data, count, length);
+        return;
+    }
+#endif
+    blake2bp_stripes(h, data, count, length);
+}
+
+/**
+ * \brief Constructs a BLAKE2bp hash object.
+ */
+BLAKE2bp::BLAKE2bp()
+{
+    reset();
+}
+
+/**
+ * \brief Destroys this BLAKE2bp hash object after clearing
+ * sensitive information.
+ */
+BLAKE2bp::~BLAKE2bp()
+{
+    clean(state);
+}
+
+size_t BLAKE2bp::hashSize() const
+{
+    return 64;
+}
+
+size_t BLAKE2bp::blockSize() const
+{
+    return 128;
+}
+
+void BLAKE2bp::reset()
+{
+    init(0, 64);
+}
+
+/**
+ * \brief Resets the hash ready for a new hashing process with a specified
+ * output length.
+ *
+ * \param outputLength The output length to use for the final hash in bytes,
+ * between 1 and 64.
+ */
+void BLAKE2bp::reset(uint8_t outputLength)
+{
+    init(0, outputLength);
+}
+
+/**
+ * \brief Resets the hash ready for a new hashing process with a specified
+ * key and output length.
+ *
+ * \param key Points to the key.
+ * \param keyLen The length of the key in bytes, between 0 and 64.
+ * \param outputLength The output length to use for the final hash in bytes,
+ * between 1 and 64.
+ *
+ * Key padding and parameters are the same as for BLAKE2b::reset(), except
+ * that every leaf is keyed.
+ */
+void BLAKE2bp::reset(const void *key, size_t keyLen, uint8_t outputLength)
+{
+    if (keyLen > 64)
+        keyLen = 64;
+    init(keyLen, outputLength);
+    memcpy(state.key, key, keyLen);
+}
+
+void BLAKE2bp::update(const void *data, size_t len)
+{
+    const uint8_t *d = (const uint8_t *)data;
+    while (len > 0) {
+        if (state.posn == BLAKE2bp_STRIPE && len > BLAKE2bp_HOLDBACK) {
+            // Buffered stripe is now followed by enough data to process it.
+            processStripes(state.buf, 1);
+            state.posn = 0;
+        }
+        if (state.posn == 0 && len > (BLAKE2bp_STRIPE + BLAKE2bp_HOLDBACK)) {
+            // Process as many stripes as possible directly from the input.
+            size_t count = (len - BLAKE2bp_HOLDBACK - 1) / BLAKE2bp_STRIPE;
+            processStripes(d, count);
+            d += count * BLAKE2bp_STRIPE;
+            len -= count * BLAKE2bp_STRIPE;
+            continue;
+        }
+        if (state.posn == sizeof(state.buf)) {
+            // The buffer is full, so the first stripe can be processed.
+            processStripes(state.buf, 1);
+            memcpy(state.buf, state.buf + BLAKE2bp_STRIPE,
+                   sizeof(state.buf) - BLAKE2bp_STRIPE);
+            state.posn -= BLAKE2bp_STRIPE;
+        }
+        size_t size = sizeof(state.buf) - state.posn;
+        if (size > len)
+            size = len;
+        memcpy(state.buf + state.posn, d, size);
+        state.posn += size;
+        len -= size;
+        d += size;
+    }
+}
+
+void BLAKE2bp::finalize(void *hash, size_t len)
+{
+    uint64_t h[8];
+    uint64_t m[16];
+    uint8_t block[128];
+    uint8_t leafHashes[4 * 64];
+    uint8_t leaf, index;
+
+    // Finalize each of the leaves.  A leaf has up to two blocks left in
+    // the buffer, plus the key block if it has not been processed yet.
+    // An empty leaf is finalized with a single all-zeroes block.
+    for (leaf = 0; leaf < 4; ++leaf) {
+        uint64_t length = state.length;
+        bool keyPending = (state.keyLen != 0 && length == 0);
+        uint16_t posn = leaf * 128;
+        bool last;
+        for (index = 0; index < 8; ++index)
+            h[index] = state.h[index][leaf];
+        do {
+            size_t size = 0;
+            memset(block, 0, sizeof(block));
+            if (keyPending) {
+                memcpy(block, state.key, state.keyLen);
+                size = 128;
+                keyPending = false;
+            } else if (posn < state.posn) {
+                size = state.posn - posn;
+                if (size > 128)
+                    size = 128;
+                memcpy(block, state.buf + posn, size);
+                posn += BLAKE2bp_STRIPE;
+            }
+            length += size;
+            last = (posn >= state.posn);
+            blake2bp_load(m, block);
+            if (!last) {
+                blake2bp_compress<uint64_t>(h, m, length, 0, 0);
+            } else {
+                blake2bp_compress<uint64_t>
+                    (h, m, length, 0xFFFFFFFFFFFFFFFFULL,
+                     leaf == 3 ? 0xFFFFFFFFFFFFFFFFULL : 0);
+            }
+        } while (!last);
+        for (index = 0; index < 8; ++index) {
+            uint64_t word = htole64(h[index]);
+            memcpy(leafHashes + leaf * 64 + index * 8, &word, 8);
+        }
+    }
+
+    // Hash the leaf hashes with the root node, which is the last node
+    // at its level of the tree.
+    for (index = 0; index < 8; ++index)
+        h[index] = pgm_read_qword(iv + index);
+    h[0] ^= 0x02040000 ^ (((uint64_t)state.keyLen) << 8) ^ state.outputLength;
+    h[2] ^= 0x4001;
+    for (index = 0; index < 2; ++index) {
+        blake2bp_load(m, leafHashes + index * 128);
+        if (index < 1) {
+            blake2bp_compress<uint64_t>(h, m, (index + 1) * 128, 0, 0);
+        } else {
+            blake2bp_compress<uint64_t>
+                (h, m, (index + 1) * 128, 0xFFFFFFFFFFFFFFFFULL,
+                 0xFFFFFFFFFFFFFFFFULL);
+        }
+    }
+
+    // Copy the hash to the caller's return buffer.
+    for (index = 0; index < 8; ++index)
+        m[index] = htole64(h[index]);
+    if (len > state.outputLength)
+        len = state.outputLength;
+    memcpy(hash, m, len);
+    clean(h);
+    clean(m);
+    clean(block);
+    clean(leafHashes);
+}
+
+void BLAKE2bp::clear()
+{
+    clean(state);
+    reset();
+}
+
+void BLAKE2bp::resetHMAC(const void *key, size_t keyLen)
+{
+    uint8_t block[128];
+    formatHMACKey(block, key, keyLen, 0x36);
+    update(block, sizeof(block));
+    clean(block);
+}
+
+void BLAKE2bp::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t hashLen)
+{
+    uint8_t block[128];
+    uint8_t temp[64];
+    finalize(temp, sizeof(temp));
+    formatHMACKey(block, key, keyLen, 0x5C);
+    update(block, sizeof(block));
+    update(temp, sizeof(temp));
+    finalize(hash, hashLen);
+    clean(block);
+    clean(temp);
+}
+
+/**
+ * \brief Initializes the leaf chaining values from the tree parameters.
+ *
+ * \param keyLen The length of the key in bytes, between 0 and 64.
+ * \param outputLength The output length in bytes, between 1 and 64.
+ */
+void BLAKE2bp::init(size_t keyLen, uint8_t outputLength)
+{
+    if (outputLength < 1)
+        outputLength = 1;
+    else if (outputLength > 64)
+        outputLength = 64;
+    for (uint8_t leaf = 0; leaf < 4; ++leaf) {
+        for (uint8_t index = 0; index < 8; ++index)
+            state.h[index][leaf] = pgm_read_qword(iv + index);
+
+        // Fanout of 4, depth of 2, leaf node at the given offset,
+        // and an inner hash length of 64.
+        state.h[0][leaf] ^= 0x02040000 ^ (keyLen << 8) ^ outputLength;
+        state.h[1][leaf] ^= leaf;
+        state.h[2][leaf] ^= 0x4000;
+    }
+    state.length = 0;
+    state.posn = 0;
+    state.keyLen = (uint8_t)keyLen;
+    state.outputLength = outputLength;
+}
+
+/**
+ * \brief Compresses whole stripes into the leaves.
+ *
+ * \param data Points to the stripes.
+ * \param count The number of stripes.
+ */
+void BLAKE2bp::processStripes(const uint8_t *data, size_t count)
+{
+    // If the hash is keyed, then the first block of every leaf is the key.
+    if (state.keyLen != 0 && state.length == 0) {
+        uint8_t keyStripe[BLAKE2bp_STRIPE];
+        memset(keyStripe, 0, sizeof(keyStripe));
+        for (uint8_t leaf = 0; leaf < 4; ++leaf)
+            memcpy(keyStripe + leaf * 128, state.key, state.keyLen);
+        blake2bp_process(state.h, keyStripe, 1, 0);
+        state.length = 128;
+        clean(keyStripe);
+        clean(state.key);
+    }
+
+    // Compress the stripes into all of the leaves.
+    blake2bp_process(state.h, data, count, state.length);
+    state.length += count * 128;
+}
@@ -25,7 +25,11 @@
 #include "utility/EndianUtil.h"
 #include "utility/RotateUtil.h"
 #include "utility/ProgMemUtil.h"
+#include "utility/CpuUtil.h"
 #include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <immintrin.h>
+#endif
 
 /**
  * \class BLAKE2s BLAKE2s.h <BLAKE2s.h>
@@ -66,6 +70,10 @@
  * References: https://blake2.net/,
  * <a href="http://tools.ietf.org/html/rfc7693">RFC 7693</a>
  *
+ * On x86 hosts with SSE4.1 or AVX, the four rows of the BLAKE2s state
+ * are held in vector registers and the columns and diagonals are processed
+ * in parallel.  The choice is made at runtime.
+ *
  * \sa BLAKE2b, SHA256, SHA3_256
  */
 
@@ -116,6 +124,17 @@ size_t BLAKE2s::blockSize() const
 #define BLAKE2s_IV6 0x1F83D9AB
 #define BLAKE2s_IV7 0x5BE0CD19
 
+#if defined(CRYPTO_X86_SIMD)
+
+// Function that compresses a single 512-bit chunk from a little-endian
+// message buffer into the hash value.
+typedef void (*blake2s_compress_t)
+    (uint32_t *h, const uint32_t *m, uint64_t length, uint32_t f0);
+
+static blake2s_compress_t blake2s_backend();
+
+#endif
+
 void BLAKE2s::reset()
 {
     state.h[0] = BLAKE2s_IV0 ^ 0x01010020; // Default output length of 32.
@@ -201,6 +220,23 @@ void BLAKE2s::update(const void *data, size_t len)
     // Break the input up into 512-bit chunks and process each in turn.
     const uint8_t *d = (const uint8_t *)data;
     while (len > 0) {
+#if defined(CRYPTO_X86_SIMD)
+        // If the chunk buffer is empty, then compress whole chunks directly
+        // from the input.  The last chunk is always left in the buffer
+        // because it may need to be processed with f0 set to all-ones.
+        if (state.chunkSize == 0 && len > 64) {
+            blake2s_compress_t compress = blake2s_backend();
+            if (compress) {
+                do {
+                    state.length += 64;
+                    (*compress)(state.h, (const uint32_t *)d, state.length, 0);
+                    d += 64;
+                    len -= 64;
+                } while (len > 64);
+                continue;
+            }
+        }
+#endif
         if (state.chunkSize == 64) {
             // Previous chunk was full and we know that it wasn't the
             // last chunk, so we can process it now with f0 set to zero.
@@ -259,6 +295,18 @@ void BLAKE2s::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t ha
     clean(temp);
 }
 
+/**
+ * \brief Processes the padded HMAC key block that resetHMAC() left in
+ * the chunk buffer, with f0 set to zero because more data will follow.
+ */
+void BLAKE2s::flushHMACKey()
+{
+    if (state.chunkSize == 64) {
+        processChunk(0);
+        state.chunkSize = 0;
+    }
+}
+
 // Permutation on the message input state for BLAKE2s.
 static const uint8_t sigma[10][16] PROGMEM = {
     { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
@@ -294,6 +342,14 @@ void BLAKE2s::processChunk(uint32_t f0)
     uint8_t index;
     uint32_t v[16];
 
+#if defined(CRYPTO_X86_SIMD)
+    blake2s_compress_t compress = blake2s_backend();
+    if (compress) {
+        (*compress)(state.h, state.m, state.length, f0);
+        return;
+    }
+#endif
+
     // Byte-swap the message buffer into little-endian if necessary.
 #if !defined(CRYPTO_LITTLE_ENDIAN)
     for (index = 0; index < 16; ++index)
@@ -330,3 +386,157 @@ void BLAKE2s::processChunk(uint32_t f0)
     for (index = 0; index < 8; ++index)
         state.h[index] ^= (v[index] ^ v[index + 8]);
 }
+
+#if defined(CRYPTO_X86_SIMD)
+
+// Message word order for each round of the vectorized compression function,
+// precomputed from "sigma".  Each group of four words is the first or
+// second message input for the four column or diagonal quarter rounds.
+static const uint8_t blake2s_vec_sigma[10][16] = {
+    { 0,  2,  4,  6,  1,  3,  5,  7,  8, 10, 12, 14,  9, 11, 13, 15},
+    {14,  4,  9, 13, 10,  8, 15,  6,  1,  0, 11,  5, 12,  2,  7,  3},
+    {11, 12,  5, 15,  8,  0,  2, 13, 10,  3,  7,  9, 14,  6,  1,  4},
+    { 7,  3, 13, 11,  9,  1, 12, 14,  2,  5,  4, 15,  6, 10,  0,  8},
+    { 9,  5,  2, 10,  0,  7,  4, 15, 14, 11,  6,  3,  1, 12,  8, 13},
+    { 2,  6,  0,  8, 12, 10, 11,  3,  4,  7, 15,  1, 13,  5, 14,  9},
+    {12,  1, 14,  4,  5, 15, 13, 10,  0,  6,  9,  8,  7,  3,  2, 11},
+    {13,  7, 12,  3, 11, 14,  1,  9,  5, 15,  8,  2,  0,  4,  6, 10},
+    { 6, 14, 11,  0, 15,  9,  3,  8, 12, 13,  1, 10,  2,  7,  4,  5},
+    {10,  8,  7,  1,  2,  4,  6,  5, 15,  9,  3, 13, 11, 14, 12,  0}
+};
+
+// Rotates the 32-bit lanes of a vector right.  This is written with
+// generic vector operations so that the compiler can use a single
+// rotate instruction when the target has one.
+typedef uint32_t blake2s_vec_t __attribute__((vector_size(16)));
+#define blake2s_vec_ror(x, bits) \
+    ((__m128i)((((blake2s_vec_t)(x)) >> (bits)) | \
+               (((blake2s_vec_t)(x)) << (32 - (bits)))))
+
+// Perform half of a BLAKE2s quarter round on all four columns (or
+// diagonals) at once.  The first half rotates by 16 and 12, and the
+// second half rotates by 8 and 7.
+#define blake2s_g1(m) \
+    do { \
+        row1 = _mm_add_epi32(_mm_add_epi32(row1, (m)), row2); \
+        row4 = _mm_shuffle_epi8(_mm_xor_si128(row4, row1), rot16); \
+        row3 = _mm_add_epi32(row3, row4); \
+        row2 = _mm_xor_si128(row2, row3); \
+        row2 = blake2s_vec_ror(row2, 12); \
+    } while (0)
+#define blake2s_g2(m) \
+    do { \
+        row1 = _mm_add_epi32(_mm_add_epi32(row1, (m)), row2); \
+        row4 = _mm_shuffle_epi8(_mm_xor_si128(row4, row1), rot8); \
+        row3 = _mm_add_epi32(row3, row4); \
+        row2 = _mm_xor_si128(row2, row3); \
+        row2 = blake2s_vec_ror(row2, 7); \
+    } while (0)
+
+// Gathers four message words for a round into a vector.
+#define blake2s_msg(i) \
+    (_mm_set_epi32(m[s[(i) + 3]], m[s[(i) + 2]], m[s[(i) + 1]], m[s[(i)]]))
+
+/**
+ * \brief Compresses a chunk with BLAKE2s with the state rows in vectors.
+ *
+ * \param h The hash value to update.
+ * \param m The 16 little-endian message words to compress.
+ * \param length The total number of bytes hashed so far.
+ * \param f0 Finalization flag; all-ones for the last chunk.
+ *
+ * The diagonal round is performed by rotating the lanes of rows 2, 3,
+ * and 4 so that the diagonals line up as columns, and then rotating
+ * them back again.  The rounds are fully unrolled so that the message
+ * word order becomes a fixed sequence of loads.
+ */
+CRYPTO_TARGET("sse4.1")
+static inline __attribute__((always_inline))
+void blake2s_compress_vec(uint32_t *h, const uint32_t *m,
+                          uint64_t length, uint32_t f0)
+{
+    const __m128i rot16 = _mm_set_epi8
+        (13, 12, 15, 14, 9, 8, 11, 10, 5, 4, 7, 6, 1, 0, 3, 2);
+    const __m128i rot8 = _mm_set_epi8
+        (12, 15, 14, 13, 8, 11, 10, 9, 4, 7, 6, 5, 0, 3, 2, 1);
+    __m128i row1 = _mm_loadu_si128((const __m128i *)h);
+    __m128i row2 = _mm_loadu_si128((const __m128i *)(h + 4));
+    __m128i row3 = _mm_set_epi32
+        (BLAKE2s_IV3, BLAKE2s_IV2, BLAKE2s_IV1, BLAKE2s_IV0);
+    __m128i row4 = _mm_set_epi32
+        (BLAKE2s_IV7, BLAKE2s_IV6 ^ f0, BLAKE2s_IV5 ^ (uint32_t)(length >> 32),
+         BLAKE2s_IV4 ^ (uint32_t)length);
+    __m128i save1 = row1;
+    __m128i save2 = row2;
+#pragma GCC unroll 10
+    for (uint8_t index = 0; index < 10; ++index) {
+        const uint8_t *s = blake2s_vec_sigma[index];
+
+        // Column round.
+        blake2s_g1(blake2s_msg(0));
+        blake2s_g2(blake2s_msg(4));
+
+        // Diagonal round.
+        row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(0, 3, 2, 1));
+        row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(2, 1, 0, 3));
+        blake2s_g1(blake2s_msg(8));
+        blake2s_g2(blake2s_msg(12));
+        row2 = _mm_shuffle_epi32(row2, _MM_SHUFFLE(2, 1, 0, 3));
+        row3 = _mm_shuffle_epi32(row3, _MM_SHUFFLE(1, 0, 3, 2));
+        row4 = _mm_shuffle_epi32(row4, _MM_SHUFFLE(0, 3, 2, 1));
+    }
+
+    // Combine the new and old hash values.
+    _mm_storeu_si128((__m128i *)h, _mm_xor_si128
+        (save1, _mm_xor_si128(row1, row3)));
+    _mm_storeu_si128((__m128i *)(h + 4), _mm_xor_si128
+        (save2, _mm_xor_si128(row2, row4)));
+}
+
+CRYPTO_TARGET("sse4.1")
+static void blake2s_compress_sse41(uint32_t *h, const uint32_t *m,
+                                   uint64_t length, uint32_t f0)
+{
+    blake2s_compress_vec(h, m, length, f0);
+}
+
+CRYPTO_TARGET("avx")
+static void blake2s_compress_avx(uint32_t *h, const uint32_t *m,
+                                 uint64_t length, uint32_t f0)
+{
+    // Same as SSE4.1, but the compiler can use the VEX encodings.
+    blake2s_compress_vec(h, m, length, f0);
+}
+
+CRYPTO_TARGET("avx512f,avx512vl")
+static void blake2s_compress_avx512(uint32_t *h, const uint32_t *m,
+                                    uint64_t length, uint32_t f0)
+{
+    // Same again, but the rotations become single instructions.
+    blake2s_compress_vec(h, m, length, f0);
+}
+
+/**
+ * \brief Selects the best BLAKE2s backend for the host CPU.
+ *
+ * \return A pointer to the backend, or NULL to use the portable
+ * processChunk() implementation.
+ */
+static blake2s_compress_t blake2s_backend()
+{
+    static blake2s_compress_t backend = 0;
+    static bool selected = false;
+    if (!selected) {
+        if (crypto_cpu_has(CRYPTO_CPU_AVX512VL))
+            backend = blake2s_compress_avx512;
+        else if (crypto_cpu_has(CRYPTO_CPU_AVX))
+            backend = blake2s_compress_avx;
+        else if (crypto_cpu_has(CRYPTO_CPU_SSE41))
+            backend = blake2s_compress_sse41;
+        selected = true;
+    }
+    return backend;
+}
+
+#endif // CRYPTO_X86_SIMD
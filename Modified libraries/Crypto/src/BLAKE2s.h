@@ -58,6 +58,7 @@ private:
     } state;
 
     void processChunk(uint32_t f0);
+    void flushHMACKey();
 };
 
 #endif
@@ -0,0 +1,310 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "MultiHash.h"
+#include "BLAKE2s.h"
+#include "Crypto.h"
+#include "utility/CpuUtil.h"
+#include "utility/EndianUtil.h"
+#include <string.h>
+
+/**
+ * \class BLAKE2sMulti MultiHash.h <MultiHash.h>
+ * \brief Hashes several independent messages with BLAKE2s at once.
+ *
+ * This class works the same way as SHA256Multi, with each SIMD lane
+ * holding the state for a separate message.  The output is the
+ * default unkeyed 32-byte BLAKE2s hash of each message.
+ *
+ * On x86 hosts with AVX-512 there are 16 lanes, with AVX2 there are 8,
+ * and otherwise there are 4 lanes using SSE2.  On other platforms the
+ * messages are hashed one at a time with BLAKE2s.
+ *
+ * \sa SHA256Multi, SHA512Multi, BLAKE2s
+ */
+
+/**
+ * \var BLAKE2sMulti::HASH_SIZE
+ * \brief Constant for the size of the hash output of BLAKE2sMulti.
+ */
+
+/**
+ * \var BLAKE2sMulti::MAX_LANES
+ * \brief Maximum number of lanes that may be returned by lanes().
+ */
+
+#if defined(CRYPTO_X86_SIMD)
+
+typedef uint32_t blake2s_v4 __attribute__((vector_size(16)));
+typedef uint32_t blake2s_v8 __attribute__((vector_size(32)));
+typedef uint32_t blake2s_v16 __attribute__((vector_size(64)));
+
+// Initialization vectors for BLAKE2s.
+static uint32_t const iv[8] = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+// Permutation on the message input state for BLAKE2s.
+static const uint8_t sigma[10][16] = {
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+    {14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3},
+    {11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4},
+    { 7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8},
+    { 9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13},
+    { 2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9},
+    {12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11},
+    {13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10},
+    { 6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5},
+    {10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0}
+};
+
+#define blake2s_ror(x, bits) (((x) >> (bits)) | ((x) << (32 - (bits))))
+
+// Perform a BLAKE2s quarter round operation on all lanes.
+#define blake2s_multi_g(a, b, c, d, i) \
+    do { \
+        (a) += (b) + w[sigma[round][2 * (i)]]; \
+        (d) = blake2s_ror((d) ^ (a), 16); \
+        (c) += (d); \
+        (b) = blake2s_ror((b) ^ (c), 12); \
+        (a) += (b) + w[sigma[round][2 * (i) + 1]]; \
+        (d) = blake2s_ror((d) ^ (a), 8); \
+        (c) += (d); \
+        (b) = blake2s_ror((b) ^ (c), 7); \
+    } while (0)
+
+/**
+ * \brief Runs the BLAKE2s compression function on all lanes.
+ *
+ * \param h The transposed hash state, one vector per word.
+ * \param w The transposed message block, followed by the low and high
+ * words of the byte counter and the finalization flag for each lane.
+ */
+template <typename V>
+static inline __attribute__((always_inline))
+void blake2s_multi_compress(V *h, const V *w)
+{
+    V v[16];
+    uint8_t index;
+    for (index = 0; index < 8; ++index) {
+        v[index] = h[index];
+        v[index + 8] = (V){} + iv[index];
+    }
+    v[12] ^= w[16];
+    v[13] ^= w[17];
+    v[14] ^= w[18];
+#pragma GCC unroll 10
+    for (uint8_t round = 0; round < 10; ++round) {
+        // Column round.
+        blake2s_multi_g(v[0], v[4], v[8],  v[12], 0);
+        blake2s_multi_g(v[1], v[5], v[9],  v[13], 1);
+        blake2s_multi_g(v[2], v[6], v[10], v[14], 2);
+        blake2s_multi_g(v[3], v[7], v[11], v[15], 3);
+
+        // Diagonal round.
+        blake2s_multi_g(v[0], v[5], v[10], v[15], 4);
+        blake2s_multi_g(v[1], v[6], v[11], v[12], 5);
+        blake2s_multi_g(v[2], v[7], v[8],  v[13], 6);
+        blake2s_multi_g(v[3], v[4], v[9],  v[14], 7);
+    }
+    for (index = 0; index < 8; ++index)
+        h[index] ^= (v[index] ^ v[index + 8]);
+}
+
+/**
+ * \brief Transposes the next chunk of up to N messages into word order,
+ * together with the counter and finalization flag for each lane.
+ */
+template <unsigned N>
+static inline __attribute__((always_inline))
+void blake2s_multi_transpose(uint32_t words[19][N], const uint8_t *const *data,
+                             uint8_t tail[N][64], const size_t *lens,
+                             const size_t *total, unsigned count, size_t block)
+{
+    static uint8_t const dummy[64] = {0};
+    for (unsigned lane = 0; lane < N; ++lane) {
+        const uint8_t *chunk;
+        uint64_t length = 0;
+        uint32_t f0 = 0;
+        if (lane >= count || block >= total[lane]) {
+            chunk = dummy;
+        } else if ((block + 1) < total[lane]) {
+            chunk = data[lane] + block * 64;
+            length = (block + 1) * 64;
+        } else {
+            chunk = tail[lane];
+            length = lens[lane];
+            f0 = 0xFFFFFFFF;
+        }
+        for (unsigned index = 0; index < 16; ++index) {
+            uint32_t word;
+            memcpy(&word, chunk + index * 4, sizeof(word));
+            words[index][lane] = le32toh(word);
+        }
+        words[16][lane] = (uint32_t)length;
+        words[17][lane] = (uint32_t)(length >> 32);
+        words[18][lane] = f0;
+    }
+}
+
+/**
+ * \brief Hashes up to N messages in parallel using N-lane vectors.
+ */
+template <typename V, unsigned N>
+static inline __attribute__((always_inline))
+void blake2s_multi_lanes(uint8_t *const *hashes, const uint8_t *const *data,
+                         const size_t *lens, unsigned count)
+{
+    uint8_t tail[N][64];
+    size_t total[N];
+    size_t maxBlocks = 0;
+    uint32_t words[2][19][N] __attribute__((aligned(sizeof(V))));
+    V h[8];
+    V w[19];
+    unsigned lane, index;
+
+    // The last chunk of each message is zero-padded.  An empty message
+    // is hashed as a single all-zeroes chunk.
+    for (lane = 0; lane < count; ++lane) {
+        size_t len = lens[lane];
+        size_t blocks = (len == 0) ? 1 : ((len + 63) / 64);
+        size_t rem = len - (blocks - 1) * 64;
+        memcpy(tail[lane], data[lane] + (blocks - 1) * 64, rem);
+        memset(tail[lane] + rem, 0, 64 - rem);
+        total[lane] = blocks;
+        if (blocks > maxBlocks)
+            maxBlocks = blocks;
+    }
+
+    // Initialize the hash state for a 32-byte unkeyed output.
+    for (index = 0; index < 8; ++index)
+        h[index] = (V){} + iv[index];
+    h[0] ^= 0x01010020;
+
+    // Transpose and compress the chunks for all lanes at once.
+    blake2s_multi_transpose<N>(words[0], data, tail, lens, total, count, 0);
+    for (size_t block = 0; block < maxBlocks; ++block) {
+        memcpy(w, words[block & 1], sizeof(w));
+        if ((block + 1) < maxBlocks) {
+            blake2s_multi_transpose<N>(words[(block + 1) & 1], data, tail,
+                                       lens, total, count, block + 1);
+        }
+        blake2s_multi_compress<V>(h, w);
+        for (lane = 0; lane < count; ++lane) {
+            if ((block + 1) != total[lane])
+                continue;
+            for (index = 0; index < 8; ++index) {
+                uint32_t word = htole32(h[index][lane]);
+                memcpy(hashes[lane] + index * 4, &word, sizeof(word));
+            }
+        }
+    }
+
+    clean(tail);
+    clean(words);
+    clean(h);
+    clean(w);
+}
+
+CRYPTO_TARGET("avx512f")
+static void blake2s_multi_avx512(uint8_t *const *hashes, const uint8_t *const *data,
+                                 const size_t *lens, unsigned count)
+{
+    blake2s_multi_lanes<blake2s_v16, 16>(hashes, data, lens, count);
+}
+
+CRYPTO_TARGET("avx2")
+static void blake2s_multi_avx2(uint8_t *const *hashes, const uint8_t *const *data,
+                               const size_t *lens, unsigned count)
+{
+    blake2s_multi_lanes<blake2s_v8, 8>(hashes, data, lens, count);
+}
+
+static void blake2s_multi_sse2(uint8_t *const *hashes, const uint8_t *const *data,
+                               const size_t *lens, unsigned count)
+{
+    blake2s_multi_lanes<blake2s_v4, 4>(hashes, data, lens, count);
+}
+
+#endif // CRYPTO_X86_SIMD
+
+/**
+ * \brief Returns the number of messages that are hashed in parallel
+ * on this platform.
+ *
+ * \sa SHA256Multi::lanes()
+ */
+size_t BLAKE2sMulti::lanes()
+{
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_AVX512F))
+        return 16;
+    else if (crypto_cpu_has(CRYPTO_CPU_AVX2))
+        return 8;
+    else
+        return 4;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * \brief Hashes a batch of independent messages with BLAKE2s.
+ *
+ * \param hashes Array of \a count pointers to buffers that receive the
+ * hash outputs.  Each buffer must be at least HASH_SIZE bytes in length.
+ * \param data Array of \a count pointers to the messages to hash.
+ * \param lens Array of \a count message lengths in bytes.
+ * \param count Number of messages to hash.
+ *
+ * The results are identical to hashing each message with BLAKE2s
+ * using the default output length of 32 bytes and no key.
+ */
+void BLAKE2sMulti::hash(uint8_t *const *hashes, const void *const *data,
+                        const size_t *lens, size_t count)
+{
+    const uint8_t *const *d = (const uint8_t *const *)data;
+#if defined(CRYPTO_X86_SIMD)
+    size_t n = lanes();
+    while (count > 0) {
+        unsigned batch = (count < n) ? (unsigned)count : (unsigned)n;
+        if (n == 16)
+            blake2s_multi_avx512(hashes, d, lens, batch);
+        else if (n == 8)
+            blake2s_multi_avx2(hashes, d, lens, batch);
+        else
+            blake2s_multi_sse2(hashes, d, lens, batch);
+        hashes += batch;
+        d += batch;
+        lens += batch;
+        count -= batch;
+    }
+#else
+    BLAKE2s blake;
+    for (size_t posn = 0; posn < count; ++posn) {
+        blake.reset();
+        blake.update(d[posn], lens[posn]);
+        blake.finalize(hashes[posn], HASH_SIZE);
+    }
+#endif
+}
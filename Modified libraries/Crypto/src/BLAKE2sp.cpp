@@ -0,0 +1,511 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "BLAKE2sp.h"
+#include "Crypto.h"
+#include "utility/EndianUtil.h"
+#include "utility/ProgMemUtil.h"
+#include "utility/CpuUtil.h"
+#include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <immintrin.h>
+#endif
+
+/**
+ * \class BLAKE2sp BLAKE2sp.h <BLAKE2sp.h>
+ * \brief BLAKE2sp hash algorithm.
+ *
+ * BLAKE2sp is the parallel tree mode of BLAKE2s.  The input is split into
+ * 64-byte blocks that are dealt out round-robin to 8 leaf BLAKE2s
+ * instances, and the 8 leaf hashes are then hashed by a root BLAKE2s
+ * instance to produce the final 256-bit output.  The leaves are
+ * independent of each other so they can be processed in parallel.
+ *
+ * The output is not the same as BLAKE2s.  This class is intended for
+ * hashing large amounts of data on platforms with SIMD support.  On x86
+ * hosts with AVX2, all 8 leaves are compressed at once using one vector
+ * lane per leaf.  On other platforms the leaves are compressed one
+ * after the other.  The state is over 1K in size, which makes this
+ * class unsuitable for small memory devices.
+ *
+ * BLAKE2sp supports the same keyed hash and HMAC modes as BLAKE2s,
+ * with the same calling conventions.
+ *
+ * References: https://blake2.net/,
+ * <a href="https://blake2.net/blake2.pdf">BLAKE2: simpler, smaller,
+ * fast as MD5</a>
+ *
+ * \sa BLAKE2s, BLAKE2bp, BLAKE2sMulti
+ */
+
+/**
+ * \var BLAKE2sp::HASH_SIZE
+ * \brief Constant for the size of the hash output of BLAKE2sp.
+ */
+
+/**
+ * \var BLAKE2sp::BLOCK_SIZE
+ * \brief Constant for the block size of BLAKE2sp.
+ */
+
+/**
+ * \var BLAKE2sp::LEAVES
+ * \brief Number of leaves in the BLAKE2sp hash tree.
+ */
+
+// Size of a stripe of input that contains one block for every leaf.
+#define BLAKE2sp_STRIPE 512
+
+// Number of bytes that must follow a stripe before it can be processed.
+// The last block of each leaf must be compressed with the finalization
+// flag, so we need to know that all leaves have more data to come.
+#define BLAKE2sp_HOLDBACK (BLAKE2sp_STRIPE - 64)
+
+// Initialization vectors for BLAKE2s.
+static uint32_t const iv[8] PROGMEM = {
+    0x6A09E667, 0xBB67AE85, 0x3C6EF372, 0xA54FF53A,
+    0x510E527F, 0x9B05688C, 0x1F83D9AB, 0x5BE0CD19
+};
+
+// Permutation on the message input state for BLAKE2s.
+static const uint8_t sigma[10][16] PROGMEM = {
+    { 0,  1,  2,  3,  4,  5,  6,  7,  8,  9, 10, 11, 12, 13, 14, 15},
+    {14, 10,  4,  8,  9, 15, 13,  6,  1, 12,  0,  2, 11,  7,  5,  3},
+    {11,  8, 12,  0,  5,  2, 15, 13, 10, 14,  3,  6,  7,  1,  9,  4},
+    { 7,  9,  3,  1, 13, 12, 11, 14,  2,  6,  5, 10,  4,  0, 15,  8},
+    { 9,  0,  5,  7,  2,  4, 10, 15, 14,  1, 11, 12,  6,  8,  3, 13},
+    { 2, 12,  6, 10,  0, 11,  8,  3,  4, 13,  7,  5, 15, 14,  1,  9},
+    {12,  5,  1, 15, 14, 13,  4, 10,  0,  7,  6,  3,  9,  2,  8, 11},
+    {13, 11,  7, 14, 12,  1,  3,  9,  5,  0, 15,  4,  8,  6,  2, 10},
+    { 6, 15, 14,  9, 11,  3,  0,  8, 12,  2, 13,  7,  1,  4, 10,  5},
+    {10,  2,  8,  4,  7,  6,  1,  5, 15, 11,  9, 14,  3, 12, 13 , 0}
+};
+
+#define blake2sp_ror(x, bits) (((x) >> (bits)) | ((x) << (32 - (bits))))
+
+// Perform a BLAKE2s quarter round operation.
+#define blake2sp_g(a, b, c, d, i) \
+    do { \
+        (a) += (b) + m[pgm_read_byte(&(sigma[round][2 * (i)]))]; \
+        (d) = blake2sp_ror((d) ^ (a), 16); \
+        (c) += (d); \
+        (b) = blake2sp_ror((b) ^ (c), 12); \
+        (a) += (b) + m[pgm_read_byte(&(sigma[round][2 * (i) + 1]))]; \
+        (d) = blake2sp_ror((d) ^ (a), 8); \
+        (c) += (d); \
+        (b) = blake2sp_ror((b) ^ (c), 7); \
+    } while (0)
+
+/**
+ * \brief Runs the BLAKE2s compression function.
+ *
+ * \param h The chaining value to update.
+ * \param m The 16 words of the message block.
+ * \param length The number of bytes hashed so far, including this block.
+ * \param f0 First finalization flag; all-ones for the last block.
+ * \param f1 Second finalization flag; all-ones for the last block of
+ * the last node at each level of the tree.
+ *
+ * The type V is either uint32_t to process a single leaf, or a vector
+ * of uint32_t to process several leaves at once with the same counter.
+ */
+template <typename V>
+static inline __attribute__((always_inline))
+void blake2sp_compress(V *h, const V *m, uint64_t length,
+                       uint32_t f0, uint32_t f1)
+{
+    V v[16];
+    uint8_t index;
+    for (index = 0; index < 8; ++index) {
+        v[index] = h[index];
+        v[index + 8] = V() + pgm_read_dword(iv + index);
+    }
+    v[12] ^= (uint32_t)length;
+    v[13] ^= (uint32_t)(length >> 32);
+    v[14] ^= f0;
+    v[15] ^= f1;
+    for (uint8_t round = 0; round < 10; ++round) {
+        // Column round.
+        blake2sp_g(v[0], v[4], v[8],  v[12], 0);
+        blake2sp_g(v[1], v[5], v[9],  v[13], 1);
+        blake2sp_g(v[2], v[6], v[10], v[14], 2);
+        blake2sp_g(v[3], v[7], v[11], v[15], 3);
+
+        // Diagonal round.
+        blake2sp_g(v[0], v[5], v[10], v[15], 4);
+        blake2sp_g(v[1], v[6], v[11], v[12], 5);
+        blake2sp_g(v[2], v[7], v[8],  v[13], 6);
+        blake2sp_g(v[3], v[4], v[9],  v[14], 7);
+    }
+    for (index = 0; index < 8; ++index)
+        h[index] ^= (v[index] ^ v[index + 8]);
+}
+
+/**
+ * \brief Loads a 64-byte block as 16 little-endian words.
+ */
+static inline void blake2sp_load(uint32_t *m, const uint8_t *data)
+{
+    memcpy(m, data, 64);
+#if !defined(CRYPTO_LITTLE_ENDIAN)
+    for (uint8_t index = 0; index < 16; ++index)
+        m[index] = le32toh(m[index]);
+#endif
+}
+
+/**
+ * \brief Compresses stripes into the leaves one leaf at a time.
+ *
+ * \param h The chaining values for the leaves, indexed by word and then leaf.
+ * \param data Points to the stripes to compress.
+ * \param count Number of stripes to compress.
+ * \param length Number of bytes that have been compressed into each
+ * leaf before the first stripe.
+ */
+static void blake2sp_stripes(uint32_t h[8][8], const uint8_t *data,
+                             size_t count, uint64_t length)
+{
+    uint32_t hl[8];
+    uint32_t m[16];
+    uint8_t leaf, index;
+    while (count > 0) {
+        length += 64;
+        for (leaf = 0; leaf < 8; ++leaf) {
+            for (index = 0; index < 8; ++index)
+                hl[index] = h[index][leaf];
+            blake2sp_load(m, data + leaf * 64);
+            blake2sp_compress<uint32_t>(hl, m, length, 0, 0);
+            for (index = 0; index < 8; ++index)
+                h[index][leaf] = hl[index];
+        }
+        data += BLAKE2sp_STRIPE;
+        --count;
+    }
+    clean(hl);
+    clean(m);
+}
+
+#if defined(CRYPTO_X86_SIMD)
+
+typedef uint32_t blake2sp_v8 __attribute__((vector_size(32)));
+
+/**
+ * \brief Compresses stripes into all 8 leaves at once using AVX2.
+ *
+ * Lane N of each vector holds the state for leaf N.  The message words
+ * for the leaves are gathered directly from the input stripe.
+ */
+CRYPTO_TARGET("avx2")
+static void blake2sp_stripes_avx2(uint32_t h[8][8], const uint8_t *data,
+                                  size_t count, uint64_t length)
+{
+    const __m256i offsets = _mm256_set_epi32(112, 96, 80, 64, 48, 32, 16, 0);
+    blake2sp_v8 hv[8];
+    blake2sp_v8 m[16];
+    uint8_t index;
+    memcpy(hv, h, sizeof(hv));
+    while (count > 0) {
+        length += 64;
+        for (index = 0; index < 16; ++index) {
+            m[index] = (blake2sp_v8)_mm256_i32gather_epi32
+                ((const int *)(data + index * 4), offsets, 4);
+        }
+        blake2sp_compress<blake2sp_v8>(hv, m, length, 0, 0);
+        data += BLAKE2sp_STRIPE;
+        --count;
+    }
+    memcpy(h, hv, sizeof(hv));
+    clean(hv);
+    clean(m);
+}
+
+#endif // CRYPTO_X86_SIMD
+
+/**
+ * \brief Compresses stripes into the leaves with the best implementation
+ * for this platform.
+ */
+static void blake2sp_process(uint32_t h[8][8], const uint8_t *data,
+                             size_t count, uint64_t length)
+{
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_AVX2)) {
+        blake2sp_stripes_avx2(h, data, count, length);
+        return;
+    }
+#endif
+    blake2sp_stripes(h, data, count, length);
+}
+
+/**
+ * \brief Constructs a BLAKE2sp hash object.
+ */
+BLAKE2sp::BLAKE2sp()
+{
+    reset();
+}
+
+/**
+ * \brief Destroys this BLAKE2sp hash object after clearing
+ * sensitive information.
+ */
+BLAKE2sp::~BLAKE2sp()
+{
+    clean(state);
+}
+
+size_t BLAKE2sp::hashSize() const
+{
+    return 32;
+}
+
+size_t BLAKE2sp::blockSize() const
+{
+    return 64;
+}
+
+void BLAKE2sp::reset()
+{
+    init(0, 32);
+}
+
+/**
+ * \brief Resets the hash ready for a new hashing process with a specified
+ * output length.
+ *
+ * \param outputLength The output length to use for the final hash in bytes,
+ * between 1 and 32.
+ */
+void BLAKE2sp::reset(uint8_t outputLength)
+{
+    init(0, outputLength);
+}
+
+/**
+ * \brief Resets the hash ready for a new hashing process with a specified
+ * key and output length.
+ *
+ * \param key Points to the key.
+ * \param keyLen The length of the key in bytes, between 0 and 32.
+ * \param outputLength The output length to use for the final hash in bytes,
+ * between 1 and 32.
+ *
+ * Key padding and parameters are the same as for BLAKE2s::reset(), except
+ * that every leaf is keyed.
+ */
+void BLAKE2sp::reset(const void *key, size_t keyLen, uint8_t outputLength)
+{
+    if (keyLen > 32)
+        keyLen = 32;
+    init(keyLen, outputLength);
+    memcpy(state.key, key, keyLen);
+}
+
+void BLAKE2sp::update(const void *data, size_t len)
+{
+    const uint8_t *d = (const uint8_t *)data;
+    while (len > 0) {
+        if (state.posn == BLAKE2sp_STRIPE && len > BLAKE2sp_HOLDBACK) {
+            // Buffered stripe is now followed by enough data to process it.
+            processStripes(state.buf, 1);
+            state.posn = 0;
+        }
+        if (state.posn == 0 && len > (BLAKE2sp_STRIPE + BLAKE2sp_HOLDBACK)) {
+            // Process as many stripes as possible directly from the input.
+            size_t count = (len - BLAKE2sp_HOLDBACK - 1) / BLAKE2sp_STRIPE;
+            processStripes(d, count);
+            d += count * BLAKE2sp_STRIPE;
+            len -= count * BLAKE2sp_STRIPE;
+            continue;
+        }
+        if (state.posn == sizeof(state.buf)) {
+            // The buffer is full, so the first stripe can be processed.
+            processStripes(state.buf, 1);
+            memcpy(state.buf, state.buf + BLAKE2sp_STRIPE,
+                   sizeof(state.buf) - BLAKE2sp_STRIPE);
+            state.posn -= BLAKE2sp_STRIPE;
+        }
+        size_t size = sizeof(state.buf) - state.posn;
+        if (size > len)
+            size = len;
+        memcpy(state.buf + state.posn, d, size);
+        state.posn += size;
+        len -= size;
+        d += size;
+    }
+}
+
+void BLAKE2sp::finalize(void *hash, size_t len)
+{
+    uint32_t h[8];
+    uint32_t m[16];
+    uint8_t block[64];
+    uint8_t leafHashes[8 * 32];
+    uint8_t leaf, index;
+
+    // Finalize each of the leaves.  A leaf has up to two blocks left in
+    // the buffer, plus the key block if it has not been processed yet.
+    // An empty leaf is finalized with a single all-zeroes block.
+    for (leaf = 0; leaf < 8; ++leaf) {
+        uint64_t length = state.length;
+        bool keyPending = (state.keyLen != 0 && length == 0);
+        uint16_t posn = leaf * 64;
+        bool last;
+        for (index = 0; index < 8; ++index)
+            h[index] = state.h[index][leaf];
+        do {
+            size_t size = 0;
+            memset(block, 0, sizeof(block));
+            if (keyPending) {
+                memcpy(block, state.key, state.keyLen);
+                size = 64;
+                keyPending = false;
+            } else if (posn < state.posn) {
+                size = state.posn - posn;
+                if (size > 64)
+                    size = 64;
+                memcpy(block, state.buf + posn, size);
+                posn += BLAKE2sp_STRIPE;
+            }
+            length += size;
+            last = (posn >= state.posn);
+            blake2sp_load(m, block);
+            if (!last) {
+                blake2sp_compress<uint32_t>(h, m, length, 0, 0);
+            } else {
+                blake2sp_compress<uint32_t>
+                    (h, m, length, 0xFFFFFFFF, leaf == 7 ? 0xFFFFFFFF : 0);
+            }
+        } while (!last);
+        for (index = 0; index < 8; ++index) {
+            uint32_t word = htole32(h[index]);
+            memcpy(leafHashes + leaf * 32 + index * 4, &word, 4);
+        }
+    }
+
+    // Hash the leaf hashes with the root node, which is the last node
+    // at its level of the tree.
+    for (index = 0; index < 8; ++index)
+        h[index] = pgm_read_dword(iv + index);
+    h[0] ^= 0x02080000 ^ (((uint32_t)state.keyLen) << 8) ^ state.outputLength;
+    h[3] ^= 0x20010000;
+    for (index = 0; index < 4; ++index) {
+        blake2sp_load(m, leafHashes + index * 64);
+        if (index < 3) {
+            blake2sp_compress<uint32_t>(h, m, (index + 1) * 64, 0, 0);
+        } else {
+            blake2sp_compress<uint32_t>
+                (h, m, (index + 1) * 64, 0xFFFFFFFF, 0xFFFFFFFF);
+        }
+    }
+
+    // Copy the hash to the caller's return buffer.
+    for (index = 0; index < 8; ++index)
+        m[index] = htole32(h[index]);
+    if (len > state.outputLength)
+        len = state.outputLength;
+    memcpy(hash, m, len);
+    clean(h);
+    clean(m);
+    clean(block);
+    clean(leafHashes);
+}
+
+void BLAKE2sp::clear()
+{
+    clean(state);
+    reset();
+}
+
+void BLAKE2sp::resetHMAC(const void *key, size_t keyLen)
+{
+    uint8_t block[64];
+    formatHMACKey(block, key, keyLen, 0x36);
+    update(block, sizeof(block));
+    clean(block);
+}
+
+void BLAKE2sp::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t hashLen)
+{
+    uint8_t block[64];
+    uint8_t temp[32];
+    finalize(temp, sizeof(temp));
+    formatHMACKey(block, key, keyLen, 0x5C);
+    update(block, sizeof(block));
+    update(temp, sizeof(temp));
+    finalize(hash, hashLen);
+    clean(block);
+    clean(temp);
+}
+
+/**
+ * \brief Initializes the leaf chaining values from the tree parameters.
+ *
+ * \param keyLen The length of the key in bytes, between 0 and 32.
+ * \param outputLength The output length in bytes, between 1 and 32.
+ */
+void BLAKE2sp::init(size_t keyLen, uint8_t outputLength)
+{
+    if (outputLength < 1)
+        outputLength = 1;
+    else if (outputLength > 32)
+        outputLength = 32;
+    for (uint8_t leaf = 0; leaf < 8; ++leaf) {
+        for (uint8_t index = 0; index < 8; ++index)
+            state.h[index][leaf] = pgm_read_dword(iv + index);
+
+        // Fanout of 8, depth of 2, leaf node at the given offset,
+        // and an inner hash length of 32.
+        state.h[0][leaf] ^= 0x02080000 ^ (keyLen << 8) ^ outputLength;
+        state.h[2][leaf] ^= leaf;
+        state.h[3][leaf] ^= 0x20000000;
+    }
+    state.length = 0;
+    state.posn = 0;
+    state.keyLen = (uint8_t)keyLen;
+    state.outputLength = outputLength;
+}
+
+/**
+ * \brief Compresses whole stripes into the leaves.
+ *
+ * \param data Points to the stripes.
+ * \param count The number of stripes.
+ */
+void BLAKE2sp::processStripes(const uint8_t *data, size_t count)
+{
+    // If the hash is keyed, then the first block of every leaf is the key.
+    if (state.keyLen != 0 && state.length == 0) {
+        uint8_t keyStripe[BLAKE2sp_STRIPE];
+        memset(keyStripe, 0, sizeof(keyStripe));
+        for (uint8_t leaf = 0; leaf < 8; ++leaf)
+            memcpy(keyStripe + leaf * 64, state.key, state.keyLen);
+        blake2sp_process(state.h, keyStripe, 1, 0);
+        state.length = 64;
+        clean(keyStripe);
+        clean(state.key);
+    }
+
+    // Compress the stripes into all of the leaves.
+    blake2sp_process(state.h, data, count, state.length);
+    state.length += count * 64;
+}
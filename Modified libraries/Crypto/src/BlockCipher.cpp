@@ -122,3 +122,46 @@ BlockCipher::~BlockCipher()
  *
  * \sa setKey(), encryptBlock(), decryptBlock()
  */
+
+/**
+ * \class StaticBlockCipher BlockCipher.h <BlockCipher.h>
+ * \brief Calls the block operations of a concrete block cipher without
+ * going through the virtual function table.
+ *
+ * The mode templates such as StaticCTR and StaticGCM wrap their cipher
+ * in this class and pass it to the same loops that CTR and GCM use with
+ * a BlockCipher pointer.  Because the calls are qualified with T, the
+ * compiler knows exactly which encryptBlock() is being called and can
+ * inline it into the loop if the definition is visible, for example
+ * with link-time optimization.
+ *
+ * The template parameter T must be the exact type of the cipher object,
+ * not a base class of it.  The mode loops are compiled into the library
+ * rather than defined in the headers, so the Static mode templates can
+ * only be used with the AES block cipher classes in this library.
+ *
+ * \sa BlockCipher
+ */
+
+/**
+ * \fn StaticBlockCipher::StaticBlockCipher(T &cipher)
+ * \brief Constructs a wrapper around a concrete block cipher.
+ *
+ * \param cipher The block cipher to wrap, which must outlive this object.
+ */
+
+/**
+ * \fn void StaticBlockCipher::encryptBlock(uint8_t *output, const uint8_t *input)
+ * \brief Encrypts a single block with T::encryptBlock().
+ *
+ * \param output The output buffer to put the ciphertext into.
+ * \param input The input buffer to read the plaintext from.
+ */
+
+/**
+ * \fn void StaticBlockCipher::decryptBlock(uint8_t *output, const uint8_t *input)
+ * \brief Decrypts a single block with T::decryptBlock().
+ *
+ * \param output The output buffer to put the plaintext into.
+ * \param input The input buffer to read the ciphertext from.
+ */
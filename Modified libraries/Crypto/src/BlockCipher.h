@@ -43,4 +43,19 @@ public:
     virtual void clear() = 0;
 };
 
+template <typename T>
+class StaticBlockCipher
+{
+public:
+    explicit StaticBlockCipher(T &cipher) : c(cipher) {}
+
+    void encryptBlock(uint8_t *output, const uint8_t *input)
+        { c.T::encryptBlock(output, input); }
+    void decryptBlock(uint8_t *output, const uint8_t *input)
+        { c.T::decryptBlock(output, input); }
+
+private:
+    T &c;
+};
+
 #endif
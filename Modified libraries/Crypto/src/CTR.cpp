@@ -22,6 +22,8 @@
 
 #include "CTR.h"
 #include "Crypto.h"
+#include "AES.h"
+#include "utility/StaticUtil.h"
 #include <string.h>
 
 /**
@@ -126,11 +128,55 @@ bool CTRCommon::setIV(const uint8_t *iv, size_t len)
 }
 
 void CTRCommon::encrypt(uint8_t *output, const uint8_t *input, size_t len)
+{
+    encryptWith(*blockCipher, output, input, len);
+}
+
+void CTRCommon::decrypt(uint8_t *output, const uint8_t *input, size_t len)
+{
+    encrypt(output, input, len);
+}
+
+void CTRCommon::clear()
+{
+    blockCipher->clear();
+    clean(counter);
+    clean(state);
+    posn = 16;
+}
+
+/**
+ * \fn void CTRCommon::setBlockCipher(BlockCipher *cipher)
+ * \brief Sets the block cipher to use for this CTR object.
+ *
+ * \param cipher The block cipher to use to implement CTR mode,
+ * which must have a block size of 16 bytes (128 bits).
+ *
+ * \note This class only works with block ciphers whose block size is
+ * 16 bytes (128 bits).  If the \a cipher has a different block size,
+ * then setKey() will fail and return false.
+ */
+
+/**
+ * \brief Encrypts or decrypts data using a specific block cipher object.
+ *
+ * \param cipher The block cipher to use, which is either the BlockCipher
+ * that was passed to setBlockCipher() or a StaticBlockCipher wrapper
+ * around the same object.
+ * \param output The output buffer to write to.
+ * \param input The input buffer to read from.
+ * \param len The number of bytes to process.
+ *
+ * This is the implementation of encrypt().  It is a template so that
+ * StaticCTR can instantiate it on the concrete block cipher type.
+ */
+template <typename B>
+void CTRCommon::encryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
 {
     while (len > 0) {
         if (posn >= 16) {
             // Generate a new encrypted counter block.
-            blockCipher->encryptBlock(state, counter);
+            cipher.encryptBlock(state, counter);
             posn = 0;
 
             // Increment the counter, taking care not to reveal
@@ -157,30 +203,12 @@ void CTRCommon::encrypt(uint8_t *output, const uint8_t *input, size_t len)
     }
 }
 
-void CTRCommon::decrypt(uint8_t *output, const uint8_t *input, size_t len)
-{
-    encrypt(output, input, len);
-}
-
-void CTRCommon::clear()
-{
-    blockCipher->clear();
-    clean(counter);
-    clean(state);
-    posn = 16;
-}
-
-/**
- * \fn void CTRCommon::setBlockCipher(BlockCipher *cipher)
- * \brief Sets the block cipher to use for this CTR object.
- *
- * \param cipher The block cipher to use to implement CTR mode,
- * which must have a block size of 16 bytes (128 bits).
- *
- * \note This class only works with block ciphers whose block size is
- * 16 bytes (128 bits).  If the \a cipher has a different block size,
- * then setKey() will fail and return false.
- */
+// Instantiate the loops for the Static templates on the algorithms
+// that are listed in utility/StaticUtil.h.
+#define CTR_STATIC(T) \
+    template void CTRCommon::encryptWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *, size_t);
+CRYPTO_STATIC_BLOCK_CIPHERS(CTR_STATIC)
 
 /**
  * \class CTR CTR.h <CTR.h>
@@ -218,3 +246,32 @@ void CTRCommon::clear()
  * \fn CTR::CTR()
  * \brief Constructs a new CTR object for the 128-bit block cipher T.
  */
+
+/**
+ * \class StaticCTR CTR.h <CTR.h>
+ * \brief Implementation of the Counter (CTR) mode that is specialized
+ * on a concrete 128-bit block cipher.
+ *
+ * This class behaves the same as CTR and can still be used through a
+ * Cipher pointer.  The difference is that encrypt() and decrypt() call
+ * T::encryptBlock() directly for each block instead of through the
+ * BlockCipher virtual function table, which allows the compiler to
+ * inline the block cipher into the counter mode loop.  The cost is a
+ * separate copy of the loop for every cipher type that is used, so
+ * memory-constrained applications may prefer CTR.  T must be one of the
+ * AES classes; see StaticBlockCipher.
+ *
+ * \code
+ * StaticCTR<AES256> ctr;
+ * ctr.setKey(key, 32);
+ * ctr.setIV(iv, 16);
+ * ctr.encrypt(output, input, len);
+ * \endcode
+ *
+ * \sa CTR, StaticBlockCipher
+ */
+
+/**
+ * \fn StaticCTR::StaticCTR()
+ * \brief Constructs a new CTR object for the 128-bit block cipher T.
+ */
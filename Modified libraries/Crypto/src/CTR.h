@@ -48,6 +48,9 @@ protected:
     CTRCommon();
     void setBlockCipher(BlockCipher *cipher) { blockCipher = cipher; }
 
+    template <typename B>
+    void encryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
+
 private:
     BlockCipher *blockCipher;
     uint8_t counter[16];
@@ -66,4 +69,25 @@ private:
     T cipher;
 };
 
+template <typename T>
+class StaticCTR : public CTRCommon
+{
+public:
+    StaticCTR() { setBlockCipher(&cipher); }
+
+    void encrypt(uint8_t *output, const uint8_t *input, size_t len)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        encryptWith(direct, output, input, len);
+    }
+    void decrypt(uint8_t *output, const uint8_t *input, size_t len)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        encryptWith(direct, output, input, len);
+    }
+
+private:
+    T cipher;
+};
+
 #endif
@@ -21,6 +21,26 @@
  */
 
 #include "Crypto.h"
+#include "utility/CpuUtil.h"
+#include "utility/CRCTables.h"
+#include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <cpuid.h>
+#include <immintrin.h>
+#endif
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#endif
+
+// glibc 2.25 and later have explicit_bzero(), which is guaranteed not
+// to be optimized away.  Elsewhere we use memset() followed by a compiler
+// barrier if the compiler supports inline assembly, or a volatile loop.
+#if defined(__GLIBC__) && \
+        (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 25))
+#define CRYPTO_EXPLICIT_BZERO 1
+#elif defined(__GNUC__)
+#define CRYPTO_MEMSET_BARRIER 1
+#endif
 
 /**
  * \brief Cleans a block of bytes.
@@ -33,14 +53,35 @@
  */
 void clean(void *dest, size_t size)
 {
+#if defined(CRYPTO_EXPLICIT_BZERO)
+    explicit_bzero(dest, size);
+#elif defined(CRYPTO_MEMSET_BARRIER)
+    // The empty assembly statement tells the compiler that the contents
+    // of "dest" may be read afterwards, so the memset() cannot be removed
+    // even with link-time optimization.
+    memset(dest, 0, size);
+    __asm__ __volatile__ ("" : : "r"(dest) : "memory");
+#else
     // Force the use of volatile so that we actually clear the memory.
     // Otherwise the compiler might optimise the entire contents of this
-    // function away, which will not be secure.
+    // function away, which will not be secure.  Clear a word at a time
+    // once the destination is aligned.
     volatile uint8_t *d = (volatile uint8_t *)dest;
+    while (size > 0 && (((uintptr_t)d) % sizeof(size_t)) != 0) {
+        *d++ = 0;
+        --size;
+    }
+    volatile size_t *w = (volatile size_t *)d;
+    while (size >= sizeof(size_t)) {
+        *w++ = 0;
+        size -= sizeof(size_t);
+    }
+    d = (volatile uint8_t *)w;
     while (size > 0) {
         *d++ = 0;
         --size;
     }
+#endif
 }
 
 /**
@@ -68,14 +109,56 @@ void clean(void *dest, size_t size)
  */
 bool secure_compare(const void *data1, const void *data2, size_t len)
 {
-    uint8_t result = 0;
     const uint8_t *d1 = (const uint8_t *)data1;
     const uint8_t *d2 = (const uint8_t *)data2;
+#if defined(__AVR__)
+    uint8_t result = 0;
+#else
+    // Accumulate the differences a vector or word at a time.  The empty
+    // assembly statements hide the accumulator from the optimizer so that
+    // it cannot turn the loops into an early exit on the first difference.
+    size_t result = 0;
+#if defined(__SSE2__)
+    __m128i diff = _mm_setzero_si128();
+    while (len >= 16) {
+        __m128i a = _mm_loadu_si128((const __m128i *)d1);
+        __m128i b = _mm_loadu_si128((const __m128i *)d2);
+        diff = _mm_or_si128(diff, _mm_xor_si128(a, b));
+        __asm__ ("" : "+x"(diff));
+        d1 += 16;
+        d2 += 16;
+        len -= 16;
+    }
+    diff = _mm_or_si128(diff, _mm_srli_si128(diff, 8));
+#if defined(__x86_64__)
+    result = (size_t)_mm_cvtsi128_si64(diff);
+#else
+    result = (size_t)_mm_cvtsi128_si32(_mm_or_si128(diff, _mm_srli_si128(diff, 4)));
+#endif
+#endif
+    while (len >= sizeof(size_t)) {
+        size_t a, b;
+        memcpy(&a, d1, sizeof(size_t));
+        memcpy(&b, d2, sizeof(size_t));
+        result |= a ^ b;
+#if defined(__GNUC__)
+        __asm__ ("" : "+r"(result));
+#endif
+        d1 += sizeof(size_t);
+        d2 += sizeof(size_t);
+        len -= sizeof(size_t);
+    }
+#endif
     while (len > 0) {
         result |= (*d1++ ^ *d2++);
         --len;
     }
+#if defined(__AVR__)
     return (bool)((((uint16_t)0x0100) - result) >> 8);
+#else
+    // The top bit of (result - 1) & ~result is set only if result is zero.
+    return (bool)(((result - 1) & ~result) >> (sizeof(size_t) * 8 - 1));
+#endif
 }
 
 /**
@@ -91,24 +174,275 @@ bool secure_compare(const void *data1, const void *data2, size_t len)
  * If the CRC-8 check fails, then it is assumed that the EEPROM/Flash
  * contents are invalid and should be re-initialized.
  *
+ * The polynomial is 0x1D and the initial value is 0xFF XOR \a tag.
+ * Because the tag is folded into the initial value, a calculation is
+ * continued over more data with crypto_crc8_update() rather than by
+ * passing the previous return value back in as \a tag.
+ *
  * Reference: http://www.sunshine2k.de/articles/coding/crc/understanding_crc.html#ch4
+ *
+ * \sa crypto_crc8_update(), crypto_crc16_ccitt(), crypto_crc32c()
  */
 uint8_t crypto_crc8(uint8_t tag, const void *data, unsigned size)
+{
+    return crypto_crc8_update(0xFF ^ tag, data, size);
+}
+
+/**
+ * \brief Continues a CRC-8 calculation over an array in memory.
+ *
+ * \param crc The starting value, which should be 0xFF for a new
+ * calculation or the return value from a previous call to continue it.
+ * \param data The data to checksum.
+ * \param size The number of bytes to checksum.
+ * \return The CRC-8 value over the data.
+ *
+ * This takes its starting value in the same way as crypto_crc16_ccitt()
+ * and crypto_crc32c().  The result of crypto_crc8() with a \a tag is the
+ * same as starting this function from 0xFF XOR \a tag.
+ *
+ * \sa crypto_crc8()
+ */
+uint8_t crypto_crc8_update(uint8_t crc, const void *data, size_t size)
 {
     const uint8_t *d = (const uint8_t *)data;
-    uint8_t crc = 0xFF ^ tag;
-    uint8_t bit;
+#if defined(__AVR__)
+    // Shift the register 4 bits at a time using a 16-entry table.
     while (size > 0) {
         crc ^= *d++;
-        for (bit = 0; bit < 8; ++bit) {
-            // if (crc & 0x80)
-            //     crc = (crc << 1) ^ 0x1D;
-            // else
-            //     crc = (crc << 1);
-            uint8_t generator = (uint8_t)((((int8_t)crc) >> 7) & 0x1D);
-            crc = (crc << 1) ^ generator;
-        }
+        crc = (uint8_t)(crc << 4) ^ pgm_read_byte(&(crc8_nibble[crc >> 4]));
+        crc = (uint8_t)(crc << 4) ^ pgm_read_byte(&(crc8_nibble[crc >> 4]));
+        --size;
+    }
+#else
+    // Process 8 bytes at a time with independent table lookups.
+    while (size >= 8) {
+        crc = pgm_read_byte(&(crc8_slice[7][crc ^ d[0]])) ^
+              pgm_read_byte(&(crc8_slice[6][d[1]])) ^
+              pgm_read_byte(&(crc8_slice[5][d[2]])) ^
+              pgm_read_byte(&(crc8_slice[4][d[3]])) ^
+              pgm_read_byte(&(crc8_slice[3][d[4]])) ^
+              pgm_read_byte(&(crc8_slice[2][d[5]])) ^
+              pgm_read_byte(&(crc8_slice[1][d[6]])) ^
+              pgm_read_byte(&(crc8_slice[0][d[7]]));
+        d += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        crc = pgm_read_byte(&(crc8_slice[0][crc ^ *d++]));
+        --size;
+    }
+#endif
+    return crc;
+}
+
+/**
+ * \brief Calculates the CRC-16-CCITT value over an array in memory.
+ *
+ * \param crc The starting value, which should be 0xFFFF for a new
+ * calculation or the return value from a previous call to continue it.
+ * \param data The data to checksum.
+ * \param size The number of bytes to checksum.
+ * \return The CRC-16 value over the data.
+ *
+ * The polynomial is 0x1021, the bits are processed most significant first,
+ * and there is no final XOR.  With a starting value of 0xFFFF this is the
+ * variant also known as CRC-16/CCITT-FALSE, for which the check value
+ * over the ASCII string "123456789" is 0x29B1.
+ *
+ * This function does not provide any real security.  It is intended for
+ * detecting accidental corruption of frames and stored records.
+ *
+ * \sa crypto_crc8(), crypto_crc32c()
+ */
+uint16_t crypto_crc16_ccitt(uint16_t crc, const void *data, size_t size)
+{
+    const uint8_t *d = (const uint8_t *)data;
+#if defined(__AVR__)
+    while (size > 0) {
+        crc ^= ((uint16_t)(*d++)) << 8;
+        crc = (crc << 4) ^ pgm_read_word(&(crc16_nibble[crc >> 12]));
+        crc = (crc << 4) ^ pgm_read_word(&(crc16_nibble[crc >> 12]));
+        --size;
+    }
+#else
+    while (size >= 8) {
+        crc = pgm_read_word(&(crc16_slice[7][(crc >> 8) ^ d[0]])) ^
+              pgm_read_word(&(crc16_slice[6][(crc & 0xFF) ^ d[1]])) ^
+              pgm_read_word(&(crc16_slice[5][d[2]])) ^
+              pgm_read_word(&(crc16_slice[4][d[3]])) ^
+              pgm_read_word(&(crc16_slice[3][d[4]])) ^
+              pgm_read_word(&(crc16_slice[2][d[5]])) ^
+              pgm_read_word(&(crc16_slice[1][d[6]])) ^
+              pgm_read_word(&(crc16_slice[0][d[7]]));
+        d += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        crc = (crc << 8) ^ pgm_read_word(&(crc16_slice[0][(crc >> 8) ^ *d++]));
+        --size;
+    }
+#endif
+    return crc;
+}
+
+#if defined(CRYPTO_X86_SIMD)
+
+/**
+ * \brief Continues a CRC-32C calculation with the SSE4.2 crc32 instruction.
+ *
+ * \param crc The current value of the CRC register.
+ * \param d The data to checksum.
+ * \param size The number of bytes to checksum.
+ * \return The new value of the CRC register.
+ */
+CRYPTO_TARGET("sse4.2")
+static uint32_t crypto_crc32c_sse42(uint32_t crc, const uint8_t *d, size_t size)
+{
+#if defined(__x86_64__)
+    while (size >= 8) {
+        uint64_t word;
+        memcpy(&word, d, sizeof(word));
+        crc = (uint32_t)_mm_crc32_u64(crc, word);
+        d += 8;
+        size -= 8;
+    }
+#endif
+    while (size >= 4) {
+        uint32_t word;
+        memcpy(&word, d, sizeof(word));
+        crc = _mm_crc32_u32(crc, word);
+        d += 4;
+        size -= 4;
+    }
+    while (size > 0) {
+        crc = _mm_crc32_u8(crc, *d++);
         --size;
     }
     return crc;
 }
+
+#endif // CRYPTO_X86_SIMD
+
+/**
+ * \brief Calculates the CRC-32C (Castagnoli) value over an array in memory.
+ *
+ * \param crc The starting value, which should be zero for a new
+ * calculation or the return value from a previous call to continue it.
+ * \param data The data to checksum.
+ * \param size The number of bytes to checksum.
+ * \return The CRC-32C value over the data.
+ *
+ * The polynomial is 0x1EDC6F41 and the bits are processed least
+ * significant first.  The register is inverted on entry and exit, so
+ * a starting value of zero gives the standard CRC-32C, for which the
+ * check value over the ASCII string "123456789" is 0xE3069283.
+ *
+ * On x86 hosts that support SSE4.2, the CPU's crc32 instruction is used.
+ *
+ * This function does not provide any real security.  It is intended for
+ * detecting accidental corruption of frames and stored records.
+ *
+ * \sa crypto_crc8(), crypto_crc16_ccitt()
+ */
+uint32_t crypto_crc32c(uint32_t crc, const void *data, size_t size)
+{
+    const uint8_t *d = (const uint8_t *)data;
+    crc = ~crc;
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_SSE42))
+        return ~crypto_crc32c_sse42(crc, d, size);
+#endif
+#if defined(__AVR__)
+    while (size > 0) {
+        crc ^= *d++;
+        crc = (crc >> 4) ^ pgm_read_dword(&(crc32c_nibble[crc & 0x0F]));
+        crc = (crc >> 4) ^ pgm_read_dword(&(crc32c_nibble[crc & 0x0F]));
+        --size;
+    }
+#else
+    while (size >= 8) {
+        uint32_t one = crc ^ (((uint32_t)(d[0])) |
+                              (((uint32_t)(d[1])) << 8) |
+                              (((uint32_t)(d[2])) << 16) |
+                              (((uint32_t)(d[3])) << 24));
+        crc = pgm_read_dword(&(crc32c_slice[7][one & 0xFF])) ^
+              pgm_read_dword(&(crc32c_slice[6][(one >> 8) & 0xFF])) ^
+              pgm_read_dword(&(crc32c_slice[5][(one >> 16) & 0xFF])) ^
+              pgm_read_dword(&(crc32c_slice[4][one >> 24])) ^
+              pgm_read_dword(&(crc32c_slice[3][d[4]])) ^
+              pgm_read_dword(&(crc32c_slice[2][d[5]])) ^
+              pgm_read_dword(&(crc32c_slice[1][d[6]])) ^
+              pgm_read_dword(&(crc32c_slice[0][d[7]]));
+        d += 8;
+        size -= 8;
+    }
+    while (size > 0) {
+        crc = (crc >> 8) ^ pgm_read_dword(&(crc32c_slice[0][(crc ^ *d++) & 0xFF]));
+        --size;
+    }
+#endif
+    return ~crc;
+}
+
+#if defined(CRYPTO_X86_SIMD)
+
+/**
+ * \brief Determines the instruction set extensions that are supported
+ * by the host CPU and operating system.
+ *
+ * \return A bitmask of CRYPTO_CPU_* feature flags.
+ *
+ * The CPUID instruction is only queried the first time this function
+ * is called.  Subsequent calls return the cached value.  The AVX, AVX2,
+ * and AVX-512 flags are only reported if the operating system has
+ * enabled saving of the wider register state on context switches.
+ */
+uint32_t crypto_cpu_features()
+{
+    static volatile uint32_t cached = 0;
+    uint32_t features = cached;
+    if (features)
+        return features;
+
+    unsigned eax, ebx, ecx, edx;
+    unsigned maxLeaf = __get_cpuid_max(0, 0);
+    uint64_t xcr0 = 0;
+    features = 0x80000000U; // Marks the cached value as initialized.
+    if (maxLeaf >= 1) {
+        __cpuid(1, eax, ebx, ecx, edx);
+        if (ecx & (1U << 9))
+            features |= CRYPTO_CPU_SSSE3;
+        if (ecx & (1U << 19))
+            features |= CRYPTO_CPU_SSE41;
+        if (ecx & (1U << 20))
+            features |= CRYPTO_CPU_SSE42;
+        if (ecx & (1U << 27)) {
+            // OSXSAVE is set, so we can query XCR0 for the enabled state.
+            unsigned lo, hi;
+            __asm__ __volatile__ ("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+            xcr0 = (((uint64_t)hi) << 32) | lo;
+        }
+        if ((ecx & (1U << 28)) && (xcr0 & 0x06) == 0x06)
+            features |= CRYPTO_CPU_AVX;
+    }
+    if (maxLeaf >= 7) {
+        __cpuid_count(7, 0, eax, ebx, ecx, edx);
+        if ((ebx & (1U << 5)) && (features & CRYPTO_CPU_AVX))
+            features |= CRYPTO_CPU_AVX2;
+        if ((ebx & (1U << 16)) && (xcr0 & 0xE6) == 0xE6)
+            features |= CRYPTO_CPU_AVX512F;
+        if ((ebx & (1U << 31)) && (features & CRYPTO_CPU_AVX512F))
+            features |= CRYPTO_CPU_AVX512VL;
+        if (ebx & (1U << 29))
+            features |= CRYPTO_CPU_SHA;
+        if (ebx & (1U << 8))
+            features |= CRYPTO_CPU_BMI2;
+        if (ebx & (1U << 19))
+            features |= CRYPTO_CPU_ADX;
+    }
+    cached = features;
+    return features;
+}
+
+#endif // CRYPTO_X86_SIMD
@@ -36,6 +36,11 @@ inline void clean(T &var)
 
 bool secure_compare(const void *data1, const void *data2, size_t len);
 
+uint8_t crypto_crc8(uint8_t tag, const void *data, unsigned size);
+uint8_t crypto_crc8_update(uint8_t crc, const void *data, size_t size);
+uint16_t crypto_crc16_ccitt(uint16_t crc, const void *data, size_t size);
+uint32_t crypto_crc32c(uint32_t crc, const void *data, size_t size);
+
 #if defined(ESP8266)
 extern "C" void system_soft_wdt_feed(void);
 #define crypto_feed_watchdog() system_soft_wdt_feed()
@@ -21,11 +21,18 @@
  */
 
 #include "Curve25519.h"
+#include "Ed25519.h"
 #include "Crypto.h"
 #include "RNG.h"
 #include "utility/LimbUtil.h"
 #include <string.h>
 
+// Batched operations process up to 16 values at a time, which needs
+// more stack space than AVR devices can spare.
+#if !defined(__AVR__)
+#define CURVE25519_BATCH_SIZE 16
+#endif
+
 /**
  * \class Curve25519 Curve25519.h <Curve25519.h>
  * \brief Diffie-Hellman key agreement based on the elliptic curve
@@ -79,123 +86,30 @@
  */
 bool Curve25519::eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[32])
 {
-    limb_t x_1[NUM_LIMBS_256BIT];
-    limb_t x_2[NUM_LIMBS_256BIT];
-    limb_t x_3[NUM_LIMBS_256BIT];
-    limb_t z_2[NUM_LIMBS_256BIT];
-    limb_t z_3[NUM_LIMBS_256BIT];
-    limb_t A[NUM_LIMBS_256BIT];
-    limb_t B[NUM_LIMBS_256BIT];
-    limb_t C[NUM_LIMBS_256BIT];
-    limb_t D[NUM_LIMBS_256BIT];
-    limb_t E[NUM_LIMBS_256BIT];
-    limb_t AA[NUM_LIMBS_256BIT];
-    limb_t BB[NUM_LIMBS_256BIT];
-    limb_t DA[NUM_LIMBS_256BIT];
-    limb_t CB[NUM_LIMBS_256BIT];
-    uint8_t mask;
-    uint8_t sposn;
-    uint8_t select;
-    uint8_t swap;
+    Ladder ladder;
+    limb_t zinv[NUM_LIMBS_FIELD25519];
     bool retval;
 
-    // Unpack the "x" argument into the limb representation
-    // which also masks off the high bit.  NULL means 9.
-    if (x) {
-        // x1 = x
-        BigNumberUtil::unpackLE(x_1, NUM_LIMBS_256BIT, x, 32);
-        x_1[NUM_LIMBS_256BIT - 1] &= ((((limb_t)1) << (LIMB_BITS - 1)) - 1);
-    } else {
-        memset(x_1, 0, sizeof(x_1));    // x_1 = 9
-        x_1[0] = 9;
-    }
-
-    // Check that "x" is within the range of the modulo field.
-    // We can do this with a reduction - if there was no borrow
-    // then the value of "x" was out of range.  Timing is sensitive
-    // here so that we don't reveal anything about the value of "x".
-    // If there was a reduction, then continue executing the rest
-    // of this function with the (now) in-range "x" value and
-    // report the failure at the end.
-    retval = (bool)(reduceQuick(x_1) & 0x01);
-
-    // Initialize the other temporary variables.
-    memset(x_2, 0, sizeof(x_2));        // x_2 = 1
-    x_2[0] = 1;
-    memset(z_2, 0, sizeof(z_2));        // z_2 = 0
-    memcpy(x_3, x_1, sizeof(x_1));      // x_3 = x
-    memcpy(z_3, x_2, sizeof(x_2));      // z_3 = 1
+    // Initialize the ladder and check "x".
+    retval = (bool)(ladderInit(ladder, x) & 0x01);
 
     // Iterate over all 255 bits of "s" from the highest to the lowest.
     // We ignore the high bit of the 256-bit representation of "s".
-    mask = 0x40;
-    sposn = 31;
-    swap = 0;
-    for (uint8_t t = 255; t > 0; --t) {
-        // Conditional swaps on entry to this bit but only if we
-        // didn't swap on the previous bit.
-        select = s[sposn] & mask;
-        swap ^= select;
-        cswap(swap, x_2, x_3);
-        cswap(swap, z_2, z_3);
-
-        // Evaluate the curve.
-        add(A, x_2, z_2);               // A = x_2 + z_2
-        square(AA, A);                  // AA = A^2
-        sub(B, x_2, z_2);               // B = x_2 - z_2
-        square(BB, B);                  // BB = B^2
-        sub(E, AA, BB);                 // E = AA - BB
-        add(C, x_3, z_3);               // C = x_3 + z_3
-        sub(D, x_3, z_3);               // D = x_3 - z_3
-        mul(DA, D, A);                  // DA = D * A
-        mul(CB, C, B);                  // CB = C * B
-        add(x_3, DA, CB);               // x_3 = (DA + CB)^2
-        square(x_3, x_3);
-        sub(z_3, DA, CB);               // z_3 = x_1 * (DA - CB)^2
-        square(z_3, z_3);
-        mul(z_3, z_3, x_1);
-        mul(x_2, AA, BB);               // x_2 = AA * BB
-        mulA24(z_2, E);                 // z_2 = E * (AA + a24 * E)
-        add(z_2, z_2, AA);
-        mul(z_2, z_2, E);
-
-        // Move onto the next lower bit of "s".
-        mask >>= 1;
-        if (!mask) {
-            --sposn;
-            mask = 0x80;
-            swap = select << 7;
-        } else {
-            swap = select >> 1;
-        }
-    }
-
-    // Final conditional swaps.
-    cswap(swap, x_2, x_3);
-    cswap(swap, z_2, z_3);
+    for (uint8_t bit = 255; bit-- > 0; )
+        ladderStep(ladder, s, bit);
+    ladderFinish(ladder);
 
     // Compute x_2 * (z_2 ^ (p - 2)) where p = 2^255 - 19.
-    recip(z_3, z_2);
-    mul(x_2, x_2, z_3);
+    fieldRecip(zinv, ladder.z_2);
+    fieldMul(ladder.x_2, ladder.x_2, zinv);
 
     // Pack the result into the return array.
-    BigNumberUtil::packLE(result, 32, x_2, NUM_LIMBS_256BIT);
+    fieldPack(ladder.x_2, ladder.x_2);
+    BigNumberUtil::packLE(result, 32, ladder.x_2, NUM_LIMBS_256BIT);
 
     // Clean up and exit.
-    clean(x_1);
-    clean(x_2);
-    clean(x_3);
-    clean(z_2);
-    clean(z_3);
-    clean(A);
-    clean(B);
-    clean(C);
-    clean(D);
-    clean(E);
-    clean(AA);
-    clean(BB);
-    clean(DA);
-    clean(CB);
+    clean(ladder);
+    clean(zinv);
     return retval;
 }
 
@@ -254,10 +168,15 @@ void Curve25519::dh1(uint8_t k[32], uint8_t f[32])
         f[31] = (f[31] & 0x7F) | 0x40;
 
         // Evaluate the curve function: k = Curve25519::eval(f, 9).
+#if defined(ED25519_FIXED_BASE)
+        // Use the fixed-base tables for the Edwards form of the curve.
+        evalBase(k, f);
+#else
         // We pass NULL to eval() to indicate the value 9.  There is no
         // need to check the return value from eval() because we know
         // that 9 is a valid field element.
         eval(k, f, 0);
+#endif
 
         // If "k" is weak for contributory behaviour then reject it,
         // generate another "f" value, and try again.  This case is
@@ -265,6 +184,82 @@ void Curve25519::dh1(uint8_t k[32], uint8_t f[32])
     } while (isWeakPoint(k));
 }
 
+/**
+ * \brief Performs phase 1 of several Diffie-Hellman key exchanges at once.
+ *
+ * \param k The key values to send to the other parties.
+ * \param f The generated secret values for this party.
+ * \param count The number of key exchanges to start.
+ *
+ * This is equivalent to calling dh1() \a count times, but it is faster
+ * because the final field inversion that converts each \a k value into
+ * its affine form is shared between groups of up to 16 keys.
+ *
+ * \sa dh1(), dh2()
+ */
+void Curve25519::dh1Batch(uint8_t k[][32], uint8_t f[][32], size_t count)
+{
+#if defined(ED25519_FIXED_BASE)
+    limb_t x[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    limb_t z[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    limb_t prod[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    limb_t inv[NUM_LIMBS_FIELD25519];
+    limb_t zinv[NUM_LIMBS_FIELD25519];
+    size_t posn, n, index;
+
+    for (posn = 0; posn < count; posn += n) {
+        n = count - posn;
+        if (n > CURVE25519_BATCH_SIZE)
+            n = CURVE25519_BATCH_SIZE;
+
+        // Generate the "f" values and compute the projective "k" values,
+        // and the running products of the denominators.
+        for (index = 0; index < n; ++index) {
+            RNG.rand(f[posn + index], 32);
+            f[posn + index][0] &= 0xF8;
+            f[posn + index][31] = (f[posn + index][31] & 0x7F) | 0x40;
+            mulBase(x[index], z[index], f[posn + index]);
+            if (index > 0)
+                fieldMul(prod[index], prod[index - 1], z[index]);
+            else
+                memcpy(prod[0], z[0], sizeof(prod[0]));
+        }
+
+        // Invert the product of the denominators and then walk backwards
+        // to recover the inverse of each denominator (Montgomery's trick).
+        fieldRecip(inv, prod[n - 1]);
+        for (index = n; index-- > 0; ) {
+            if (index > 0) {
+                fieldMul(zinv, inv, prod[index - 1]);
+                fieldMul(inv, inv, z[index]);
+            } else {
+                memcpy(zinv, inv, sizeof(zinv));
+            }
+            fieldMul(x[index], x[index], zinv);
+            fieldPack(x[index], x[index]);
+            BigNumberUtil::packLE(k[posn + index], 32, x[index], NUM_LIMBS_256BIT);
+        }
+
+        // Generate new values for any weak "k" values.  This case is
+        // highly unlikely but we still perform the check just in case.
+        for (index = 0; index < n; ++index) {
+            if (isWeakPoint(k[posn + index]))
+                dh1(k[posn + index], f[posn + index]);
+        }
+    }
+
+    // Clean up.
+    clean(x);
+    clean(z);
+    clean(prod);
+    clean(inv);
+    clean(zinv);
+#else
+    for (size_t posn = 0; posn < count; ++posn)
+        dh1(k[posn], f[posn]);
+#endif
+}
+
 /**
  * \brief Performs phase 2 of a Diffie-Hellman key exchange using Curve25519.
  *
@@ -297,6 +292,123 @@ bool Curve25519::dh2(uint8_t k[32], uint8_t f[32])
     return (bool)((weak ^ 0x01) & 0x01);
 }
 
+/**
+ * \brief Performs phase 2 of several Diffie-Hellman key exchanges at once.
+ *
+ * \param k On entry, the values that were received from the other parties.
+ * On exit, the shared secrets.
+ * \param f The secret values for this party that were generated by dh1()
+ * or dh1Batch().  The values will be destroyed by this function.
+ * \param count The number of key exchanges to complete.
+ * \param results Array of \a count entries that is set to the result of
+ * each key exchange, or NULL if only the overall result is needed.
+ *
+ * \return Returns true if all of the key exchanges succeeded, or false
+ * if at least one of the \a k values was invalid.
+ *
+ * This is equivalent to calling dh2() \a count times, but it is faster
+ * because the ladders for up to 16 exchanges are evaluated together and
+ * the final field inversion is shared between them.  Each ladder still
+ * takes the same amount of time irrespective of its inputs.
+ *
+ * \sa dh2(), dh1Batch()
+ */
+bool Curve25519::dh2Batch(uint8_t k[][32], uint8_t f[][32], size_t count,
+                          bool *results)
+{
+    bool result = true;
+#if defined(CURVE25519_BATCH_SIZE)
+    Ladder ladders[CURVE25519_BATCH_SIZE];
+    limb_t prod[CURVE25519_BATCH_SIZE][NUM_LIMBS_FIELD25519];
+    uint8_t weak[CURVE25519_BATCH_SIZE];
+    limb_t inv[NUM_LIMBS_FIELD25519];
+    limb_t zinv[NUM_LIMBS_FIELD25519];
+    size_t posn, n, index;
+    uint8_t bit;
+
+    for (posn = 0; posn < count; posn += n) {
+        n = count - posn;
+        if (n > CURVE25519_BATCH_SIZE)
+            n = CURVE25519_BATCH_SIZE;
+
+        // Check if "k" is weak before the curve evaluation and initialize
+        // the ladders.  The ladders are evaluated together one bit at a time,
+        // two at a time with interleaved field operations.
+        for (index = 0; index < n; ++index) {
+            weak[index] = isWeakPoint(k[posn + index]);
+            weak[index] |= ((ladderInit(ladders[index], k[posn + index]) ^ 0x01) & 0x01);
+        }
+        for (bit = 255; bit-- > 0; ) {
+            for (index = 0; (index + 1) < n; index += 2) {
+                ladderStep2(ladders[index], ladders[index + 1],
+                            f[posn + index], f[posn + index + 1], bit);
+            }
+            if (index < n)
+                ladderStep(ladders[index], f[posn + index], bit);
+        }
+
+        // Normalize the results with a single inversion (Montgomery's trick).
+        // If z_2 is zero, then the result is zero.  Replace z_2 with 1 and
+        // x_2 with 0 in that case so that the product is not spoiled.
+        for (index = 0; index < n; ++index) {
+            Ladder &ladder = ladders[index];
+            limb_t check;
+            ladderFinish(ladder);
+            fieldPack(inv, ladder.z_2);
+            check = 0;
+            for (uint8_t limb = 0; limb < NUM_LIMBS_256BIT; ++limb)
+                check |= inv[limb];
+            check = (limb_t)(((((dlimb_t)1) << LIMB_BITS) - check) >> LIMB_BITS);
+            memset(inv, 0, sizeof(inv));
+            fieldCmove(check, ladder.x_2, inv);
+            inv[0] = 1;
+            fieldCmove(check, ladder.z_2, inv);
+            if (index > 0)
+                fieldMul(prod[index], prod[index - 1], ladder.z_2);
+            else
+                memcpy(prod[0], ladder.z_2, sizeof(prod[0]));
+        }
+        fieldRecip(inv, prod[n - 1]);
+        for (index = n; index-- > 0; ) {
+            Ladder &ladder = ladders[index];
+            if (index > 0) {
+                fieldMul(zinv, inv, prod[index - 1]);
+                fieldMul(inv, inv, ladder.z_2);
+            } else {
+                memcpy(zinv, inv, sizeof(zinv));
+            }
+            fieldMul(ladder.x_2, ladder.x_2, zinv);
+            fieldPack(ladder.x_2, ladder.x_2);
+            BigNumberUtil::packLE(k[posn + index], 32, ladder.x_2, NUM_LIMBS_256BIT);
+        }
+
+        // Check if "k" is weak after the curve evaluation.
+        for (index = 0; index < n; ++index) {
+            weak[index] |= isWeakPoint(k[posn + index]);
+            clean(f[posn + index], 32);
+            if (results)
+                results[posn + index] = (bool)((weak[index] ^ 0x01) & 0x01);
+            result &= (bool)((weak[index] ^ 0x01) & 0x01);
+        }
+    }
+
+    // Clean up.
+    clean(ladders);
+    clean(prod);
+    clean(inv);
+    clean(zinv);
+#else
+    bool ok;
+    for (size_t posn = 0; posn < count; ++posn) {
+        ok = dh2(k[posn], f[posn]);
+        if (results)
+            results[posn] = ok;
+        result &= ok;
+    }
+#endif
+    return result;
+}
+
 /**
  * \brief Determines if a Curve25519 point is weak for contributory behaviour.
  *
@@ -1483,14 +1595,615 @@ void Curve25519::cmove(limb_t select, limb_t *x, const limb_t *y)
 }
 
 /**
- * \brief Raise x to the power of (2^250 - 1).
+ * \brief Computes the reciprocal of a number modulo 2^255 - 19.
+ *
+ * \param result The result as a array of NUM_LIMBS_256BIT limbs in size.
+ * This cannot be the same array as \a x.
+ * \param x The number to compute the reciprocal for.
+ *
+ * \sa fieldRecip()
+ */
+void Curve25519::recip(limb_t *result, const limb_t *x)
+{
+#if defined(CURVE25519_RADIX51)
+    limb_t t1[NUM_LIMBS_FIELD25519];
+    limb_t t2[NUM_LIMBS_FIELD25519];
+    fieldUnpack(t1, x);
+    fieldRecip(t2, t1);
+    fieldPack(result, t2);
+    clean(t1);
+    clean(t2);
+#else
+    fieldRecip(result, x);
+#endif
+}
+
+/**
+ * \brief Computes the square root of a number modulo 2^255 - 19.
+ *
+ * \param result The result as a array of NUM_LIMBS_256BIT limbs in size.
+ * This must not overlap with \a x.
+ * \param x The number to compute the square root for.
  *
- * \param result The result array, which must be NUM_LIMBS_256BIT limbs in size.
+ * For any number \a x, there are two square roots: positive and negative.
+ * For example, both 2 and -2 are square roots of 4 because 2 * 2 = -2 * -2.
+ * This function will return one or the other.  Callers must determine which
+ * square root they are interested in and invert the result as necessary.
+ *
+ * \note This function is not constant time so it should only be used
+ * on publicly-known values.
+ *
+ * \sa fieldSqrt()
+ */
+bool Curve25519::sqrt(limb_t *result, const limb_t *x)
+{
+#if defined(CURVE25519_RADIX51)
+    limb_t t1[NUM_LIMBS_FIELD25519];
+    limb_t t2[NUM_LIMBS_FIELD25519];
+    bool ok;
+    fieldUnpack(t1, x);
+    ok = fieldSqrt(t2, t1);
+    fieldPack(result, t2);
+    clean(t1);
+    clean(t2);
+    return ok;
+#else
+    return fieldSqrt(result, x);
+#endif
+}
+
+/**
+ * \brief Converts a number modulo 2^255 - 19 into the field representation.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size.
+ * This can be the same array as \a x.
+ * \param x The number to convert, which must be NUM_LIMBS_256BIT limbs in
+ * size and less than 2^255.
+ *
+ * On 64-bit hosts the field representation consists of five 51-bit limbs.
+ * On all other platforms it is the same as the regular NUM_LIMBS_256BIT
+ * representation and this function simply copies \a x to \a result.
+ *
+ * \sa fieldPack()
+ */
+void Curve25519::fieldUnpack(limb_t *result, const limb_t *x)
+{
+#if defined(CURVE25519_RADIX51)
+    const limb_t mask = (((limb_t)1) << 51) - 1;
+    limb_t x0 = x[0];
+    limb_t x1 = x[1];
+    limb_t x2 = x[2];
+    limb_t x3 = x[3];
+    result[0] = x0 & mask;
+    result[1] = ((x0 >> 51) | (x1 << 13)) & mask;
+    result[2] = ((x1 >> 38) | (x2 << 26)) & mask;
+    result[3] = ((x2 >> 25) | (x3 << 39)) & mask;
+    result[4] = (x3 >> 12) & mask;
+#else
+    if (result != x)
+        memcpy(result, x, NUM_LIMBS_256BIT * sizeof(limb_t));
+#endif
+}
+
+/**
+ * \brief Converts a field element back into a fully reduced number
+ * modulo 2^255 - 19.
+ *
+ * \param result The result, which will be NUM_LIMBS_256BIT limbs in size.
+ * This can be the same array as \a x.
+ * \param x The field element to convert, which must be
+ * NUM_LIMBS_FIELD25519 limbs in size.
+ *
+ * The result is always less than 2^255 - 19 so it can be compared
+ * directly against other packed values.
+ *
+ * \sa fieldUnpack()
+ */
+void Curve25519::fieldPack(limb_t *result, const limb_t *x)
+{
+#if defined(CURVE25519_RADIX51)
+    const limb_t mask = (((limb_t)1) << 51) - 1;
+    limb_t x0 = x[0];
+    limb_t x1 = x[1];
+    limb_t x2 = x[2];
+    limb_t x3 = x[3];
+    limb_t x4 = x[4];
+    limb_t q;
+
+    // Propagate the carries so that every limb is less than 2^51.
+    // Doing this twice absorbs the carry that wraps around from x4.
+    for (uint8_t round = 0; round < 2; ++round) {
+        x1 += x0 >> 51; x0 &= mask;
+        x2 += x1 >> 51; x1 &= mask;
+        x3 += x2 >> 51; x2 &= mask;
+        x4 += x3 >> 51; x3 &= mask;
+        x0 += 19 * (x4 >> 51); x4 &= mask;
+    }
+
+    // The value is now less than 2 * (2^255 - 19).  Determine if it is
+    // greater than or equal to 2^255 - 19 by checking for a carry out
+    // of the top bit after adding 19.  Then subtract 2^255 - 19 if
+    // necessary by adding 19 * q and discarding bit 255.
+    q = (x0 + 19) >> 51;
+    q = (x1 + q) >> 51;
+    q = (x2 + q) >> 51;
+    q = (x3 + q) >> 51;
+    q = (x4 + q) >> 51;
+    x0 += 19 * q;
+    x1 += x0 >> 51; x0 &= mask;
+    x2 += x1 >> 51; x1 &= mask;
+    x3 += x2 >> 51; x2 &= mask;
+    x4 += x3 >> 51; x3 &= mask;
+    x4 &= mask;
+
+    // Pack the 51-bit limbs into 64-bit limbs.
+    result[0] = x0 | (x1 << 51);
+    result[1] = (x1 >> 13) | (x2 << 38);
+    result[2] = (x2 >> 26) | (x3 << 25);
+    result[3] = (x3 >> 39) | (x4 << 12);
+#else
+    if (result != x)
+        memcpy(result, x, NUM_LIMBS_256BIT * sizeof(limb_t));
+#endif
+}
+
+#if defined(CURVE25519_RADIX51)
+
+/** @cond curve25519_radix51 */
+
+// Carries the 128-bit column sums of a multiplication into five 51-bit
+// limbs.  The top carry is folded back into the bottom using 2^255 = 19.
+// The result limbs will all be less than 2^51 except result[1] which may
+// be slightly larger; the next operation will absorb the excess.
+#define curve25519_carry51(result, t0, t1, t2, t3, t4) \
+    do { \
+        const limb_t mask = (((limb_t)1) << 51) - 1; \
+        dlimb_t c; \
+        t1 += (limb_t)(t0 >> 51); \
+        t2 += (limb_t)(t1 >> 51); \
+        t3 += (limb_t)(t2 >> 51); \
+        t4 += (limb_t)(t3 >> 51); \
+        c = ((dlimb_t)((limb_t)(t4 >> 51))) * 19U + (((limb_t)t0) & mask); \
+        (result)[0] = ((limb_t)c) & mask; \
+        (result)[1] = (((limb_t)t1) & mask) + (limb_t)(c >> 51); \
+        (result)[2] = ((limb_t)t2) & mask; \
+        (result)[3] = ((limb_t)t3) & mask; \
+        (result)[4] = ((limb_t)t4) & mask; \
+    } while (0)
+
+/** @endcond */
+
+/**
+ * \brief Multiplies two field elements and then reduces the result
+ * modulo 2^255 - 19.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value to multiply, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
+ * \param y The second value to multiply, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.  This can be the same array as \a x.
+ *
+ * The limbs of \a x and \a y may be up to 2^54 in size, which allows the
+ * unreduced outputs of fieldAdd() to be passed to this function directly.
+ * The result is only partially reduced; use fieldPack() to obtain the
+ * canonical value.
+ *
+ * \sa fieldSquare()
+ */
+void Curve25519::fieldMul(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    limb_t x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4 = x[4];
+    limb_t y0 = y[0], y1 = y[1], y2 = y[2], y3 = y[3], y4 = y[4];
+    limb_t y1_19 = y1 * 19;
+    limb_t y2_19 = y2 * 19;
+    limb_t y3_19 = y3 * 19;
+    limb_t y4_19 = y4 * 19;
+    dlimb_t t0, t1, t2, t3, t4;
+
+    // Multiply the limbs, folding the terms above 2^255 back into
+    // the low limbs by multiplying them by 19.
+    t0 = ((dlimb_t)x0) * y0 + ((dlimb_t)x1) * y4_19 + ((dlimb_t)x2) * y3_19 +
+         ((dlimb_t)x3) * y2_19 + ((dlimb_t)x4) * y1_19;
+    t1 = ((dlimb_t)x0) * y1 + ((dlimb_t)x1) * y0 + ((dlimb_t)x2) * y4_19 +
+         ((dlimb_t)x3) * y3_19 + ((dlimb_t)x4) * y2_19;
+    t2 = ((dlimb_t)x0) * y2 + ((dlimb_t)x1) * y1 + ((dlimb_t)x2) * y0 +
+         ((dlimb_t)x3) * y4_19 + ((dlimb_t)x4) * y3_19;
+    t3 = ((dlimb_t)x0) * y3 + ((dlimb_t)x1) * y2 + ((dlimb_t)x2) * y1 +
+         ((dlimb_t)x3) * y0 + ((dlimb_t)x4) * y4_19;
+    t4 = ((dlimb_t)x0) * y4 + ((dlimb_t)x1) * y3 + ((dlimb_t)x2) * y2 +
+         ((dlimb_t)x3) * y1 + ((dlimb_t)x4) * y0;
+
+    // Propagate the carries.
+    curve25519_carry51(result, t0, t1, t2, t3, t4);
+}
+
+/**
+ * \brief Squares a field element and then reduces the result
+ * modulo 2^255 - 19.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to square, which must be NUM_LIMBS_FIELD25519 limbs
+ * in size.
+ *
+ * Squaring needs 15 limb multiplications instead of the 25 that are
+ * needed by fieldMul().
+ *
+ * \sa fieldMul()
+ */
+void Curve25519::fieldSquare(limb_t *result, const limb_t *x)
+{
+    limb_t x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4 = x[4];
+    limb_t d0 = x0 * 2;
+    limb_t d1 = x1 * 2;
+    limb_t d2 = x2 * 2;
+    limb_t d3 = x3 * 2;
+    limb_t x3_19 = x3 * 19;
+    limb_t x4_19 = x4 * 19;
+    dlimb_t t0, t1, t2, t3, t4;
+
+    t0 = ((dlimb_t)x0) * x0 + ((dlimb_t)d1) * x4_19 + ((dlimb_t)d2) * x3_19;
+    t1 = ((dlimb_t)d0) * x1 + ((dlimb_t)d2) * x4_19 + ((dlimb_t)x3) * x3_19;
+    t2 = ((dlimb_t)d0) * x2 + ((dlimb_t)x1) * x1 + ((dlimb_t)d3) * x4_19;
+    t3 = ((dlimb_t)d0) * x3 + ((dlimb_t)d1) * x2 + ((dlimb_t)x4) * x4_19;
+    t4 = ((dlimb_t)d0) * x4 + ((dlimb_t)d1) * x3 + ((dlimb_t)x2) * x2;
+
+    curve25519_carry51(result, t0, t1, t2, t3, t4);
+}
+
+/**
+ * \brief Multiplies a field element by the a24 constant and then reduces
+ * the result modulo 2^255 - 19.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to multiply by a24, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
+ */
+void Curve25519::fieldMulA24(limb_t *result, const limb_t *x)
+{
+    dlimb_t t0 = ((dlimb_t)(x[0])) * 121665U;
+    dlimb_t t1 = ((dlimb_t)(x[1])) * 121665U;
+    dlimb_t t2 = ((dlimb_t)(x[2])) * 121665U;
+    dlimb_t t3 = ((dlimb_t)(x[3])) * 121665U;
+    dlimb_t t4 = ((dlimb_t)(x[4])) * 121665U;
+    curve25519_carry51(result, t0, t1, t2, t3, t4);
+}
+
+/**
+ * \brief Multiplies a field element by a constant and then reduces the
+ * result modulo 2^255 - 19.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x.
+ * \param x The field element to multiply, which must be
+ * NUM_LIMBS_FIELD25519 limbs in size.
+ * \param y The constant to multiply by, which must be NUM_LIMBS_256BIT limbs
+ * in size and less than 2^255 - 19.  This array must be in program memory.
+ *
+ * The constant \a y is in the regular NUM_LIMBS_256BIT representation so
+ * that the same constant tables can be used on all platforms.
+ */
+void Curve25519::fieldMul_P(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    limb_t temp[NUM_LIMBS_FIELD25519];
+    fieldUnpack(temp, y);
+    fieldMul(result, x, temp);
+}
+
+/**
+ * \brief Adds two field elements without reducing the result.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value to add, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
+ * \param y The second value to add, which must be NUM_LIMBS_FIELD25519
+ * limbs in size.
+ *
+ * The limbs are added without carry propagation.  The result can be
+ * passed to fieldMul(), fieldSquare(), or fieldSub(), or added once more
+ * before being passed to fieldMul() or fieldSquare().
+ */
+void Curve25519::fieldAdd(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    result[0] = x[0] + y[0];
+    result[1] = x[1] + y[1];
+    result[2] = x[2] + y[2];
+    result[3] = x[3] + y[3];
+    result[4] = x[4] + y[4];
+}
+
+/**
+ * \brief Subtracts two field elements and then partially reduces the result.
+ *
+ * \param result The result, which must be NUM_LIMBS_FIELD25519 limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value, which must be NUM_LIMBS_FIELD25519 limbs in size.
+ * \param y The value to subtract from \a x, which must be
+ * NUM_LIMBS_FIELD25519 limbs in size.
+ *
+ * A multiple of 2^255 - 19 is added to the difference to keep the limbs
+ * positive.  The limbs of \a y must be less than 2^53 - 76, which allows
+ * \a y to be the unreduced output of a single fieldAdd().
+ */
+void Curve25519::fieldSub(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    // 4 * (2^255 - 19) in radix-2^51 form.
+    const limb_t p4_0 = 0x1FFFFFFFFFFFB4ULL;
+    const limb_t p4_n = 0x1FFFFFFFFFFFFCULL;
+    const limb_t mask = (((limb_t)1) << 51) - 1;
+    limb_t r0 = x[0] + p4_0 - y[0];
+    limb_t r1 = x[1] + p4_n - y[1];
+    limb_t r2 = x[2] + p4_n - y[2];
+    limb_t r3 = x[3] + p4_n - y[3];
+    limb_t r4 = x[4] + p4_n - y[4];
+    r1 += r0 >> 51; r0 &= mask;
+    r2 += r1 >> 51; r1 &= mask;
+    r3 += r2 >> 51; r2 &= mask;
+    r4 += r3 >> 51; r3 &= mask;
+    r0 += 19 * (r4 >> 51); r4 &= mask;
+    result[0] = r0;
+    result[1] = r1;
+    result[2] = r2;
+    result[3] = r3;
+    result[4] = r4;
+}
+
+/**
+ * \brief Conditionally swaps two field elements if a selection value
+ * is non-zero.
+ *
+ * \param select Non-zero to swap \a x and \a y, zero to leave them unchanged.
+ * \param x The first value to conditionally swap.
+ * \param y The second value to conditionally swap.
+ *
+ * \sa fieldCmove(), cswap()
+ */
+void Curve25519::fieldCswap(limb_t select, limb_t *x, limb_t *y)
+{
+    uint8_t posn;
+    limb_t dummy;
+    limb_t sel;
+
+    sel = (limb_t)(((((dlimb_t)1) << LIMB_BITS) - select) >> LIMB_BITS);
+    --sel;
+    for (posn = 0; posn < NUM_LIMBS_FIELD25519; ++posn) {
+        dummy = sel & (x[posn] ^ y[posn]);
+        x[posn] ^= dummy;
+        y[posn] ^= dummy;
+    }
+}
+
+/**
+ * \brief Conditionally moves field element \a y into \a x if a selection
+ * value is non-zero.
+ *
+ * \param select Non-zero to move \a y into \a x, zero to leave \a x unchanged.
+ * \param x The destination to move into.
+ * \param y The value to conditionally move.
+ *
+ * \sa fieldCswap(), cmove()
+ */
+void Curve25519::fieldCmove(limb_t select, limb_t *x, const limb_t *y)
+{
+    uint8_t posn;
+    limb_t dummy;
+    limb_t sel;
+
+    sel = (limb_t)(((((dlimb_t)1) << LIMB_BITS) - select) >> LIMB_BITS);
+    --sel;
+    for (posn = 0; posn < NUM_LIMBS_FIELD25519; ++posn) {
+        dummy = sel & (x[posn] ^ y[posn]);
+        x[posn] ^= dummy;
+    }
+}
+
+#endif // CURVE25519_RADIX51
+
+/**
+ * \brief Initializes a Montgomery ladder.
+ *
+ * \param ladder The ladder state to initialize.
+ * \param x The X(Q) parameter to the curve function.  If this pointer is
+ * NULL then the value 9 is used for \a x.
+ *
+ * \return Returns 1 if \a x is a proper member of the field modulo
+ * (2^255 - 19), or 0 otherwise.
+ *
+ * \sa ladderStep(), ladderFinish()
+ */
+uint8_t Curve25519::ladderInit(Ladder &ladder, const uint8_t x[32])
+{
+    uint8_t retval;
+
+    // Unpack the "x" argument into the limb representation
+    // which also masks off the high bit.  NULL means 9.
+    if (x) {
+        // x1 = x
+        BigNumberUtil::unpackLE(ladder.x_1, NUM_LIMBS_256BIT, x, 32);
+        ladder.x_1[NUM_LIMBS_256BIT - 1] &= ((((limb_t)1) << (LIMB_BITS - 1)) - 1);
+    } else {
+        memset(ladder.x_1, 0, sizeof(ladder.x_1));  // x_1 = 9
+        ladder.x_1[0] = 9;
+    }
+
+    // Check that "x" is within the range of the modulo field.
+    // We can do this with a reduction - if there was no borrow
+    // then the value of "x" was out of range.  Timing is sensitive
+    // here so that we don't reveal anything about the value of "x".
+    // If there was a reduction, then continue executing the rest
+    // of the ladder with the (now) in-range "x" value and report
+    // the failure at the end.
+    retval = (uint8_t)(reduceQuick(ladder.x_1) & 0x01);
+
+    // Convert "x" into the field representation for the curve arithmetic.
+    fieldUnpack(ladder.x_1, ladder.x_1);
+
+    // Initialize the other variables.
+    memset(ladder.x_2, 0, sizeof(ladder.x_2));      // x_2 = 1
+    ladder.x_2[0] = 1;
+    memset(ladder.z_2, 0, sizeof(ladder.z_2));      // z_2 = 0
+    memcpy(ladder.x_3, ladder.x_1, sizeof(ladder.x_1)); // x_3 = x
+    memcpy(ladder.z_3, ladder.x_2, sizeof(ladder.x_2)); // z_3 = 1
+    ladder.swap = 0;
+    return retval;
+}
+
+/**
+ * \brief Performs a single step of a Montgomery ladder.
+ *
+ * \param ladder The ladder state.
+ * \param s The S parameter to the curve function.
+ * \param bit The bit of \a s to process, between 254 and 0.
+ *
+ * \sa ladderInit(), ladderFinish()
+ */
+void Curve25519::ladderStep(Ladder &ladder, const uint8_t s[32], uint8_t bit)
+{
+    limb_t *A = ladder.A;
+    limb_t *B = ladder.B;
+    limb_t *C = ladder.C;
+    limb_t *D = ladder.D;
+    uint8_t select;
+
+    // Conditional swaps on entry to this bit but only if we
+    // didn't swap on the previous bit.
+    select = (s[bit >> 3] >> (bit & 0x07)) & 0x01;
+    ladder.swap ^= select;
+    fieldCswap(ladder.swap, ladder.x_2, ladder.x_3);
+    fieldCswap(ladder.swap, ladder.z_2, ladder.z_3);
+    ladder.swap = select;
+
+    // Evaluate the curve.
+    fieldAdd(A, ladder.x_2, ladder.z_2);        // A = x_2 + z_2
+    fieldSub(B, ladder.x_2, ladder.z_2);        // B = x_2 - z_2
+    fieldAdd(C, ladder.x_3, ladder.z_3);        // C = x_3 + z_3
+    fieldSub(D, ladder.x_3, ladder.z_3);        // D = x_3 - z_3
+    fieldMul(D, D, A);                          // DA = D * A
+    fieldMul(C, C, B);                          // CB = C * B
+    fieldSquare(A, A);                          // AA = A^2
+    fieldSquare(B, B);                          // BB = B^2
+    fieldAdd(ladder.x_3, D, C);                 // x_3 = (DA + CB)^2
+    fieldSquare(ladder.x_3, ladder.x_3);
+    fieldSub(ladder.z_3, D, C);                 // z_3 = x_1 * (DA - CB)^2
+    fieldSquare(ladder.z_3, ladder.z_3);
+    fieldMul(ladder.z_3, ladder.z_3, ladder.x_1);
+    fieldMul(ladder.x_2, A, B);                 // x_2 = AA * BB
+    fieldSub(B, A, B);                          // E = AA - BB
+    fieldMulA24(ladder.z_2, B);                 // z_2 = E * (AA + a24 * E)
+    fieldAdd(ladder.z_2, ladder.z_2, A);
+    fieldMul(ladder.z_2, ladder.z_2, B);
+}
+
+/**
+ * \brief Performs a single step of two Montgomery ladders with the
+ * field operations interleaved.
+ *
+ * \param l1 The first ladder state.
+ * \param l2 The second ladder state.
+ * \param s1 The S parameter for the first ladder.
+ * \param s2 The S parameter for the second ladder.
+ * \param bit The bit of \a s1 and \a s2 to process, between 254 and 0.
+ *
+ * \sa ladderStep()
+ */
+void Curve25519::ladderStep2(Ladder &l1, Ladder &l2, const uint8_t s1[32],
+                             const uint8_t s2[32], uint8_t bit)
+{
+    limb_t *A1 = l1.A;
+    limb_t *A2 = l2.A;
+    limb_t *B1 = l1.B;
+    limb_t *B2 = l2.B;
+    limb_t *C1 = l1.C;
+    limb_t *C2 = l2.C;
+    limb_t *D1 = l1.D;
+    limb_t *D2 = l2.D;
+    uint8_t select;
+
+    // Conditional swaps on entry to this bit for both ladders.
+    select = (s1[bit >> 3] >> (bit & 0x07)) & 0x01;
+    l1.swap ^= select;
+    fieldCswap(l1.swap, l1.x_2, l1.x_3);
+    fieldCswap(l1.swap, l1.z_2, l1.z_3);
+    l1.swap = select;
+    select = (s2[bit >> 3] >> (bit & 0x07)) & 0x01;
+    l2.swap ^= select;
+    fieldCswap(l2.swap, l2.x_2, l2.x_3);
+    fieldCswap(l2.swap, l2.z_2, l2.z_3);
+    l2.swap = select;
+
+    // Evaluate both curves with the operations interleaved so that the
+    // independent multiplications can overlap in the processor pipeline.
+    fieldAdd(A1, l1.x_2, l1.z_2);           // A = x_2 + z_2
+    fieldAdd(A2, l2.x_2, l2.z_2);
+    fieldSub(B1, l1.x_2, l1.z_2);           // B = x_2 - z_2
+    fieldSub(B2, l2.x_2, l2.z_2);
+    fieldAdd(C1, l1.x_3, l1.z_3);           // C = x_3 + z_3
+    fieldAdd(C2, l2.x_3, l2.z_3);
+    fieldSub(D1, l1.x_3, l1.z_3);           // D = x_3 - z_3
+    fieldSub(D2, l2.x_3, l2.z_3);
+    fieldMul(D1, D1, A1);                   // DA = D * A
+    fieldMul(D2, D2, A2);
+    fieldMul(C1, C1, B1);                   // CB = C * B
+    fieldMul(C2, C2, B2);
+    fieldSquare(A1, A1);                    // AA = A^2
+    fieldSquare(A2, A2);
+    fieldSquare(B1, B1);                    // BB = B^2
+    fieldSquare(B2, B2);
+    fieldAdd(l1.x_3, D1, C1);               // x_3 = (DA + CB)^2
+    fieldAdd(l2.x_3, D2, C2);
+    fieldSquare(l1.x_3, l1.x_3);
+    fieldSquare(l2.x_3, l2.x_3);
+    fieldSub(l1.z_3, D1, C1);               // z_3 = x_1 * (DA - CB)^2
+    fieldSub(l2.z_3, D2, C2);
+    fieldSquare(l1.z_3, l1.z_3);
+    fieldSquare(l2.z_3, l2.z_3);
+    fieldMul(l1.z_3, l1.z_3, l1.x_1);
+    fieldMul(l2.z_3, l2.z_3, l2.x_1);
+    fieldMul(l1.x_2, A1, B1);               // x_2 = AA * BB
+    fieldMul(l2.x_2, A2, B2);
+    fieldSub(B1, A1, B1);                   // E = AA - BB
+    fieldSub(B2, A2, B2);
+    fieldMulA24(l1.z_2, B1);                // z_2 = E * (AA + a24 * E)
+    fieldMulA24(l2.z_2, B2);
+    fieldAdd(l1.z_2, l1.z_2, A1);
+    fieldAdd(l2.z_2, l2.z_2, A2);
+    fieldMul(l1.z_2, l1.z_2, B1);
+    fieldMul(l2.z_2, l2.z_2, B2);
+}
+
+/**
+ * \brief Finishes a Montgomery ladder with the final conditional swap.
+ *
+ * \param ladder The ladder state.  The result is x_2 / z_2.
+ *
+ * The temporaries that ladderStep() keeps in the ladder state are
+ * cleaned here once rather than after every step.
+ *
+ * \sa ladderInit(), ladderStep()
+ */
+void Curve25519::ladderFinish(Ladder &ladder)
+{
+    fieldCswap(ladder.swap, ladder.x_2, ladder.x_3);
+    fieldCswap(ladder.swap, ladder.z_2, ladder.z_3);
+    clean(ladder.A);
+    clean(ladder.B);
+    clean(ladder.C);
+    clean(ladder.D);
+}
+
+/**
+ * \brief Raise a field element to the power of (2^250 - 1).
+ *
+ * \param result The result array, which must be NUM_LIMBS_FIELD25519 limbs
+ * in size.
  * \param x The value to raise.
  */
-void Curve25519::pow250(limb_t *result, const limb_t *x)
+void Curve25519::fieldPow250(limb_t *result, const limb_t *x)
 {
-    limb_t t1[NUM_LIMBS_256BIT];
+    limb_t t1[NUM_LIMBS_FIELD25519];
     uint8_t i, j;
 
     // The big-endian hexadecimal expansion of (2^250 - 1) is:
@@ -1506,23 +2219,23 @@ void Curve25519::pow250(limb_t *result, const limb_t *x)
     // Build a pattern of 250 bits in length of repeated copies of 0000000001.
     #define RECIP_GROUP_SIZE 10
     #define RECIP_GROUP_BITS 250    // Must be a multiple of RECIP_GROUP_SIZE.
-    square(t1, x);
+    fieldSquare(t1, x);
     for (j = 0; j < (RECIP_GROUP_SIZE - 1); ++j)
-        square(t1, t1);
-    mul(result, t1, x);
+        fieldSquare(t1, t1);
+    fieldMul(result, t1, x);
     for (i = 0; i < ((RECIP_GROUP_BITS / RECIP_GROUP_SIZE) - 2); ++i) {
         for (j = 0; j < RECIP_GROUP_SIZE; ++j)
-            square(t1, t1);
-        mul(result, result, t1);
+            fieldSquare(t1, t1);
+        fieldMul(result, result, t1);
     }
 
     // Multiply bit-shifted versions of the 0000000001 pattern into
     // the result to "fill in" the gaps in the pattern.
-    square(t1, result);
-    mul(result, result, t1);
+    fieldSquare(t1, result);
+    fieldMul(result, result, t1);
     for (j = 0; j < (RECIP_GROUP_SIZE - 2); ++j) {
-        square(t1, t1);
-        mul(result, result, t1);
+        fieldSquare(t1, t1);
+        fieldMul(result, result, t1);
     }
 
     // Clean up and exit.
@@ -1530,81 +2243,218 @@ void Curve25519::pow250(limb_t *result, const limb_t *x)
 }
 
 /**
- * \brief Computes the reciprocal of a number modulo 2^255 - 19.
+ * \brief Computes the reciprocal of a field element modulo 2^255 - 19.
  *
- * \param result The result as a array of NUM_LIMBS_256BIT limbs in size.
+ * \param result The result as a array of NUM_LIMBS_FIELD25519 limbs in size.
  * This cannot be the same array as \a x.
- * \param x The number to compute the reciprocal for.
+ * \param x The field element to compute the reciprocal for.
+ *
+ * \sa recip()
  */
-void Curve25519::recip(limb_t *result, const limb_t *x)
+void Curve25519::fieldRecip(limb_t *result, const limb_t *x)
 {
     // The reciprocal is the same as x ^ (p - 2) where p = 2^255 - 19.
     // The big-endian hexadecimal expansion of (p - 2) is:
     // 7FFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFEB
     // Start with the 250 upper bits of the expansion of (p - 2).
-    pow250(result, x);
+    fieldPow250(result, x);
 
     // Deal with the 5 lowest bits of (p - 2), 01011, from highest to lowest.
-    square(result, result);
-    square(result, result);
-    mul(result, result, x);
-    square(result, result);
-    square(result, result);
-    mul(result, result, x);
-    square(result, result);
-    mul(result, result, x);
+    fieldSquare(result, result);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
+    fieldSquare(result, result);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
 }
 
+// sqrt(-1) mod (2^255 - 19).
+static limb_t const numSqrtM1[NUM_LIMBS_256BIT] PROGMEM = {
+    LIMB_PAIR(0x4A0EA0B0, 0xC4EE1B27), LIMB_PAIR(0xAD2FE478, 0x2F431806),
+    LIMB_PAIR(0x3DFBD7A7, 0x2B4D0099), LIMB_PAIR(0x4FC1DF0B, 0x2B832480)
+};
+
 /**
- * \brief Computes the square root of a number modulo 2^255 - 19.
+ * \brief Computes the square root of a field element modulo 2^255 - 19.
  *
- * \param result The result as a array of NUM_LIMBS_256BIT limbs in size.
+ * \param result The result as a array of NUM_LIMBS_FIELD25519 limbs in size.
  * This must not overlap with \a x.
- * \param x The number to compute the square root for.
- *
- * For any number \a x, there are two square roots: positive and negative.
- * For example, both 2 and -2 are square roots of 4 because 2 * 2 = -2 * -2.
- * This function will return one or the other.  Callers must determine which
- * square root they are interested in and invert the result as necessary.
+ * \param x The field element to compute the square root for.
  *
  * \note This function is not constant time so it should only be used
  * on publicly-known values.
+ *
+ * \sa sqrt()
  */
-bool Curve25519::sqrt(limb_t *result, const limb_t *x)
+bool Curve25519::fieldSqrt(limb_t *result, const limb_t *x)
 {
-    // sqrt(-1) mod (2^255 - 19).
-    static limb_t const numSqrtM1[NUM_LIMBS_256BIT] PROGMEM = {
-        LIMB_PAIR(0x4A0EA0B0, 0xC4EE1B27), LIMB_PAIR(0xAD2FE478, 0x2F431806),
-        LIMB_PAIR(0x3DFBD7A7, 0x2B4D0099), LIMB_PAIR(0x4FC1DF0B, 0x2B832480)
-    };
-    limb_t y[NUM_LIMBS_256BIT];
+    limb_t y[NUM_LIMBS_FIELD25519];
+    limb_t xx[NUM_LIMBS_FIELD25519];
 
     // Algorithm from: http://tools.ietf.org/html/rfc7748
 
     // Compute a candidate root: result = x^((p + 3) / 8) mod p.
     // (p + 3) / 8 = (2^252 - 2) which is 251 one bits followed by a zero:
     // 0FFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFF FFFFFFFE
-    pow250(result, x);
-    square(result, result);
-    mul(result, result, x);
-    square(result, result);
-
-    // Did we get the square root immediately?
-    square(y, result);
-    if (memcmp(x, y, sizeof(y)) == 0) {
+    fieldPow250(result, x);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
+    fieldSquare(result, result);
+
+    // Did we get the square root immediately?  Field elements may not
+    // be fully reduced so pack them before comparing.
+    fieldPack(xx, x);
+    fieldSquare(y, result);
+    fieldPack(y, y);
+    if (memcmp(xx, y, NUM_LIMBS_256BIT * sizeof(limb_t)) == 0) {
         clean(y);
+        clean(xx);
         return true;
     }
 
     // Multiply the result by sqrt(-1) and check again.
-    mul_P(result, result, numSqrtM1);
-    square(y, result);
-    if (memcmp(x, y, sizeof(y)) == 0) {
+    fieldMul_P(result, result, numSqrtM1);
+    fieldSquare(y, result);
+    fieldPack(y, y);
+    if (memcmp(xx, y, NUM_LIMBS_256BIT * sizeof(limb_t)) == 0) {
         clean(y);
+        clean(xx);
         return true;
     }
 
     // The number does not have a square root.
     clean(y);
+    clean(xx);
     return false;
 }
+
+/**
+ * \brief Computes the square root of the ratio of two field elements
+ * modulo 2^255 - 19.
+ *
+ * \param result The result as a array of NUM_LIMBS_FIELD25519 limbs in size.
+ * This must not overlap with \a u or \a v.
+ * \param u The numerator of the ratio.
+ * \param v The denominator of the ratio, which must not be zero.
+ *
+ * \return Returns true if u / v has a square root or false if it does not.
+ *
+ * This is faster than computing the reciprocal of \a v and then calling
+ * fieldSqrt() because it only needs a single exponentiation.
+ *
+ * \note This function is not constant time so it should only be used
+ * on publicly-known values.
+ *
+ * \sa fieldSqrt()
+ */
+bool Curve25519::fieldSqrtRatio(limb_t *result, const limb_t *u, const limb_t *v)
+{
+    limb_t v3[NUM_LIMBS_FIELD25519];
+    limb_t t[NUM_LIMBS_FIELD25519];
+    limb_t uu[NUM_LIMBS_FIELD25519];
+    bool ok = true;
+
+    // Algorithm from: http://tools.ietf.org/html/rfc8032#section-5.1.3
+
+    // Compute v^3 and u * v^7.
+    fieldSquare(v3, v);
+    fieldMul(v3, v3, v);
+    fieldSquare(t, v3);
+    fieldMul(t, t, v);
+    fieldMul(t, t, u);
+
+    // Compute a candidate root: result = u * v^3 * (u * v^7)^((p - 5) / 8).
+    // (p - 5) / 8 = (2^252 - 3) which is 250 one bits followed by 01.
+    fieldPow250(result, t);
+    fieldSquare(result, result);
+    fieldSquare(result, result);
+    fieldMul(result, result, t);
+    fieldMul(result, result, v3);
+    fieldMul(result, result, u);
+
+    // Check if v * result^2 is u or -u.  In the second case we need to
+    // multiply the result by sqrt(-1).  Otherwise there is no root.
+    fieldSquare(t, result);
+    fieldMul(t, t, v);
+    fieldPack(t, t);
+    fieldPack(uu, u);
+    if (memcmp(t, uu, NUM_LIMBS_256BIT * sizeof(limb_t)) != 0) {
+        memset(v3, 0, sizeof(v3));
+        fieldSub(uu, v3, u);
+        fieldPack(uu, uu);
+        if (memcmp(t, uu, NUM_LIMBS_256BIT * sizeof(limb_t)) == 0)
+            fieldMul_P(result, result, numSqrtM1);
+        else
+            ok = false;
+    }
+
+    // Clean up and exit.
+    clean(v3);
+    clean(t);
+    clean(uu);
+    return ok;
+}
+
+#if defined(ED25519_FIXED_BASE)
+
+/**
+ * \brief Multiplies the base point 9 by a scalar, leaving the result
+ * in projective form.
+ *
+ * \param x The numerator of the result, NUM_LIMBS_FIELD25519 limbs in size.
+ * \param z The denominator of the result, NUM_LIMBS_FIELD25519 limbs in size.
+ * \param s The 32-byte scalar to multiply by.  The high bit is ignored.
+ *
+ * The multiplication is performed on the birationally-equivalent Edwards
+ * curve using the fixed-base tables for Ed25519, whose base point maps to
+ * the point with u = 9.  The result (X : Y : Z) is mapped back to the
+ * Montgomery form as u = (Z + Y) / (Z - Y).
+ *
+ * \sa evalBase()
+ */
+void Curve25519::mulBase(limb_t *x, limb_t *z, const uint8_t s[32])
+{
+    Ed25519::Point P;
+    limb_t e[NUM_LIMBS_256BIT];
+
+    BigNumberUtil::unpackLE(e, NUM_LIMBS_256BIT, s, 32);
+    e[NUM_LIMBS_256BIT - 1] &= ((((limb_t)1) << (LIMB_BITS - 1)) - 1);
+    Ed25519::mul(P, e);
+    fieldAdd(x, P.z, P.y);
+    fieldSub(z, P.z, P.y);
+
+    clean(P);
+    clean(e);
+}
+
+/**
+ * \brief Evaluates the curve function for the base point 9.
+ *
+ * \param result The result of evaluating the curve function.
+ * \param s The 32-byte scalar to multiply by.  The high bit is ignored.
+ *
+ * This produces the same result as eval(result, s, 0) but it is faster
+ * because it uses the fixed-base tables for Ed25519.
+ *
+ * \sa mulBase(), eval()
+ */
+void Curve25519::evalBase(uint8_t result[32], const uint8_t s[32])
+{
+    limb_t x[NUM_LIMBS_FIELD25519];
+    limb_t z[NUM_LIMBS_FIELD25519];
+    limb_t zinv[NUM_LIMBS_FIELD25519];
+
+    mulBase(x, z, s);
+    fieldRecip(zinv, z);
+    fieldMul(x, x, zinv);
+    fieldPack(x, x);
+    BigNumberUtil::packLE(result, 32, x, NUM_LIMBS_256BIT);
+
+    clean(x);
+    clean(z);
+    clean(zinv);
+}
+
+#endif // ED25519_FIXED_BASE
@@ -25,6 +25,15 @@
 
 #include "BigNumberUtil.h"
 
+// On 64-bit hosts with 128-bit double limbs, field elements for the curve
+// arithmetic use an unsaturated representation of five 51-bit limbs.
+#if BIGNUMBER_LIMB_64BIT
+#define CURVE25519_RADIX51 1
+#define NUM_LIMBS_FIELD25519 5
+#else
+#define NUM_LIMBS_FIELD25519 (32 / sizeof(limb_t))
+#endif
+
 class Ed25519;
 
 class Curve25519
@@ -33,7 +42,10 @@ public:
     static bool eval(uint8_t result[32], const uint8_t s[32], const uint8_t x[32]);
 
     static void dh1(uint8_t k[32], uint8_t f[32]);
+    static void dh1Batch(uint8_t k[][32], uint8_t f[][32], size_t count);
     static bool dh2(uint8_t k[32], uint8_t f[32]);
+    static bool dh2Batch(uint8_t k[][32], uint8_t f[][32], size_t count,
+                         bool *results = 0);
 
 #if defined(TEST_CURVE25519_FIELD_OPS)
 public:
@@ -63,10 +75,69 @@ private:
     static void cswap(limb_t select, limb_t *x, limb_t *y);
     static void cmove(limb_t select, limb_t *x, const limb_t *y);
 
-    static void pow250(limb_t *result, const limb_t *x);
     static void recip(limb_t *result, const limb_t *x);
     static bool sqrt(limb_t *result, const limb_t *x);
 
+    static void fieldUnpack(limb_t *result, const limb_t *x);
+    static void fieldPack(limb_t *result, const limb_t *x);
+
+#if defined(CURVE25519_RADIX51)
+    static void fieldMul(limb_t *result, const limb_t *x, const limb_t *y);
+    static void fieldSquare(limb_t *result, const limb_t *x);
+    static void fieldMulA24(limb_t *result, const limb_t *x);
+    static void fieldMul_P(limb_t *result, const limb_t *x, const limb_t *y);
+    static void fieldAdd(limb_t *result, const limb_t *x, const limb_t *y);
+    static void fieldSub(limb_t *result, const limb_t *x, const limb_t *y);
+    static void fieldCswap(limb_t select, limb_t *x, limb_t *y);
+    static void fieldCmove(limb_t select, limb_t *x, const limb_t *y);
+#else
+    static void fieldMul(limb_t *result, const limb_t *x, const limb_t *y)
+        { mul(result, x, y); }
+    static void fieldSquare(limb_t *result, const limb_t *x)
+        { mul(result, x, x); }
+    static void fieldMulA24(limb_t *result, const limb_t *x)
+        { mulA24(result, x); }
+    static void fieldMul_P(limb_t *result, const limb_t *x, const limb_t *y)
+        { mul_P(result, x, y); }
+    static void fieldAdd(limb_t *result, const limb_t *x, const limb_t *y)
+        { add(result, x, y); }
+    static void fieldSub(limb_t *result, const limb_t *x, const limb_t *y)
+        { sub(result, x, y); }
+    static void fieldCswap(limb_t select, limb_t *x, limb_t *y)
+        { cswap(select, x, y); }
+    static void fieldCmove(limb_t select, limb_t *x, const limb_t *y)
+        { cmove(select, x, y); }
+#endif
+
+    static void fieldPow250(limb_t *result, const limb_t *x);
+    static void fieldRecip(limb_t *result, const limb_t *x);
+    static bool fieldSqrt(limb_t *result, const limb_t *x);
+    static bool fieldSqrtRatio(limb_t *result, const limb_t *u, const limb_t *v);
+
+    // State of a Montgomery ladder for eval() and dh2Batch().
+    struct Ladder
+    {
+        limb_t x_1[NUM_LIMBS_FIELD25519];
+        limb_t x_2[NUM_LIMBS_FIELD25519];
+        limb_t z_2[NUM_LIMBS_FIELD25519];
+        limb_t x_3[NUM_LIMBS_FIELD25519];
+        limb_t z_3[NUM_LIMBS_FIELD25519];
+        limb_t A[NUM_LIMBS_FIELD25519];     // Temporaries for ladderStep(),
+        limb_t B[NUM_LIMBS_FIELD25519];     // cleaned by ladderFinish().
+        limb_t C[NUM_LIMBS_FIELD25519];
+        limb_t D[NUM_LIMBS_FIELD25519];
+        uint8_t swap;
+    };
+
+    static uint8_t ladderInit(Ladder &ladder, const uint8_t x[32]);
+    static void ladderStep(Ladder &ladder, const uint8_t s[32], uint8_t bit);
+    static void ladderStep2(Ladder &l1, Ladder &l2, const uint8_t s1[32],
+                            const uint8_t s2[32], uint8_t bit);
+    static void ladderFinish(Ladder &ladder);
+
+    static void mulBase(limb_t *x, limb_t *z, const uint8_t s[32]);
+    static void evalBase(uint8_t result[32], const uint8_t s[32]);
+
     // Constructor and destructor are private - cannot instantiate this class.
     Curve25519() {}
     ~Curve25519() {}
@@ -22,6 +22,8 @@
 
 #include "EAX.h"
 #include "Crypto.h"
+#include "AES.h"
+#include "utility/StaticUtil.h"
 #include <string.h>
 
 /**
@@ -99,18 +101,12 @@ bool EAXCommon::setIV(const uint8_t *iv, size_t len)
 
 void EAXCommon::encrypt(uint8_t *output, const uint8_t *input, size_t len)
 {
-    if (state.authMode)
-        closeAuthData();
-    encryptCTR(output, input, len);
-    omac.update(state.hash, output, len);
+    encryptWith(*(omac.blockCipher()), output, input, len);
 }
 
 void EAXCommon::decrypt(uint8_t *output, const uint8_t *input, size_t len)
 {
-    if (state.authMode)
-        closeAuthData();
-    omac.update(state.hash, input, len);
-    encryptCTR(output, input, len);
+    decryptWith(*(omac.blockCipher()), output, input, len);
 }
 
 void EAXCommon::addAuthData(const void *data, size_t len)
@@ -162,19 +158,21 @@ void EAXCommon::closeAuthData()
 /**
  * \brief Encrypts or decrypts a region using the block cipher in CTR mode.
  *
+ * \param cipher The block cipher to use.
  * \param output The output buffer to write to, which may be the same
  * buffer as \a input.  The \a output buffer must have at least as many
  * bytes as the \a input buffer.
  * \param input The input buffer to read from.
  * \param len The number of bytes to process.
  */
-void EAXCommon::encryptCTR(uint8_t *output, const uint8_t *input, size_t len)
+template <typename B>
+void EAXCommon::encryptCTR(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
 {
     while (len > 0) {
         // Do we need to start a new block?
         if (state.encPosn == 16) {
             // Encrypt the counter to create the next keystream block.
-            omac.blockCipher()->encryptBlock(state.stream, state.counter);
+            cipher.encryptBlock(state.stream, state.counter);
             state.encPosn = 0;
 
             // Increment the counter, taking care not to reveal
@@ -225,6 +223,58 @@ void EAXCommon::closeTag()
  * This object must have a block size of 128 bits (16 bytes).
  */
 
+/**
+ * \brief Encrypts data using a specific block cipher object.
+ *
+ * \param cipher The block cipher to use, which is either the BlockCipher
+ * that was passed to setBlockCipher() or a StaticBlockCipher wrapper
+ * around the same object.
+ * \param output The output buffer to write the ciphertext to.
+ * \param input The input buffer to read the plaintext from.
+ * \param len The number of bytes to encrypt.
+ *
+ * This is the implementation of encrypt().  It is a template so that
+ * StaticEAX can instantiate it on the concrete block cipher type.
+ *
+ * \sa decryptWith()
+ */
+template <typename B>
+void EAXCommon::encryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
+{
+    if (state.authMode)
+        closeAuthData();
+    encryptCTR(cipher, output, input, len);
+    omac.updateWith(cipher, state.hash, output, len);
+}
+
+/**
+ * \brief Decrypts data using a specific block cipher object.
+ *
+ * \param cipher The block cipher to use.
+ * \param output The output buffer to write the plaintext to.
+ * \param input The input buffer to read the ciphertext from.
+ * \param len The number of bytes to decrypt.
+ *
+ * \sa encryptWith()
+ */
+template <typename B>
+void EAXCommon::decryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
+{
+    if (state.authMode)
+        closeAuthData();
+    omac.updateWith(cipher, state.hash, input, len);
+    encryptCTR(cipher, output, input, len);
+}
+
+// Instantiate the loops for the Static templates on the algorithms
+// that are listed in utility/StaticUtil.h.
+#define EAX_STATIC(T) \
+    template void EAXCommon::encryptWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *, size_t); \
+    template void EAXCommon::decryptWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *, size_t);
+CRYPTO_STATIC_BLOCK_CIPHERS(EAX_STATIC)
+
 /**
  * \class EAX EAX.h <EAX.h>
  * \brief Implementation of the EAX authenticated cipher.
@@ -291,3 +341,26 @@ void EAXCommon::closeTag()
  * \fn EAX::EAX()
  * \brief Constructs a new EAX object for the block cipher T.
  */
+
+/**
+ * \class StaticEAX EAX.h <EAX.h>
+ * \brief Implementation of the EAX authenticated cipher that is
+ * specialized on a concrete 128-bit block cipher.
+ *
+ * This class behaves the same as EAX and can still be used through an
+ * AuthenticatedCipher pointer.  The difference is that encrypt() and
+ * decrypt() call T::encryptBlock() directly for the CTR keystream and
+ * the OMAC of the ciphertext, instead of through the BlockCipher virtual
+ * function table.  T must be one of the AES classes.
+ *
+ * \code
+ * StaticEAX<AES256> eax;
+ * \endcode
+ *
+ * \sa EAX, StaticBlockCipher
+ */
+
+/**
+ * \fn StaticEAX::StaticEAX()
+ * \brief Constructs a new EAX object for the block cipher T.
+ */
@@ -56,6 +56,11 @@ protected:
         omac.setBlockCipher(cipher);
     }
 
+    template <typename B>
+    void encryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
+    template <typename B>
+    void decryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
+
 private:
     struct {
         uint8_t counter[16];
@@ -68,7 +73,8 @@ private:
     OMAC omac;
 
     void closeAuthData();
-    void encryptCTR(uint8_t *output, const uint8_t *input, size_t len);
+    template <typename B>
+    void encryptCTR(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
     void closeTag();
 };
 
@@ -82,4 +88,25 @@ private:
     T cipher;
 };
 
+template <typename T>
+class StaticEAX : public EAXCommon
+{
+public:
+    StaticEAX() { setBlockCipher(&cipher); }
+
+    void encrypt(uint8_t *output, const uint8_t *input, size_t len)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        encryptWith(direct, output, input, len);
+    }
+    void decrypt(uint8_t *output, const uint8_t *input, size_t len)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        decryptWith(direct, output, input, len);
+    }
+
+private:
+    T cipher;
+};
+
 #endif
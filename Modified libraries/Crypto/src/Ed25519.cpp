@@ -27,6 +27,27 @@
 #include "utility/LimbUtil.h"
 #include <string.h>
 
+#if defined(ED25519_FIXED_BASE)
+#include "utility/Ed25519Tables.h"
+#endif
+
+// Batch verification needs about 11K of stack space to hold the points
+// and scalars for a group of 32 signatures.  Even a group of 8 needs
+// over 4K, which is too much for the task stacks on ESP8266 and ESP32,
+// so batching is only enabled by default on hosted platforms.  Define
+// ED25519_BATCH_SIZE to a group size of 8 or more to enable it on other
+// platforms with enough stack space.
+#if !defined(ED25519_BATCH_SIZE) && \
+        (defined(__linux__) || defined(__APPLE__) || defined(_WIN32))
+#define ED25519_BATCH_SIZE      32
+#endif
+#if defined(ED25519_BATCH_SIZE)
+#if ED25519_BATCH_SIZE < 8
+#error "ED25519_BATCH_SIZE must be at least 8"
+#endif
+#define ED25519_BATCH_BUCKETS   16  // 2^(5 - 1) for 5-bit windows.
+#endif
+
 /**
  * \class Ed25519 Ed25519.h <Ed25519.h>
  * \brief Digital signatures based on the elliptic curve modulo 2^255 - 19.
@@ -64,6 +85,10 @@
  * }
  * \endcode
  *
+ * Verification is cofactored: a signature is accepted if 8 * s * B is
+ * equal to 8 * R + 8 * k * A.  This allows verify() and verifyBatch()
+ * to agree on signatures whose R or A has a component of small order.
+ *
  * \note The public functions in this class need a substantial amount of
  * stack space to store intermediate results while the curve function is
  * being evaluated.  About 1.5k of free stack space is recommended for safety.
@@ -130,47 +155,37 @@ void Ed25519::sign(uint8_t signature[64], const uint8_t privateKey[32],
     SHA512 hash;
     uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
     limb_t a[NUM_LIMBS_256BIT];
-    limb_t r[NUM_LIMBS_256BIT];
-    limb_t k[NUM_LIMBS_256BIT];
-    limb_t t[NUM_LIMBS_512BIT + 1];
-    Point rB;
 
     // Derive the secret scalar a and the message prefix from the private key.
     deriveKeys(&hash, a, privateKey);
 
-    // Hash the prefix and the message to derive r.
+    // Start hashing the prefix and then sign the message.
     hash.reset();
     hash.update(buf + 32, 32);
-    hash.update(message, len);
-    hash.finalize(buf, 0);
-    reduceQFromBuffer(r, buf, t);
-
-    // Encode rB into the first half of the signature buffer as R.
-    mul(rB, r);
-    encodePoint(signature, rB);
-
-    // Hash R, A, and the message to get k.
-    hash.reset();
-    hash.update(signature, 32); // R
-    hash.update(publicKey, 32); // A
-    hash.update(message, len);
-    hash.finalize(buf, 0);
-    reduceQFromBuffer(k, buf, t);
-
-    // Compute s = (r + k * a) mod q.
-    Curve25519::mulNoReduce(t, k, a);
-    t[NUM_LIMBS_512BIT] = 0;
-    reduceQ(t, t);
-    BigNumberUtil::add(t, t, r, NUM_LIMBS_256BIT);
-    BigNumberUtil::reduceQuick_P(t, t, numQ, NUM_LIMBS_256BIT);
-    BigNumberUtil::packLE(signature + 32, 32, t, NUM_LIMBS_256BIT);
+    signMessage(signature, a, hash, publicKey, message, len);
 
     // Clean up.
     clean(a);
-    clean(r);
-    clean(k);
-    clean(t);
-    clean(rB);
+}
+
+/**
+ * \brief Signs a message using a prepared Ed25519 private key.
+ *
+ * \param signature The signature value.
+ * \param privateKey The prepared private key to use to sign the message.
+ * \param message Points to the message to be signed.
+ * \param len The length of the \a message to be signed.
+ *
+ * This is faster than signing with the original private key because the
+ * private key does not need to be hashed again for every signature.
+ *
+ * \sa PrivateKey, verify()
+ */
+void Ed25519::sign(uint8_t signature[64], const PrivateKey &privateKey,
+                   const void *message, size_t len)
+{
+    SHA512 hash(privateKey.prefixHash);
+    signMessage(signature, privateKey.a, hash, privateKey.pub, message, len);
 }
 
 /**
@@ -194,6 +209,10 @@ bool Ed25519::verify(const uint8_t signature[64], const uint8_t publicKey[32],
     Point R;
     Point sB;
     Point kA;
+#if defined(ED25519_FIXED_BASE)
+    PointCached table[8];
+    limb_t temp[NUM_LIMBS_512BIT + 1];
+#endif
     uint8_t *k = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
     bool result = false;
 
@@ -206,6 +225,22 @@ bool Ed25519::verify(const uint8_t signature[64], const uint8_t publicKey[32],
         hash.update(message, len);
         hash.finalize(k, 0);
 
+#if defined(ED25519_FIXED_BASE)
+        // Reduce s and k modulo q.  Multiplying B by s modulo q gives
+        // the same answer as multiplying by s because B has order q.
+        // The reduced s value is stored in kA.t and k is stored in kA.z.
+        reduceSFromSignature(kA.t, signature, temp);
+        reduceQFromBuffer(kA.z, k, temp);
+
+        // Negate A and then calculate s * B - k * A with a single
+        // doubling chain.  The result should be equal to R.
+        memset(kA.x, 0, sizeof(kA.x));
+        Curve25519::fieldSub(A.x, kA.x, A.x);
+        Curve25519::fieldSub(A.t, kA.x, A.t);
+        oddMultiples(table, A);
+        jointMul(sB, kA.t, kA.z, table);
+        result = equalCofactor(sB, R);
+#else
         // Calculate s * B.  The s value is stored temporarily in kA.t.
         BigNumberUtil::unpackLE(kA.t, NUM_LIMBS_256BIT, signature + 32, 32);
         mul(sB, kA.t, false);
@@ -217,7 +252,8 @@ bool Ed25519::verify(const uint8_t signature[64], const uint8_t publicKey[32],
         add(R, kA);
 
         // Compare s * B and R + k * A for equality.
-        result = equal(sB, R);
+        result = equalCofactor(sB, R);
+#endif
     }
 
     // Clean up and exit.
@@ -225,6 +261,157 @@ bool Ed25519::verify(const uint8_t signature[64], const uint8_t publicKey[32],
     clean(R);
     clean(sB);
     clean(kA);
+#if defined(ED25519_FIXED_BASE)
+    clean(table);
+    clean(temp);
+#endif
+    return result;
+}
+
+/**
+ * \brief Verifies a signature using a prepared Ed25519 public key.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The prepared public key to use to verify the signature.
+ * \param message The message whose signature is to be verified.
+ * \param len The length of the \a message to be verified.
+ *
+ * \return Returns true if the \a signature is valid for \a message;
+ * or false if the \a signature is not valid.
+ *
+ * This is faster than verifying with the encoded public key because the
+ * key does not need to be decoded and its multiples are precomputed.
+ *
+ * \sa PublicKey, sign()
+ */
+bool Ed25519::verify(const uint8_t signature[64], const PublicKey &publicKey,
+                     const void *message, size_t len)
+{
+    SHA512 hash;
+    Point R;
+    Point sB;
+    Point kA;
+#if defined(ED25519_FIXED_BASE)
+    limb_t temp[NUM_LIMBS_512BIT + 1];
+#else
+    Point A;
+#endif
+    uint8_t *k = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    bool result = false;
+
+    // Decode the R component of the signature.
+    if (publicKey.valid && decodePoint(R, signature)) {
+        // Reconstruct the k value from the signing step.
+        hash.reset();
+        hash.update(signature, 32);
+        hash.update(publicKey.key, 32);
+        hash.update(message, len);
+        hash.finalize(k, 0);
+
+#if defined(ED25519_FIXED_BASE)
+        // Reduce s and k modulo q, and then calculate s * B - k * A.
+        reduceSFromSignature(kA.t, signature, temp);
+        reduceQFromBuffer(kA.z, k, temp);
+        jointMul(sB, kA.t, kA.z, publicKey.table);
+        result = equalCofactor(sB, R);
+#else
+        // Calculate s * B and R + k * A and compare them for equality.
+        BigNumberUtil::unpackLE(kA.t, NUM_LIMBS_256BIT, signature + 32, 32);
+        mul(sB, kA.t, false);
+        reduceQFromBuffer(sB.t, k, kA.x);
+        memcpy(&A, &(publicKey.point), sizeof(Point));
+        mul(kA, sB.t, A, false);
+        add(R, kA);
+        result = equalCofactor(sB, R);
+#endif
+    }
+
+    // Clean up and exit.
+    clean(R);
+    clean(sB);
+    clean(kA);
+#if defined(ED25519_FIXED_BASE)
+    clean(temp);
+#else
+    clean(A);
+#endif
+    return result;
+}
+
+/**
+ * \brief Verifies a batch of signatures.
+ *
+ * \param signatures The signature values to be verified.
+ * \param publicKeys The public keys to use to verify each signature.
+ * \param messages The messages whose signatures are to be verified.
+ * \param lens The lengths of the \a messages to be verified.
+ * \param count The number of signatures to verify.
+ * \param results Array of \a count entries that is set to the result of
+ * verifying each signature, or NULL if only the overall result is needed.
+ *
+ * \return Returns true if all of the signatures are valid; or false if
+ * at least one of the signatures is not valid.
+ *
+ * The signatures are checked in groups of up to 32 by combining the
+ * verification equations with random 128-bit coefficients and then
+ * evaluating the sum with a single multi-scalar multiplication.
+ * Batches of less than 8 signatures are verified one at a time.
+ *
+ * Grouping is only enabled on hosted platforms because a group of 32
+ * needs about 11K of stack space.  On embedded platforms, this function
+ * verifies the signatures one at a time unless the library is compiled
+ * with ED25519_BATCH_SIZE defined to a smaller group size.
+ *
+ * If a group fails and \a results is not NULL, then each signature in
+ * the group is verified separately to identify the bad ones.
+ *
+ * The random coefficients are derived by hashing output from
+ * \link RNGClass::rand() RNG.rand()\endlink together with the
+ * signatures and messages in the group.
+ *
+ * \sa verify()
+ */
+bool Ed25519::verifyBatch(const uint8_t * const signatures[],
+                          const uint8_t * const publicKeys[],
+                          const void * const messages[], const size_t lens[],
+                          size_t count, bool *results)
+{
+    bool result = true;
+    size_t posn, index, n;
+    bool ok;
+
+    for (posn = 0; posn < count; posn += n) {
+        n = count - posn;
+#if defined(ED25519_BATCH_SIZE)
+        // The multi-scalar multiplication is slower than verify()
+        // for very small groups, so only use it on 8 or more signatures.
+        if (n > ED25519_BATCH_SIZE)
+            n = ED25519_BATCH_SIZE;
+        if (n >= 8) {
+            if (verifyGroup(signatures + posn, publicKeys + posn,
+                            messages + posn, lens + posn, n)) {
+                if (results) {
+                    for (index = 0; index < n; ++index)
+                        results[posn + index] = true;
+                }
+                continue;
+            }
+            if (!results)
+                return false;
+        }
+#endif
+
+        // Verify the signatures one at a time.
+        for (index = 0; index < n; ++index) {
+            ok = verify(signatures[posn + index], publicKeys[posn + index],
+                        messages[posn + index], lens[posn + index]);
+            if (results)
+                results[posn + index] = ok;
+            else if (!ok)
+                return false;
+            result &= ok;
+        }
+    }
     return result;
 }
 
@@ -271,6 +458,269 @@ void Ed25519::derivePublicKey(uint8_t publicKey[32], const uint8_t privateKey[32
     clean(ptA);
 }
 
+/**
+ * \class Ed25519::PublicKey Ed25519.h <Ed25519.h>
+ * \brief Ed25519 public key that has been prepared for repeated verification.
+ *
+ * Verifying a signature with Ed25519::verify() normally starts by decoding
+ * the public key, which involves a field square root, and then computing
+ * a table of multiples of the key.  When the same public key is used to
+ * verify many signatures, this class can be used to do that work once:
+ *
+ * \code
+ * Ed25519::PublicKey key;
+ * if (key.setKey(publicKey)) {
+ *     ...
+ *     bool ok = Ed25519::verify(signature, key, message, len);
+ *     ...
+ * }
+ * \endcode
+ *
+ * On AVR platforms the object only holds the decoded key because there
+ * is not enough memory for the table of multiples.
+ */
+
+/**
+ * \brief Constructs an empty prepared public key.
+ *
+ * \sa setKey()
+ */
+Ed25519::PublicKey::PublicKey()
+    : valid(false)
+{
+}
+
+/**
+ * \brief Destroys this prepared public key.
+ */
+Ed25519::PublicKey::~PublicKey()
+{
+    clean(this, sizeof(PublicKey));
+}
+
+/**
+ * \brief Sets the public key and prepares it for verification.
+ *
+ * \param publicKey The public key in its encoded 32-byte form.
+ *
+ * \return Returns true if the key was prepared, or false if
+ * \a publicKey is not a valid curve point.  Verification against an
+ * invalid key will always fail.
+ *
+ * \sa isValid(), clear()
+ */
+bool Ed25519::PublicKey::setKey(const uint8_t publicKey[32])
+{
+#if defined(ED25519_FIXED_BASE)
+    Point A;
+    Point multiples[8];
+    PointCached twoA;
+    limb_t prod[8][NUM_LIMBS_FIELD25519];
+    limb_t inv[NUM_LIMBS_FIELD25519];
+    limb_t zinv[NUM_LIMBS_FIELD25519];
+    uint8_t index;
+
+    // Decode and negate the public key.
+    memcpy(key, publicKey, 32);
+    valid = decodePoint(A, publicKey);
+    if (valid) {
+        memset(inv, 0, sizeof(inv));
+        Curve25519::fieldSub(A.x, inv, A.x);
+        Curve25519::fieldSub(A.t, inv, A.t);
+
+        // Compute the odd multiples -A, -3A, ..., -15A.
+        memcpy(&(multiples[0]), &A, sizeof(Point));
+        dbl(A);
+        toCached(twoA, A);
+        for (index = 1; index < 8; ++index) {
+            memcpy(&(multiples[index]), &(multiples[index - 1]), sizeof(Point));
+            add(multiples[index], twoA);
+        }
+
+        // Convert the multiples into affine form using a single inversion
+        // with Montgomery's trick, which makes each addition cheaper.
+        memcpy(prod[0], multiples[0].z, sizeof(prod[0]));
+        for (index = 1; index < 8; ++index)
+            Curve25519::fieldMul(prod[index], prod[index - 1], multiples[index].z);
+        Curve25519::fieldRecip(inv, prod[7]);
+        for (index = 8; index-- > 0; ) {
+            if (index > 0) {
+                Curve25519::fieldMul(zinv, inv, prod[index - 1]);
+                Curve25519::fieldMul(inv, inv, multiples[index].z);
+            } else {
+                memcpy(zinv, inv, sizeof(zinv));
+            }
+            Curve25519::fieldMul(A.x, multiples[index].x, zinv);
+            Curve25519::fieldMul(A.y, multiples[index].y, zinv);
+            Curve25519::fieldMul(A.t, A.x, A.y);
+            toPrecomp(table[index], A);
+        }
+
+        // Clean up.
+        clean(A);
+        clean(multiples);
+        clean(twoA);
+        clean(prod);
+        clean(inv);
+        clean(zinv);
+    }
+#else
+    memcpy(key, publicKey, 32);
+    valid = decodePoint(point, publicKey);
+#endif
+    return valid;
+}
+
+/**
+ * \fn bool Ed25519::PublicKey::isValid() const
+ * \brief Determine if this object contains a valid prepared public key.
+ *
+ * \return Returns true if setKey() has succeeded; false otherwise.
+ */
+
+/**
+ * \brief Clears the prepared public key.
+ */
+void Ed25519::PublicKey::clear()
+{
+    clean(this, sizeof(PublicKey));
+    valid = false;
+}
+
+/**
+ * \class Ed25519::PrivateKey Ed25519.h <Ed25519.h>
+ * \brief Ed25519 private key that has been expanded for repeated signing.
+ *
+ * Signing a message with Ed25519::sign() normally starts by hashing the
+ * private key to derive the secret scalar and the message prefix.  When
+ * the same private key is used to sign many messages, this class can be
+ * used to do that work once:
+ *
+ * \code
+ * Ed25519::PrivateKey key;
+ * key.setKey(privateKey);
+ * ...
+ * Ed25519::sign(signature, key, message, len);
+ * \endcode
+ *
+ * The object also holds the public key, which is derived in setKey().
+ */
+
+/**
+ * \brief Constructs an empty expanded private key.
+ *
+ * \sa setKey()
+ */
+Ed25519::PrivateKey::PrivateKey()
+{
+    memset(a, 0, sizeof(a));
+    memset(pub, 0, sizeof(pub));
+}
+
+/**
+ * \brief Destroys this expanded private key.
+ */
+Ed25519::PrivateKey::~PrivateKey()
+{
+    clean(a);
+    clean(pub);
+}
+
+/**
+ * \brief Sets the private key and expands it for signing.
+ *
+ * \param privateKey The private key to expand.
+ *
+ * The secret scalar is derived from \a privateKey and the hash that is
+ * used to generate the per-message nonce is primed with the prefix.
+ * The public key is also derived and can be retrieved with publicKey().
+ *
+ * \sa clear()
+ */
+void Ed25519::PrivateKey::setKey(const uint8_t privateKey[32])
+{
+    uint8_t *buf = (uint8_t *)(prefixHash.state.w);
+    Point ptA;
+
+    // Derive the secret scalar a and the message prefix, and then
+    // start the nonce hash with the prefix.
+    deriveKeys(&prefixHash, a, privateKey);
+    prefixHash.reset();
+    prefixHash.update(buf + 32, 32);
+
+    // Compute the point A = aB and encode it.
+    mul(ptA, a);
+    encodePoint(pub, ptA);
+    clean(ptA);
+}
+
+/**
+ * \fn const uint8_t *Ed25519::PrivateKey::publicKey() const
+ * \brief Returns the 32-byte public key that corresponds to this private key.
+ */
+
+/**
+ * \brief Clears the expanded private key.
+ */
+void Ed25519::PrivateKey::clear()
+{
+    clean(a);
+    clean(pub);
+    prefixHash.clear();
+}
+
+/**
+ * \brief Signs a message after the prefix has been hashed.
+ *
+ * \param signature The signature value.
+ * \param a The secret scalar that was derived from the private key.
+ * \param hash Hash object that has already absorbed the message prefix.
+ * \param publicKey The public key corresponding to \a a.
+ * \param message Points to the message to be signed.
+ * \param len The length of the \a message to be signed.
+ */
+void Ed25519::signMessage(uint8_t signature[64], const limb_t *a, SHA512 &hash,
+                          const uint8_t publicKey[32], const void *message,
+                          size_t len)
+{
+    uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    limb_t r[NUM_LIMBS_256BIT];
+    limb_t k[NUM_LIMBS_256BIT];
+    limb_t t[NUM_LIMBS_512BIT + 1];
+    Point rB;
+
+    // Hash the prefix and the message to derive r.
+    hash.update(message, len);
+    hash.finalize(buf, 0);
+    reduceQFromBuffer(r, buf, t);
+
+    // Encode rB into the first half of the signature buffer as R.
+    mul(rB, r);
+    encodePoint(signature, rB);
+
+    // Hash R, A, and the message to get k.
+    hash.reset();
+    hash.update(signature, 32); // R
+    hash.update(publicKey, 32); // A
+    hash.update(message, len);
+    hash.finalize(buf, 0);
+    reduceQFromBuffer(k, buf, t);
+
+    // Compute s = (r + k * a) mod q.
+    Curve25519::mulNoReduce(t, k, a);
+    t[NUM_LIMBS_512BIT] = 0;
+    reduceQ(t, t);
+    BigNumberUtil::add(t, t, r, NUM_LIMBS_256BIT);
+    BigNumberUtil::reduceQuick_P(t, t, numQ, NUM_LIMBS_256BIT);
+    BigNumberUtil::packLE(signature + 32, 32, t, NUM_LIMBS_256BIT);
+
+    // Clean up.
+    clean(r);
+    clean(k);
+    clean(t);
+    clean(rB);
+}
+
 /**
  * \brief Reduces a number modulo q that was specified in a 512 bit buffer.
  *
@@ -287,6 +737,22 @@ void Ed25519::reduceQFromBuffer(limb_t *result, const uint8_t buf[64], limb_t *t
     reduceQ(result, temp);
 }
 
+/**
+ * \brief Reduces the s component of a signature modulo q.
+ *
+ * \param result The result array, which must be NUM_LIMBS_256BIT limbs in size.
+ * \param signature The signature, with s in the last 32 bytes.
+ * \param temp A temporary buffer of at least NUM_LIMBS_512BIT + 1 in size.
+ *
+ * \sa reduceQFromBuffer()
+ */
+void Ed25519::reduceSFromSignature(limb_t *result, const uint8_t signature[64], limb_t *temp)
+{
+    BigNumberUtil::unpackLE(temp, NUM_LIMBS_512BIT, signature + 32, 32);
+    temp[NUM_LIMBS_512BIT] = 0;
+    reduceQ(result, temp);
+}
+
 /**
  * \brief Reduces a number modulo q.
  *
@@ -352,10 +818,10 @@ void Ed25519::reduceQ(limb_t *result, limb_t *r)
 void Ed25519::mul(Point &result, const limb_t *s, Point &p, bool constTime)
 {
     Point q;
-    limb_t A[NUM_LIMBS_256BIT];
-    limb_t B[NUM_LIMBS_256BIT];
-    limb_t C[NUM_LIMBS_256BIT];
-    limb_t D[NUM_LIMBS_256BIT];
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
     limb_t mask, select;
     uint8_t sposn, t;
 
@@ -373,58 +839,43 @@ void Ed25519::mul(Point &result, const limb_t *s, Point &p, bool constTime)
         // by using B, D, q.z, and q.t to hold those values temporarily.
         select = s[sposn] & mask;
         if (constTime || select) {
-            Curve25519::sub(A, result.y, result.x);
-            Curve25519::sub(C, p.y, p.x);
-            Curve25519::mul(A, A, C);
-            Curve25519::add(B, result.y, result.x);
-            Curve25519::add(C, p.y, p.x);
-            Curve25519::mul(B, B, C);
-            Curve25519::mul(C, result.t, p.t);
-            Curve25519::mul_P(C, C, numDx2);
-            Curve25519::mul(D, result.z, p.z);
-            Curve25519::add(D, D, D);
-            Curve25519::sub(q.t, B, A);             // E = B - A
-            Curve25519::sub(q.z, D, C);             // F = D - C
-            Curve25519::add(D, D, C);               // G = D + C
-            Curve25519::add(B, B, A);               // H = B + A
+            Curve25519::fieldSub(A, result.y, result.x);
+            Curve25519::fieldSub(C, p.y, p.x);
+            Curve25519::fieldMul(A, A, C);
+            Curve25519::fieldAdd(B, result.y, result.x);
+            Curve25519::fieldAdd(C, p.y, p.x);
+            Curve25519::fieldMul(B, B, C);
+            Curve25519::fieldMul(C, result.t, p.t);
+            Curve25519::fieldMul_P(C, C, numDx2);
+            Curve25519::fieldMul(D, result.z, p.z);
+            Curve25519::fieldAdd(D, D, D);
+            Curve25519::fieldSub(q.t, B, A);        // E = B - A
+            Curve25519::fieldSub(q.z, D, C);        // F = D - C
+            Curve25519::fieldAdd(D, D, C);          // G = D + C
+            Curve25519::fieldAdd(B, B, A);          // H = B + A
             if (constTime) {
                 // Put the intermediate value into q.
-                Curve25519::mul(q.x, q.t, q.z);         // q.x = E * F
-                Curve25519::mul(q.y, D, B);             // q.y = G * H
-                Curve25519::mul(q.z, q.z, D);           // q.z = F * G
-                Curve25519::mul(q.t, q.t, B);           // q.t = E * H
+                Curve25519::fieldMul(q.x, q.t, q.z);    // q.x = E * F
+                Curve25519::fieldMul(q.y, D, B);        // q.y = G * H
+                Curve25519::fieldMul(q.z, q.z, D);      // q.z = F * G
+                Curve25519::fieldMul(q.t, q.t, B);      // q.t = E * H
 
                 // Copy q into the result if the current bit of s is 1.
-                Curve25519::cmove(select, result.x, q.x);
-                Curve25519::cmove(select, result.y, q.y);
-                Curve25519::cmove(select, result.z, q.z);
-                Curve25519::cmove(select, result.t, q.t);
+                Curve25519::fieldCmove(select, result.x, q.x);
+                Curve25519::fieldCmove(select, result.y, q.y);
+                Curve25519::fieldCmove(select, result.z, q.z);
+                Curve25519::fieldCmove(select, result.t, q.t);
             } else {
                 // Put the intermediate value directly into the result.
-                Curve25519::mul(result.x, q.t, q.z);     // q.x = E * F
-                Curve25519::mul(result.y, D, B);         // q.y = G * H
-                Curve25519::mul(result.z, q.z, D);       // q.z = F * G
-                Curve25519::mul(result.t, q.t, B);       // q.t = E * H
+                Curve25519::fieldMul(result.x, q.t, q.z); // q.x = E * F
+                Curve25519::fieldMul(result.y, D, B);     // q.y = G * H
+                Curve25519::fieldMul(result.z, q.z, D);   // q.z = F * G
+                Curve25519::fieldMul(result.t, q.t, B);   // q.t = E * H
             }
         }
 
         // Double p for the next iteration.
-        Curve25519::sub(A, p.y, p.x);
-        Curve25519::square(A, A);
-        Curve25519::add(B, p.y, p.x);
-        Curve25519::square(B, B);
-        Curve25519::square(C, p.t);
-        Curve25519::mul_P(C, C, numDx2);
-        Curve25519::square(D, p.z);
-        Curve25519::add(D, D, D);
-        Curve25519::sub(p.t, B, A);             // E = B - A
-        Curve25519::sub(p.z, D, C);             // F = D - C
-        Curve25519::add(D, D, C);               // G = D + C
-        Curve25519::add(B, B, A);               // H = B + A
-        Curve25519::mul(p.x, p.t, p.z);         // p.x = E * F
-        Curve25519::mul(p.y, D, B);             // p.y = G * H
-        Curve25519::mul(p.z, p.z, D);           // p.z = F * G
-        Curve25519::mul(p.t, p.t, B);           // p.t = E * H
+        dbl(p);
 
         // Move onto the next bit of s from lowest to highest.
         if (mask != (((limb_t)1) << (LIMB_BITS - 1))) {
@@ -450,14 +901,72 @@ void Ed25519::mul(Point &result, const limb_t *s, Point &p, bool constTime)
  * \param s The value, which must be NUM_LIMBS_256BIT limbs in size.
  * \param constTime Set to true if the evaluation must be constant-time
  * because \a s is a secret values.
+ *
+ * When \a constTime is true, \a s must be less than 2^255.  The value is
+ * split into 64 signed 4-bit digits and the result is accumulated from
+ * the precomputed multiples of B in two passes of 32 additions each,
+ * separated by 4 doublings.  Table entries are selected in constant time.
  */
 void Ed25519::mul(Point &result, const limb_t *s, bool constTime)
 {
+#if defined(ED25519_FIXED_BASE)
+    if (constTime) {
+        PointPrecomp q;
+        int8_t e[64];
+        int8_t carry;
+        uint8_t posn;
+
+        // Convert s into 64 radix-16 digits, and then adjust the digits
+        // to be between -8 and 8 inclusive.  The top digit cannot exceed
+        // 8 because the top bit of s is zero.
+        for (posn = 0; posn < 64; ++posn) {
+            e[posn] = (int8_t)((s[posn / (LIMB_BITS / 4)] >>
+                                (4 * (posn % (LIMB_BITS / 4)))) & 0x0F);
+        }
+        carry = 0;
+        for (posn = 0; posn < 63; ++posn) {
+            e[posn] += carry;
+            carry = (e[posn] + 8) >> 4;
+            e[posn] -= carry << 4;
+        }
+        e[63] += carry;
+
+        // Initialize the result to (0, 1, 1, 0).
+        memset(&result, 0, sizeof(Point));
+        result.y[0] = 1;
+        result.z[0] = 1;
+
+        // Add e[i] * 16^(i - 1) * B for the odd digits, multiply by 16,
+        // and then add e[i] * 16^i * B for the even digits.
+        for (posn = 1; posn < 64; posn += 2) {
+            lookupBase(q, posn / 2, e[posn]);
+            add(result, q);
+        }
+        dbl(result);
+        dbl(result);
+        dbl(result);
+        dbl(result);
+        for (posn = 0; posn < 64; posn += 2) {
+            lookupBase(q, posn / 2, e[posn]);
+            add(result, q);
+        }
+
+        // Clean up and exit.
+        clean(q);
+        clean(e);
+        return;
+    }
+#endif
+
     Point P;
-    memcpy_P(P.x, numBx, sizeof(P.x));
-    memcpy_P(P.y, numBy, sizeof(P.y));
-    memcpy_P(P.z, numBz, sizeof(P.z));
-    memcpy_P(P.t, numBt, sizeof(P.t));
+    memcpy_P(P.x, numBx, sizeof(numBx));
+    memcpy_P(P.y, numBy, sizeof(numBy));
+    memcpy_P(P.z, numBz, sizeof(numBz));
+    memcpy_P(P.t, numBt, sizeof(numBt));
+    Curve25519::fieldUnpack(P.x, P.x);
+    Curve25519::fieldUnpack(P.y, P.y);
+    Curve25519::fieldUnpack(P.z, P.z);
+    Curve25519::fieldUnpack(P.t, P.t);
     mul(result, s, P, constTime);
     clean(P);
 }
@@ -470,29 +979,184 @@ void Ed25519::mul(Point &result, const limb_t *s, bool constTime)
  */
 void Ed25519::add(Point &p, const Point &q)
 {
-    limb_t A[NUM_LIMBS_256BIT];
-    limb_t B[NUM_LIMBS_256BIT];
-    limb_t C[NUM_LIMBS_256BIT];
-    limb_t D[NUM_LIMBS_256BIT];
-
-    Curve25519::sub(A, p.y, p.x);
-    Curve25519::sub(C, q.y, q.x);
-    Curve25519::mul(A, A, C);
-    Curve25519::add(B, p.y, p.x);
-    Curve25519::add(C, q.y, q.x);
-    Curve25519::mul(B, B, C);
-    Curve25519::mul(C, p.t, q.t);
-    Curve25519::mul_P(C, C, numDx2);
-    Curve25519::mul(D, p.z, q.z);
-    Curve25519::add(D, D, D);
-    Curve25519::sub(p.t, B, A);             // E = B - A
-    Curve25519::sub(p.z, D, C);             // F = D - C
-    Curve25519::add(D, D, C);               // G = D + C
-    Curve25519::add(B, B, A);               // H = B + A
-    Curve25519::mul(p.x, p.t, p.z);         // p.x = E * F
-    Curve25519::mul(p.y, D, B);             // p.y = G * H
-    Curve25519::mul(p.z, p.z, D);           // p.z = F * G
-    Curve25519::mul(p.t, p.t, B);           // p.t = E * H
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+
+    Curve25519::fieldSub(A, p.y, p.x);
+    Curve25519::fieldSub(C, q.y, q.x);
+    Curve25519::fieldMul(A, A, C);
+    Curve25519::fieldAdd(B, p.y, p.x);
+    Curve25519::fieldAdd(C, q.y, q.x);
+    Curve25519::fieldMul(B, B, C);
+    Curve25519::fieldMul(C, p.t, q.t);
+    Curve25519::fieldMul_P(C, C, numDx2);
+    Curve25519::fieldMul(D, p.z, q.z);
+    Curve25519::fieldAdd(D, D, D);
+    Curve25519::fieldSub(p.t, B, A);        // E = B - A
+    Curve25519::fieldSub(p.z, D, C);        // F = D - C
+    Curve25519::fieldAdd(D, D, C);          // G = D + C
+    Curve25519::fieldAdd(B, B, A);          // H = B + A
+    Curve25519::fieldMul(p.x, p.t, p.z);    // p.x = E * F
+    Curve25519::fieldMul(p.y, D, B);        // p.y = G * H
+    Curve25519::fieldMul(p.z, p.z, D);      // p.z = F * G
+    Curve25519::fieldMul(p.t, p.t, B);      // p.t = E * H
+
+    clean(A);
+    clean(B);
+    clean(C);
+    clean(D);
+}
+
+/**
+ * \brief Adds a precomputed affine point to a curve point.
+ *
+ * \param p The first point and the result.
+ * \param q The precomputed point to add.
+ * \param negate Set to true to subtract \a q from \a p instead.
+ */
+void Ed25519::add(Point &p, const PointPrecomp &q, bool negate)
+{
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+
+    // Same as adding two curve points but we can skip the multiplications
+    // by 2 * d and by q.z because they are included in the precomputation.
+    // Negating q swaps y + x with y - x and negates 2 * d * x * y.
+    Curve25519::fieldSub(A, p.y, p.x);
+    Curve25519::fieldMul(A, A, negate ? q.ypx : q.ymx);
+    Curve25519::fieldAdd(B, p.y, p.x);
+    Curve25519::fieldMul(B, B, negate ? q.ymx : q.ypx);
+    Curve25519::fieldMul(C, p.t, q.xy2d);
+    Curve25519::fieldAdd(D, p.z, p.z);
+    Curve25519::fieldSub(p.t, B, A);        // E = B - A
+    if (!negate) {
+        Curve25519::fieldSub(p.z, D, C);    // F = D - C
+        Curve25519::fieldAdd(D, D, C);      // G = D + C
+    } else {
+        Curve25519::fieldAdd(p.z, D, C);    // F = D + C
+        Curve25519::fieldSub(D, D, C);      // G = D - C
+    }
+    Curve25519::fieldAdd(B, B, A);          // H = B + A
+    Curve25519::fieldMul(p.x, p.t, p.z);    // p.x = E * F
+    Curve25519::fieldMul(p.y, D, B);        // p.y = G * H
+    Curve25519::fieldMul(p.z, p.z, D);      // p.z = F * G
+    Curve25519::fieldMul(p.t, p.t, B);      // p.t = E * H
+
+    clean(A);
+    clean(B);
+    clean(C);
+    clean(D);
+}
+
+/**
+ * \brief Adds a cached projective point to a curve point.
+ *
+ * \param p The first point and the result.
+ * \param q The cached point to add.
+ * \param negate Set to true to subtract \a q from \a p instead.
+ *
+ * \sa toCached()
+ */
+void Ed25519::add(Point &p, const PointCached &q, bool negate)
+{
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+
+    Curve25519::fieldSub(A, p.y, p.x);
+    Curve25519::fieldMul(A, A, negate ? q.ypx : q.ymx);
+    Curve25519::fieldAdd(B, p.y, p.x);
+    Curve25519::fieldMul(B, B, negate ? q.ymx : q.ypx);
+    Curve25519::fieldMul(C, p.t, q.t2d);
+    Curve25519::fieldMul(D, p.z, q.z);
+    Curve25519::fieldAdd(D, D, D);
+    Curve25519::fieldSub(p.t, B, A);        // E = B - A
+    if (!negate) {
+        Curve25519::fieldSub(p.z, D, C);    // F = D - C
+        Curve25519::fieldAdd(D, D, C);      // G = D + C
+    } else {
+        Curve25519::fieldAdd(p.z, D, C);    // F = D + C
+        Curve25519::fieldSub(D, D, C);      // G = D - C
+    }
+    Curve25519::fieldAdd(B, B, A);          // H = B + A
+    Curve25519::fieldMul(p.x, p.t, p.z);    // p.x = E * F
+    Curve25519::fieldMul(p.y, D, B);        // p.y = G * H
+    Curve25519::fieldMul(p.z, p.z, D);      // p.z = F * G
+    Curve25519::fieldMul(p.t, p.t, B);      // p.t = E * H
+
+    clean(A);
+    clean(B);
+    clean(C);
+    clean(D);
+}
+
+/**
+ * \brief Converts a curve point into cached form for repeated additions.
+ *
+ * \param c The cached form of the point.
+ * \param p The curve point to convert.
+ *
+ * \sa add()
+ */
+void Ed25519::toCached(PointCached &c, const Point &p)
+{
+    Curve25519::fieldAdd(c.ypx, p.y, p.x);
+    Curve25519::fieldSub(c.ymx, p.y, p.x);
+    memcpy(c.z, p.z, sizeof(c.z));
+    Curve25519::fieldMul_P(c.t2d, p.t, numDx2);
+}
+
+/**
+ * \brief Converts an affine curve point into precomputed form.
+ *
+ * \param c The precomputed form of the point.
+ * \param p The curve point to convert, which must have z = 1.
+ *
+ * \sa add()
+ */
+void Ed25519::toPrecomp(PointPrecomp &c, const Point &p)
+{
+    Curve25519::fieldAdd(c.ypx, p.y, p.x);
+    Curve25519::fieldSub(c.ymx, p.y, p.x);
+    Curve25519::fieldMul_P(c.xy2d, p.t, numDx2);
+}
+
+/**
+ * \brief Doubles a curve point.
+ *
+ * \param p The point to double and the result.
+ *
+ * This uses the dedicated doubling formula for twisted Edwards curves
+ * with a = -1, which does not need the t co-ordinate of the input.
+ * The result is negated in all four co-ordinates, which represents
+ * the same point, to avoid explicit negations.
+ */
+void Ed25519::dbl(Point &p)
+{
+    limb_t A[NUM_LIMBS_FIELD25519];
+    limb_t B[NUM_LIMBS_FIELD25519];
+    limb_t C[NUM_LIMBS_FIELD25519];
+    limb_t D[NUM_LIMBS_FIELD25519];
+
+    Curve25519::fieldSquare(A, p.x);        // A = x^2
+    Curve25519::fieldSquare(B, p.y);        // B = y^2
+    Curve25519::fieldSquare(C, p.z);        // C = 2 * z^2
+    Curve25519::fieldAdd(C, C, C);
+    Curve25519::fieldAdd(D, p.x, p.y);      // D = (x + y)^2
+    Curve25519::fieldSquare(D, D);
+    Curve25519::fieldAdd(p.t, A, B);        // H = A + B
+    Curve25519::fieldSub(p.z, B, A);        // G = B - A
+    Curve25519::fieldSub(D, D, p.t);        // E = D - H
+    Curve25519::fieldSub(C, C, p.z);        // F = C - G
+    Curve25519::fieldMul(p.x, D, C);        // p.x = E * F
+    Curve25519::fieldMul(p.y, p.z, p.t);    // p.y = G * H
+    Curve25519::fieldMul(p.t, D, p.t);      // p.t = E * H
+    Curve25519::fieldMul(p.z, C, p.z);      // p.z = F * G
 
     clean(A);
     clean(B);
@@ -500,6 +1164,408 @@ void Ed25519::add(Point &p, const Point &q)
     clean(D);
 }
 
+/**
+ * \brief Looks up a multiple of the base point in the precomputed tables.
+ *
+ * \param q The point that was looked up.
+ * \param posn The table position between 0 and 31.
+ * \param b The signed multiple between -8 and 8 to look up.
+ *
+ * The result is b * 256^posn * B.  Every entry in the table row is
+ * read so that the memory access pattern does not reveal \a b.
+ */
+void Ed25519::lookupBase(PointPrecomp &q, uint8_t posn, int8_t b)
+{
+#if defined(ED25519_FIXED_BASE)
+    limb_t entry[3][NUM_LIMBS_256BIT];
+    limb_t temp[NUM_LIMBS_FIELD25519];
+    uint8_t bneg = ((uint8_t)b) >> 7;
+    uint8_t babs = (uint8_t)(b - (((-bneg) & b) << 1));
+    limb_t select;
+
+    // Start with the identity (1, 1, 0) and then select the k'th
+    // table entry if k is equal to the absolute value of b.
+    memset(&q, 0, sizeof(q));
+    q.ypx[0] = 1;
+    q.ymx[0] = 1;
+    for (uint8_t k = 1; k <= 8; ++k) {
+        memcpy_P(entry, ed25519_comb[posn][k - 1], sizeof(entry));
+        select = (limb_t)((((uint32_t)(babs ^ k)) - 1U) >> 31);
+        Curve25519::cmove(select, q.ypx, entry[0]);
+        Curve25519::cmove(select, q.ymx, entry[1]);
+        Curve25519::cmove(select, q.xy2d, entry[2]);
+    }
+    Curve25519::fieldUnpack(q.ypx, q.ypx);
+    Curve25519::fieldUnpack(q.ymx, q.ymx);
+    Curve25519::fieldUnpack(q.xy2d, q.xy2d);
+
+    // Negate the point if b is negative by swapping y + x and y - x,
+    // and negating 2 * d * x * y.
+    Curve25519::fieldCswap(bneg, q.ypx, q.ymx);
+    memset(temp, 0, sizeof(temp));
+    Curve25519::fieldSub(temp, temp, q.xy2d);
+    Curve25519::fieldCmove(bneg, q.xy2d, temp);
+
+    // Clean up.
+    clean(entry);
+    clean(temp);
+#endif
+}
+
+/**
+ * \brief Recodes a scalar into width-w non-adjacent form.
+ *
+ * \param naf The 256 signed digits of the result, from least significant
+ * to most significant.
+ * \param s The scalar to recode, which must be NUM_LIMBS_256BIT limbs in
+ * size and less than 2^255.
+ * \param w The window width, between 2 and 8.
+ *
+ * Every non-zero digit is odd and less than 2^(w - 1) in absolute value,
+ * and is followed by at least w - 1 zero digits.
+ *
+ * \note This function is not constant time so it should only be used
+ * on publicly-known values.
+ */
+void Ed25519::recodeWNAF(int8_t naf[256], const limb_t *s, uint8_t w)
+{
+    uint16_t bit = 0;
+    uint8_t carry = 0;
+    uint8_t now, posn;
+    int16_t word;
+
+    #define wnaf_bit(n) ((uint8_t)((s[(n) / LIMB_BITS] >> ((n) % LIMB_BITS)) & 1))
+    memset(naf, 0, 256);
+    while (bit < 256) {
+        // Skip over bits that are the same as the carry.
+        if (wnaf_bit(bit) == carry) {
+            ++bit;
+            continue;
+        }
+
+        // Extract the next w bits and convert them into a signed digit.
+        now = w;
+        if (now > (256 - bit))
+            now = 256 - bit;
+        word = carry;
+        for (posn = 0; posn < now; ++posn)
+            word += ((int16_t)wnaf_bit(bit + posn)) << posn;
+        carry = (uint8_t)((word >> (w - 1)) & 1);
+        word -= ((int16_t)carry) << w;
+        naf[bit] = (int8_t)word;
+        bit += now;
+    }
+    #undef wnaf_bit
+}
+
+#if defined(ED25519_FIXED_BASE)
+
+/**
+ * \brief Computes the odd multiples of a curve point.
+ *
+ * \param table The odd multiples p, 3p, ..., 15p in cached form.
+ * \param p The curve point.
+ */
+void Ed25519::oddMultiples(PointCached table[8], const Point &p)
+{
+    Point temp;
+
+    memcpy(&temp, &p, sizeof(Point));
+    dbl(temp);
+    toCached(table[7], temp);
+    memcpy(&temp, &p, sizeof(Point));
+    toCached(table[0], temp);
+    for (uint8_t index = 1; index < 8; ++index) {
+        add(temp, table[7]);
+        toCached(table[index], temp);
+    }
+    clean(temp);
+}
+
+/**
+ * \brief Computes s * B + k * p, where B is the base point.
+ *
+ * \param result The result of the computation.
+ * \param s The multiplier for B, which must be NUM_LIMBS_256BIT limbs
+ * in size and less than 2^255.
+ * \param k The multiplier for p, which must be NUM_LIMBS_256BIT limbs
+ * in size and less than 2^255.
+ * \param table The odd multiples p, 3p, ..., 15p in cached or
+ * precomputed form.
+ *
+ * Both multiplications share a single chain of doublings.  The multiples
+ * of B come from a precomputed table of odd multiples and \a s is recoded
+ * with a width-7 NAF.  The scalar \a k is recoded with a width-5 NAF.
+ *
+ * \note This function is not constant time so it should only be used
+ * on publicly-known values.
+ *
+ * \sa oddMultiples()
+ */
+template <typename T>
+void Ed25519::jointMul(Point &result, const limb_t *s, const limb_t *k,
+                       const T *table)
+{
+    PointPrecomp q;
+    int8_t nafS[256];
+    int8_t nafK[256];
+    int16_t posn;
+    int8_t digit;
+
+    // Recode the scalars.
+    recodeWNAF(nafS, s, 7);
+    recodeWNAF(nafK, k, 5);
+
+    // Initialize the result to (0, 1, 1, 0).
+    memset(&result, 0, sizeof(Point));
+    result.y[0] = 1;
+    result.z[0] = 1;
+
+    // Find the most significant non-zero digit.
+    posn = 255;
+    while (posn >= 0 && !nafS[posn] && !nafK[posn])
+        --posn;
+
+    // Double the result and add in the multiples for each digit.
+    for (; posn >= 0; --posn) {
+        dbl(result);
+        digit = nafS[posn];
+        if (digit) {
+            uint8_t index = (uint8_t)((digit < 0 ? -digit : digit) / 2);
+            memcpy_P(q.ypx, ed25519_odd[index][0], sizeof(ed25519_odd[index][0]));
+            memcpy_P(q.ymx, ed25519_odd[index][1], sizeof(ed25519_odd[index][1]));
+            memcpy_P(q.xy2d, ed25519_odd[index][2], sizeof(ed25519_odd[index][2]));
+            Curve25519::fieldUnpack(q.ypx, q.ypx);
+            Curve25519::fieldUnpack(q.ymx, q.ymx);
+            Curve25519::fieldUnpack(q.xy2d, q.xy2d);
+            add(result, q, digit < 0);
+        }
+        digit = nafK[posn];
+        if (digit > 0)
+            add(result, table[digit / 2]);
+        else if (digit < 0)
+            add(result, table[(-digit) / 2], true);
+    }
+
+    // Clean up.
+    clean(q);
+}
+
+#endif // ED25519_FIXED_BASE
+
+#if defined(ED25519_BATCH_SIZE)
+
+/**
+ * \brief Verifies a group of signatures with a single multi-scalar
+ * multiplication.
+ *
+ * \param signatures The signature values to be verified.
+ * \param publicKeys The public keys to use to verify each signature.
+ * \param messages The messages whose signatures are to be verified.
+ * \param lens The lengths of the \a messages to be verified.
+ * \param count The number of signatures to verify, between 1 and
+ * ED25519_BATCH_SIZE.
+ *
+ * \return Returns true if the combined verification equation holds.
+ *
+ * For random z[i], this checks that 8 times the following is the identity:
+ *
+ * -(sum z[i] * s[i]) * B + sum z[i] * R[i] + sum (z[i] * k[i]) * A[i]
+ *
+ * The sum is evaluated with Pippenger's bucket method using signed
+ * c-bit windows.  The z[i] multipliers are only 128 bits in size so
+ * the R[i] points drop out of the upper windows.
+ */
+bool Ed25519::verifyGroup(const uint8_t * const signatures[],
+                          const uint8_t * const publicKeys[],
+                          const void * const messages[], const size_t lens[],
+                          size_t count)
+{
+    SHA512 hash;
+    SHA512 seedHash;
+    uint8_t *buf = (uint8_t *)(hash.state.w); // Reuse hash buffer to save memory.
+    PointPrecomp points[ED25519_BATCH_SIZE * 2 + 1];
+    limb_t scalars[ED25519_BATCH_SIZE * 2 + 1][NUM_LIMBS_256BIT + 1];
+    Point buckets[ED25519_BATCH_BUCKETS];
+    bool used[ED25519_BATCH_BUCKETS];
+    limb_t temp[NUM_LIMBS_512BIT + 1];
+    limb_t z[NUM_LIMBS_256BIT];
+    uint8_t seed[64];
+    Point P, sum, running, result;
+    size_t index, npoints;
+    uint16_t posn;
+    uint8_t c, windows, window, bit, bucket, block;
+    int8_t digit;
+    bool haveSum, haveRunning;
+    bool ok = false;
+
+    // Decode R[i] and A[i], compute k[i] mod q, and reduce s[i] mod q.
+    // The s[i] values are stored in the slots for R[i] for now.
+    // The seed for the z[i] values is the hash of some random data
+    // and all of the signatures and k's.
+    seedHash.reset();
+    RNG.rand(seed, sizeof(seed));
+    seedHash.update(seed, sizeof(seed));
+    for (index = 0; index < count; ++index) {
+        if (!decodePoint(P, signatures[index]))
+            goto cleanup;
+        toPrecomp(points[index * 2 + 1], P);
+        if (!decodePoint(P, publicKeys[index]))
+            goto cleanup;
+        toPrecomp(points[index * 2 + 2], P);
+        hash.reset();
+        hash.update(signatures[index], 32);
+        hash.update(publicKeys[index], 32);
+        hash.update(messages[index], lens[index]);
+        hash.finalize(buf, 0);
+        seedHash.update(signatures[index], 64);
+        seedHash.update(buf, 64);
+        reduceQFromBuffer(scalars[index * 2 + 2], buf, temp);
+        reduceSFromSignature(scalars[index * 2 + 1], signatures[index], temp);
+    }
+    seedHash.finalize(seed, 0);
+
+    // Generate z[i] and then compute the scalars for B, R[i], and A[i].
+    // Each block of hash output provides four 128-bit z[i] values.
+    memset(scalars[0], 0, sizeof(scalars[0]));
+    for (index = 0; index < count; ++index) {
+        if ((index % 4) == 0) {
+            block = (uint8_t)(index / 4);
+            hash.reset();
+            hash.update(seed, sizeof(seed));
+            hash.update(&block, 1);
+            hash.finalize(buf, 0);
+        }
+        BigNumberUtil::unpackLE(z, NUM_LIMBS_256BIT, buf + (index % 4) * 16, 16);
+        Curve25519::mulNoReduce(temp, z, scalars[index * 2 + 1]);
+        temp[NUM_LIMBS_512BIT] = 0;
+        reduceQ(temp, temp);
+        BigNumberUtil::add(scalars[0], scalars[0], temp, NUM_LIMBS_256BIT);
+        BigNumberUtil::reduceQuick_P(scalars[0], scalars[0], numQ, NUM_LIMBS_256BIT);
+        memcpy(scalars[index * 2 + 1], z, sizeof(z));
+        Curve25519::mulNoReduce(temp, z, scalars[index * 2 + 2]);
+        temp[NUM_LIMBS_512BIT] = 0;
+        reduceQ(scalars[index * 2 + 2], temp);
+    }
+
+    // The first point is -B.
+    memcpy_P(P.x, numBx, sizeof(numBx));
+    memcpy_P(P.y, numBy, sizeof(numBy));
+    memcpy_P(P.t, numBt, sizeof(numBt));
+    Curve25519::fieldUnpack(P.x, P.x);
+    Curve25519::fieldUnpack(P.y, P.y);
+    Curve25519::fieldUnpack(P.t, P.t);
+    memset(temp, 0, sizeof(temp));
+    Curve25519::fieldSub(P.x, temp, P.x);
+    Curve25519::fieldSub(P.t, temp, P.t);
+    toPrecomp(points[0], P);
+
+    // Choose the window size that minimizes the number of additions.
+    npoints = count * 2 + 1;
+    if (count < 12)
+        c = 3;
+    else if (count < 32)
+        c = 4;
+    else
+        c = 5;
+    windows = (254 + c - 1) / c;
+
+    // Add 2^(c - 1) to every window of the scalars so that the signed
+    // digits between -2^(c - 1) and 2^(c - 1) - 1 can be extracted
+    // without carries.  All scalars are less than q < 2^253 so the
+    // top window cannot overflow.
+    memset(temp, 0, sizeof(temp));
+    for (window = 0; window < windows; ++window) {
+        posn = window * c + c - 1;
+        temp[posn / LIMB_BITS] |= ((limb_t)1) << (posn % LIMB_BITS);
+    }
+    for (index = 0; index < npoints; ++index) {
+        scalars[index][NUM_LIMBS_256BIT] = 0;
+        BigNumberUtil::add(scalars[index], scalars[index], temp,
+                           NUM_LIMBS_256BIT + 1);
+    }
+
+    // Initialize the result to (0, 1, 1, 0).
+    memset(&result, 0, sizeof(Point));
+    result.y[0] = 1;
+    result.z[0] = 1;
+
+    // Process the windows from the most significant down.
+    for (window = windows; window-- > 0; ) {
+        for (bit = 0; bit < c; ++bit)
+            dbl(result);
+
+        // Sort the points into buckets by the absolute value of their digit.
+        memset(used, 0, sizeof(used));
+        posn = window * c;
+        for (index = 0; index < npoints; ++index) {
+            limb_t word = scalars[index][posn / LIMB_BITS] >> (posn % LIMB_BITS);
+            if ((posn % LIMB_BITS) > (LIMB_BITS - c))
+                word |= scalars[index][posn / LIMB_BITS + 1] << (LIMB_BITS - posn % LIMB_BITS);
+            digit = (int8_t)(word & ((1 << c) - 1)) - (int8_t)(1 << (c - 1));
+            if (!digit)
+                continue;
+            bucket = (uint8_t)((digit < 0 ? -digit : digit) - 1);
+            if (!used[bucket]) {
+                memset(&(buckets[bucket]), 0, sizeof(Point));
+                buckets[bucket].y[0] = 1;
+                buckets[bucket].z[0] = 1;
+                used[bucket] = true;
+            }
+            add(buckets[bucket], points[index], digit < 0);
+        }
+
+        // Compute the sum of (bucket + 1) * buckets[bucket] with
+        // a running sum from the highest bucket down.
+        haveSum = false;
+        haveRunning = false;
+        for (bucket = (uint8_t)(1 << (c - 1)); bucket-- > 0; ) {
+            if (used[bucket]) {
+                if (haveRunning) {
+                    add(running, buckets[bucket]);
+                } else {
+                    memcpy(&running, &(buckets[bucket]), sizeof(Point));
+                    haveRunning = true;
+                }
+            }
+            if (haveRunning) {
+                if (haveSum) {
+                    add(sum, running);
+                } else {
+                    memcpy(&sum, &running, sizeof(Point));
+                    haveSum = true;
+                }
+            }
+        }
+        if (haveSum)
+            add(result, sum);
+    }
+
+    // The combined equation holds if 8 times the result is the identity.
+    dbl(result);
+    dbl(result);
+    dbl(result);
+    memset(&P, 0, sizeof(Point));
+    P.y[0] = 1;
+    P.z[0] = 1;
+    ok = equal(result, P);
+
+cleanup:
+    clean(points);
+    clean(scalars);
+    clean(buckets);
+    clean(temp);
+    clean(z);
+    clean(seed);
+    clean(P);
+    clean(sum);
+    clean(running);
+    clean(result);
+    return ok;
+}
+
+#endif // ED25519_BATCH_SIZE
+
 /**
  * \brief Determine if two curve points are equal.
  *
@@ -510,23 +1576,49 @@ void Ed25519::add(Point &p, const Point &q)
  */
 bool Ed25519::equal(const Point &p, const Point &q)
 {
-    limb_t a[NUM_LIMBS_256BIT];
-    limb_t b[NUM_LIMBS_256BIT];
+    limb_t a[NUM_LIMBS_FIELD25519];
+    limb_t b[NUM_LIMBS_FIELD25519];
     bool result = true;
 
-    Curve25519::mul(a, p.x, q.z);
-    Curve25519::mul(b, q.x, p.z);
-    result &= secure_compare(a, b, sizeof(a));
+    Curve25519::fieldMul(a, p.x, q.z);
+    Curve25519::fieldMul(b, q.x, p.z);
+    Curve25519::fieldPack(a, a);
+    Curve25519::fieldPack(b, b);
+    result &= secure_compare(a, b, NUM_LIMBS_256BIT * sizeof(limb_t));
 
-    Curve25519::mul(a, p.y, q.z);
-    Curve25519::mul(b, q.y, p.z);
-    result &= secure_compare(a, b, sizeof(a));
+    Curve25519::fieldMul(a, p.y, q.z);
+    Curve25519::fieldMul(b, q.y, p.z);
+    Curve25519::fieldPack(a, a);
+    Curve25519::fieldPack(b, b);
+    result &= secure_compare(a, b, NUM_LIMBS_256BIT * sizeof(limb_t));
 
     clean(a);
     clean(b);
     return result;
 }
 
+/**
+ * \brief Determine if two curve points are equal after multiplying
+ * them by the cofactor 8.
+ *
+ * \param p The first curve point, which is modified.
+ * \param q The second curve point, which is modified.
+ *
+ * \return Returns true if 8 * \a p and 8 * \a q are equal; false otherwise.
+ */
+bool Ed25519::equalCofactor(Point &p, Point &q)
+{
+    // Doubling does not use the t co-ordinate, so it doesn't matter
+    // if the caller has used it as a temporary buffer.
+    dbl(p);
+    dbl(p);
+    dbl(p);
+    dbl(q);
+    dbl(q);
+    dbl(q);
+    return equal(p, q);
+}
+
 /**
  * \brief Encodes a curve point into a 32-byte buffer.
  *
@@ -543,9 +1635,11 @@ void Ed25519::encodePoint(uint8_t *buf, Point &point)
     //      x = x * zinv  mod p
     //      y = y * zinv  mod p
     // We don't need the t coordinate, so use that to store zinv temporarily.
-    Curve25519::recip(point.t, point.z);
-    Curve25519::mul(point.x, point.x, point.t);
-    Curve25519::mul(point.y, point.y, point.t);
+    Curve25519::fieldRecip(point.t, point.z);
+    Curve25519::fieldMul(point.x, point.x, point.t);
+    Curve25519::fieldMul(point.y, point.y, point.t);
+    Curve25519::fieldPack(point.x, point.x);
+    Curve25519::fieldPack(point.y, point.y);
 
     // Copy the lowest bit of x to the highest bit of y.
     point.y[NUM_LIMBS_256BIT - 1] |= (point.x[0] << (LIMB_BITS - 1));
@@ -568,7 +1662,9 @@ void Ed25519::encodePoint(uint8_t *buf, Point &point)
  */
 bool Ed25519::decodePoint(Point &point, const uint8_t *buf)
 {
-    limb_t temp[NUM_LIMBS_256BIT];
+    limb_t u[NUM_LIMBS_FIELD25519];
+    limb_t temp[NUM_LIMBS_FIELD25519];
+    bool ok = false;
 
     // Convert the input buffer from little-endian into the limbs of y.
     BigNumberUtil::unpackLE(point.y, NUM_LIMBS_256BIT, buf, 32);
@@ -576,44 +1672,45 @@ bool Ed25519::decodePoint(Point &point, const uint8_t *buf)
     // The high bit of y is the sign bit for x.
     limb_t sign = point.y[NUM_LIMBS_256BIT - 1] >> (LIMB_BITS - 1);
     point.y[NUM_LIMBS_256BIT - 1] &= ~(((limb_t)1) << (LIMB_BITS - 1));
+    Curve25519::fieldUnpack(point.y, point.y);
 
     // Set z to 1.
-    memcpy_P(point.z, numBz, sizeof(point.z));
-
-    // Compute t = (y * y - 1) * modinv(d * y * y + 1).
-    Curve25519::square(point.t, point.y);
-    Curve25519::sub(point.x, point.t, point.z);
-    Curve25519::mul_P(point.t, point.t, numD);
-    Curve25519::add(point.t, point.t, point.z);
-    Curve25519::recip(temp, point.t);
-    Curve25519::mul(point.t, point.x, temp);
-    clean(temp);
+    memset(point.z, 0, sizeof(point.z));
+    point.z[0] = 1;
 
-    // Check for t = 0.
-    limb_t check = point.t[0];
-    for (uint8_t posn = 1; posn < NUM_LIMBS_256BIT; ++posn)
-        check |= point.t[posn];
-    if (!check) {
-        // If the sign bit is set, then decoding has failed.
-        // Otherwise x is zero and we're done.
-        if (sign)
-            return false;
-        memset(point.x, 0, sizeof(point.x));
-        return true;
-    }
+    // Compute u = y * y - 1 and v = d * y * y + 1, and then recover x
+    // by taking the square root of u / v.  The value v is stored in t.
+    Curve25519::fieldSquare(point.t, point.y);
+    Curve25519::fieldSub(u, point.t, point.z);
+    Curve25519::fieldMul_P(point.t, point.t, numD);
+    Curve25519::fieldAdd(point.t, point.t, point.z);
+    if (!Curve25519::fieldSqrtRatio(point.x, u, point.t))
+        goto cleanup;
 
-    // Recover x by taking the sqrt of t and flipping the sign if necessary.
-    if (!Curve25519::sqrt(point.x, point.t))
-        return false;
-    if (sign != (point.x[0] & ((limb_t)1))) {
+    // If x is zero and the sign bit is set, then decoding has failed.
+    // Otherwise flip the sign of x if necessary.
+    Curve25519::fieldPack(temp, point.x);
+    {
+        limb_t check = temp[0];
+        for (uint8_t posn = 1; posn < NUM_LIMBS_256BIT; ++posn)
+            check |= temp[posn];
+        if (!check && sign)
+            goto cleanup;
+    }
+    if (sign != (temp[0] & ((limb_t)1))) {
         // The signs are different so we want the other square root.
         memset(point.t, 0, sizeof(point.t));
-        Curve25519::sub(point.x, point.t, point.x);
+        Curve25519::fieldSub(point.x, point.t, point.x);
     }
 
     // Finally, t = x * y.
-    Curve25519::mul(point.t, point.x, point.y);
-    return true;
+    Curve25519::fieldMul(point.t, point.x, point.y);
+    ok = true;
+
+cleanup:
+    clean(u);
+    clean(temp);
+    return ok;
 }
 
 /**
@@ -23,17 +23,34 @@
 #ifndef CRYPTO_ED25519_h
 #define CRYPTO_ED25519_h
 
-#include "BigNumberUtil.h"
+#include "Curve25519.h"
 #include "SHA512.h"
 
+// The fixed-base tables for B need 24K of program memory, which is more
+// than most AVR devices can spare.  Use double-and-add on AVR instead.
+#if !defined(__AVR__)
+#define ED25519_FIXED_BASE 1
+#endif
+
 class Ed25519
 {
 public:
+    class PrivateKey;
+    class PublicKey;
+
     static void sign(uint8_t signature[64], const uint8_t privateKey[32],
                      const uint8_t publicKey[32], const void *message,
                      size_t len);
+    static void sign(uint8_t signature[64], const PrivateKey &privateKey,
+                     const void *message, size_t len);
     static bool verify(const uint8_t signature[64], const uint8_t publicKey[32],
                        const void *message, size_t len);
+    static bool verify(const uint8_t signature[64], const PublicKey &publicKey,
+                       const void *message, size_t len);
+    static bool verifyBatch(const uint8_t * const signatures[],
+                            const uint8_t * const publicKeys[],
+                            const void * const messages[], const size_t lens[],
+                            size_t count, bool *results = 0);
 
     static void generatePrivateKey(uint8_t privateKey[32]);
     static void derivePublicKey(uint8_t publicKey[32], const uint8_t privateKey[32]);
@@ -46,26 +63,111 @@ private:
     // Curve point represented in extended homogeneous coordinates.
     struct Point
     {
-        limb_t x[32 / sizeof(limb_t)];
-        limb_t y[32 / sizeof(limb_t)];
-        limb_t z[32 / sizeof(limb_t)];
-        limb_t t[32 / sizeof(limb_t)];
+        limb_t x[NUM_LIMBS_FIELD25519];
+        limb_t y[NUM_LIMBS_FIELD25519];
+        limb_t z[NUM_LIMBS_FIELD25519];
+        limb_t t[NUM_LIMBS_FIELD25519];
+    };
+
+    // Precomputed affine point represented as (y + x, y - x, 2 * d * x * y).
+    struct PointPrecomp
+    {
+        limb_t ypx[NUM_LIMBS_FIELD25519];
+        limb_t ymx[NUM_LIMBS_FIELD25519];
+        limb_t xy2d[NUM_LIMBS_FIELD25519];
+    };
+
+    // Projective point represented as (y + x, y - x, z, 2 * d * t).
+    struct PointCached
+    {
+        limb_t ypx[NUM_LIMBS_FIELD25519];
+        limb_t ymx[NUM_LIMBS_FIELD25519];
+        limb_t z[NUM_LIMBS_FIELD25519];
+        limb_t t2d[NUM_LIMBS_FIELD25519];
     };
 
     static void reduceQFromBuffer(limb_t *result, const uint8_t buf[64], limb_t *temp);
+    static void reduceSFromSignature(limb_t *result, const uint8_t signature[64], limb_t *temp);
     static void reduceQ(limb_t *result, limb_t *r);
 
     static void mul(Point &result, const limb_t *s, Point &p, bool constTime = true);
     static void mul(Point &result, const limb_t *s, bool constTime = true);
 
     static void add(Point &p, const Point &q);
+    static void add(Point &p, const PointPrecomp &q, bool negate = false);
+    static void add(Point &p, const PointCached &q, bool negate = false);
+    static void dbl(Point &p);
+
+    static void lookupBase(PointPrecomp &q, uint8_t posn, int8_t b);
+
+    static void toCached(PointCached &c, const Point &p);
+    static void toPrecomp(PointPrecomp &c, const Point &p);
+    static void recodeWNAF(int8_t naf[256], const limb_t *s, uint8_t w);
+    static void oddMultiples(PointCached table[8], const Point &p);
+    template <typename T>
+    static void jointMul(Point &result, const limb_t *s, const limb_t *k,
+                         const T *table);
+    static bool verifyGroup(const uint8_t * const signatures[],
+                            const uint8_t * const publicKeys[],
+                            const void * const messages[], const size_t lens[],
+                            size_t count);
 
     static bool equal(const Point &p, const Point &q);
+    static bool equalCofactor(Point &p, Point &q);
 
     static void encodePoint(uint8_t *buf, Point &point);
     static bool decodePoint(Point &point, const uint8_t *buf);
 
     static void deriveKeys(SHA512 *hash, limb_t *a, const uint8_t privateKey[32]);
+    static void signMessage(uint8_t signature[64], const limb_t *a, SHA512 &hash,
+                            const uint8_t publicKey[32], const void *message,
+                            size_t len);
+
+    friend class Curve25519;
+};
+
+class Ed25519::PrivateKey
+{
+public:
+    PrivateKey();
+    ~PrivateKey();
+
+    void setKey(const uint8_t privateKey[32]);
+    const uint8_t *publicKey() const { return pub; }
+
+    void clear();
+
+private:
+    limb_t a[32 / sizeof(limb_t)];
+    SHA512 prefixHash;
+    uint8_t pub[32];
+
+    friend class Ed25519;
+};
+
+class Ed25519::PublicKey
+{
+public:
+    PublicKey();
+    ~PublicKey();
+
+    bool setKey(const uint8_t publicKey[32]);
+    bool isValid() const { return valid; }
+
+    void clear();
+
+private:
+    uint8_t key[32];
+#if defined(ED25519_FIXED_BASE)
+    // Odd multiples -A, -3A, ..., -15A of the decoded key.
+    PointPrecomp table[8];
+#else
+    // Decoded key A.
+    Point point;
+#endif
+    bool valid;
+
+    friend class Ed25519;
 };
 
 #endif
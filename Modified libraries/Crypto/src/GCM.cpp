@@ -23,6 +23,8 @@
 #include "GCM.h"
 #include "Crypto.h"
 #include "utility/EndianUtil.h"
+#include "AES.h"
+#include "utility/StaticUtil.h"
 #include <string.h>
 
 /**
@@ -121,94 +123,14 @@ bool GCMCommon::setIV(const uint8_t *iv, size_t len)
     return true;
 }
 
-/**
- * \brief Increments the least significant 32 bits of the counter block.
- *
- * \param counter The counter block to increment.
- */
-static inline void increment(uint8_t counter[16])
-{
-    uint16_t carry = 1;
-    carry += counter[15];
-    counter[15] = (uint8_t)carry;
-    carry = (carry >> 8) + counter[14];
-    counter[14] = (uint8_t)carry;
-    carry = (carry >> 8) + counter[13];
-    counter[13] = (uint8_t)carry;
-    carry = (carry >> 8) + counter[12];
-    counter[12] = (uint8_t)carry;
-}
-
 void GCMCommon::encrypt(uint8_t *output, const uint8_t *input, size_t len)
 {
-    // Finalize the authenticated data if necessary.
-    if (!state.dataStarted) {
-        ghash.pad();
-        state.dataStarted = true;
-    }
-
-    // Encrypt the plaintext using the block cipher in counter mode.
-    uint8_t *out = output;
-    size_t size = len;
-    while (size > 0) {
-        // Create a new keystream block if necessary.
-        if (state.posn >= 16) {
-            increment(state.counter);
-            blockCipher->encryptBlock(state.stream, state.counter);
-            state.posn = 0;
-        }
-
-        // Encrypt as many bytes as we can using the keystream block.
-        uint8_t temp = 16 - state.posn;
-        if (temp > size)
-            temp = size;
-        uint8_t *stream = state.stream + state.posn;
-        state.posn += temp;
-        size -= temp;
-        while (temp > 0) {
-            *out++ = *input++ ^ *stream++;
-            --temp;
-        }
-    }
-
-    // Feed the ciphertext into the hash.
-    ghash.update(output, len);
-    state.dataSize += len;
+    encryptWith(*blockCipher, output, input, len);
 }
 
 void GCMCommon::decrypt(uint8_t *output, const uint8_t *input, size_t len)
 {
-    // Finalize the authenticated data if necessary.
-    if (!state.dataStarted) {
-        ghash.pad();
-        state.dataStarted = true;
-    }
-
-    // Feed the ciphertext into the hash before we decrypt it.
-    ghash.update(input, len);
-    state.dataSize += len;
-
-    // Decrypt the plaintext using the block cipher in counter mode.
-    while (len > 0) {
-        // Create a new keystream block if necessary.
-        if (state.posn >= 16) {
-            increment(state.counter);
-            blockCipher->encryptBlock(state.stream, state.counter);
-            state.posn = 0;
-        }
-
-        // Decrypt as many bytes as we can using the keystream block.
-        uint8_t temp = 16 - state.posn;
-        if (temp > len)
-            temp = len;
-        uint8_t *stream = state.stream + state.posn;
-        state.posn += temp;
-        len -= temp;
-        while (temp > 0) {
-            *output++ = *input++ ^ *stream++;
-            --temp;
-        }
-    }
+    decryptWith(*blockCipher, output, input, len);
 }
 
 void GCMCommon::addAuthData(const void *data, size_t len)
@@ -266,6 +188,108 @@ void GCMCommon::clear()
  * This object must have a block size of 128 bits (16 bytes).
  */
 
+/**
+ * \brief Encrypts data using a specific block cipher object.
+ *
+ * \param cipher The block cipher to use, which is either the BlockCipher
+ * that was passed to setBlockCipher() or a StaticBlockCipher wrapper
+ * around the same object.
+ * \param output The output buffer to write the ciphertext to.
+ * \param input The input buffer to read the plaintext from.
+ * \param len The number of bytes to encrypt.
+ *
+ * This is the implementation of encrypt().  It is a template so that
+ * StaticGCM can instantiate it on the concrete block cipher type.
+ *
+ * \sa decryptWith()
+ */
+template <typename B>
+void GCMCommon::encryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
+{
+    // Finalize the authenticated data if necessary.
+    if (!state.dataStarted) {
+        ghash.pad();
+        state.dataStarted = true;
+    }
+
+    // Encrypt the plaintext using the block cipher in counter mode.
+    encryptCTR(cipher, output, input, len);
+
+    // Feed the ciphertext into the hash.
+    ghash.update(output, len);
+    state.dataSize += len;
+}
+
+/**
+ * \brief Decrypts data using a specific block cipher object.
+ *
+ * \param cipher The block cipher to use.
+ * \param output The output buffer to write the plaintext to.
+ * \param input The input buffer to read the ciphertext from.
+ * \param len The number of bytes to decrypt.
+ *
+ * \sa encryptWith()
+ */
+template <typename B>
+void GCMCommon::decryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
+{
+    // Finalize the authenticated data if necessary.
+    if (!state.dataStarted) {
+        ghash.pad();
+        state.dataStarted = true;
+    }
+
+    // Feed the ciphertext into the hash before we decrypt it.
+    ghash.update(input, len);
+    state.dataSize += len;
+
+    // Decrypt the plaintext using the block cipher in counter mode.
+    encryptCTR(cipher, output, input, len);
+}
+
+template <typename B>
+void GCMCommon::encryptCTR(B &cipher, uint8_t *output, const uint8_t *input, size_t len)
+{
+    while (len > 0) {
+        // Create a new keystream block if necessary.
+        if (state.posn >= 16) {
+            // Increment the low 32 bits of the counter.
+            uint16_t carry = 1;
+            carry += state.counter[15];
+            state.counter[15] = (uint8_t)carry;
+            carry = (carry >> 8) + state.counter[14];
+            state.counter[14] = (uint8_t)carry;
+            carry = (carry >> 8) + state.counter[13];
+            state.counter[13] = (uint8_t)carry;
+            carry = (carry >> 8) + state.counter[12];
+            state.counter[12] = (uint8_t)carry;
+            cipher.encryptBlock(state.stream, state.counter);
+            state.posn = 0;
+        }
+
+        // Encrypt as many bytes as we can using the keystream block.
+        uint8_t temp = 16 - state.posn;
+        if (temp > len)
+            temp = len;
+        uint8_t *stream = state.stream + state.posn;
+        state.posn += temp;
+        len -= temp;
+        while (temp > 0) {
+            *output++ = *input++ ^ *stream++;
+            --temp;
+        }
+    }
+}
+
+// Instantiate the loops for the Static templates on the algorithms
+// that are listed in utility/StaticUtil.h.
+#define GCM_STATIC(T) \
+    template void GCMCommon::encryptWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *, size_t); \
+    template void GCMCommon::decryptWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *, size_t);
+CRYPTO_STATIC_BLOCK_CIPHERS(GCM_STATIC)
+
 /**
  * \class GCM GCM.h <GCM.h>
  * \brief Implementation of the Galois Counter Mode (GCM).
@@ -333,3 +357,26 @@ void GCMCommon::clear()
  * \fn GCM::GCM()
  * \brief Constructs a new GCM object for the block cipher T.
  */
+
+/**
+ * \class StaticGCM GCM.h <GCM.h>
+ * \brief Implementation of the Galois Counter Mode (GCM) that is
+ * specialized on a concrete 128-bit block cipher.
+ *
+ * This class behaves the same as GCM and can still be used through an
+ * AuthenticatedCipher pointer.  The difference is that encrypt() and
+ * decrypt() call T::encryptBlock() directly for each block of keystream
+ * instead of through the BlockCipher virtual function table.  Setting
+ * the key and IV is unchanged.  T must be one of the AES classes.
+ *
+ * \code
+ * StaticGCM<AES256> gcm;
+ * \endcode
+ *
+ * \sa GCM, StaticBlockCipher
+ */
+
+/**
+ * \fn StaticGCM::StaticGCM()
+ * \brief Constructs a new GCM object for the block cipher T.
+ */
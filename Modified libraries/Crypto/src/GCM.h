@@ -53,6 +53,11 @@ protected:
     GCMCommon();
     void setBlockCipher(BlockCipher *cipher) { blockCipher = cipher; }
 
+    template <typename B>
+    void encryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
+    template <typename B>
+    void decryptWith(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
+
 private:
     BlockCipher *blockCipher;
     GHASH ghash;
@@ -65,6 +70,9 @@ private:
         bool dataStarted;
         uint8_t posn;
     } state;
+
+    template <typename B>
+    void encryptCTR(B &cipher, uint8_t *output, const uint8_t *input, size_t len);
 };
 
 template <typename T>
@@ -77,4 +85,25 @@ private:
     T cipher;
 };
 
+template <typename T>
+class StaticGCM : public GCMCommon
+{
+public:
+    StaticGCM() { setBlockCipher(&cipher); }
+
+    void encrypt(uint8_t *output, const uint8_t *input, size_t len)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        encryptWith(direct, output, input, len);
+    }
+    void decrypt(uint8_t *output, const uint8_t *input, size_t len)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        decryptWith(direct, output, input, len);
+    }
+
+private:
+    T cipher;
+};
+
 #endif
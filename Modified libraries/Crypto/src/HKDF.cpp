@@ -21,6 +21,16 @@
  */
 
 #include "HKDF.h"
+#include "SHA224.h"
+#include "SHA256.h"
+#include "SHA384.h"
+#include "SHA512.h"
+#include "SHA3.h"
+#include "BLAKE2s.h"
+#include "BLAKE2b.h"
+#include "BLAKE2sp.h"
+#include "BLAKE2bp.h"
+#include "utility/StaticUtil.h"
 #include <string.h>
 
 /**
@@ -63,50 +73,109 @@ HKDFCommon::~HKDFCommon()
  */
 void HKDFCommon::setKey(const void *key, size_t keyLen, const void *salt, size_t saltLen)
 {
-    // Initialise the HKDF context with the key and salt to generate the PRK.
+    setKeyWith(*hash, key, keyLen, salt, saltLen);
+}
+
+/**
+ * \brief Extracts data from a HKDF session.
+ *
+ * \param out Points to the buffer to fill with extracted data.
+ * \param outLen Number of bytes to extract into the \a out buffer.
+ * \param info Points to the application-specific information string.
+ * \param infoLen Length of the \a info string in bytes.
+ *
+ * \note RFC 5869 specifies that a maximum of 255 * HashLen bytes
+ * should be extracted from a HKDF session.  This maximum is not
+ * enforced by this function.
+ */
+void HKDFCommon::extract(void *out, size_t outLen, const void *info, size_t infoLen)
+{
+    extractWith(*hash, out, outLen, info, infoLen);
+}
+
+/**
+ * \brief Clears sensitive information from this HKDF instance.
+ */
+void HKDFCommon::clear()
+{
     size_t hashSize = hash->hashSize();
+    hash->clear();
+    clean(buf, hashSize * 2);
+    counter = 1;
+    posn = hashSize;
+}
+
+/**
+ * \fn void HKDFCommon::setHashAlgorithm(Hash *hashAlg, uint8_t *buffer)
+ * \brief Sets the hash algorithm to use for HKDF operations.
+ *
+ * \param hashAlg Points to the hash algorithm instance to use.
+ * \param buffer Points to a buffer that must be at least twice the
+ * size of the hash output from \a hashAlg.
+ */
+
+/**
+ * \brief Sets the key and salt for a HKDF session using a specific
+ * hash object.
+ *
+ * \param h The hash algorithm, which is either the Hash that was passed
+ * to setHashAlgorithm() or a StaticHash wrapper around the same object.
+ * \param key Points to the key.
+ * \param keyLen Length of the \a key in bytes.
+ * \param salt Points to the salt.
+ * \param saltLen Length of the \a salt in bytes.
+ *
+ * This is the implementation of setKey().  It is a template so that
+ * StaticHKDF can instantiate it on the concrete hash type.
+ */
+template <typename H>
+void HKDFCommon::setKeyWith(H &h, const void *key, size_t keyLen, const void *salt, size_t saltLen)
+{
+    // Initialise the HKDF context with the key and salt to generate the PRK.
+    size_t hashSize = h.hashSize();
     if (salt && saltLen) {
-        hash->resetHMAC(salt, saltLen);
-        hash->update(key, keyLen);
-        hash->finalizeHMAC(salt, saltLen, buf + hashSize, hashSize);
+        h.resetHMAC(salt, saltLen);
+        h.update(key, keyLen);
+        h.finalizeHMAC(salt, saltLen, buf + hashSize, hashSize);
     } else {
         // If no salt is provided, RFC 5869 says that a string of
         // hashSize zeroes should be used instead.
         memset(buf, 0, hashSize);
-        hash->resetHMAC(buf, hashSize);
-        hash->update(key, keyLen);
-        hash->finalizeHMAC(buf, hashSize, buf + hashSize, hashSize);
+        h.resetHMAC(buf, hashSize);
+        h.update(key, keyLen);
+        h.finalizeHMAC(buf, hashSize, buf + hashSize, hashSize);
     }
     counter = 1;
     posn = hashSize;
 }
 
 /**
- * \brief Extracts data from a HKDF session.
+ * \brief Extracts data from a HKDF session using a specific hash object.
  *
+ * \param h The hash algorithm, which is either the Hash that was passed
+ * to setHashAlgorithm() or a StaticHash wrapper around the same object.
  * \param out Points to the buffer to fill with extracted data.
  * \param outLen Number of bytes to extract into the \a out buffer.
  * \param info Points to the application-specific information string.
  * \param infoLen Length of the \a info string in bytes.
  *
- * \note RFC 5869 specifies that a maximum of 255 * HashLen bytes
- * should be extracted from a HKDF session.  This maximum is not
- * enforced by this function.
+ * This is the implementation of extract().
  */
-void HKDFCommon::extract(void *out, size_t outLen, const void *info, size_t infoLen)
+template <typename H>
+void HKDFCommon::extractWith(H &h, void *out, size_t outLen, const void *info, size_t infoLen)
 {
-    size_t hashSize = hash->hashSize();
+    size_t hashSize = h.hashSize();
     uint8_t *outPtr = (uint8_t *)out;
     while (outLen > 0) {
         // Generate a new output block if necessary.
         if (posn >= hashSize) {
-            hash->resetHMAC(buf + hashSize, hashSize);
+            h.resetHMAC(buf + hashSize, hashSize);
             if (counter != 1)
-                hash->update(buf, hashSize);
+                h.update(buf, hashSize);
             if (info && infoLen)
-                hash->update(info, infoLen);
-            hash->update(&counter, 1);
-            hash->finalizeHMAC(buf + hashSize, hashSize, buf, hashSize);
+                h.update(info, infoLen);
+            h.update(&counter, 1);
+            h.finalizeHMAC(buf + hashSize, hashSize, buf, hashSize);
             ++counter;
             posn = 0;
         }
@@ -122,26 +191,14 @@ void HKDFCommon::extract(void *out, size_t outLen, const void *info, size_t info
     }
 }
 
-/**
- * \brief Clears sensitive information from this HKDF instance.
- */
-void HKDFCommon::clear()
-{
-    size_t hashSize = hash->hashSize();
-    hash->clear();
-    clean(buf, hashSize * 2);
-    counter = 1;
-    posn = hashSize;
-}
-
-/**
- * \fn void HKDFCommon::setHashAlgorithm(Hash *hashAlg, uint8_t *buffer)
- * \brief Sets the hash algorithm to use for HKDF operations.
- *
- * \param hashAlg Points to the hash algorithm instance to use.
- * \param buffer Points to a buffer that must be at least twice the
- * size of the hash output from \a hashAlg.
- */
+// Instantiate the loops for the Static templates on the algorithms
+// that are listed in utility/StaticUtil.h.
+#define HKDF_STATIC(T) \
+    template void HKDFCommon::setKeyWith< StaticHash<T> > \
+        (StaticHash<T> &, const void *, size_t, const void *, size_t); \
+    template void HKDFCommon::extractWith< StaticHash<T> > \
+        (StaticHash<T> &, void *, size_t, const void *, size_t);
+CRYPTO_STATIC_HASHES(HKDF_STATIC)
 
 /**
  * \class HKDF HKDF.h <HKDF.h>
@@ -192,6 +249,49 @@ void HKDFCommon::clear()
  * \brief Destroys a HKDF instance and all sensitive data within it.
  */
 
+/**
+ * \class StaticHKDF HKDF.h <HKDF.h>
+ * \brief Implementation of the HKDF mode that is specialized on a
+ * concrete hash algorithm.
+ *
+ * This class behaves the same as HKDF except that setKey() and extract()
+ * call the HMAC functions of T directly instead of through the Hash
+ * virtual function table.  This is mostly of benefit when HKDF is
+ * called many times with short outputs, such as when deriving
+ * per-message keys.  T must be one of the SHA-2, SHA-3 or BLAKE2 hash
+ * classes; see StaticHash.
+ *
+ * setKey() and extract() are not virtual in HKDFCommon.  Calling them
+ * through a reference to HKDFCommon will produce the same result, but
+ * without the benefit of static dispatch.
+ *
+ * \sa HKDF, StaticHash
+ */
+
+/**
+ * \fn StaticHKDF::StaticHKDF()
+ * \brief Constructs a new HKDF object for the hash algorithm T.
+ */
+
+/**
+ * \fn StaticHKDF::~StaticHKDF()
+ * \brief Destroys a HKDF instance and all sensitive data within it.
+ */
+
+/**
+ * \fn void StaticHKDF::setKey(const void *key, size_t keyLen, const void *salt, size_t saltLen)
+ * \brief Sets the key and salt for a HKDF session.
+ *
+ * \sa HKDFCommon::setKey()
+ */
+
+/**
+ * \fn void StaticHKDF::extract(void *out, size_t outLen, const void *info, size_t infoLen)
+ * \brief Extracts data from a HKDF session.
+ *
+ * \sa HKDFCommon::extract()
+ */
+
 /**
  * \fn void hkdf<T>(void *out, size_t outLen, const void *key, size_t keyLen, const void *salt, size_t saltLen, const void *info, size_t infoLen)
  * \brief All-in-one implementation of HKDF using a hash algorithm.
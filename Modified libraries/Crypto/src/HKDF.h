@@ -45,6 +45,11 @@ protected:
         buf = buffer;
     }
 
+    template <typename H>
+    void setKeyWith(H &h, const void *key, size_t keyLen, const void *salt, size_t saltLen);
+    template <typename H>
+    void extractWith(H &h, void *out, size_t outLen, const void *info, size_t infoLen);
+
 private:
     Hash *hash;
     uint8_t *buf;
@@ -64,6 +69,30 @@ private:
     uint8_t buffer[T::HASH_SIZE * 2];
 };
 
+template <typename T>
+class StaticHKDF : public HKDFCommon
+{
+public:
+    StaticHKDF() { setHashAlgorithm(&hashAlg, buffer); }
+    ~StaticHKDF() { ::clean(buffer, sizeof(buffer)); }
+
+    void setKey(const void *key, size_t keyLen, const void *salt = 0, size_t saltLen = 0)
+    {
+        StaticHash<T> direct(hashAlg);
+        setKeyWith(direct, key, keyLen, salt, saltLen);
+    }
+
+    void extract(void *out, size_t outLen, const void *info = 0, size_t infoLen = 0)
+    {
+        StaticHash<T> direct(hashAlg);
+        extractWith(direct, out, outLen, info, infoLen);
+    }
+
+private:
+    T hashAlg;
+    uint8_t buffer[T::HASH_SIZE * 2];
+};
+
 template <typename T> void hkdf
     (void *out, size_t outLen, const void *key, size_t keyLen,
      const void *salt, size_t saltLen, const void *info, size_t infoLen)
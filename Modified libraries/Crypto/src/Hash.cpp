@@ -179,6 +179,22 @@ void Hash::formatHMACKey(void *block, const void *key, size_t len, uint8_t pad)
     }
 }
 
+/**
+ * \brief Processes the padded HMAC key that was buffered by resetHMAC().
+ *
+ * The HMAC class calls this after resetHMAC() when it precomputes the
+ * state for a key, on the understanding that more data will always be
+ * added before the hash is finalized.  Hash algorithms that hold back
+ * the last block until finalization, such as BLAKE2s, can override this
+ * to process the key block ahead of time.  The default implementation
+ * does nothing.
+ *
+ * \sa resetHMAC(), HMAC
+ */
+void Hash::flushHMACKey()
+{
+}
+
 /**
  * \fn void hmac<T>(void *out, size_t outLen, const void *key, size_t keyLen, const void *data, size_t dataLen)
  * \brief All-in-one convenience function for computing HMAC values.
@@ -200,3 +216,166 @@ void Hash::formatHMACKey(void *block, const void *key, size_t len, uint8_t pad)
  * hmac<SHA256>(out, sizeof(out), key, keyLen, data, dataLen);
  * \endcode
  */
+
+/**
+ * \class HMAC Hash.h <Hash.h>
+ * \brief HMAC context that precomputes the padded key for a hash algorithm.
+ *
+ * Hash::resetHMAC() and Hash::finalizeHMAC() have to process the padded
+ * key for both the inner and outer hashes of every message.  When many
+ * short messages are authenticated under the same key, that can double
+ * or triple the cost of each message.  This class instead saves copies
+ * of the hash state after absorbing the inner and outer padded keys, so
+ * that each message only costs its own blocks plus one finalization of
+ * the outer hash.
+ *
+ * The template argument T must be the name of a class that inherits from
+ * Hash and that defines the HASH_SIZE and BLOCK_SIZE constants, such as
+ * SHA256, SHA512, BLAKE2s, BLAKE2b, or SHA3_256:
+ *
+ * \code
+ * HMAC<SHA256> mac(key, keyLen);
+ * uint8_t out[SHA256::HASH_SIZE];
+ * for (...) {
+ *     mac.update(msg, msgLen);
+ *     mac.finalize(out, sizeof(out));
+ * }
+ * \endcode
+ *
+ * The results are identical to those from hmac<T>().  The context holds
+ * three copies of the hash state and the padded key, so it may be too
+ * large for some memory-constrained platforms.
+ *
+ * \sa hmac<T>(), Hash::resetHMAC()
+ */
+
+/**
+ * \fn HMAC<T>::HMAC()
+ * \brief Constructs a new HMAC context without a key.
+ *
+ * \sa setKey()
+ */
+
+/**
+ * \fn HMAC<T>::HMAC(const void *key, size_t keyLen)
+ * \brief Constructs a new HMAC context and sets its key.
+ *
+ * \param key Points to the HMAC key.
+ * \param keyLen Length of the HMAC \a key in bytes.
+ */
+
+/**
+ * \fn HMAC<T>::~HMAC()
+ * \brief Destroys this HMAC context after clearing all sensitive information.
+ */
+
+/**
+ * \fn size_t HMAC<T>::hashSize() const
+ * \brief Returns the size of the HMAC output in bytes.
+ */
+
+/**
+ * \fn void HMAC<T>::setKey(const void *key, size_t keyLen)
+ * \brief Sets the key for this HMAC context and precomputes the inner
+ * and outer hash states.
+ *
+ * \param key Points to the HMAC key.
+ * \param keyLen Length of the HMAC \a key in bytes.
+ *
+ * The context is reset ready to authenticate a new message.
+ */
+
+/**
+ * \fn void HMAC<T>::reset()
+ * \brief Resets the HMAC context ready to authenticate a new message
+ * under the current key.
+ */
+
+/**
+ * \fn void HMAC<T>::update(const void *data, size_t len)
+ * \brief Updates the HMAC context with more message data.
+ *
+ * \param data Points to the data to add.
+ * \param len Length of the \a data in bytes.
+ */
+
+/**
+ * \fn void HMAC<T>::finalize(void *hash, size_t hashLen)
+ * \brief Finalizes the HMAC for the current message.
+ *
+ * \param hash Points to the buffer to receive the HMAC value.
+ * \param hashLen Length of the \a hash buffer in bytes.
+ *
+ * The context is then reset ready for the next message under the same key.
+ */
+
+/**
+ * \fn void HMAC<T>::compute(void *out, size_t outLen, const void *data, size_t dataLen)
+ * \brief Computes the HMAC value for a complete message in one call.
+ *
+ * \param out Points to the buffer to receive the HMAC value.
+ * \param outLen Length of the \a out buffer in bytes.
+ * \param data Points to the message data.
+ * \param dataLen Length of the message \a data in bytes.
+ */
+
+/**
+ * \fn void HMAC<T>::clear()
+ * \brief Clears the key and all other sensitive information from this
+ * HMAC context.
+ *
+ * setKey() must be called again before the context is used.
+ */
+
+/**
+ * \class StaticHash Hash.h <Hash.h>
+ * \brief Calls the operations of a concrete hash algorithm without
+ * going through the virtual function table.
+ *
+ * This is the hash algorithm counterpart to StaticBlockCipher, which is
+ * used by StaticHKDF.  The hash size is also a compile-time constant.
+ *
+ * The template parameter T must be the exact type of the hash object,
+ * not a base class of it.  StaticHKDF is compiled into the library for
+ * the SHA-2, SHA-3 and BLAKE2 hash classes only.
+ *
+ * \sa Hash, StaticBlockCipher
+ */
+
+/**
+ * \fn StaticHash::StaticHash(T &hash)
+ * \brief Constructs a wrapper around a concrete hash object.
+ *
+ * \param hash The hash object to wrap, which must outlive this object.
+ */
+
+/**
+ * \fn size_t StaticHash::hashSize() const
+ * \brief Returns T::HASH_SIZE.
+ */
+
+/**
+ * \fn void StaticHash::update(const void *data, size_t len)
+ * \brief Updates the hash with T::update().
+ *
+ * \param data The data to be hashed.
+ * \param len The number of bytes of data to be hashed.
+ */
+
+/**
+ * \fn void StaticHash::resetHMAC(const void *key, size_t keyLen)
+ * \brief Resets the hash for a new HMAC computation with T::resetHMAC().
+ *
+ * \param key Points to the HMAC key.
+ * \param keyLen Size of the HMAC key in bytes.
+ */
+
+/**
+ * \fn void StaticHash::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t hashLen)
+ * \brief Finalizes the HMAC computation with T::finalizeHMAC().
+ *
+ * \param key Points to the HMAC key.
+ * \param keyLen Size of the HMAC key in bytes.
+ * \param hash The buffer to return the HMAC value in.
+ * \param hashLen The length of the \a hash buffer.
+ */
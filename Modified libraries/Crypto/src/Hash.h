@@ -23,8 +23,10 @@
 #ifndef CRYPTO_HASH_h
 #define CRYPTO_HASH_h
 
+#include "Crypto.h"
 #include <inttypes.h>
 #include <stddef.h>
+#include <string.h>
 
 class Hash
 {
@@ -46,6 +48,28 @@ public:
 
 protected:
     void formatHMACKey(void *block, const void *key, size_t len, uint8_t pad);
+    virtual void flushHMACKey();
+
+    template <typename T> friend class HMAC;
+};
+
+template <typename T>
+class StaticHash
+{
+public:
+    explicit StaticHash(T &hash) : h(hash) {}
+
+    size_t hashSize() const { return T::HASH_SIZE; }
+
+    void update(const void *data, size_t len) { h.T::update(data, len); }
+
+    void resetHMAC(const void *key, size_t keyLen)
+        { h.T::resetHMAC(key, keyLen); }
+    void finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t hashLen)
+        { h.T::finalizeHMAC(key, keyLen, hash, hashLen); }
+
+private:
+    T &h;
 };
 
 template <typename T> void hmac
@@ -58,4 +82,93 @@ template <typename T> void hmac
     context.finalizeHMAC(key, keyLen, out, outLen);
 }
 
+template <typename T> class HMAC
+{
+public:
+    HMAC() : empty(true) {}
+    HMAC(const void *key, size_t keyLen) { setKey(key, keyLen); }
+    ~HMAC() { clean(key); }
+
+    size_t hashSize() const { return T::HASH_SIZE; }
+
+    void setKey(const void *key, size_t keyLen)
+    {
+        // Reduce the key to a single block, hashing it down if necessary.
+        if (keyLen > T::BLOCK_SIZE) {
+            inner.reset();
+            inner.update(key, keyLen);
+            inner.finalize(this->key, T::HASH_SIZE);
+            keyLen = T::HASH_SIZE;
+        } else {
+            memcpy(this->key, key, keyLen);
+        }
+        memset(this->key + keyLen, 0, T::BLOCK_SIZE - keyLen);
+
+        // Absorb the inner padded key.  XOR'ing the key with 0x36 ^ 0x5C
+        // turns the inner pad that resetHMAC() applies into the outer pad.
+        uint8_t block[T::BLOCK_SIZE];
+        for (size_t posn = 0; posn < T::BLOCK_SIZE; ++posn)
+            block[posn] = this->key[posn] ^ (0x36 ^ 0x5C);
+        inner.resetHMAC(this->key, T::BLOCK_SIZE);
+        outer.resetHMAC(block, T::BLOCK_SIZE);
+        static_cast<Hash &>(inner).flushHMACKey();
+        static_cast<Hash &>(outer).flushHMACKey();
+        clean(block);
+        reset();
+    }
+
+    void reset()
+    {
+        context = inner;
+        empty = true;
+    }
+
+    void update(const void *data, size_t len)
+    {
+        if (len) {
+            context.update(data, len);
+            empty = false;
+        }
+    }
+
+    void finalize(void *hash, size_t hashLen)
+    {
+        // The precomputed inner state may assume that at least one byte
+        // of message data will follow the key.  Start again from the key
+        // if the message is empty.
+        uint8_t temp[T::HASH_SIZE];
+        if (empty)
+            context.resetHMAC(key, T::BLOCK_SIZE);
+        context.finalize(temp, T::HASH_SIZE);
+        context = outer;
+        context.update(temp, T::HASH_SIZE);
+        context.finalize(hash, hashLen);
+        clean(temp);
+        reset();
+    }
+
+    void compute(void *out, size_t outLen, const void *data, size_t dataLen)
+    {
+        reset();
+        update(data, dataLen);
+        finalize(out, outLen);
+    }
+
+    void clear()
+    {
+        inner.clear();
+        outer.clear();
+        context.clear();
+        clean(key);
+        empty = true;
+    }
+
+private:
+    T inner;
+    T outer;
+    T context;
+    uint8_t key[T::BLOCK_SIZE];
+    bool empty;
+};
+
 #endif
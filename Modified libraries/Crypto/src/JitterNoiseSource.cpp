@@ -0,0 +1,193 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "JitterNoiseSource.h"
+#include "Crypto.h"
+
+#if defined(__linux__)
+
+#include <time.h>
+#include <string.h>
+
+/**
+ * \class JitterNoiseSource JitterNoiseSource.h <JitterNoiseSource.h>
+ * \brief Noise source that harvests CPU execution time jitter.
+ *
+ * The time that it takes to execute a short burst of memory accesses
+ * varies slightly from one run to the next due to caches, pipelines,
+ * interrupts, and frequency scaling.  This class measures that variation
+ * with the monotonic nanosecond clock and folds the timing differences
+ * into a 48-byte pool that is output on every call to stir().
+ *
+ * The entropy estimate is deliberately conservative: each timing
+ * difference is assumed to carry 1/8 of a bit of min-entropy.  The
+ * differences are checked with the repetition count and adaptive
+ * proportion health tests from NIST SP 800-90B, with cutoffs for that
+ * entropy level and a false alarm rate of 2^-20.  No credit is given
+ * until 1024 samples in a row have passed the tests, both at start-up and
+ * after a failure, and the noise source reports that it is calibrating
+ * in the meantime.
+ *
+ * Each call to stir() takes 384 samples, which is around 100 microseconds
+ * on a typical desktop processor.  Use NoiseHarvester to keep that work
+ * off the application's own threads.
+ *
+ * \code
+ * JitterNoiseSource jitterNoise;
+ *
+ * RNG.begin("MyApp 1.0");
+ * RNG.addNoiseSource(jitterNoise);
+ * \endcode
+ *
+ * \note This class is only available on Linux.
+ *
+ * \sa KernelNoiseSource, NoiseHarvester, RNGClass
+ */
+
+// Number of timing samples to collect each time stir() is called.
+#define JITTER_SAMPLES 384
+
+// Parameters for the SP 800-90B health tests, assuming H = 1/8 bit of
+// min-entropy per sample and alpha = 2^-20.  The repetition count cutoff
+// is 1 + ceil(20 / H).  The adaptive proportion cutoff is the smallest C
+// such that at most 2^-20 of 512-sample windows would have C or more
+// samples equal to the first if each value had probability 2^-H.
+#define JITTER_RCT_CUTOFF   161
+#define JITTER_APT_WINDOW   512
+#define JITTER_APT_CUTOFF   497
+#define JITTER_STARTUP      1024
+
+/**
+ * \brief Constructs a new CPU jitter noise source.
+ */
+JitterNoiseSource::JitterNoiseSource()
+    : prevTime(0)
+    , prevDelta(0)
+    , aptValue(0)
+    , rctCount(0)
+    , aptCount(0)
+    , aptPosn(0)
+    , startup(JITTER_STARTUP)
+    , calib(true)
+{
+    memset(pool, 0, sizeof(pool));
+    memset(memory, 0, sizeof(memory));
+}
+
+/**
+ * \brief Destroys this CPU jitter noise source.
+ */
+JitterNoiseSource::~JitterNoiseSource()
+{
+    clean(pool);
+}
+
+bool JitterNoiseSource::calibrating() const
+{
+    return calib;
+}
+
+void JitterNoiseSource::stir()
+{
+    bool healthy = true;
+    uint32_t delta;
+    for (uint16_t index = 0; index < JITTER_SAMPLES; ++index) {
+        // Fold the timing difference into the pool, rotating the
+        // previous word so that each sample lands on different bits.
+        delta = sample();
+        uint32_t word = pool[(index + 11) % 12];
+        pool[index % 12] ^= ((word << 7) | (word >> 25)) + delta;
+        if (!healthTest(delta))
+            healthy = false;
+        prevDelta = delta;
+    }
+    if (!healthy)
+        startup = JITTER_STARTUP;
+    else if (startup > JITTER_SAMPLES)
+        startup -= JITTER_SAMPLES;
+    else
+        startup = 0;
+    calib = (startup != 0);
+    output((const uint8_t *)pool, sizeof(pool),
+           calib ? 0 : JITTER_SAMPLES / 8);
+}
+
+/**
+ * \brief Times one burst of memory accesses.
+ *
+ * \return The time difference from the previous sample in nanoseconds.
+ *
+ * The memory locations that are touched depend upon the previous timing
+ * difference so that the pattern varies from one sample to the next
+ * without revealing the contents of the pool.
+ */
+uint32_t JitterNoiseSource::sample()
+{
+    struct timespec ts;
+    uint32_t posn = prevDelta;
+    for (uint8_t count = 0; count < 64; ++count) {
+        posn = (posn * 33 + 0x9E37) % sizeof(memory);
+        memory[posn] += (uint8_t)(posn + count);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    uint64_t time = ((uint64_t)ts.tv_sec) * 1000000000ULL + ts.tv_nsec;
+    uint32_t delta = (uint32_t)(time - prevTime);
+    prevTime = time;
+    return delta;
+}
+
+/**
+ * \brief Runs the SP 800-90B health tests on a timing difference.
+ *
+ * \param delta The timing difference from sample().
+ *
+ * \return Returns false if the repetition count test or the adaptive
+ * proportion test has failed; true otherwise.
+ */
+bool JitterNoiseSource::healthTest(uint32_t delta)
+{
+    bool ok = true;
+
+    // Repetition count test: too many identical samples in a row.
+    if (delta == prevDelta && rctCount != 0) {
+        if (++rctCount >= JITTER_RCT_CUTOFF)
+            ok = false;
+    } else {
+        rctCount = 1;
+    }
+
+    // Adaptive proportion test: the first sample in each window
+    // occurs too often within that window.
+    if (aptPosn == 0) {
+        aptValue = delta;
+        aptCount = 1;
+    } else if (delta == aptValue) {
+        if (++aptCount >= JITTER_APT_CUTOFF)
+            ok = false;
+    }
+    if (++aptPosn >= JITTER_APT_WINDOW)
+        aptPosn = 0;
+
+    return ok;
+}
+
+#endif // __linux__
@@ -0,0 +1,57 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_JITTERNOISESOURCE_H
+#define CRYPTO_JITTERNOISESOURCE_H
+
+#include "NoiseSource.h"
+
+#if defined(__linux__)
+
+class JitterNoiseSource : public NoiseSource
+{
+public:
+    JitterNoiseSource();
+    virtual ~JitterNoiseSource();
+
+    bool calibrating() const;
+    void stir();
+
+private:
+    uint32_t pool[12];
+    uint8_t memory[2048];
+    uint64_t prevTime;
+    uint32_t prevDelta;
+    uint32_t aptValue;
+    uint16_t rctCount;
+    uint16_t aptCount;
+    uint16_t aptPosn;
+    uint16_t startup;
+    bool calib;
+
+    uint32_t sample();
+    bool healthTest(uint32_t delta);
+};
+
+#endif
+
+#endif
@@ -0,0 +1,287 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "KangarooTwelve.h"
+#include "Crypto.h"
+#include "utility/CpuUtil.h"
+
+/**
+ * \class KangarooTwelve KangarooTwelve.h <KangarooTwelve.h>
+ * \brief KangarooTwelve tree hashing Extendable-Output Function (XOF).
+ *
+ * KangarooTwelve (KT128) splits its input into 8192-byte chunks.  Each
+ * chunk after the first is hashed as an independent leaf with
+ * TurboSHAKE128, and the 32-byte chaining values of the leaves are then
+ * absorbed into a final node along with the first chunk.  Inputs of up
+ * to 8192 bytes reduce to a single call of TurboSHAKE128.
+ *
+ * Because the leaves are independent, they can be hashed in parallel.
+ * On x86 hosts, update() uses KeccakCoreX4 to hash four leaves at a time
+ * directly from the caller's buffer whenever it is given enough data
+ * in one call.  For the best throughput on large inputs, pass the data
+ * in blocks of 32K or more.  The leaves are otherwise hashed as the data
+ * arrives, so there is no need to buffer the chunks.
+ *
+ * An optional customization string can be supplied by calling
+ * customize() after the last call to update() and before extend():
+ *
+ * \code
+ * KangarooTwelve k12;
+ * k12.update(data, len);
+ * k12.customize("my app", 6);
+ * k12.extend(hash, 32);
+ * \endcode
+ *
+ * Reference: https://www.rfc-editor.org/rfc/rfc9861
+ *
+ * \sa TurboSHAKE128, KeccakCoreX4
+ */
+
+/**
+ * \var KangarooTwelve::CHUNK_SIZE
+ * \brief Size of each chunk of the input in bytes.
+ */
+
+/**
+ * \var KangarooTwelve::CV_SIZE
+ * \brief Size of the chaining value that is output by each leaf.
+ */
+
+// Domain separation bytes for the different kinds of node.
+#define K12_SINGLE_NODE     0x07
+#define K12_FINAL_NODE      0x06
+#define K12_LEAF_NODE       0x0B
+
+/**
+ * \brief Encodes a length value with the length_encode() function
+ * from the KangarooTwelve specification.
+ *
+ * \param buf The buffer to write the encoded value to, which must be
+ * at least 9 bytes in size.
+ * \param value The value to encode.
+ *
+ * \return The number of bytes that were written to \a buf.
+ */
+static uint8_t k12_length_encode(uint8_t *buf, uint64_t value)
+{
+    uint8_t size = 0;
+    uint64_t temp = value;
+    while (temp != 0) {
+        ++size;
+        temp >>= 8;
+    }
+    for (uint8_t posn = 0; posn < size; ++posn)
+        buf[posn] = (uint8_t)(value >> ((size - 1 - posn) * 8));
+    buf[size] = size;
+    return size + 1;
+}
+
+#if defined(CRYPTO_X86_SIMD)
+
+/**
+ * \brief Hashes four consecutive leaf chunks at once.
+ *
+ * \param cv Returns the chaining values for the four leaves.
+ * \param data Points to the four chunks of data to hash.
+ */
+static void k12_leaves_x4(uint8_t cv[KeccakCoreX4::LANES][KangarooTwelve::CV_SIZE],
+                          const uint8_t *data)
+{
+    KeccakCoreX4 core;
+    const void *in[KeccakCoreX4::LANES];
+    void *out[KeccakCoreX4::LANES];
+    core.setCapacity(256);
+    core.setRounds(12);
+    for (unsigned lane = 0; lane < KeccakCoreX4::LANES; ++lane) {
+        in[lane] = data + lane * KangarooTwelve::CHUNK_SIZE;
+        out[lane] = cv[lane];
+    }
+    core.update(in, KangarooTwelve::CHUNK_SIZE);
+    core.pad(K12_LEAF_NODE);
+    core.extract(out, KangarooTwelve::CV_SIZE);
+}
+
+#endif
+
+/**
+ * \brief Constructs a new KangarooTwelve object.
+ */
+KangarooTwelve::KangarooTwelve()
+{
+    node.setCapacity(256);
+    node.setRounds(12);
+    leaf.setCapacity(256);
+    leaf.setRounds(12);
+    reset();
+}
+
+/**
+ * \brief Destroys this KangarooTwelve object after clearing all sensitive
+ * information.
+ */
+KangarooTwelve::~KangarooTwelve()
+{
+}
+
+size_t KangarooTwelve::blockSize() const
+{
+    return node.blockSize();
+}
+
+void KangarooTwelve::reset()
+{
+    node.reset();
+    leaf.reset();
+    chunks = 1;
+    customLen = 0;
+    chunkPosn = 0;
+    finalized = false;
+}
+
+void KangarooTwelve::update(const void *data, size_t len)
+{
+    if (finalized)
+        reset();
+    absorb((const uint8_t *)data, len);
+}
+
+/**
+ * \brief Adds data to the customization string.
+ *
+ * \param data Points to the customization data.
+ * \param len Number of bytes of customization data.
+ *
+ * This function can be called multiple times to supply the customization
+ * string in pieces.  It must be called after the last call to update()
+ * for the message and before the first call to extend() or encrypt().
+ */
+void KangarooTwelve::customize(const void *data, size_t len)
+{
+    if (finalized)
+        reset();
+    customLen += len;
+    absorb((const uint8_t *)data, len);
+}
+
+void KangarooTwelve::extend(uint8_t *data, size_t len)
+{
+    if (!finalized)
+        finalize();
+    node.extract(data, len);
+}
+
+void KangarooTwelve::encrypt(uint8_t *output, const uint8_t *input, size_t len)
+{
+    if (!finalized)
+        finalize();
+    node.encrypt(output, input, len);
+}
+
+void KangarooTwelve::clear()
+{
+    node.clear();
+    leaf.clear();
+    reset();
+}
+
+/**
+ * \brief Absorbs message or customization data into the tree.
+ *
+ * \param data Points to the data to absorb.
+ * \param len Number of bytes of data to absorb.
+ */
+void KangarooTwelve::absorb(const uint8_t *data, size_t len)
+{
+    while (len > 0) {
+        if (chunkPosn == CHUNK_SIZE) {
+            // The current chunk is full and there is more data,
+            // so we need to start a new leaf chunk.
+            if (chunks == 1) {
+                static uint8_t const marker[8] = {0x03, 0, 0, 0, 0, 0, 0, 0};
+                node.update(marker, sizeof(marker));
+            } else {
+                finishLeaf();
+            }
+            ++chunks;
+            chunkPosn = 0;
+#if defined(CRYPTO_X86_SIMD)
+            // Hash four whole leaves at once from the caller's buffer
+            // as long as there is more data after them.
+            if (len > KeccakCoreX4::LANES * CHUNK_SIZE) {
+                uint8_t cv[KeccakCoreX4::LANES][CV_SIZE];
+                do {
+                    k12_leaves_x4(cv, data);
+                    node.update(cv, sizeof(cv));
+                    data += KeccakCoreX4::LANES * CHUNK_SIZE;
+                    len -= KeccakCoreX4::LANES * CHUNK_SIZE;
+                    chunks += KeccakCoreX4::LANES;
+                } while (len > KeccakCoreX4::LANES * CHUNK_SIZE);
+                clean(cv);
+            }
+#endif
+        }
+        size_t size = CHUNK_SIZE - chunkPosn;
+        if (size > len)
+            size = len;
+        if (chunks == 1)
+            node.update(data, size);
+        else
+            leaf.update(data, size);
+        chunkPosn += size;
+        data += size;
+        len -= size;
+    }
+}
+
+/**
+ * \brief Finishes the current leaf and absorbs its chaining value
+ * into the final node.
+ */
+void KangarooTwelve::finishLeaf()
+{
+    uint8_t cv[CV_SIZE];
+    leaf.pad(K12_LEAF_NODE);
+    leaf.extract(cv, CV_SIZE);
+    node.update(cv, CV_SIZE);
+    leaf.reset();
+    clean(cv);
+}
+
+/**
+ * \brief Finalizes the tree so that output can be extracted.
+ */
+void KangarooTwelve::finalize()
+{
+    uint8_t buf[9];
+    absorb(buf, k12_length_encode(buf, customLen));
+    if (chunks == 1) {
+        node.pad(K12_SINGLE_NODE);
+    } else {
+        finishLeaf();
+        node.update(buf, k12_length_encode(buf, chunks - 1));
+        buf[0] = 0xFF;
+        buf[1] = 0xFF;
+        node.update(buf, 2);
+        node.pad(K12_FINAL_NODE);
+    }
+    finalized = true;
+}
@@ -37,6 +37,9 @@ public:
 
     size_t blockSize() const { return _blockSize; }
 
+    uint8_t rounds() const { return _rounds; }
+    void setRounds(uint8_t rounds);
+
     void reset();
 
     void update(const void *data, size_t size);
@@ -56,8 +59,53 @@ private:
         uint8_t outputSize;
     } state;
     uint8_t _blockSize;
+    uint8_t _rounds;
 
     void keccakp();
 };
 
+class KeccakCoreX4
+{
+public:
+    KeccakCoreX4();
+    ~KeccakCoreX4();
+
+    size_t capacity() const;
+    void setCapacity(size_t capacity);
+
+    size_t blockSize() const { return _blockSize; }
+
+    uint8_t rounds() const { return _rounds; }
+    void setRounds(uint8_t rounds);
+
+    void reset();
+
+    void update(const void *const *data, size_t size);
+    void pad(uint8_t tag);
+
+    void extract(void *const *data, size_t size);
+
+    void clear();
+
+    static const size_t LANES = 4;
+
+private:
+    struct {
+        uint64_t A[25][LANES];
+        uint8_t inputSize;
+        uint8_t outputSize;
+    } state;
+    uint8_t _blockSize;
+    uint8_t _rounds;
+
+    void keccakp();
+    void spongeLanes(uint8_t *const *outputs, size_t outLen,
+                     const uint8_t *const *data, const size_t *lens,
+                     unsigned count, uint8_t tag);
+
+    friend class SHA3_256Multi;
+    friend class SHAKE128Multi;
+    friend class SHAKE256Multi;
+};
+
 #endif
@@ -0,0 +1,530 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "KeccakCore.h"
+#include "Crypto.h"
+#include "utility/CpuUtil.h"
+#include "utility/EndianUtil.h"
+#include "utility/KeccakUtil.h"
+#include <string.h>
+
+/**
+ * \class KeccakCoreX4 KeccakCore.h <KeccakCore.h>
+ * \brief Four Keccak sponge functions that are run in lock-step.
+ *
+ * KeccakCoreX4 holds the state for four independent sponge functions of
+ * the same capacity and permutes all of them at once.  The state is
+ * interleaved so that each 64-bit lane of the permutation is stored as
+ * a vector of four values, one per sponge.  On x86 hosts with AVX2 a
+ * single permutation of all four states costs little more than a
+ * single KeccakCore permutation.
+ *
+ * The API mirrors KeccakCore except that update() and extract() take an
+ * array of LANES data pointers and process the same number of bytes for
+ * every sponge:
+ *
+ * \code
+ * KeccakCoreX4 core;
+ * core.setCapacity(512);
+ * const void *data[4] = {msg1, msg2, msg3, msg4};
+ * void *hashes[4] = {hash1, hash2, hash3, hash4};
+ * core.update(data, len);
+ * core.pad(0x06);
+ * core.extract(hashes, 32);
+ * \endcode
+ *
+ * This class is the basis for SHA3_256Multi, SHAKE128Multi, and
+ * SHAKE256Multi, which can also handle messages of different lengths.
+ *
+ * \sa KeccakCore, SHA3_256Multi, SHAKE128Multi, SHAKE256Multi
+ */
+
+/**
+ * \var KeccakCoreX4::LANES
+ * \brief Number of sponge functions that are run in lock-step.
+ */
+
+#if !defined(CRYPTO_LITTLE_ENDIAN)
+#error "KeccakCoreX4 is not supported on big-endian platforms yet - todo"
+#endif
+
+typedef uint64_t keccakx4_v __attribute__((vector_size(32)));
+
+// Rotates all elements of a lane vector left by a number of bits.
+#define keccakx4_rotate(a, bits) \
+    (__extension__ ({ \
+        keccakx4_v _temp = (a); \
+        (_temp << (bits)) | (_temp >> (64 - (bits))); \
+    }))
+
+// Loads and stores lane vectors in the interleaved state, complementing
+// the lanes that keccakp_round() expects to be complemented.
+#define keccakx4_load(name, index, invert) \
+    do { \
+        memcpy(&name, A[(index)], sizeof(keccakx4_v)); \
+        if ((invert)) \
+            name = ~name; \
+    } while (0)
+#define keccakx4_store(name, index, invert) \
+    do { \
+        keccakx4_v _temp = name; \
+        if ((invert)) \
+            _temp = ~_temp; \
+        memcpy(A[(index)], &_temp, sizeof(keccakx4_v)); \
+    } while (0)
+
+/**
+ * \brief Performs KECCAK-p[1600] on four interleaved states.
+ *
+ * \param A The interleaved state to permute.
+ * \param rounds The number of rounds to perform, which must be even.
+ */
+static inline __attribute__((always_inline))
+void keccakp_x4_rounds(uint64_t A[25][KeccakCoreX4::LANES], uint8_t rounds)
+{
+    keccakp_lanes(keccakx4_v);
+
+    keccakx4_load(Aba, 0, 0);  keccakx4_load(Abe, 1, 1);
+    keccakx4_load(Abi, 2, 1);  keccakx4_load(Abo, 3, 0);
+    keccakx4_load(Abu, 4, 0);  keccakx4_load(Aga, 5, 0);
+    keccakx4_load(Age, 6, 0);  keccakx4_load(Agi, 7, 0);
+    keccakx4_load(Ago, 8, 1);  keccakx4_load(Agu, 9, 0);
+    keccakx4_load(Aka, 10, 0); keccakx4_load(Ake, 11, 0);
+    keccakx4_load(Aki, 12, 1); keccakx4_load(Ako, 13, 0);
+    keccakx4_load(Aku, 14, 0); keccakx4_load(Ama, 15, 0);
+    keccakx4_load(Ame, 16, 0); keccakx4_load(Ami, 17, 1);
+    keccakx4_load(Amo, 18, 0); keccakx4_load(Amu, 19, 0);
+    keccakx4_load(Asa, 20, 1); keccakx4_load(Ase, 21, 0);
+    keccakx4_load(Asi, 22, 0); keccakx4_load(Aso, 23, 0);
+    keccakx4_load(Asu, 24, 0);
+
+    for (uint8_t round = 24 - rounds; round < 24; round += 2) {
+        keccakp_round(A, E, keccakx4_rotate, keccakp_rc[round]);
+        keccakp_round(E, A, keccakx4_rotate, keccakp_rc[round + 1]);
+    }
+
+    keccakx4_store(Aba, 0, 0);  keccakx4_store(Abe, 1, 1);
+    keccakx4_store(Abi, 2, 1);  keccakx4_store(Abo, 3, 0);
+    keccakx4_store(Abu, 4, 0);  keccakx4_store(Aga, 5, 0);
+    keccakx4_store(Age, 6, 0);  keccakx4_store(Agi, 7, 0);
+    keccakx4_store(Ago, 8, 1);  keccakx4_store(Agu, 9, 0);
+    keccakx4_store(Aka, 10, 0); keccakx4_store(Ake, 11, 0);
+    keccakx4_store(Aki, 12, 1); keccakx4_store(Ako, 13, 0);
+    keccakx4_store(Aku, 14, 0); keccakx4_store(Ama, 15, 0);
+    keccakx4_store(Ame, 16, 0); keccakx4_store(Ami, 17, 1);
+    keccakx4_store(Amo, 18, 0); keccakx4_store(Amu, 19, 0);
+    keccakx4_store(Asa, 20, 1); keccakx4_store(Ase, 21, 0);
+    keccakx4_store(Asi, 22, 0); keccakx4_store(Aso, 23, 0);
+    keccakx4_store(Asu, 24, 0);
+}
+
+typedef void (*keccakp_x4_t)(uint64_t A[25][KeccakCoreX4::LANES],
+                             uint8_t rounds);
+
+#if defined(CRYPTO_X86_SIMD)
+
+// AVX-512VL has a native 64-bit vector rotate which halves the cost of rho.
+CRYPTO_TARGET("avx512f,avx512vl")
+static void keccakp_x4_avx512(uint64_t A[25][KeccakCoreX4::LANES],
+                              uint8_t rounds)
+{
+    keccakp_x4_rounds(A, rounds);
+}
+
+CRYPTO_TARGET("avx2")
+static void keccakp_x4_avx2(uint64_t A[25][KeccakCoreX4::LANES],
+                            uint8_t rounds)
+{
+    keccakp_x4_rounds(A, rounds);
+}
+
+#endif
+
+// Portable version; the compiler splits the vectors into whatever the
+// platform supports natively, such as pairs of SSE2 registers on x86.
+static void keccakp_x4_portable(uint64_t A[25][KeccakCoreX4::LANES],
+                                uint8_t rounds)
+{
+    keccakp_x4_rounds(A, rounds);
+}
+
+/**
+ * \brief Selects the best KECCAK-p[1600] x4 implementation for this CPU.
+ */
+static keccakp_x4_t keccakp_x4_backend()
+{
+    static keccakp_x4_t backend = keccakp_x4_portable;
+#if defined(CRYPTO_X86_SIMD)
+    static bool selected = false;
+    if (!selected) {
+        if (crypto_cpu_has(CRYPTO_CPU_AVX512F | CRYPTO_CPU_AVX512VL))
+            backend = keccakp_x4_avx512;
+        else if (crypto_cpu_has(CRYPTO_CPU_AVX2))
+            backend = keccakp_x4_avx2;
+        selected = true;
+    }
+#endif
+    return backend;
+}
+
+/**
+ * \brief XOR's data into one of the interleaved sponge states.
+ *
+ * \param A The interleaved state.
+ * \param lane The sponge to XOR the data into.
+ * \param posn Byte position within the sponge state to start at.
+ * \param data Points to the data to XOR into the state.
+ * \param len Number of bytes of data.
+ */
+static void keccakx4_absorb(uint64_t A[25][KeccakCoreX4::LANES], unsigned lane,
+                            unsigned posn, const uint8_t *data, unsigned len)
+{
+    while (len > 0 && (posn % 8) != 0) {
+        ((uint8_t *)&(A[posn / 8][lane]))[posn % 8] ^= *data++;
+        ++posn;
+        --len;
+    }
+    while (len >= 8) {
+        uint64_t word;
+        memcpy(&word, data, 8);
+        A[posn / 8][lane] ^= word;
+        data += 8;
+        posn += 8;
+        len -= 8;
+    }
+    while (len > 0) {
+        ((uint8_t *)&(A[posn / 8][lane]))[posn % 8] ^= *data++;
+        ++posn;
+        --len;
+    }
+}
+
+/**
+ * \brief Copies data out of one of the interleaved sponge states.
+ *
+ * \param A The interleaved state.
+ * \param lane The sponge to copy the data from.
+ * \param posn Byte position within the sponge state to start at.
+ * \param data Points to the buffer to receive the data.
+ * \param len Number of bytes of data.
+ */
+static void keccakx4_squeeze(const uint64_t A[25][KeccakCoreX4::LANES],
+                             unsigned lane, unsigned posn, uint8_t *data,
+                             unsigned len)
+{
+    while (len > 0 && (posn % 8) != 0) {
+        *data++ = ((const uint8_t *)&(A[posn / 8][lane]))[posn % 8];
+        ++posn;
+        --len;
+    }
+    while (len >= 8) {
+        memcpy(data, &(A[posn / 8][lane]), 8);
+        data += 8;
+        posn += 8;
+        len -= 8;
+    }
+    while (len > 0) {
+        *data++ = ((const uint8_t *)&(A[posn / 8][lane]))[posn % 8];
+        ++posn;
+        --len;
+    }
+}
+
+/**
+ * \brief XOR's a single byte into one of the interleaved sponge states.
+ *
+ * \param A The interleaved state.
+ * \param lane The sponge to XOR the byte into.
+ * \param posn Byte position within the sponge state.
+ * \param value The byte value.
+ */
+static inline void keccakx4_xor_byte(uint64_t A[25][KeccakCoreX4::LANES],
+                                     unsigned lane, unsigned posn,
+                                     uint8_t value)
+{
+    A[posn / 8][lane] ^= ((uint64_t)value) << ((posn % 8) * 8);
+}
+
+/**
+ * \brief Constructs four new Keccak sponge functions.
+ *
+ * The capacity() will initially be set to 1536, which normally won't be
+ * of much use to the caller.  The constructor should be followed by a
+ * call to setCapacity() to select the capacity of interest.
+ */
+KeccakCoreX4::KeccakCoreX4()
+    : _blockSize(8)
+    , _rounds(24)
+{
+    memset(state.A, 0, sizeof(state.A));
+    state.inputSize = 0;
+    state.outputSize = 0;
+}
+
+/**
+ * \brief Destroys these Keccak sponge functions after clearing all
+ * sensitive information.
+ */
+KeccakCoreX4::~KeccakCoreX4()
+{
+    clean(state);
+}
+
+/**
+ * \brief Returns the capacity of the sponge functions in bits.
+ *
+ * \sa setCapacity(), blockSize()
+ */
+size_t KeccakCoreX4::capacity() const
+{
+    return 1600 - ((size_t)_blockSize) * 8;
+}
+
+/**
+ * \brief Sets the capacity of the Keccak sponge functions in bits.
+ *
+ * \param capacity The capacity of the Keccak sponge functions in bits which
+ * should be a multiple of 64 and between 64 and 1536.
+ *
+ * \sa capacity(), blockSize()
+ */
+void KeccakCoreX4::setCapacity(size_t capacity)
+{
+    _blockSize = (1600 - capacity) / 8;
+    reset();
+}
+
+/**
+ * \fn size_t KeccakCoreX4::blockSize() const
+ * \brief Returns the input block size for the sponge functions in bytes.
+ *
+ * The block size is (1600 - capacity()) / 8.
+ *
+ * \sa capacity()
+ */
+
+/**
+ * \fn uint8_t KeccakCoreX4::rounds() const
+ * \brief Returns the number of rounds of the KECCAK-p permutation.
+ *
+ * \sa setRounds()
+ */
+
+/**
+ * \brief Sets the number of rounds of the KECCAK-p permutation.
+ *
+ * \param rounds The number of rounds, which must be an even number
+ * between 2 and 24.  The default is 24 for KECCAK-f[1600].
+ *
+ * \sa rounds(), KeccakCore::setRounds()
+ */
+void KeccakCoreX4::setRounds(uint8_t rounds)
+{
+    _rounds = rounds;
+}
+
+/**
+ * \brief Resets the Keccak sponge functions ready for a new session.
+ *
+ * \sa update(), extract()
+ */
+void KeccakCoreX4::reset()
+{
+    memset(state.A, 0, sizeof(state.A));
+    state.inputSize = 0;
+    state.outputSize = 0;
+}
+
+/**
+ * \brief Updates all of the Keccak sponge functions with more input data.
+ *
+ * \param data Array of LANES pointers to the extra input data for each
+ * of the sponge functions.
+ * \param size The size of the new data to incorporate into each sponge.
+ *
+ * This function will invoke the sponge functions whenever a full
+ * blockSize() bytes of input data have been accumulated.  Call pad()
+ * after the last block to finalize the input before calling extract().
+ *
+ * \sa pad(), extract(), reset()
+ */
+void KeccakCoreX4::update(const void *const *data, size_t size)
+{
+    // Stop generating output while we incorporate the new data.
+    state.outputSize = 0;
+
+    // Break the input up into chunks and process each in turn.
+    size_t offset = 0;
+    while (size > 0) {
+        uint8_t len = _blockSize - state.inputSize;
+        if (len > size)
+            len = size;
+        for (unsigned lane = 0; lane < LANES; ++lane) {
+            keccakx4_absorb(state.A, lane, state.inputSize,
+                            ((const uint8_t *)(data[lane])) + offset, len);
+        }
+        state.inputSize += len;
+        size -= len;
+        offset += len;
+        if (state.inputSize == _blockSize) {
+            keccakp();
+            state.inputSize = 0;
+        }
+    }
+}
+
+/**
+ * \brief Pads the last block of input data to blockSize() in all sponges.
+ *
+ * \param tag The tag byte to add to the padding to identify SHA3 (0x06),
+ * SHAKE (0x1F), or the plain pre-standardized version of Keccak (0x01).
+ *
+ * \sa update(), extract()
+ */
+void KeccakCoreX4::pad(uint8_t tag)
+{
+    for (unsigned lane = 0; lane < LANES; ++lane) {
+        keccakx4_xor_byte(state.A, lane, state.inputSize, tag);
+        keccakx4_xor_byte(state.A, lane, _blockSize - 1, 0x80);
+    }
+    keccakp();
+    state.inputSize = 0;
+    state.outputSize = 0;
+}
+
+/**
+ * \brief Extracts data from all of the Keccak sponge functions.
+ *
+ * \param data Array of LANES pointers to the buffers that receive the
+ * output of each of the sponge functions.
+ * \param size The number of bytes of output to extract from each sponge.
+ *
+ * \sa update(), pad()
+ */
+void KeccakCoreX4::extract(void *const *data, size_t size)
+{
+    // Stop accepting input while we are generating output.
+    state.inputSize = 0;
+
+    // Copy the output data into the caller's return buffers.
+    size_t offset = 0;
+    uint8_t tempSize;
+    while (size > 0) {
+        // Generate another output block if the current one has been exhausted.
+        if (state.outputSize >= _blockSize) {
+            keccakp();
+            state.outputSize = 0;
+        }
+
+        // How many bytes can we copy this time around?
+        tempSize = _blockSize - state.outputSize;
+        if (tempSize > size)
+            tempSize = size;
+
+        // Copy the partial output data into the caller's return buffers.
+        for (unsigned lane = 0; lane < LANES; ++lane) {
+            keccakx4_squeeze(state.A, lane, state.outputSize,
+                             ((uint8_t *)(data[lane])) + offset, tempSize);
+        }
+        state.outputSize += tempSize;
+        size -= tempSize;
+        offset += tempSize;
+    }
+}
+
+/**
+ * \brief Clears all sensitive data from these Keccak sponge functions.
+ */
+void KeccakCoreX4::clear()
+{
+    clean(state);
+}
+
+/**
+ * \brief Transform all four states with the KECCAK-p sponge function
+ * with b = 1600.
+ */
+void KeccakCoreX4::keccakp()
+{
+    (*keccakp_x4_backend())(state.A, _rounds);
+}
+
+/**
+ * \brief Absorbs and squeezes up to LANES messages of different lengths.
+ *
+ * \param outputs Array of \a count pointers to the output buffers.
+ * \param outLen Number of bytes of output to produce for each message.
+ * \param data Array of \a count pointers to the messages.
+ * \param lens Array of \a count message lengths in bytes.
+ * \param count Number of messages, between 1 and LANES.
+ * \param tag The padding tag byte; e.g. 0x06 for SHA3 or 0x1F for SHAKE.
+ *
+ * Each call to the permutation either absorbs the next block of a message
+ * or squeezes the next block of its output.  Messages that finish
+ * absorbing early start squeezing while the longer messages are still
+ * being absorbed, so lanes are never left idle until the very end.
+ */
+void KeccakCoreX4::spongeLanes(uint8_t *const *outputs, size_t outLen,
+                               const uint8_t *const *data, const size_t *lens,
+                               unsigned count, uint8_t tag)
+{
+    size_t rate = _blockSize;
+    size_t outBlocks = (outLen + rate - 1) / rate;
+    size_t blocks[LANES];
+    size_t steps = 0;
+    unsigned lane;
+    reset();
+    if (!outLen)
+        return;
+    for (lane = 0; lane < count; ++lane) {
+        // The last block is always partial and contains the padding.
+        blocks[lane] = lens[lane] / rate + 1;
+        if ((blocks[lane] + outBlocks - 1) > steps)
+            steps = blocks[lane] + outBlocks - 1;
+    }
+    for (size_t step = 0; step < steps; ++step) {
+        for (lane = 0; lane < count; ++lane) {
+            if (step + 1 < blocks[lane]) {
+                keccakx4_absorb(state.A, lane, 0,
+                                data[lane] + step * rate, rate);
+            } else if (step + 1 == blocks[lane]) {
+                unsigned left = lens[lane] % rate;
+                keccakx4_absorb(state.A, lane, 0,
+                                data[lane] + step * rate, left);
+                keccakx4_xor_byte(state.A, lane, left, tag);
+                keccakx4_xor_byte(state.A, lane, rate - 1, 0x80);
+            }
+        }
+        keccakp();
+        for (lane = 0; lane < count; ++lane) {
+            if (step + 1 < blocks[lane])
+                continue;
+            size_t posn = (step + 1 - blocks[lane]) * rate;
+            if (posn >= outLen)
+                continue;
+            size_t len = outLen - posn;
+            if (len > rate)
+                len = rate;
+            keccakx4_squeeze(state.A, lane, 0, outputs[lane] + posn, len);
+        }
+    }
+}
@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "KernelNoiseSource.h"
+#include "Crypto.h"
+
+#if defined(__linux__)
+
+#include <sys/random.h>
+#include <errno.h>
+
+/**
+ * \class KernelNoiseSource KernelNoiseSource.h <KernelNoiseSource.h>
+ * \brief Noise source that reads from the Linux kernel's random number
+ * generator.
+ *
+ * This class uses the getrandom() system call to fetch 32 bytes from the
+ * kernel each time that stir() is called, crediting every bit of them.
+ * The kernel is never asked to block: if its pool has not been initialized
+ * yet, which can happen early during boot, then the noise source reports
+ * that it is calibrating and tries again on the next call to stir().
+ *
+ * \code
+ * KernelNoiseSource kernelNoise;
+ *
+ * RNG.begin("MyApp 1.0");
+ * RNG.addNoiseSource(kernelNoise);
+ * \endcode
+ *
+ * \note This class is only available on Linux.
+ *
+ * \sa JitterNoiseSource, NoiseHarvester, RNGClass
+ */
+
+/**
+ * \brief Constructs a new kernel noise source.
+ */
+KernelNoiseSource::KernelNoiseSource()
+    : ready(false)
+{
+}
+
+/**
+ * \brief Destroys this kernel noise source.
+ */
+KernelNoiseSource::~KernelNoiseSource()
+{
+}
+
+bool KernelNoiseSource::calibrating() const
+{
+    return !ready;
+}
+
+void KernelNoiseSource::stir()
+{
+    uint8_t data[32];
+    ssize_t len;
+    do {
+        len = getrandom(data, sizeof(data), GRND_NONBLOCK);
+    } while (len < 0 && errno == EINTR);
+    ready = (len == (ssize_t)sizeof(data));
+    if (ready)
+        output(data, sizeof(data), sizeof(data) * 8);
+    clean(data);
+}
+
+void KernelNoiseSource::added()
+{
+    // Stir in some data from the kernel straight away.
+    stir();
+}
+
+#endif // __linux__
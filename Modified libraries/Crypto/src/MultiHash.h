@@ -0,0 +1,131 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_MULTIHASH_H
+#define CRYPTO_MULTIHASH_H
+
+#include <inttypes.h>
+#include <stddef.h>
+
+class SHA256Multi
+{
+public:
+    static size_t lanes();
+
+    static void hash(uint8_t *const *hashes, const void *const *data,
+                     const size_t *lens, size_t count);
+
+    static const size_t HASH_SIZE = 32;
+    static const size_t MAX_LANES = 16;
+
+private:
+    // Constructor and destructor are private - cannot instantiate this class.
+    SHA256Multi() {}
+    ~SHA256Multi() {}
+};
+
+class SHA512Multi
+{
+public:
+    static size_t lanes();
+
+    static void hash(uint8_t *const *hashes, const void *const *data,
+                     const size_t *lens, size_t count);
+
+    static const size_t HASH_SIZE = 64;
+    static const size_t MAX_LANES = 8;
+
+private:
+    // Constructor and destructor are private - cannot instantiate this class.
+    SHA512Multi() {}
+    ~SHA512Multi() {}
+};
+
+class BLAKE2sMulti
+{
+public:
+    static size_t lanes();
+
+    static void hash(uint8_t *const *hashes, const void *const *data,
+                     const size_t *lens, size_t count);
+
+    static const size_t HASH_SIZE = 32;
+    static const size_t MAX_LANES = 16;
+
+private:
+    // Constructor and destructor are private - cannot instantiate this class.
+    BLAKE2sMulti() {}
+    ~BLAKE2sMulti() {}
+};
+
+class SHA3_256Multi
+{
+public:
+    static size_t lanes();
+
+    static void hash(uint8_t *const *hashes, const void *const *data,
+                     const size_t *lens, size_t count);
+
+    static const size_t HASH_SIZE = 32;
+    static const size_t MAX_LANES = 4;
+
+private:
+    // Constructor and destructor are private - cannot instantiate this class.
+    SHA3_256Multi() {}
+    ~SHA3_256Multi() {}
+};
+
+class SHAKE128Multi
+{
+public:
+    static size_t lanes();
+
+    static void extend(uint8_t *const *outputs, size_t outLen,
+                       const void *const *data, const size_t *lens,
+                       size_t count);
+
+    static const size_t MAX_LANES = 4;
+
+private:
+    // Constructor and destructor are private - cannot instantiate this class.
+    SHAKE128Multi() {}
+    ~SHAKE128Multi() {}
+};
+
+class SHAKE256Multi
+{
+public:
+    static size_t lanes();
+
+    static void extend(uint8_t *const *outputs, size_t outLen,
+                       const void *const *data, const size_t *lens,
+                       size_t count);
+
+    static const size_t MAX_LANES = 4;
+
+private:
+    // Constructor and destructor are private - cannot instantiate this class.
+    SHAKE256Multi() {}
+    ~SHAKE256Multi() {}
+};
+
+#endif
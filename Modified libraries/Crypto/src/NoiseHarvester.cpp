@@ -0,0 +1,181 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "NoiseHarvester.h"
+
+#if defined(__linux__) && defined(RNG_THREAD_LOCAL)
+
+#include <time.h>
+#include <errno.h>
+
+/**
+ * \class NoiseHarvester NoiseHarvester.h <NoiseHarvester.h>
+ * \brief Polls the noise sources of the global RNG object from a
+ * background thread.
+ *
+ * Noise sources such as JitterNoiseSource can take a while to gather
+ * their data.  If the application calls \link RNGClass::loop() RNG.loop()\endlink
+ * on a thread that also serves requests, then that time is added to the
+ * request latency.  NoiseHarvester runs RNG.loop() on its own thread
+ * at a regular interval instead:
+ *
+ * \code
+ * KernelNoiseSource kernelNoise;
+ * JitterNoiseSource jitterNoise;
+ * NoiseHarvester harvester;
+ *
+ * RNG.begin("MyApp 1.0");
+ * RNG.addNoiseSource(kernelNoise);
+ * RNG.addNoiseSource(jitterNoise);
+ * harvester.start();
+ * \endcode
+ *
+ * All of the registered noise sources are stirred in one batch and then
+ * ThreadRNG::reseed() is called so that every thread that uses ThreadRNG
+ * picks up the new entropy the next time that it generates random data.
+ * The noise sources gather their data without holding ThreadRNG::lock(),
+ * so the lock is only held while each source's output is stirred into
+ * the pool.  Other threads that are reseeding or calling methods on the
+ * global RNG object do not have to wait for a slow source to finish.
+ *
+ * Once the harvester has been started, the application should not call
+ * RNG.loop() itself or add more noise sources.
+ *
+ * \note This class is only available on Linux.
+ *
+ * \sa KernelNoiseSource, JitterNoiseSource, ThreadRNG
+ */
+
+/**
+ * \brief Constructs a new noise harvester that is not running.
+ *
+ * \sa start()
+ */
+NoiseHarvester::NoiseHarvester()
+    : interval(1000)
+    , running(false)
+    , stopping(false)
+{
+    pthread_mutex_init(&mutex, 0);
+    pthread_cond_init(&cond, 0);
+}
+
+/**
+ * \brief Destroys this noise harvester, stopping the thread if necessary.
+ */
+NoiseHarvester::~NoiseHarvester()
+{
+    stop();
+    pthread_cond_destroy(&cond);
+    pthread_mutex_destroy(&mutex);
+}
+
+/**
+ * \brief Starts the background harvesting thread.
+ *
+ * \param interval The number of milliseconds between batches.
+ *
+ * \return Returns true if the thread was started or is already running,
+ * or false if the thread could not be created.
+ *
+ * The first batch is harvested straight away.
+ *
+ * \sa stop(), isRunning()
+ */
+bool NoiseHarvester::start(unsigned long interval)
+{
+    if (running)
+        return true;
+    if (!interval)
+        interval = 1; // Just in case.
+    this->interval = interval;
+    stopping = false;
+    running = (pthread_create(&thread, 0, run, this) == 0);
+    return running;
+}
+
+/**
+ * \brief Stops the background harvesting thread.
+ *
+ * This function waits for any batch that is in progress to finish.
+ *
+ * \sa start()
+ */
+void NoiseHarvester::stop()
+{
+    if (!running)
+        return;
+    pthread_mutex_lock(&mutex);
+    stopping = true;
+    pthread_cond_signal(&cond);
+    pthread_mutex_unlock(&mutex);
+    pthread_join(thread, 0);
+    running = false;
+}
+
+/**
+ * \fn bool NoiseHarvester::isRunning() const
+ * \brief Determine if the background harvesting thread is running.
+ *
+ * \return Returns true if the thread is running; false otherwise.
+ *
+ * \sa start(), stop()
+ */
+
+/**
+ * \brief Entry point for the background harvesting thread.
+ *
+ * \param arg Points to the NoiseHarvester object.
+ *
+ * \return Always returns NULL.
+ */
+void *NoiseHarvester::run(void *arg)
+{
+    NoiseHarvester *harvester = (NoiseHarvester *)arg;
+    struct timespec deadline;
+    pthread_mutex_lock(&harvester->mutex);
+    while (!harvester->stopping) {
+        // Stir in a batch from all registered noise sources.
+        pthread_mutex_unlock(&harvester->mutex);
+        RNG.loop();
+        ThreadRNG::reseed();
+        pthread_mutex_lock(&harvester->mutex);
+
+        // Wait for the next interval or a request to stop.
+        clock_gettime(CLOCK_REALTIME, &deadline);
+        deadline.tv_sec += harvester->interval / 1000;
+        deadline.tv_nsec += (harvester->interval % 1000) * 1000000L;
+        if (deadline.tv_nsec >= 1000000000L) {
+            ++(deadline.tv_sec);
+            deadline.tv_nsec -= 1000000000L;
+        }
+        while (!harvester->stopping) {
+            if (pthread_cond_timedwait(&harvester->cond, &harvester->mutex,
+                                       &deadline) == ETIMEDOUT)
+                break;
+        }
+    }
+    pthread_mutex_unlock(&harvester->mutex);
+    return 0;
+}
+
+#endif // __linux__ && RNG_THREAD_LOCAL
@@ -23,6 +23,8 @@
 #include "OMAC.h"
 #include "GF128.h"
 #include "Crypto.h"
+#include "AES.h"
+#include "utility/StaticUtil.h"
 #include <string.h>
 
 /**
@@ -141,11 +143,30 @@ void OMAC::initNext(uint8_t omac[16], uint8_t tag)
  * \sa initFirst(), initNext(), finalize()
  */
 void OMAC::update(uint8_t omac[16], const uint8_t *data, size_t size)
+{
+    updateWith(*_blockCipher, omac, data, size);
+}
+
+/**
+ * \brief Updates an OMAC hashing context with more data using a specific
+ * block cipher object.
+ *
+ * \param cipher The block cipher to use, which is either the BlockCipher
+ * that was passed to setBlockCipher() or a StaticBlockCipher wrapper
+ * around the same object.
+ * \param omac The OMAC hashing context.
+ * \param data Points to the data to be hashed.
+ * \param size The number of bytes to be hashed.
+ *
+ * \sa update()
+ */
+template <typename B>
+void OMAC::updateWith(B &cipher, uint8_t omac[16], const uint8_t *data, size_t size)
 {
     while (size > 0) {
         // Encrypt the current block if it is already full.
         if (posn == 16) {
-            _blockCipher->encryptBlock(omac, omac);
+            cipher.encryptBlock(omac, omac);
             posn = 0;
         }
 
@@ -162,6 +183,15 @@ void OMAC::update(uint8_t omac[16], const uint8_t *data, size_t size)
     }
 }
 
+// Instantiate the loop for BlockCipher, which EAXCommon also uses, and
+// for the Static templates on the algorithms in utility/StaticUtil.h.
+template void OMAC::updateWith<BlockCipher>
+    (BlockCipher &, uint8_t *, const uint8_t *, size_t);
+#define OMAC_STATIC(T) \
+    template void OMAC::updateWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *, size_t);
+CRYPTO_STATIC_BLOCK_CIPHERS(OMAC_STATIC)
+
 /**
  * \brief Finalises an OMAC hashing context.
  *
@@ -37,6 +37,8 @@ public:
     void initFirst(uint8_t omac[16]);
     void initNext(uint8_t omac[16], uint8_t tag);
     void update(uint8_t omac[16], const uint8_t *data, size_t size);
+    template <typename B>
+    void updateWith(B &cipher, uint8_t omac[16], const uint8_t *data, size_t size);
     void finalize(uint8_t omac[16]);
 
     void clear();
@@ -35,7 +35,9 @@
  *
  * \note The public functions in this class need a substantial amount of
  * stack space to store intermediate results while the curve function is
- * being evaluated.  About 2k of free stack space is recommended for safety.
+ * being evaluated.  About 2k of free stack space is recommended for safety
+ * on AVR.  Other platforms use a table of precomputed multiples to speed
+ * up the curve function, which raises the recommendation to about 6k.
  *
  * References: NIST FIPS 186-4,
  * <a href="http://tools.ietf.org/html/rfc6090">RFC 6090</a>,
@@ -63,6 +65,13 @@
 #define strict_clean(x)     do { ; } while (0)
 #endif
 
+// Scalar multiplication uses a fixed 4-bit window over a table of 15
+// multiples of the point.  The table needs about 3K of stack space,
+// which is more than AVR devices can spare.  Use double-and-add on AVR.
+#if !defined(__AVR__)
+#define P521_FIXED_WINDOW 1
+#endif
+
 // Expand the partial 9-bit left over limb at the top of a 521-bit number.
 #if BIGNUMBER_LIMB_8BIT
 #define LIMB_PARTIAL(value) ((uint8_t)(value)), \
@@ -71,6 +80,10 @@
 #define LIMB_PARTIAL(value) (value)
 #endif
 
+#if defined(P521_FIXED_BASE)
+#include "utility/P521Tables.h"
+#endif
+
 /** @cond */
 
 // The group order "q" value from RFC 4754 and RFC 5903.  This is the
@@ -138,20 +151,18 @@ bool P521::eval(uint8_t result[132], const uint8_t f[66], const uint8_t point[13
     limb_t y[NUM_LIMBS_521BIT];
     bool ok;
 
-    // Unpack the curve point from the parameters and validate it.
+    // Unpack the curve point from the parameters and validate it,
+    // and then evaluate the curve function.
     if (point) {
         BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, point, 66);
         BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, point + 66, 66);
         ok = validate(x, y);
+        evaluate(x, y, f);
     } else {
-        memcpy_P(x, P521_Gx, sizeof(x));
-        memcpy_P(y, P521_Gy, sizeof(y));
+        evaluateBase(x, y, f);
         ok = true;
     }
 
-    // Evaluate the curve function.
-    evaluate(x, y, f);
-
     // Pack the answer into the result array.
     BigNumberUtil::packBE(result, 66, x, NUM_LIMBS_521BIT);
     BigNumberUtil::packBE(result + 66, 66, y, NUM_LIMBS_521BIT);
@@ -310,9 +321,7 @@ void P521::sign(uint8_t signature[132], const uint8_t privateKey[66],
             generateK(k, hm, privateKey, count);
 
         // Generate r = kG.x mod q.
-        memcpy_P(x, P521_Gx, sizeof(x));
-        memcpy_P(y, P521_Gy, sizeof(y));
-        evaluate(x, y, k);
+        evaluateBase(x, y, k);
         BigNumberUtil::reduceQuick_P(x, x, P521_q, NUM_LIMBS_521BIT);
         BigNumberUtil::packBE(signature, 66, x, NUM_LIMBS_521BIT);
 
@@ -374,13 +383,43 @@ bool P521::verify(const uint8_t signature[132],
                   const uint8_t publicKey[132],
                   const void *message, size_t len, Hash *hash)
 {
+    PublicKey key;
+    key.setKey(publicKey);
+    return verify(signature, key, message, len, hash);
+}
+
+/**
+ * \brief Verifies a signature using a prepared P-521 public key.
+ *
+ * \param signature The signature value to be verified.
+ * \param publicKey The prepared public key to use to verify the signature.
+ * \param message The message whose signature is to be verified.
+ * \param len The length of the \a message to be verified.
+ * \param hash The hash algorithm to use to hash the \a message before
+ * verification.  If \a hash is NULL, then the \a message is assumed to
+ * already be a hash value from some previous process.
+ *
+ * \return Returns true if the \a signature is valid for \a message;
+ * or false if the \a publicKey or \a signature is not valid.
+ *
+ * This is faster than the other form of verify() when the same public
+ * key is used to verify many signatures.
+ *
+ * \sa PublicKey, sign()
+ */
+bool P521::verify(const uint8_t signature[132],
+                  const PublicKey &publicKey,
+                  const void *message, size_t len, Hash *hash)
+{
+#if !defined(P521_FIXED_BASE)
     limb_t x[NUM_LIMBS_521BIT];
     limb_t y[NUM_LIMBS_521BIT];
+    uint8_t t[66];
+#endif
     limb_t r[NUM_LIMBS_521BIT];
     limb_t s[NUM_LIMBS_521BIT];
     limb_t u1[NUM_LIMBS_521BIT];
     limb_t u2[NUM_LIMBS_521BIT];
-    uint8_t t[66];
     bool ok = false;
 
     // Because we are operating on public values, we don't need to
@@ -392,15 +431,13 @@ bool P521::verify(const uint8_t signature[132],
     BigNumberUtil::unpackBE(s, NUM_LIMBS_521BIT, signature + 66, 66);
     if (BigNumberUtil::isZero(r, NUM_LIMBS_521BIT) ||
             BigNumberUtil::isZero(s, NUM_LIMBS_521BIT) ||
-            !BigNumberUtil::sub_P(x, r, P521_q, NUM_LIMBS_521BIT) ||
-            !BigNumberUtil::sub_P(x, s, P521_q, NUM_LIMBS_521BIT)) {
+            !BigNumberUtil::sub_P(u1, r, P521_q, NUM_LIMBS_521BIT) ||
+            !BigNumberUtil::sub_P(u1, s, P521_q, NUM_LIMBS_521BIT)) {
         goto failed;
     }
 
-    // Unpack the public key and check that it is a valid curve point.
-    BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, publicKey, 66);
-    BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, publicKey + 66, 66);
-    if (!validate(x, y)) {
+    // The public key must have been set to a valid curve point.
+    if (!publicKey.valid) {
         goto failed;
     }
 
@@ -426,7 +463,15 @@ bool P521::verify(const uint8_t signature[132],
     mulQ(u1, u1, u2);
     mulQ(u2, r, u2);
 
+#if defined(P521_FIXED_BASE)
+    // Compute the X co-ordinate of the curve point
+    // R = u1 * G + u2 * publicKey with a single doubling chain.
+    jointMul(s, u1, u2, publicKey);
+    BigNumberUtil::reduceQuick_P(u1, s, P521_q, NUM_LIMBS_521BIT);
+#else
     // Compute the curve point R = u2 * publicKey + u1 * G.
+    memcpy(x, publicKey.x, sizeof(x));
+    memcpy(y, publicKey.y, sizeof(y));
     BigNumberUtil::packBE(t, 66, u2, NUM_LIMBS_521BIT);
     evaluate(x, y, t);
     memcpy_P(u2, P521_Gx, sizeof(x));
@@ -434,20 +479,23 @@ bool P521::verify(const uint8_t signature[132],
     BigNumberUtil::packBE(t, 66, u1, NUM_LIMBS_521BIT);
     evaluate(u2, s, t);
     addAffine(u2, s, x, y);
+    BigNumberUtil::reduceQuick_P(u1, u2, P521_q, NUM_LIMBS_521BIT);
+#endif
 
     // If R.x = r mod q, then the signature is valid.
-    BigNumberUtil::reduceQuick_P(u1, u2, P521_q, NUM_LIMBS_521BIT);
     ok = secure_compare(u1, r, NUM_LIMBS_521BIT * sizeof(limb_t));
 
     // Clean up and exit.
 failed:
+#if !defined(P521_FIXED_BASE)
     clean(x);
     clean(y);
+    clean(t);
+#endif
     clean(r);
     clean(s);
     clean(u1);
     clean(u2);
-    clean(t);
     return ok;
 }
 
@@ -499,9 +547,7 @@ void P521::derivePublicKey(uint8_t publicKey[132], const uint8_t privateKey[66])
     // Evaluate the curve function starting with the generator.
     limb_t x[NUM_LIMBS_521BIT];
     limb_t y[NUM_LIMBS_521BIT];
-    memcpy_P(x, P521_Gx, sizeof(x));
-    memcpy_P(y, P521_Gy, sizeof(y));
-    evaluate(x, y, privateKey);
+    evaluateBase(x, y, privateKey);
 
     // Pack the (x, y) point into the public key.
     BigNumberUtil::packBE(publicKey, 66, x, NUM_LIMBS_521BIT);
@@ -584,6 +630,141 @@ bool P521::isValidPublicKey(const uint8_t publicKey[132])
  * two operations are equivalent.
  */
 
+/**
+ * \class P521::PublicKey P521.h <P521.h>
+ * \brief P-521 public key that has been prepared for repeated verification.
+ *
+ * Verifying a signature with P521::verify() normally starts by validating
+ * the public key and then computing a table of multiples of the key.
+ * When the same public key is used to verify many signatures, this class
+ * can be used to do that work once:
+ *
+ * \code
+ * P521::PublicKey key;
+ * if (key.setKey(publicKey)) {
+ *     ...
+ *     bool ok = P521::verify(signature, key, message, len, &hash);
+ *     ...
+ * }
+ * \endcode
+ *
+ * On AVR platforms the object only holds the validated key because there
+ * is not enough memory for the table of multiples.
+ */
+
+/**
+ * \brief Constructs an empty prepared public key.
+ *
+ * \sa setKey()
+ */
+P521::PublicKey::PublicKey()
+    : valid(false)
+{
+}
+
+/**
+ * \brief Destroys this prepared public key.
+ */
+P521::PublicKey::~PublicKey()
+{
+    clean(this, sizeof(PublicKey));
+}
+
+/**
+ * \brief Sets the public key and prepares it for verification.
+ *
+ * \param publicKey The public key consisting of the x and y values
+ * encoded in big-endian order.
+ *
+ * \return Returns true if the key was prepared, or false if
+ * \a publicKey is not a valid curve point.  Verification against an
+ * invalid key will always fail.
+ *
+ * \sa isValid(), clear()
+ */
+bool P521::PublicKey::setKey(const uint8_t publicKey[132])
+{
+#if defined(P521_FIXED_BASE)
+    limb_t x[NUM_LIMBS_521BIT];
+    limb_t y[NUM_LIMBS_521BIT];
+    limb_t z[8][NUM_LIMBS_521BIT];
+    limb_t prod[8][NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t z2[NUM_LIMBS_521BIT];
+    uint8_t index;
+
+    // Unpack the (x, y) point and validate it.
+    BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, publicKey, 66);
+    BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, publicKey + 66, 66);
+    valid = validate(x, y);
+    if (valid) {
+        // Compute the odd multiples Q, 3Q, ..., 15Q in Jacobian co-ordinates.
+        fieldUnpack(table[0][0], x);
+        fieldUnpack(table[0][1], y);
+        memset(z[0], 0, sizeof(z[0]));
+        z[0][0] = 1;
+        dblPoint(x2, y2, z2, table[0][0], table[0][1], z[0]);
+        for (index = 1; index < 8; ++index) {
+            addPoint(table[index][0], table[index][1], z[index],
+                     table[index - 1][0], table[index - 1][1], z[index - 1],
+                     x2, y2, z2);
+        }
+
+        // Convert the multiples into affine form using a single inversion
+        // with Montgomery's trick, which makes each addition cheaper.
+        memcpy(prod[0], z[0], sizeof(prod[0]));
+        for (index = 1; index < 8; ++index)
+            fieldMul(prod[index], prod[index - 1], z[index]);
+        fieldRecip(x2, prod[7]);
+        for (index = 8; index-- > 0; ) {
+            if (index > 0) {
+                fieldMul(y2, x2, prod[index - 1]);
+                fieldMul(x2, x2, z[index]);
+            } else {
+                memcpy(y2, x2, sizeof(y2));
+            }
+            fieldSquare(z2, y2);
+            fieldMul(table[index][0], table[index][0], z2);
+            fieldMul(z2, z2, y2);
+            fieldMul(table[index][1], table[index][1], z2);
+        }
+    } else {
+        memset(table, 0, sizeof(table));
+    }
+
+    // Clean up.
+    clean(x);
+    clean(y);
+    clean(z);
+    clean(prod);
+    clean(x2);
+    clean(y2);
+    clean(z2);
+#else
+    BigNumberUtil::unpackBE(x, NUM_LIMBS_521BIT, publicKey, 66);
+    BigNumberUtil::unpackBE(y, NUM_LIMBS_521BIT, publicKey + 66, 66);
+    valid = validate(x, y);
+#endif
+    return valid;
+}
+
+/**
+ * \fn bool P521::PublicKey::isValid() const
+ * \brief Determine if this object contains a valid prepared public key.
+ *
+ * \return Returns true if setKey() has succeeded; false otherwise.
+ */
+
+/**
+ * \brief Clears the prepared public key.
+ */
+void P521::PublicKey::clear()
+{
+    clean(this, sizeof(PublicKey));
+    valid = false;
+}
+
 /**
  * \brief Evaluates the curve function by multiplying (x, y) by f.
  *
@@ -596,6 +777,102 @@ bool P521::isValidPublicKey(const uint8_t publicKey[132])
  */
 void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
 {
+#if defined(P521_FIXED_WINDOW)
+    limb_t x1[NUM_LIMBS_521BIT];
+    limb_t y1[NUM_LIMBS_521BIT];
+    limb_t z1[NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t z2[NUM_LIMBS_521BIT];
+    limb_t z3[NUM_LIMBS_521BIT];
+    limb_t tx[15][NUM_LIMBS_521BIT];
+    limb_t ty[15][NUM_LIMBS_521BIT];
+    limb_t tz[15][NUM_LIMBS_521BIT];
+    uint8_t index;
+
+    // Build a table of the multiples 1 * (x, y) to 15 * (x, y) in
+    // Jacobian co-ordinates.  The input point has an implicit z of 1.
+    fieldUnpack(tx[0], x);
+    fieldUnpack(ty[0], y);
+    memset(tz[0], 0, sizeof(tz[0]));
+    tz[0][0] = 1;
+    dblPoint(tx[1], ty[1], tz[1], tx[0], ty[0], tz[0]);
+    for (index = 2; index < 15; ++index) {
+        addPoint(tx[index], ty[index], tz[index],
+                 tx[index - 1], ty[index - 1], tz[index - 1],
+                 tx[0], ty[0]/*, tz[0]*/);
+    }
+
+    // Set the answer to the point-at-infinity initially (z = 0).
+    memset(x1, 0, sizeof(x1));
+    memset(y1, 0, sizeof(y1));
+    memset(z1, 0, sizeof(z1));
+
+    // Iterate over the 4-bit windows of f from highest to lowest.
+    // The top window only contains bit 520.  Doubling the point at
+    // infinity leaves it unchanged so the first window is not special.
+    uint8_t window = 131;
+    while (window > 0) {
+        --window;
+
+        // Multiply the answer by 16.
+        dblPoint(x1, y1, z1, x1, y1, z1);
+        dblPoint(x1, y1, z1, x1, y1, z1);
+        dblPoint(x1, y1, z1, x1, y1, z1);
+        dblPoint(x1, y1, z1, x1, y1, z1);
+
+        // Extract the next window of f.
+        uint8_t digit = f[65 - (window >> 1)];
+        if (window & 0x01)
+            digit >>= 4;
+        if (window == 130)
+            digit &= 0x01;
+        else
+            digit &= 0x0F;
+
+        // Look up the multiple for the digit by scanning the whole table.
+        // A zero digit selects the first entry and the addition is
+        // discarded below, which preserves the overall timing.
+        memcpy(x, tx[0], sizeof(x1));
+        memcpy(y, ty[0], sizeof(y1));
+        memcpy(z3, tz[0], sizeof(z3));
+        for (index = 1; index < 15; ++index) {
+            uint16_t select = ((uint16_t)(digit ^ (index + 1))) - 1U;
+            select >>= 8;
+            cmove(select, x, tx[index]);
+            cmove(select, y, ty[index]);
+            cmove(select, z3, tz[index]);
+        }
+
+        // Add the multiple to the answer if the digit is non-zero.
+        addPoint(x2, y2, z2, x1, y1, z1, x, y, z3);
+        cmove(digit, x1, x2);
+        cmove(digit, y1, y2);
+        cmove(digit, z1, z2);
+    }
+
+    // Convert from Jacobian co-ordinates back into affine co-ordinates.
+    // x = x1 * (z1^2)^-1, y = y1 * (z1^3)^-1.
+    fieldRecip(x2, z1);
+    fieldSquare(y2, x2);
+    fieldMul(z2, x1, y2);
+    fieldPack(x, z2);
+    fieldMul(y2, y2, x2);
+    fieldMul(z2, y1, y2);
+    fieldPack(y, z2);
+
+    // Clean up.
+    clean(x1);
+    clean(y1);
+    clean(z1);
+    clean(x2);
+    clean(y2);
+    clean(z2);
+    clean(z3);
+    clean(tx);
+    clean(ty);
+    clean(tz);
+#else
     limb_t x1[NUM_LIMBS_521BIT];
     limb_t y1[NUM_LIMBS_521BIT];
     limb_t z1[NUM_LIMBS_521BIT];
@@ -607,6 +884,8 @@ void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
     // corresponds to the affine point (x / z^2, y / z^3), so if we set z
     // to 1 we end up with Jacobian co-ordinates.  Remember that z is 1
     // and continue on.
+    fieldUnpack(x, x);
+    fieldUnpack(y, y);
 
     // Set the answer to the point-at-infinity initially (z = 0).
     memset(x1, 0, sizeof(x1));
@@ -648,11 +927,101 @@ void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
 
     // Convert from Jacobian co-ordinates back into affine co-ordinates.
     // x = x1 * (z1^2)^-1, y = y1 * (z1^3)^-1.
-    recip(x2, z1);
-    square(y2, x2);
-    mul(x, x1, y2);
-    mul(y2, y2, x2);
-    mul(y, y1, y2);
+    fieldRecip(x2, z1);
+    fieldSquare(y2, x2);
+    fieldMul(x, x1, y2);
+    fieldPack(x, x);
+    fieldMul(y2, y2, x2);
+    fieldMul(y, y1, y2);
+    fieldPack(y, y);
+
+    // Clean up.
+    clean(x1);
+    clean(y1);
+    clean(z1);
+    clean(x2);
+    clean(y2);
+    clean(z2);
+#endif
+}
+
+/**
+ * \brief Evaluates the curve function by multiplying the generator by f.
+ *
+ * \param x The X co-ordinate of the result on exit.
+ * \param y The Y co-ordinate of the result on exit.
+ * \param f The 521-bit scalar to multiply the generator by, most
+ * significant bit first.
+ *
+ * When fixed-base tables are available, \a f is split into 131 signed
+ * 4-bit digits and the result is accumulated from the precomputed
+ * multiples of G in four passes of about 33 additions each, separated
+ * by 4 doublings.  Table entries are selected in constant time.
+ */
+void P521::evaluateBase(limb_t *x, limb_t *y, const uint8_t f[66])
+{
+#if defined(P521_FIXED_BASE)
+    limb_t x1[NUM_LIMBS_521BIT];
+    limb_t y1[NUM_LIMBS_521BIT];
+    limb_t z1[NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    limb_t z2[NUM_LIMBS_521BIT];
+    int8_t e[131];
+    int8_t carry;
+    uint8_t posn, pass;
+
+    // Convert f into 131 radix-16 digits, and then adjust the digits
+    // to be between -8 and 8 inclusive.  Only bit 520 of the top digit
+    // is used, so the top digit cannot exceed 2.
+    for (posn = 0; posn < 131; posn += 2) {
+        e[posn] = (int8_t)(f[65 - posn / 2] & 0x0F);
+        if (posn < 130)
+            e[posn + 1] = (int8_t)(f[65 - posn / 2] >> 4);
+    }
+    e[130] &= 0x01;
+    carry = 0;
+    for (posn = 0; posn < 130; ++posn) {
+        e[posn] += carry;
+        carry = (e[posn] + 8) >> 4;
+        e[posn] -= carry << 4;
+    }
+    e[130] += carry;
+
+    // Set the answer to the point-at-infinity initially (z = 0).
+    memset(x1, 0, sizeof(x1));
+    memset(y1, 0, sizeof(y1));
+    memset(z1, 0, sizeof(z1));
+
+    // Row i of the table holds the multiples of 2^(16 * i) * G.  For each
+    // pass m from 3 down to 0, multiply the answer by 16 and then add
+    // e[4 * i + m] * 2^(16 * i) * G for every row.  Zero digits still
+    // perform the addition to preserve the overall timing.
+    for (pass = 4; pass-- > 0; ) {
+        if (pass < 3) {
+            dblPoint(x1, y1, z1, x1, y1, z1);
+            dblPoint(x1, y1, z1, x1, y1, z1);
+            dblPoint(x1, y1, z1, x1, y1, z1);
+            dblPoint(x1, y1, z1, x1, y1, z1);
+        }
+        for (posn = pass; posn < 131; posn += 4) {
+            lookupBase(x, y, posn / 4, e[posn]);
+            addPoint(x2, y2, z2, x1, y1, z1, x, y);
+            cmove((uint8_t)(e[posn]), x1, x2);
+            cmove((uint8_t)(e[posn]), y1, y2);
+            cmove((uint8_t)(e[posn]), z1, z2);
+        }
+    }
+
+    // Convert from Jacobian co-ordinates back into affine co-ordinates.
+    // x = x1 * (z1^2)^-1, y = y1 * (z1^3)^-1.
+    fieldRecip(x2, z1);
+    fieldSquare(y2, x2);
+    fieldMul(z2, x1, y2);
+    fieldPack(x, z2);
+    fieldMul(y2, y2, x2);
+    fieldMul(z2, y1, y2);
+    fieldPack(y, z2);
 
     // Clean up.
     clean(x1);
@@ -661,8 +1030,242 @@ void P521::evaluate(limb_t *x, limb_t *y, const uint8_t f[66])
     clean(x2);
     clean(y2);
     clean(z2);
+    clean(e);
+#else
+    memcpy_P(x, P521_Gx, sizeof(P521_Gx));
+    memcpy_P(y, P521_Gy, sizeof(P521_Gy));
+    evaluate(x, y, f);
+#endif
+}
+
+#if defined(P521_FIXED_BASE)
+
+/**
+ * \brief Looks up a multiple of the generator in the fixed-base table.
+ *
+ * \param x The X co-ordinate of the multiple on exit, in the field
+ * representation.
+ * \param y The Y co-ordinate of the multiple on exit, in the field
+ * representation.
+ * \param row The row of the table, between 0 and 32.
+ * \param b The signed digit between -8 and 8 to select from the row.
+ *
+ * The whole row is read and the entry is selected with cmove() so that
+ * neither the timing nor the memory access pattern depends on \a b.
+ * If \a b is zero, then the result is (0, 0) and must be discarded.
+ */
+void P521::lookupBase(limb_t *x, limb_t *y, uint8_t row, int8_t b)
+{
+    limb_t entry[2][NUM_LIMBS_521BIT];
+    uint8_t bneg = ((uint8_t)b) >> 7;
+    uint8_t babs = (uint8_t)(b - (((-bneg) & b) << 1));
+    limb_t select;
+
+    // Select the k'th table entry if k is equal to the absolute value of b.
+    memset(x, 0, sizeof(entry[0]));
+    memset(y, 0, sizeof(entry[1]));
+    for (uint8_t k = 1; k <= 8; ++k) {
+        memcpy_P(entry, p521_comb[row][k - 1], sizeof(entry));
+        select = (limb_t)((((uint32_t)(babs ^ k)) - 1U) >> 31);
+        cmove(select, x, entry[0]);
+        cmove(select, y, entry[1]);
+    }
+    fieldUnpack(x, x);
+    fieldUnpack(y, y);
+
+    // Negate the point if b is negative by negating y.
+    memset(entry[0], 0, sizeof(entry[0]));
+    fieldSub(entry[1], entry[0], y);
+    cmove(bneg, y, entry[1]);
+
+    // Clean up.
+    clean(entry);
 }
 
+/**
+ * \brief Recodes a scalar into width-w non-adjacent form.
+ *
+ * \param naf The 522 signed digits of the result, from least significant
+ * to most significant.
+ * \param s The scalar to recode, which must be NUM_LIMBS_521BIT limbs in
+ * size and less than 2^521.
+ * \param w The window width, between 2 and 8.
+ *
+ * Every non-zero digit is odd and less than 2^(w - 1) in absolute value,
+ * and is followed by at least w - 1 zero digits.
+ */
+void P521::recodeWNAF(int8_t naf[522], const limb_t *s, uint8_t w)
+{
+    uint16_t bit = 0;
+    uint8_t carry = 0;
+    uint8_t now, posn;
+    int16_t word;
+
+    #define wnaf_bit(n) ((uint8_t)((s[(n) / LIMB_BITS] >> ((n) % LIMB_BITS)) & 1))
+    memset(naf, 0, 522);
+    while (bit < 522) {
+        // Skip over bits that are the same as the carry.
+        if (wnaf_bit(bit) == carry) {
+            ++bit;
+            continue;
+        }
+
+        // Extract the next w bits and convert them into a signed digit.
+        now = w;
+        if (now > (522 - bit))
+            now = 522 - bit;
+        word = carry;
+        for (posn = 0; posn < now; ++posn)
+            word += ((int16_t)wnaf_bit(bit + posn)) << posn;
+        carry = (uint8_t)((word >> (w - 1)) & 1);
+        word -= ((int16_t)carry) << w;
+        naf[bit] = (int8_t)word;
+        bit += now;
+    }
+    #undef wnaf_bit
+}
+
+/**
+ * \brief Computes the X co-ordinate of s * G + k * Q, where G is the
+ * generator and Q is a prepared public key.
+ *
+ * \param x The X co-ordinate of the result, which will be NUM_LIMBS_521BIT
+ * limbs in size and zero if the result is the point-at-infinity.
+ * \param s The multiplier for G, which must be NUM_LIMBS_521BIT limbs
+ * in size and less than 2^521.
+ * \param k The multiplier for Q, which must be NUM_LIMBS_521BIT limbs
+ * in size and less than 2^521.
+ * \param publicKey The prepared public key Q.
+ *
+ * Both multiplications share a single chain of doublings.  The multiples
+ * of G come from a precomputed table of odd multiples and \a s is recoded
+ * with a width-7 NAF.  The scalar \a k is recoded with a width-5 NAF.
+ *
+ * \note This function is not constant time so it should only be used
+ * on publicly-known values.
+ */
+void P521::jointMul(limb_t *x, const limb_t *s, const limb_t *k,
+                    const PublicKey &publicKey)
+{
+    limb_t x1[NUM_LIMBS_521BIT];
+    limb_t y1[NUM_LIMBS_521BIT];
+    limb_t z1[NUM_LIMBS_521BIT];
+    limb_t x2[NUM_LIMBS_521BIT];
+    limb_t y2[NUM_LIMBS_521BIT];
+    int8_t nafS[522];
+    int8_t nafK[522];
+    int16_t posn;
+    int8_t digit;
+
+    // Recode the scalars.
+    recodeWNAF(nafS, s, 7);
+    recodeWNAF(nafK, k, 5);
+
+    // Set the answer to the point-at-infinity initially (z = 0).
+    memset(x1, 0, sizeof(x1));
+    memset(y1, 0, sizeof(y1));
+    memset(z1, 0, sizeof(z1));
+
+    // Find the most significant non-zero digit.
+    posn = 521;
+    while (posn >= 0 && !nafS[posn] && !nafK[posn])
+        --posn;
+
+    // Double the result and add in the multiples for each digit.
+    for (; posn >= 0; --posn) {
+        dblPoint(x1, y1, z1, x1, y1, z1);
+        digit = nafS[posn];
+        if (digit) {
+            uint8_t index = (uint8_t)((digit < 0 ? -digit : digit) / 2);
+            memcpy_P(x2, p521_odd[index][0], sizeof(x2));
+            memcpy_P(y2, p521_odd[index][1], sizeof(y2));
+            fieldUnpack(x2, x2);
+            fieldUnpack(y2, y2);
+            addInPlace(x1, y1, z1, x2, y2, digit < 0);
+        }
+        digit = nafK[posn];
+        if (digit > 0) {
+            addInPlace(x1, y1, z1, publicKey.table[digit / 2][0],
+                       publicKey.table[digit / 2][1], false);
+        } else if (digit < 0) {
+            addInPlace(x1, y1, z1, publicKey.table[(-digit) / 2][0],
+                       publicKey.table[(-digit) / 2][1], true);
+        }
+    }
+
+    // Convert the X co-ordinate back into affine co-ordinates.
+    // x = x1 * (z1^2)^-1.
+    fieldRecip(x2, z1);
+    fieldSquare(y2, x2);
+    fieldMul(x2, x1, y2);
+    fieldPack(x, x2);
+
+    // Clean up.
+    clean(x1);
+    clean(y1);
+    clean(z1);
+    clean(x2);
+    clean(y2);
+}
+
+/**
+ * \brief Adds an affine point or its negation to a point in Jacobian
+ * co-ordinates.
+ *
+ * \param x1 The X value for the first point to add, and the result.
+ * \param y1 The Y value for the first point to add, and the result.
+ * \param z1 The Z value for the first point to add, and the result.
+ * \param x2 The X value for the second point to add.
+ * \param y2 The Y value for the second point to add.
+ * \param negate Set to true to add the negation of (x2, y2).
+ *
+ * \note This function is not constant time so it should only be used
+ * on publicly-known values.
+ */
+void P521::addInPlace(limb_t *x1, limb_t *y1, limb_t *z1,
+                      const limb_t *x2, const limb_t *y2, bool negate)
+{
+    limb_t xout[NUM_LIMBS_521BIT];
+    limb_t yout[NUM_LIMBS_521BIT];
+    limb_t zout[NUM_LIMBS_521BIT];
+    limb_t yneg[NUM_LIMBS_521BIT];
+    limb_t t[NUM_LIMBS_521BIT];
+    if (negate) {
+        memset(yneg, 0, sizeof(yneg));
+        fieldSub(yneg, yneg, y2);
+        y2 = yneg;
+    }
+    addPoint(xout, yout, zout, x1, y1, z1, x2, y2);
+
+    // The mixed addition formula is incomplete.  If the first point was
+    // not the identity but the result is, then h = 0 and the points are
+    // either equal or negations of each other.  Equal points need to be
+    // doubled instead.  The sum of a point and its negation is the
+    // point-at-infinity, which is what addPoint() returned.
+    fieldPack(t, zout);
+    if (BigNumberUtil::isZero(t, NUM_LIMBS_521BIT)) {
+        fieldPack(t, z1);
+        if (!BigNumberUtil::isZero(t, NUM_LIMBS_521BIT)) {
+            // Compare y2 * z1^3 with y1 to determine if r = 0.
+            fieldSquare(t, z1);
+            fieldMul(t, t, z1);
+            fieldMul(t, y2, t);
+            fieldSub(t, t, y1);
+            fieldPack(t, t);
+            if (BigNumberUtil::isZero(t, NUM_LIMBS_521BIT)) {
+                dblPoint(x1, y1, z1, x1, y1, z1);
+                return;
+            }
+        }
+    }
+
+    memcpy(x1, xout, sizeof(xout));
+    memcpy(y1, yout, sizeof(yout));
+    memcpy(z1, zout, sizeof(zout));
+}
+
+#endif // P521_FIXED_BASE
+
 /**
  * \brief Adds two affine points.
  *
@@ -679,27 +1282,39 @@ void P521::addAffine(limb_t *x1, limb_t *y1, const limb_t *x2, const limb_t *y2)
     limb_t yout[NUM_LIMBS_521BIT];
     limb_t zout[NUM_LIMBS_521BIT];
     limb_t z1[NUM_LIMBS_521BIT];
+    limb_t u[NUM_LIMBS_521BIT];
+    limb_t v[NUM_LIMBS_521BIT];
+
+    // Convert the points into the field representation.
+    fieldUnpack(x1, x1);
+    fieldUnpack(y1, y1);
+    fieldUnpack(u, x2);
+    fieldUnpack(v, y2);
 
     // z1 = 1
     z1[0] = 1;
     memset(z1 + 1, 0, (NUM_LIMBS_521BIT - 1) * sizeof(limb_t));
 
     // Add the two points.
-    addPoint(xout, yout, zout, x1, y1, z1, x2, y2/*, z2*/);
+    addPoint(xout, yout, zout, x1, y1, z1, u, v/*, z2*/);
 
     // Convert from Jacobian co-ordinates back into affine co-ordinates.
     // x1 = xout * (zout^2)^-1, y1 = yout * (zout^3)^-1.
-    recip(z1, zout);
-    square(zout, z1);
-    mul(x1, xout, zout);
-    mul(zout, zout, z1);
-    mul(y1, yout, zout);
+    fieldRecip(z1, zout);
+    fieldSquare(zout, z1);
+    fieldMul(x1, xout, zout);
+    fieldPack(x1, x1);
+    fieldMul(zout, zout, z1);
+    fieldMul(y1, yout, zout);
+    fieldPack(y1, y1);
 
     // Clean up.
     clean(xout);
     clean(yout);
     clean(zout);
     clean(z1);
+    clean(u);
+    clean(v);
 }
 
 /**
@@ -724,16 +1339,23 @@ bool P521::validate(const limb_t *x, const limb_t *y)
     // We need to check that y^2 = x^3 - 3 * x + b mod 2^521 - 1.
     limb_t t1[NUM_LIMBS_521BIT];
     limb_t t2[NUM_LIMBS_521BIT];
-    square(t1, x);
-    mul(t1, t1, x);
-    mulLiteral(t2, x, 3);
-    sub(t1, t1, t2);
+    limb_t t3[NUM_LIMBS_521BIT];
+    fieldUnpack(t3, x);
+    fieldSquare(t1, t3);
+    fieldMul(t1, t1, t3);
+    fieldMulLiteral(t2, t3, 3);
+    fieldSub(t1, t1, t2);
     memcpy_P(t2, P521_b, sizeof(t2));
-    add(t1, t1, t2);
-    square(t2, y);
+    fieldUnpack(t2, t2);
+    fieldAdd(t1, t1, t2);
+    fieldPack(t1, t1);
+    fieldUnpack(t3, y);
+    fieldSquare(t2, t3);
+    fieldPack(t2, t2);
     result &= secure_compare(t1, t2, sizeof(t1));
     clean(t1);
     clean(t2);
+    clean(t3);
     return result;
 }
 
@@ -1122,6 +1744,343 @@ void P521::sub(limb_t *result, const limb_t *x, const limb_t *y)
 #endif
 }
 
+/**
+ * \brief Converts a number modulo 2^521 - 1 into the field representation.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size.
+ * This can be the same array as \a x.
+ * \param x The number to convert, which must be NUM_LIMBS_521BIT limbs in
+ * size and less than 2^521.
+ *
+ * On 64-bit hosts the field representation consists of nine 58-bit limbs.
+ * On all other platforms it is the same as the regular NUM_LIMBS_521BIT
+ * representation and this function simply copies \a x to \a result.
+ *
+ * \sa fieldPack()
+ */
+void P521::fieldUnpack(limb_t *result, const limb_t *x)
+{
+#if defined(P521_RADIX58)
+    const limb_t mask = (((limb_t)1) << 58) - 1;
+    limb_t x0 = x[0];
+    limb_t x1 = x[1];
+    limb_t x2 = x[2];
+    limb_t x3 = x[3];
+    limb_t x4 = x[4];
+    limb_t x5 = x[5];
+    limb_t x6 = x[6];
+    limb_t x7 = x[7];
+    limb_t x8 = x[8];
+    result[0] = x0 & mask;
+    result[1] = ((x0 >> 58) | (x1 << 6)) & mask;
+    result[2] = ((x1 >> 52) | (x2 << 12)) & mask;
+    result[3] = ((x2 >> 46) | (x3 << 18)) & mask;
+    result[4] = ((x3 >> 40) | (x4 << 24)) & mask;
+    result[5] = ((x4 >> 34) | (x5 << 30)) & mask;
+    result[6] = ((x5 >> 28) | (x6 << 36)) & mask;
+    result[7] = ((x6 >> 22) | (x7 << 42)) & mask;
+    result[8] = ((x7 >> 16) | (x8 << 48)) & mask;
+#else
+    if (result != x)
+        memcpy(result, x, NUM_LIMBS_521BIT * sizeof(limb_t));
+#endif
+}
+
+/**
+ * \brief Converts a field element back into a fully reduced number
+ * modulo 2^521 - 1.
+ *
+ * \param result The result, which will be NUM_LIMBS_521BIT limbs in size.
+ * This can be the same array as \a x.
+ * \param x The field element to convert, which must be NUM_LIMBS_521BIT
+ * limbs in size.
+ *
+ * The result is always less than 2^521 - 1 so it can be compared
+ * directly against other packed values.
+ *
+ * \sa fieldUnpack()
+ */
+void P521::fieldPack(limb_t *result, const limb_t *x)
+{
+#if defined(P521_RADIX58)
+    const limb_t mask = (((limb_t)1) << 58) - 1;
+    const limb_t mask57 = (((limb_t)1) << 57) - 1;
+    limb_t x0 = x[0];
+    limb_t x1 = x[1];
+    limb_t x2 = x[2];
+    limb_t x3 = x[3];
+    limb_t x4 = x[4];
+    limb_t x5 = x[5];
+    limb_t x6 = x[6];
+    limb_t x7 = x[7];
+    limb_t x8 = x[8];
+    limb_t q;
+
+    // Propagate the carries so that every limb is less than 2^58 and the
+    // top limb is less than 2^57.  Doing this twice absorbs the carry that
+    // wraps around from x8.
+    for (uint8_t round = 0; round < 2; ++round) {
+        x1 += x0 >> 58; x0 &= mask;
+        x2 += x1 >> 58; x1 &= mask;
+        x3 += x2 >> 58; x2 &= mask;
+        x4 += x3 >> 58; x3 &= mask;
+        x5 += x4 >> 58; x4 &= mask;
+        x6 += x5 >> 58; x5 &= mask;
+        x7 += x6 >> 58; x6 &= mask;
+        x8 += x7 >> 58; x7 &= mask;
+        x0 += x8 >> 57; x8 &= mask57;
+    }
+
+    // The value is now less than 2 * (2^521 - 1).  Determine if it is
+    // greater than or equal to 2^521 - 1 by checking for a carry out
+    // of the top bit after adding 1.  Then subtract 2^521 - 1 if
+    // necessary by adding q and discarding bit 521.
+    q = (x0 + 1) >> 58;
+    q = (x1 + q) >> 58;
+    q = (x2 + q) >> 58;
+    q = (x3 + q) >> 58;
+    q = (x4 + q) >> 58;
+    q = (x5 + q) >> 58;
+    q = (x6 + q) >> 58;
+    q = (x7 + q) >> 58;
+    q = (x8 + q) >> 57;
+    x0 += q;
+    x1 += x0 >> 58; x0 &= mask;
+    x2 += x1 >> 58; x1 &= mask;
+    x3 += x2 >> 58; x2 &= mask;
+    x4 += x3 >> 58; x3 &= mask;
+    x5 += x4 >> 58; x4 &= mask;
+    x6 += x5 >> 58; x5 &= mask;
+    x7 += x6 >> 58; x6 &= mask;
+    x8 += x7 >> 58; x7 &= mask;
+    x8 &= mask57;
+
+    // Pack the 58-bit limbs into 64-bit limbs.
+    result[0] = x0 | (x1 << 58);
+    result[1] = (x1 >> 6) | (x2 << 52);
+    result[2] = (x2 >> 12) | (x3 << 46);
+    result[3] = (x3 >> 18) | (x4 << 40);
+    result[4] = (x4 >> 24) | (x5 << 34);
+    result[5] = (x5 >> 30) | (x6 << 28);
+    result[6] = (x6 >> 36) | (x7 << 22);
+    result[7] = (x7 >> 42) | (x8 << 16);
+    result[8] = x8 >> 48;
+#else
+    if (result != x)
+        memcpy(result, x, NUM_LIMBS_521BIT * sizeof(limb_t));
+#endif
+}
+
+#if defined(P521_RADIX58)
+
+/** @cond p521_radix58 */
+
+// Propagates the carries between the limbs of a field element.  The carry
+// out of the top 57-bit limb is folded back into the bottom using
+// 2^521 = 1.  The result limbs will all be less than 2^58 except x[0]
+// which may be slightly larger; the next operation will absorb the excess.
+#define p521_carry58(x) \
+    do { \
+        const limb_t mask = (((limb_t)1) << 58) - 1; \
+        for (uint8_t _posn = 0; _posn < 8; ++_posn) { \
+            (x)[_posn + 1] += (x)[_posn] >> 58; \
+            (x)[_posn] &= mask; \
+        } \
+        (x)[0] += (x)[8] >> 57; \
+        (x)[8] &= (mask >> 1); \
+    } while (0)
+
+// Carries the 128-bit column sums of a multiplication into nine 58-bit
+// limbs.  The top carry is folded back into the bottom using 2^521 = 1.
+// The result limbs will all be less than 2^58 except result[1] which may
+// be slightly larger; the next operation will absorb the excess.
+#define p521_carry58_wide(result, t) \
+    do { \
+        const limb_t mask = (((limb_t)1) << 58) - 1; \
+        limb_t _c; \
+        for (uint8_t _posn = 0; _posn < 8; ++_posn) { \
+            (t)[_posn + 1] += (limb_t)((t)[_posn] >> 58); \
+            (result)[_posn] = ((limb_t)((t)[_posn])) & mask; \
+        } \
+        _c = (result)[0] + (limb_t)((t)[8] >> 57); \
+        (result)[8] = ((limb_t)((t)[8])) & (mask >> 1); \
+        (result)[0] = _c & mask; \
+        (result)[1] += _c >> 58; \
+    } while (0)
+
+/** @endcond */
+
+/**
+ * \brief Multiplies two field elements and then reduces the result
+ * modulo 2^521 - 1.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value to multiply, which must be NUM_LIMBS_521BIT
+ * limbs in size.
+ * \param y The second value to multiply, which must be NUM_LIMBS_521BIT
+ * limbs in size.  This can be the same array as \a x.
+ *
+ * The result is only partially reduced; use fieldPack() to obtain the
+ * canonical value.
+ *
+ * \sa fieldSquare()
+ */
+void P521::fieldMul(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    limb_t x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4 = x[4];
+    limb_t x5 = x[5], x6 = x[6], x7 = x[7], x8 = x[8];
+    limb_t y0 = y[0], y1 = y[1], y2 = y[2], y3 = y[3], y4 = y[4];
+    limb_t y5 = y[5], y6 = y[6], y7 = y[7], y8 = y[8];
+    limb_t y1_2 = y1 << 1, y2_2 = y2 << 1, y3_2 = y3 << 1, y4_2 = y4 << 1;
+    limb_t y5_2 = y5 << 1, y6_2 = y6 << 1, y7_2 = y7 << 1, y8_2 = y8 << 1;
+    dlimb_t t[NUM_LIMBS_521BIT];
+
+    // Multiply the limbs.  Products of limbs i and j with i + j >= 9 lie
+    // above 2^522, which is 2 modulo 2^521 - 1.  Fold them into the low
+    // limbs by doubling.
+    t[0] = ((dlimb_t)x0) * y0 + ((dlimb_t)x1) * y8_2 + ((dlimb_t)x2) * y7_2 +
+           ((dlimb_t)x3) * y6_2 + ((dlimb_t)x4) * y5_2 +
+           ((dlimb_t)x5) * y4_2 + ((dlimb_t)x6) * y3_2 +
+           ((dlimb_t)x7) * y2_2 + ((dlimb_t)x8) * y1_2;
+    t[1] = ((dlimb_t)x0) * y1 + ((dlimb_t)x1) * y0 + ((dlimb_t)x2) * y8_2 +
+           ((dlimb_t)x3) * y7_2 + ((dlimb_t)x4) * y6_2 +
+           ((dlimb_t)x5) * y5_2 + ((dlimb_t)x6) * y4_2 +
+           ((dlimb_t)x7) * y3_2 + ((dlimb_t)x8) * y2_2;
+    t[2] = ((dlimb_t)x0) * y2 + ((dlimb_t)x1) * y1 + ((dlimb_t)x2) * y0 +
+           ((dlimb_t)x3) * y8_2 + ((dlimb_t)x4) * y7_2 +
+           ((dlimb_t)x5) * y6_2 + ((dlimb_t)x6) * y5_2 +
+           ((dlimb_t)x7) * y4_2 + ((dlimb_t)x8) * y3_2;
+    t[3] = ((dlimb_t)x0) * y3 + ((dlimb_t)x1) * y2 + ((dlimb_t)x2) * y1 +
+           ((dlimb_t)x3) * y0 + ((dlimb_t)x4) * y8_2 + ((dlimb_t)x5) * y7_2 +
+           ((dlimb_t)x6) * y6_2 + ((dlimb_t)x7) * y5_2 + ((dlimb_t)x8) * y4_2;
+    t[4] = ((dlimb_t)x0) * y4 + ((dlimb_t)x1) * y3 + ((dlimb_t)x2) * y2 +
+           ((dlimb_t)x3) * y1 + ((dlimb_t)x4) * y0 + ((dlimb_t)x5) * y8_2 +
+           ((dlimb_t)x6) * y7_2 + ((dlimb_t)x7) * y6_2 + ((dlimb_t)x8) * y5_2;
+    t[5] = ((dlimb_t)x0) * y5 + ((dlimb_t)x1) * y4 + ((dlimb_t)x2) * y3 +
+           ((dlimb_t)x3) * y2 + ((dlimb_t)x4) * y1 + ((dlimb_t)x5) * y0 +
+           ((dlimb_t)x6) * y8_2 + ((dlimb_t)x7) * y7_2 + ((dlimb_t)x8) * y6_2;
+    t[6] = ((dlimb_t)x0) * y6 + ((dlimb_t)x1) * y5 + ((dlimb_t)x2) * y4 +
+           ((dlimb_t)x3) * y3 + ((dlimb_t)x4) * y2 + ((dlimb_t)x5) * y1 +
+           ((dlimb_t)x6) * y0 + ((dlimb_t)x7) * y8_2 + ((dlimb_t)x8) * y7_2;
+    t[7] = ((dlimb_t)x0) * y7 + ((dlimb_t)x1) * y6 + ((dlimb_t)x2) * y5 +
+           ((dlimb_t)x3) * y4 + ((dlimb_t)x4) * y3 + ((dlimb_t)x5) * y2 +
+           ((dlimb_t)x6) * y1 + ((dlimb_t)x7) * y0 + ((dlimb_t)x8) * y8_2;
+    t[8] = ((dlimb_t)x0) * y8 + ((dlimb_t)x1) * y7 + ((dlimb_t)x2) * y6 +
+           ((dlimb_t)x3) * y5 + ((dlimb_t)x4) * y4 + ((dlimb_t)x5) * y3 +
+           ((dlimb_t)x6) * y2 + ((dlimb_t)x7) * y1 + ((dlimb_t)x8) * y0;
+
+    // Propagate the carries.
+    p521_carry58_wide(result, t);
+}
+
+/**
+ * \brief Squares a field element and then reduces the result
+ * modulo 2^521 - 1.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to square, which must be NUM_LIMBS_521BIT limbs
+ * in size.
+ *
+ * Squaring needs 45 limb multiplications instead of the 81 that are
+ * needed by fieldMul().
+ *
+ * \sa fieldMul()
+ */
+void P521::fieldSquare(limb_t *result, const limb_t *x)
+{
+    limb_t x0 = x[0], x1 = x[1], x2 = x[2], x3 = x[3], x4 = x[4];
+    limb_t x5 = x[5], x6 = x[6], x7 = x[7], x8 = x[8];
+    limb_t x1_2 = x1 << 1, x2_2 = x2 << 1, x3_2 = x3 << 1, x4_2 = x4 << 1;
+    limb_t x5_2 = x5 << 1, x6_2 = x6 << 1, x7_2 = x7 << 1, x8_2 = x8 << 1;
+    limb_t x5_4 = x5 << 2, x6_4 = x6 << 2, x7_4 = x7 << 2, x8_4 = x8 << 2;
+    dlimb_t t[NUM_LIMBS_521BIT];
+
+    // The cross products appear twice, and those that lie above 2^522
+    // need to be doubled again when they are folded into the low limbs.
+    t[0] = ((dlimb_t)x0) * x0 + ((dlimb_t)x1) * x8_4 + ((dlimb_t)x2) * x7_4 +
+           ((dlimb_t)x3) * x6_4 + ((dlimb_t)x4) * x5_4;
+    t[1] = ((dlimb_t)x0) * x1_2 + ((dlimb_t)x2) * x8_4 +
+           ((dlimb_t)x3) * x7_4 + ((dlimb_t)x4) * x6_4 + ((dlimb_t)x5) * x5_2;
+    t[2] = ((dlimb_t)x0) * x2_2 + ((dlimb_t)x1) * x1 + ((dlimb_t)x3) * x8_4 +
+           ((dlimb_t)x4) * x7_4 + ((dlimb_t)x5) * x6_4;
+    t[3] = ((dlimb_t)x0) * x3_2 + ((dlimb_t)x1) * x2_2 +
+           ((dlimb_t)x4) * x8_4 + ((dlimb_t)x5) * x7_4 + ((dlimb_t)x6) * x6_2;
+    t[4] = ((dlimb_t)x0) * x4_2 + ((dlimb_t)x1) * x3_2 + ((dlimb_t)x2) * x2 +
+           ((dlimb_t)x5) * x8_4 + ((dlimb_t)x6) * x7_4;
+    t[5] = ((dlimb_t)x0) * x5_2 + ((dlimb_t)x1) * x4_2 +
+           ((dlimb_t)x2) * x3_2 + ((dlimb_t)x6) * x8_4 + ((dlimb_t)x7) * x7_2;
+    t[6] = ((dlimb_t)x0) * x6_2 + ((dlimb_t)x1) * x5_2 +
+           ((dlimb_t)x2) * x4_2 + ((dlimb_t)x3) * x3 + ((dlimb_t)x7) * x8_4;
+    t[7] = ((dlimb_t)x0) * x7_2 + ((dlimb_t)x1) * x6_2 +
+           ((dlimb_t)x2) * x5_2 + ((dlimb_t)x3) * x4_2 + ((dlimb_t)x8) * x8_2;
+    t[8] = ((dlimb_t)x0) * x8_2 + ((dlimb_t)x1) * x7_2 +
+           ((dlimb_t)x2) * x6_2 + ((dlimb_t)x3) * x5_2 + ((dlimb_t)x4) * x4;
+
+    // Propagate the carries.
+    p521_carry58_wide(result, t);
+}
+
+/**
+ * \brief Multiplies a field element by a small literal modulo 2^521 - 1.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size
+ * and can be the same array as \a x.
+ * \param x The value to multiply, which must be NUM_LIMBS_521BIT limbs
+ * in size.
+ * \param y The literal to multiply by, which must be less than 32.
+ */
+void P521::fieldMulLiteral(limb_t *result, const limb_t *x, limb_t y)
+{
+    for (uint8_t posn = 0; posn < NUM_LIMBS_521BIT; ++posn)
+        result[posn] = x[posn] * y;
+    p521_carry58(result);
+}
+
+/**
+ * \brief Adds two field elements modulo 2^521 - 1.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value to add, which must be NUM_LIMBS_521BIT limbs
+ * in size.
+ * \param y The second value to add, which must be NUM_LIMBS_521BIT limbs
+ * in size.
+ */
+void P521::fieldAdd(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    for (uint8_t posn = 0; posn < NUM_LIMBS_521BIT; ++posn)
+        result[posn] = x[posn] + y[posn];
+    p521_carry58(result);
+}
+
+/**
+ * \brief Subtracts two field elements modulo 2^521 - 1.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size
+ * and can be the same array as \a x or \a y.
+ * \param x The first value, which must be NUM_LIMBS_521BIT limbs in size.
+ * \param y The value to subtract from \a x, which must be NUM_LIMBS_521BIT
+ * limbs in size.
+ *
+ * To avoid underflow, 4 * (2^521 - 1) is added to \a x before \a y is
+ * subtracted.  Each limb of the multiple is larger than the corresponding
+ * limb of any partially reduced field element.
+ */
+void P521::fieldSub(limb_t *result, const limb_t *x, const limb_t *y)
+{
+    const limb_t p4 = (((limb_t)1) << 60) - 4;
+    const limb_t p4top = (((limb_t)1) << 59) - 4;
+    for (uint8_t posn = 0; posn < (NUM_LIMBS_521BIT - 1); ++posn)
+        result[posn] = x[posn] + p4 - y[posn];
+    result[NUM_LIMBS_521BIT - 1] =
+        x[NUM_LIMBS_521BIT - 1] + p4top - y[NUM_LIMBS_521BIT - 1];
+    p521_carry58(result);
+}
+
+#endif // P521_RADIX58
+
 /**
  * \brief Doubles a point represented in Jacobian co-ordinates.
  *
@@ -1150,26 +2109,26 @@ void P521::dblPoint(limb_t *xout, limb_t *yout, limb_t *zout,
     // Double the point.  If it is the point at infinity (z = 0),
     // then zout will still be zero at the end of this process so
     // we don't need any special handling for that case.
-    square(delta, zin);       // delta = z^2
-    square(gamma, yin);       // gamma = y^2
-    mul(beta, xin, gamma);    // beta = x * gamma
-    sub(tmp, xin, delta);     // alpha = 3 * (x - delta) * (x + delta)
-    mulLiteral(alpha, tmp, 3);
-    add(tmp, xin, delta);
-    mul(alpha, alpha, tmp);
-    square(xout, alpha);      // xout = alpha^2 - 8 * beta
-    mulLiteral(tmp, beta, 8);
-    sub(xout, xout, tmp);
-    add(zout, yin, zin);      // zout = (y + z)^2 - gamma - delta
-    square(zout, zout);
-    sub(zout, zout, gamma);
-    sub(zout, zout, delta);
-    mulLiteral(yout, beta, 4);// yout = alpha * (4 * beta - xout) - 8 * gamma^2
-    sub(yout, yout, xout);
-    mul(yout, alpha, yout);
-    square(gamma, gamma);
-    mulLiteral(gamma, gamma, 8);
-    sub(yout, yout, gamma);
+    fieldSquare(delta, zin);        // delta = z^2
+    fieldSquare(gamma, yin);        // gamma = y^2
+    fieldMul(beta, xin, gamma);     // beta = x * gamma
+    fieldSub(tmp, xin, delta);      // alpha = 3 * (x - delta) * (x + delta)
+    fieldMulLiteral(alpha, tmp, 3);
+    fieldAdd(tmp, xin, delta);
+    fieldMul(alpha, alpha, tmp);
+    fieldSquare(xout, alpha);       // xout = alpha^2 - 8 * beta
+    fieldMulLiteral(tmp, beta, 8);
+    fieldSub(xout, xout, tmp);
+    fieldAdd(zout, yin, zin);       // zout = (y + z)^2 - gamma - delta
+    fieldSquare(zout, zout);
+    fieldSub(zout, zout, gamma);
+    fieldSub(zout, zout, delta);
+    fieldMulLiteral(yout, beta, 4); // yout = alpha * (4 * beta - xout) - 8 * gamma^2
+    fieldSub(yout, yout, xout);
+    fieldMul(yout, alpha, yout);
+    fieldSquare(gamma, gamma);
+    fieldMulLiteral(gamma, gamma, 8);
+    fieldSub(yout, yout, gamma);
 
     // Clean up.
     strict_clean(alpha);
@@ -1214,31 +2173,32 @@ void P521::addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
 
     // Determine if the first value is the point-at-infinity identity element.
     // The second z value is always 1 so it cannot be the point-at-infinity.
-    limb_t p1IsIdentity = BigNumberUtil::isZero(z1, NUM_LIMBS_521BIT);
+    fieldPack(z1z1, z1);
+    limb_t p1IsIdentity = BigNumberUtil::isZero(z1z1, NUM_LIMBS_521BIT);
 
     // Multiply the points, assuming that z2 = 1.
-    square(z1z1, z1);               // z1z1 = z1^2
-    mul(u2, x2, z1z1);              // u2 = x2 * z1z1
-    mul(s2, y2, z1);                // s2 = y2 * z1 * z1z1
-    mul(s2, s2, z1z1);
-    sub(h, u2, x1);                 // h = u2 - x1
-    mulLiteral(i, h, 2);            // i = (2 * h)^2
-    square(i, i);
-    sub(r, s2, y1);                 // r = 2 * (s2 - y1)
-    add(r, r, r);
-    mul(j, h, i);                   // j = h * i
-    mul(v, x1, i);                  // v = x1 * i
-    square(xout, r);                // xout = r^2 - j - 2 * v
-    sub(xout, xout, j);
-    sub(xout, xout, v);
-    sub(xout, xout, v);
-    sub(yout, v, xout);             // yout = r * (v - xout) - 2 * y1 * j
-    mul(yout, r, yout);
-    mul(j, y1, j);
-    sub(yout, yout, j);
-    sub(yout, yout, j);
-    mul(zout, z1, h);               // zout = 2 * z1 * h
-    add(zout, zout, zout);
+    fieldSquare(z1z1, z1);          // z1z1 = z1^2
+    fieldMul(u2, x2, z1z1);         // u2 = x2 * z1z1
+    fieldMul(s2, y2, z1);           // s2 = y2 * z1 * z1z1
+    fieldMul(s2, s2, z1z1);
+    fieldSub(h, u2, x1);            // h = u2 - x1
+    fieldMulLiteral(i, h, 2);       // i = (2 * h)^2
+    fieldSquare(i, i);
+    fieldSub(r, s2, y1);            // r = 2 * (s2 - y1)
+    fieldAdd(r, r, r);
+    fieldMul(j, h, i);              // j = h * i
+    fieldMul(v, x1, i);             // v = x1 * i
+    fieldSquare(xout, r);           // xout = r^2 - j - 2 * v
+    fieldSub(xout, xout, j);
+    fieldSub(xout, xout, v);
+    fieldSub(xout, xout, v);
+    fieldSub(yout, v, xout);        // yout = r * (v - xout) - 2 * y1 * j
+    fieldMul(yout, r, yout);
+    fieldMul(j, y1, j);
+    fieldSub(yout, yout, j);
+    fieldSub(yout, yout, j);
+    fieldMul(zout, z1, h);          // zout = 2 * z1 * h
+    fieldAdd(zout, zout, zout);
 
     // Select the answer to return.  If (x1, y1, z1) was the identity,
     // then the answer is (x2, y2, z2).  Otherwise it is (xout, yout, zout).
@@ -1258,6 +2218,91 @@ void P521::addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
     strict_clean(v);
 }
 
+/**
+ * \brief Adds two curve points that are both represented in Jacobian
+ * co-ordinates.
+ *
+ * \param xout The X value for the result.
+ * \param yout The Y value for the result.
+ * \param zout The Z value for the result.
+ * \param x1 The X value for the first point to add.
+ * \param y1 The Y value for the first point to add.
+ * \param z1 The Z value for the first point to add.
+ * \param x2 The X value for the second point to add.
+ * \param y2 The Y value for the second point to add.
+ * \param z2 The Z value for the second point to add.
+ *
+ * The output parameters must not overlap with either of the inputs.
+ *
+ * The second point must not be the point-at-infinity.
+ *
+ * Reference: http://hyperelliptic.org/EFD/g1p/auto-shortw-jacobian-3.html#addition-add-2007-bl
+ */
+void P521::addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
+                    const limb_t *x1, const limb_t *y1,
+                    const limb_t *z1, const limb_t *x2,
+                    const limb_t *y2, const limb_t *z2)
+{
+    limb_t z1z1[NUM_LIMBS_521BIT];
+    limb_t z2z2[NUM_LIMBS_521BIT];
+    limb_t u1[NUM_LIMBS_521BIT];
+    limb_t u2[NUM_LIMBS_521BIT];
+    limb_t s1[NUM_LIMBS_521BIT];
+    limb_t s2[NUM_LIMBS_521BIT];
+    limb_t h[NUM_LIMBS_521BIT];
+    limb_t i[NUM_LIMBS_521BIT];
+    limb_t r[NUM_LIMBS_521BIT];
+
+    // Determine if the first value is the point-at-infinity identity element.
+    fieldPack(z1z1, z1);
+    limb_t p1IsIdentity = BigNumberUtil::isZero(z1z1, NUM_LIMBS_521BIT);
+
+    // Add the points.
+    fieldSquare(z1z1, z1);          // z1z1 = z1^2
+    fieldSquare(z2z2, z2);          // z2z2 = z2^2
+    fieldMul(u1, x1, z2z2);         // u1 = x1 * z2z2
+    fieldMul(u2, x2, z1z1);         // u2 = x2 * z1z1
+    fieldMul(s1, y1, z2);           // s1 = y1 * z2 * z2z2
+    fieldMul(s1, s1, z2z2);
+    fieldMul(s2, y2, z1);           // s2 = y2 * z1 * z1z1
+    fieldMul(s2, s2, z1z1);
+    fieldSub(h, u2, u1);            // h = u2 - u1
+    fieldMulLiteral(i, h, 2);       // i = (2 * h)^2
+    fieldSquare(i, i);
+    fieldSub(r, s2, s1);            // r = 2 * (s2 - s1)
+    fieldAdd(r, r, r);
+    fieldMul(z2z2, h, i);           // j = h * i
+    fieldMul(u1, u1, i);            // v = u1 * i
+    fieldSquare(xout, r);           // xout = r^2 - j - 2 * v
+    fieldSub(xout, xout, z2z2);
+    fieldSub(xout, xout, u1);
+    fieldSub(xout, xout, u1);
+    fieldSub(yout, u1, xout);       // yout = r * (v - xout) - 2 * s1 * j
+    fieldMul(yout, r, yout);
+    fieldMul(s1, s1, z2z2);
+    fieldSub(yout, yout, s1);
+    fieldSub(yout, yout, s1);
+    fieldMul(zout, z1, z2);         // zout = 2 * z1 * z2 * h
+    fieldMul(zout, zout, h);
+    fieldAdd(zout, zout, zout);
+
+    // If (x1, y1, z1) was the identity, then the answer is (x2, y2, z2).
+    cmove(p1IsIdentity, xout, x2);
+    cmove(p1IsIdentity, yout, y2);
+    cmove(p1IsIdentity, zout, z2);
+
+    // Clean up.
+    strict_clean(z1z1);
+    strict_clean(z2z2);
+    strict_clean(u1);
+    strict_clean(u2);
+    strict_clean(s1);
+    strict_clean(s2);
+    strict_clean(h);
+    strict_clean(i);
+    strict_clean(r);
+}
+
 /**
  * \brief Conditionally moves \a y into \a x if a selection value is non-zero.
  *
@@ -1326,8 +2371,35 @@ void P521::cmove1(limb_t select, limb_t *x)
  * This cannot be the same array as \a x.
  * \param x The number to compute the reciprocal for, also NUM_LIMBS_521BIT
  * limbs in size.
+ *
+ * \sa fieldRecip()
  */
 void P521::recip(limb_t *result, const limb_t *x)
+{
+#if defined(P521_RADIX58)
+    limb_t t1[NUM_LIMBS_521BIT];
+    limb_t t2[NUM_LIMBS_521BIT];
+    fieldUnpack(t1, x);
+    fieldRecip(t2, t1);
+    fieldPack(result, t2);
+    clean(t1);
+    clean(t2);
+#else
+    fieldRecip(result, x);
+#endif
+}
+
+/**
+ * \brief Computes the reciprocal of a field element modulo 2^521 - 1.
+ *
+ * \param result The result, which must be NUM_LIMBS_521BIT limbs in size.
+ * This cannot be the same array as \a x.
+ * \param x The field element to compute the reciprocal for, also
+ * NUM_LIMBS_521BIT limbs in size.
+ *
+ * \sa recip()
+ */
+void P521::fieldRecip(limb_t *result, const limb_t *x)
 {
     limb_t t1[NUM_LIMBS_521BIT];
 
@@ -1341,30 +2413,30 @@ void P521::recip(limb_t *result, const limb_t *x)
     // and then 1111111111111111, and so on for the top 512-bits.
 
     // Build a 4-bit pattern 1111 in the result.
-    square(result, x);
-    mul(result, result, x);
-    square(result, result);
-    mul(result, result, x);
-    square(result, result);
-    mul(result, result, x);
+    fieldSquare(result, x);
+    fieldMul(result, result, x);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
 
     // Shift and multiply by increasing powers of two.  This turns
     // 1111 into 11111111, and then 1111111111111111, and so on.
     for (size_t power = 4; power <= 256; power <<= 1) {
-        square(t1, result);
+        fieldSquare(t1, result);
         for (size_t temp = 1; temp < power; ++temp)
-            square(t1, t1);
-        mul(result, result, t1);
+            fieldSquare(t1, t1);
+        fieldMul(result, result, t1);
     }
 
     // Handle the 9 lowest bits of (p - 2), 111111101, from highest to lowest.
     for (uint8_t index = 0; index < 7; ++index) {
-        square(result, result);
-        mul(result, result, x);
+        fieldSquare(result, result);
+        fieldMul(result, result, x);
     }
-    square(result, result);
-    square(result, result);
-    mul(result, result, x);
+    fieldSquare(result, result);
+    fieldSquare(result, result);
+    fieldMul(result, result, x);
 
     // Clean up.
     clean(t1);
@@ -25,11 +25,27 @@
 
 #include "BigNumberUtil.h"
 
+// On 64-bit hosts with 128-bit double limbs, field elements for the curve
+// arithmetic use an unsaturated representation of nine 58-bit limbs.
+// Either way a field element occupies the same number of limbs as a
+// 521-bit number.
+#if BIGNUMBER_LIMB_64BIT
+#define P521_RADIX58 1
+#endif
+#define NUM_LIMBS_FIELD521 ((66 + sizeof(limb_t) - 1) / sizeof(limb_t))
+
+// The fixed-base tables for G need 42K of program memory, which is more
+// than most AVR devices can spare.  Use the generic curve function on AVR.
+#if !defined(__AVR__)
+#define P521_FIXED_BASE 1
+#endif
+
 class Hash;
 
 class P521
 {
 public:
+    class PublicKey;
 
     static bool eval(uint8_t result[132], const uint8_t f[66], const uint8_t point[132]);
 
@@ -41,6 +57,9 @@ public:
     static bool verify(const uint8_t signature[132],
                        const uint8_t publicKey[132],
                        const void *message, size_t len, Hash *hash = 0);
+    static bool verify(const uint8_t signature[132],
+                       const PublicKey &publicKey,
+                       const void *message, size_t len, Hash *hash = 0);
 
     static void generatePrivateKey(uint8_t privateKey[66]);
     static void derivePublicKey(uint8_t publicKey[132], const uint8_t privateKey[66]);
@@ -59,6 +78,16 @@ public:
 private:
 #endif
     static void evaluate(limb_t *x, limb_t *y, const uint8_t f[66]);
+    static void evaluateBase(limb_t *x, limb_t *y, const uint8_t f[66]);
+
+#if defined(P521_FIXED_BASE)
+    static void lookupBase(limb_t *x, limb_t *y, uint8_t row, int8_t b);
+    static void recodeWNAF(int8_t naf[522], const limb_t *s, uint8_t w);
+    static void jointMul(limb_t *x, const limb_t *s, const limb_t *k,
+                         const PublicKey &publicKey);
+    static void addInPlace(limb_t *x1, limb_t *y1, limb_t *z1,
+                           const limb_t *x2, const limb_t *y2, bool negate);
+#endif
 
     static void addAffine(limb_t *x1, limb_t *y1,
                           const limb_t *x2, const limb_t *y2);
@@ -82,6 +111,30 @@ private:
     static void add(limb_t *result, const limb_t *x, const limb_t *y);
     static void sub(limb_t *result, const limb_t *x, const limb_t *y);
 
+    static void fieldUnpack(limb_t *result, const limb_t *x);
+    static void fieldPack(limb_t *result, const limb_t *x);
+
+#if defined(P521_RADIX58)
+    static void fieldMul(limb_t *result, const limb_t *x, const limb_t *y);
+    static void fieldSquare(limb_t *result, const limb_t *x);
+    static void fieldMulLiteral(limb_t *result, const limb_t *x, limb_t y);
+    static void fieldAdd(limb_t *result, const limb_t *x, const limb_t *y);
+    static void fieldSub(limb_t *result, const limb_t *x, const limb_t *y);
+#else
+    static void fieldMul(limb_t *result, const limb_t *x, const limb_t *y)
+        { mul(result, x, y); }
+    static void fieldSquare(limb_t *result, const limb_t *x)
+        { mul(result, x, x); }
+    static void fieldMulLiteral(limb_t *result, const limb_t *x, limb_t y)
+        { mulLiteral(result, x, y); }
+    static void fieldAdd(limb_t *result, const limb_t *x, const limb_t *y)
+        { add(result, x, y); }
+    static void fieldSub(limb_t *result, const limb_t *x, const limb_t *y)
+        { sub(result, x, y); }
+#endif
+
+    static void fieldRecip(limb_t *result, const limb_t *x);
+
     static void dblPoint(limb_t *xout, limb_t *yout, limb_t *zout,
                          const limb_t *xin, const limb_t *yin,
                          const limb_t *zin);
@@ -89,6 +142,10 @@ private:
                          const limb_t *x1, const limb_t *y1,
                          const limb_t *z1, const limb_t *x2,
                          const limb_t *y2);
+    static void addPoint(limb_t *xout, limb_t *yout, limb_t *zout,
+                         const limb_t *x1, const limb_t *y1,
+                         const limb_t *z1, const limb_t *x2,
+                         const limb_t *y2, const limb_t *z2);
 
     static void cmove(limb_t select, limb_t *x, const limb_t *y);
     static void cmove1(limb_t select, limb_t *x);
@@ -109,4 +166,29 @@ private:
     ~P521() {}
 };
 
+class P521::PublicKey
+{
+public:
+    PublicKey();
+    ~PublicKey();
+
+    bool setKey(const uint8_t publicKey[132]);
+    bool isValid() const { return valid; }
+
+    void clear();
+
+private:
+#if defined(P521_FIXED_BASE)
+    // Odd multiples Q, 3Q, ..., 15Q of the key in affine co-ordinates.
+    limb_t table[8][2][NUM_LIMBS_FIELD521];
+#else
+    // Affine co-ordinates of the key Q.
+    limb_t x[NUM_LIMBS_FIELD521];
+    limb_t y[NUM_LIMBS_FIELD521];
+#endif
+    bool valid;
+
+    friend class P521;
+};
+
 #endif
@@ -49,6 +49,18 @@
 #define RNG_WORD_TRNG_GET() (esp_random())
 #define RNG_ESP_NVS 1
 #include <nvs.h>
+#elif defined(__linux__)
+// Linux hosts can seed the pool from the kernel's random number generator.
+#define RNG_GETRANDOM 1
+#include <sys/random.h>
+#endif
+#if defined(RNG_THREAD_LOCAL)
+#include <pthread.h>
+#include <sched.h>
+#include <unistd.h>
+#if defined(__APPLE__)
+#include <sys/random.h>
+#endif
 #endif
 #include <string.h>
 
@@ -59,7 +71,8 @@
 //       in your sketch and then comment out the #warning line below.
 #if !defined(RNG_DUE_TRNG) && \
     !defined(RNG_WATCHDOG) && \
-    !defined(RNG_WORD_TRNG)
+    !defined(RNG_WORD_TRNG) && \
+    !defined(RNG_GETRANDOM)
 #warning "no hardware random number source detected for this platform"
 #endif
 
@@ -175,10 +188,17 @@ RNGClass RNG;
 // Maximum entropy credit that can be contained in the pool.
 #define RNG_MAX_CREDITS     384u
 
-/** @cond */
+// Lock the pool on hosted platforms where ThreadRNG and NoiseHarvester
+// may access the global RNG object from several threads at once.
+#if defined(RNG_THREAD_LOCAL)
+#define rngLock()           ThreadRNG::lock()
+#define rngUnlock()         ThreadRNG::unlock()
+#else
+#define rngLock()           do { ; } while (0)
+#define rngUnlock()         do { ; } while (0)
+#endif
 
-// Imported from Crypto.cpp.
-extern uint8_t crypto_crc8(uint8_t tag, const void *data, unsigned size);
+/** @cond */
 
 // Tag for 256-bit ChaCha20 keys.  This will always appear in the
 // first 16 bytes of the block.  The remaining 48 bytes are the seed.
@@ -405,8 +425,11 @@ static void eraseAndWriteSeed()
 void RNGClass::begin(const char *tag)
 {
     // Bail out if we have already done this.
-    if (initialized)
+    rngLock();
+    if (initialized) {
+        rngUnlock();
         return;
+    }
 
     // Initialize the ChaCha20 input block from the saved seed.
     memcpy_P(block, tagRNG, sizeof(tagRNG));
@@ -458,9 +481,27 @@ void RNGClass::begin(const char *tag)
     // Mix in some output from a word-based TRNG to initialize the state.
     mixTRNG();
 #endif
+#if defined(RNG_GETRANDOM)
+    // Mix in a seed from the kernel.  Don't block if the kernel's pool
+    // has not been initialized yet, which can happen early during boot.
+    uint32_t seed[12];
+    bool seeded = (getrandom(seed, sizeof(seed), GRND_NONBLOCK) ==
+                   (ssize_t)sizeof(seed));
+    if (seeded) {
+        for (int posn = 0; posn < 12; ++posn)
+            block[posn + 4] ^= seed[posn];
+    }
+    clean(seed);
+#endif
 
     // No entropy credits for the saved seed.
     credits = 0;
+#if defined(RNG_GETRANDOM)
+    // The kernel's output is as good as a hardware TRNG, so give it
+    // full credit.  KernelNoiseSource can be used to keep it topped up.
+    if (seeded)
+        credits = RNG_MAX_CREDITS;
+#endif
 
     // Trigger an automatic save once the entropy credits max out.
     firstSave = 1;
@@ -520,6 +561,7 @@ void RNGClass::begin(const char *tag)
 
     // The RNG has now been initialized.
     initialized = 1;
+    rngUnlock();
 }
 
 /**
@@ -537,10 +579,12 @@ void RNGClass::begin(const char *tag)
 void RNGClass::addNoiseSource(NoiseSource &source)
 {
     #define MAX_NOISE_SOURCES (sizeof(noiseSources) / sizeof(noiseSources[0]))
+    rngLock();
     if (count < MAX_NOISE_SOURCES) {
         noiseSources[count++] = &source;
         source.added();
     }
+    rngUnlock();
 }
 
 /**
@@ -587,6 +631,7 @@ void RNGClass::rand(uint8_t *data, size_t len)
 {
     // Make sure that the RNG is initialized in case the application
     // forgot to call RNG.begin() at startup time.
+    rngLock();
     if (!initialized)
         begin(0);
 
@@ -636,6 +681,7 @@ void RNGClass::rand(uint8_t *data, size_t len)
 
     // Force a rekey after every request.
     rekey();
+    rngUnlock();
 }
 
 /**
@@ -679,10 +725,14 @@ void RNGClass::rand(uint8_t *data, size_t len)
  */
 bool RNGClass::available(size_t len) const
 {
+    rngLock();
+    bool result;
     if (len >= (RNG_MAX_CREDITS / 8))
-        return credits >= RNG_MAX_CREDITS;
+        result = (credits >= RNG_MAX_CREDITS);
     else
-        return (uint16_t)len <= (credits / 8);
+        result = ((uint16_t)len <= (credits / 8));
+    rngUnlock();
+    return result;
 }
 
 /**
@@ -713,6 +763,7 @@ bool RNGClass::available(size_t len) const
 void RNGClass::stir(const uint8_t *data, size_t len, unsigned int credit)
 {
     // Increase the entropy credit.
+    rngLock();
     if ((credit / 8) >= len && len)
         credit = len * 8;
     if ((uint16_t)(RNG_MAX_CREDITS - credits) > credit)
@@ -751,6 +802,7 @@ void RNGClass::stir(const uint8_t *data, size_t len, unsigned int credit)
         firstSave = 0;
         save();
     }
+    rngUnlock();
 }
 
 /**
@@ -783,6 +835,7 @@ void RNGClass::save()
 {
     // Generate random data from the current state and save
     // that as the seed.  Then force a rekey.
+    rngLock();
     ++(block[12]);
     ChaCha::hashCore(stream, block, RNG_ROUNDS);
 #if defined(RNG_EEPROM)
@@ -813,6 +866,7 @@ void RNGClass::save()
 #endif
     rekey();
     timer = millis();
+    rngUnlock();
 }
 
 /**
@@ -823,10 +877,14 @@ void RNGClass::save()
  */
 void RNGClass::loop()
 {
-    // Stir in the entropy from all registered noise sources.
+    // Stir in the entropy from all registered noise sources.  The pool
+    // is not locked while the sources gather their data because that can
+    // take a while.  Each source locks the pool when it calls stir().
     for (uint8_t posn = 0; posn < count; ++posn)
         noiseSources[posn]->stir();
 
+    rngLock();
+
 #if defined(RNG_DUE_TRNG)
     // If there is data available from the Arudino Due's TRNG, then XOR
     // it with the state block and increase the entropy credit.  We don't
@@ -910,6 +968,7 @@ void RNGClass::loop()
     // Save the seed if the auto-save timer has expired.
     if ((millis() - timer) >= timeout)
         save();
+    rngUnlock();
 }
 
 /**
@@ -933,6 +992,7 @@ void RNGClass::loop()
  */
 void RNGClass::destroy()
 {
+    rngLock();
     clean(block);
     clean(stream);
 #if defined(RNG_EEPROM)
@@ -952,6 +1012,7 @@ void RNGClass::destroy()
     }
 #endif
     initialized = 0;
+    rngUnlock();
 }
 
 /**
@@ -1022,3 +1083,283 @@ void RNGClass::mixTRNG()
     }
 #endif
 }
+
+#if defined(RNG_THREAD_LOCAL)
+
+/**
+ * \class ThreadRNG RNG.h <RNG.h>
+ * \brief Per-thread random number generators for hosted platforms.
+ *
+ * The global RNG object is not thread-safe and rekeys after every call
+ * to RNGClass::rand(), which is slow when a multi-threaded application
+ * needs lots of small random values such as nonces.  ThreadRNG gives
+ * each thread its own ChaCha20 generator that is seeded from the global
+ * RNG object:
+ *
+ * \code
+ * uint8_t nonce[12];
+ * ThreadRNG::rand(nonce, sizeof(nonce));
+ * \endcode
+ *
+ * Each thread generates its output into a reservoir of 1K of keystream
+ * at a time.  The first 48 bytes of each reservoir become the new key
+ * and the rest is handed out to callers, erasing it as it goes, so that
+ * the state cannot be wound backwards if it is captured later.  Requests
+ * that fit in the reservoir do not need to run ChaCha20 at all.
+ *
+ * Seeding takes a short spin lock around the global RNG object, which
+ * happens the first time a thread asks for data, after every 256K of
+ * output, and after reseed() is called.  There is no locking otherwise.
+ * The methods of the global RNG object take the same lock, so they can
+ * be called from any thread.  The application should call reseed()
+ * after stirring in new entropy so that every thread picks it up.
+ * NoiseHarvester does this for the registered noise sources on Linux.
+ *
+ * ThreadRNG does not track entropy credits.  The application should
+ * wait for RNGClass::available() on the global RNG object before
+ * using ThreadRNG to generate keys.
+ *
+ * \note This class is only available on Linux and Apple platforms.
+ *
+ * \sa RNGClass
+ */
+
+// Number of ChaCha blocks to generate into the per-thread reservoir.
+#define RNG_RESERVOIR_BLOCKS 16
+
+// Reseed the per-thread state from the global RNG after this many refills.
+#define RNG_RESEED_REFILLS   256
+
+/** @cond */
+
+// Per-thread random number generator state.  Objects with thread
+// storage duration are zero-initialized, which leaves "generation"
+// out of step with "rootGeneration" to force seeding on first use.
+struct ThreadRNGState
+{
+    uint32_t block[16];
+    uint32_t reservoir[RNG_RESERVOIR_BLOCKS * 16];
+    uint32_t generation;
+    uint16_t posn;
+    uint16_t refills;
+
+    ~ThreadRNGState() { clean(this, sizeof(ThreadRNGState)); }
+};
+
+static thread_local ThreadRNGState threadState;
+
+// Spin lock that protects the global RNG object.
+static uint8_t rootLock = 0;
+
+// Number of times that the current thread has acquired the spin lock.
+static thread_local uint8_t rootLockDepth = 0;
+
+// Incremented by ThreadRNG::reseed() to force all threads to reseed.
+static uint32_t rootGeneration = 1;
+
+/** @endcond */
+
+/**
+ * \brief Locks the global RNG object for use by the current thread.
+ *
+ * The lock is a simple spin lock that is only intended to be held for
+ * short periods.  The methods of the global RNG object take the lock
+ * themselves, so it is only necessary to call this to make a sequence
+ * of calls atomic, such as a call to RNGClass::available() followed by
+ * a call to RNGClass::rand().
+ *
+ * The lock is recursive.  A thread that already holds the lock can call
+ * lock() again, but must call unlock() the same number of times.
+ *
+ * \sa unlock()
+ */
+void ThreadRNG::lock()
+{
+    if (rootLockDepth++ != 0)
+        return;
+    while (__atomic_test_and_set(&rootLock, __ATOMIC_ACQUIRE)) {
+        // Give the holder a chance to run in case it was preempted.
+        sched_yield();
+    }
+}
+
+/**
+ * \brief Unlocks the global RNG object.
+ *
+ * \sa lock()
+ */
+void ThreadRNG::unlock()
+{
+    if (--rootLockDepth == 0)
+        __atomic_clear(&rootLock, __ATOMIC_RELEASE);
+}
+
+/**
+ * \brief Locks the global RNG object before fork().
+ *
+ * Another thread may hold the lock when fork() is called, and that thread
+ * will not exist in the child.  Holding the lock across fork() ensures
+ * that the child gets a consistent copy of the global RNG object.
+ */
+static void threadForkPrepare()
+{
+    ThreadRNG::lock();
+}
+
+/**
+ * \brief Unlocks the global RNG object in the parent after fork().
+ */
+static void threadForkParent()
+{
+    ThreadRNG::unlock();
+}
+
+/**
+ * \brief Makes the global RNG object in the child diverge from the
+ * parent after fork().
+ *
+ * The child starts with a byte-for-byte copy of the parent's global RNG
+ * object.  If both processes were to reseed from it then they would
+ * produce the same output.  Stir fresh kernel output and the process ID
+ * into the child's copy and force every thread state to be re-derived.
+ */
+static void threadForkChild()
+{
+    uint32_t seed[12];
+#if defined(RNG_GETRANDOM)
+    bool seeded = (getrandom(seed, sizeof(seed), GRND_NONBLOCK) ==
+                   (ssize_t)sizeof(seed));
+#else
+    bool seeded = (getentropy(seed, sizeof(seed)) == 0);
+#endif
+    pid_t pid = getpid();
+    if (seeded)
+        RNG.stir((const uint8_t *)seed, sizeof(seed));
+    RNG.stir((const uint8_t *)&pid, sizeof(pid));
+    clean(seed);
+    __atomic_add_fetch(&rootGeneration, 1, __ATOMIC_RELAXED);
+    ThreadRNG::unlock();
+}
+
+/**
+ * \brief Registers the fork() handlers when the library is loaded.
+ */
+__attribute__((constructor)) static void threadForkInit()
+{
+    pthread_atfork(threadForkPrepare, threadForkParent, threadForkChild);
+}
+
+/**
+ * \brief Seeds the state for the current thread from the global RNG object.
+ *
+ * \param state The state for the current thread.
+ * \param generation The seeding generation for the new state.
+ *
+ * The new seed is XOR'ed with the existing key so that any previous
+ * state for the thread contributes to the new key.
+ */
+static void threadSeed(ThreadRNGState *state, uint32_t generation)
+{
+    uint32_t seed[12];
+    RNG.rand((uint8_t *)seed, sizeof(seed));
+    memcpy_P(state->block, tagRNG, 16);
+    for (uint8_t posn = 0; posn < 12; ++posn)
+        state->block[posn + 4] ^= seed[posn];
+    state->generation = generation;
+    state->posn = sizeof(state->reservoir);
+    state->refills = 0;
+    clean(seed);
+}
+
+/**
+ * \brief Refills the reservoir for the current thread and rekeys.
+ *
+ * \param state The state for the current thread.
+ */
+static void threadRefill(ThreadRNGState *state)
+{
+    for (uint8_t index = 0; index < RNG_RESERVOIR_BLOCKS; ++index) {
+        ++(state->block[12]);
+        ChaCha::hashCore(state->reservoir + index * 16, state->block,
+                         RNG_ROUNDS);
+    }
+    memcpy(state->block + 4, state->reservoir, 48);
+    memset(state->reservoir, 0, 48);
+    state->posn = 48;
+    ++(state->refills);
+}
+
+/**
+ * \brief Generates random bytes into a caller-supplied buffer using the
+ * generator for the current thread.
+ *
+ * \param data Points to the buffer to fill with random bytes.
+ * \param len Number of bytes to generate.
+ *
+ * \sa reseed()
+ */
+void ThreadRNG::rand(uint8_t *data, size_t len)
+{
+    ThreadRNGState *state = &threadState;
+    uint32_t generation = __atomic_load_n(&rootGeneration, __ATOMIC_RELAXED);
+    if (state->generation != generation ||
+            state->refills >= RNG_RESEED_REFILLS)
+        threadSeed(state, generation);
+    while (len > 0) {
+        if (state->posn >= sizeof(state->reservoir))
+            threadRefill(state);
+        uint8_t *reservoir = ((uint8_t *)(state->reservoir)) + state->posn;
+        size_t templen = sizeof(state->reservoir) - state->posn;
+        if (templen > len)
+            templen = len;
+        state->posn += templen;
+        len -= templen;
+        // Copy and erase in 8-byte chunks.  Fixed-size copies become
+        // simple moves, which is faster for the small requests that
+        // are the common case than a variable-length memcpy().
+        while (templen >= 8) {
+            memcpy(data, reservoir, 8);
+            memset(reservoir, 0, 8);
+            data += 8;
+            reservoir += 8;
+            templen -= 8;
+        }
+        while (templen > 0) {
+            *data++ = *reservoir;
+            *reservoir++ = 0;
+            --templen;
+        }
+    }
+}
+
+/**
+ * \brief Forces every thread to reseed from the global RNG object the
+ * next time that it generates random data.
+ *
+ * This should be called after new entropy has been stirred into the
+ * global RNG object.
+ *
+ * It is not necessary to call this after fork().  The child process
+ * automatically stirs fresh output from the kernel and its process ID
+ * into its copy of the global RNG object, and then forces every thread
+ * to reseed, so the child will not repeat the output of the parent.
+ *
+ * \sa rand(), RNGClass::stir()
+ */
+void ThreadRNG::reseed()
+{
+    __atomic_add_fetch(&rootGeneration, 1, __ATOMIC_RELAXED);
+}
+
+/**
+ * \brief Clears the random number generator state for the current thread.
+ *
+ * The state will be seeded again from the global RNG object if the
+ * current thread asks for more random data.
+ */
+void ThreadRNG::clear()
+{
+    clean(&threadState, sizeof(ThreadRNGState));
+}
+
+#endif // RNG_THREAD_LOCAL
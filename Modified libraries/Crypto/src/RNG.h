@@ -71,4 +71,29 @@ private:
 
 extern RNGClass RNG;
 
+// Hosted platforms with threads can use per-thread generators that
+// are seeded from the global RNG object.
+#if defined(__GNUC__) && (defined(__linux__) || defined(__APPLE__))
+#define RNG_THREAD_LOCAL 1
+#endif
+
+#if defined(RNG_THREAD_LOCAL)
+
+class ThreadRNG
+{
+public:
+    static void rand(uint8_t *data, size_t len);
+
+    static void reseed();
+    static void clear();
+
+    static void lock();
+    static void unlock();
+
+private:
+    ThreadRNG() {}
+};
+
+#endif
+
 #endif
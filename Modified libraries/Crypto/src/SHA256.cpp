@@ -25,7 +25,12 @@
 #include "utility/RotateUtil.h"
 #include "utility/EndianUtil.h"
 #include "utility/ProgMemUtil.h"
+#include "utility/CpuUtil.h"
+#include "utility/SHA2Util.h"
 #include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <immintrin.h>
+#endif
 
 /**
  * \class SHA256 SHA256.h <SHA256.h>
@@ -33,6 +38,10 @@
  *
  * Reference: http://en.wikipedia.org/wiki/SHA-2
  *
+ * On x86 hosts, the compression function will use the SHA extensions
+ * if the CPU supports them, falling back to an AVX2 or SSSE3 message
+ * schedule otherwise.  The choice is made at runtime.
+ *
  * \sa SHA224, SHA384, SHA512, SHA3_256, BLAKE2s
  */
 
@@ -46,6 +55,36 @@
  * \brief Constant for the block size of SHA256.
  */
 
+// Round constants for SHA-256.
+uint32_t const sha256_k[64] PROGMEM = {
+    0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
+    0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
+    0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
+    0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
+    0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
+    0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
+    0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
+    0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
+    0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
+    0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
+    0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
+    0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
+    0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
+    0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
+    0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
+    0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
+};
+
+#if defined(CRYPTO_X86_SIMD)
+
+// Function that processes one or more 512-bit chunks directly from
+// a big-endian input buffer and adds the result into the hash value.
+typedef void (*sha256_blocks_t)(uint32_t *h, const uint8_t *data, size_t blocks);
+
+static sha256_blocks_t sha256_backend();
+
+#endif
+
 /**
  * \brief Constructs a SHA-256 hash object.
  */
@@ -95,6 +134,20 @@ void SHA256::update(const void *data, size_t len)
     // Break the input up into 512-bit chunks and process each in turn.
     const uint8_t *d = (const uint8_t *)data;
     while (len > 0) {
+#if defined(CRYPTO_X86_SIMD)
+        // If the chunk buffer is empty and there is an accelerated
+        // backend, then process whole chunks directly from the input.
+        if (state.chunkSize == 0 && len >= 64) {
+            sha256_blocks_t blocks = sha256_backend();
+            if (blocks) {
+                size_t count = len / 64;
+                (*blocks)(state.h, d, count);
+                d += count * 64;
+                len -= count * 64;
+                continue;
+            }
+        }
+#endif
         uint8_t size = 64 - state.chunkSize;
         if (size > len)
             size = len;
@@ -173,25 +226,13 @@ void SHA256::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t has
  */
 void SHA256::processChunk()
 {
-    // Round constants for SHA-256.
-    static uint32_t const k[64] PROGMEM = {
-        0x428a2f98, 0x71374491, 0xb5c0fbcf, 0xe9b5dba5,
-        0x3956c25b, 0x59f111f1, 0x923f82a4, 0xab1c5ed5,
-        0xd807aa98, 0x12835b01, 0x243185be, 0x550c7dc3,
-        0x72be5d74, 0x80deb1fe, 0x9bdc06a7, 0xc19bf174,
-        0xe49b69c1, 0xefbe4786, 0x0fc19dc6, 0x240ca1cc,
-        0x2de92c6f, 0x4a7484aa, 0x5cb0a9dc, 0x76f988da,
-        0x983e5152, 0xa831c66d, 0xb00327c8, 0xbf597fc7,
-        0xc6e00bf3, 0xd5a79147, 0x06ca6351, 0x14292967,
-        0x27b70a85, 0x2e1b2138, 0x4d2c6dfc, 0x53380d13,
-        0x650a7354, 0x766a0abb, 0x81c2c92e, 0x92722c85,
-        0xa2bfe8a1, 0xa81a664b, 0xc24b8b70, 0xc76c51a3,
-        0xd192e819, 0xd6990624, 0xf40e3585, 0x106aa070,
-        0x19a4c116, 0x1e376c08, 0x2748774c, 0x34b0bcb5,
-        0x391c0cb3, 0x4ed8aa4a, 0x5b9cca4f, 0x682e6ff3,
-        0x748f82ee, 0x78a5636f, 0x84c87814, 0x8cc70208,
-        0x90befffa, 0xa4506ceb, 0xbef9a3f7, 0xc67178f2
-    };
+#if defined(CRYPTO_X86_SIMD)
+    sha256_blocks_t blocks = sha256_backend();
+    if (blocks) {
+        (*blocks)(state.h, (const uint8_t *)state.w, 1);
+        return;
+    }
+#endif
 
     // Convert the first 16 words from big endian to host byte order.
     uint8_t index;
@@ -211,7 +252,7 @@ void SHA256::processChunk()
     // Perform the first 16 rounds of the compression function main loop.
     uint32_t temp1, temp2;
     for (index = 0; index < 16; ++index) {
-        temp1 = h + pgm_read_dword(k + index) + state.w[index] +
+        temp1 = h + pgm_read_dword(sha256_k + index) + state.w[index] +
                 (rightRotate6(e) ^ rightRotate11(e) ^ rightRotate25(e)) +
                 ((e & f) ^ ((~e) & g));
         temp2 = (rightRotate2(a) ^ rightRotate13(a) ^ rightRotate22(a)) +
@@ -239,7 +280,7 @@ void SHA256::processChunk()
                 (rightRotate17(temp2) ^ rightRotate19(temp2) ^ (temp2 >> 10));
 
         // Perform the round.
-        temp1 = h + pgm_read_dword(k + index) + temp1 +
+        temp1 = h + pgm_read_dword(sha256_k + index) + temp1 +
                 (rightRotate6(e) ^ rightRotate11(e) ^ rightRotate25(e)) +
                 ((e & f) ^ ((~e) & g));
         temp2 = (rightRotate2(a) ^ rightRotate13(a) ^ rightRotate22(a)) +
@@ -267,3 +308,337 @@ void SHA256::processChunk()
     // Attempt to clean up the stack.
     a = b = c = d = e = f = g = h = temp1 = temp2 = 0;
 }
+
+#if defined(CRYPTO_X86_SIMD)
+
+/**
+ * \brief Performs the 64 rounds of SHA-256 on a pre-expanded message
+ * schedule that has already had the round constants added to it.
+ *
+ * \param hash The hash value to update.
+ * \param wk The 64 words of W[t] + K[t] for the chunk.
+ */
+static inline __attribute__((always_inline))
+void sha256_rounds(uint32_t *hash, const uint32_t *wk)
+{
+    uint32_t a = hash[0];
+    uint32_t b = hash[1];
+    uint32_t c = hash[2];
+    uint32_t d = hash[3];
+    uint32_t e = hash[4];
+    uint32_t f = hash[5];
+    uint32_t g = hash[6];
+    uint32_t h = hash[7];
+    uint32_t temp1, temp2;
+    for (uint8_t index = 0; index < 64; ++index) {
+        temp1 = h + wk[index] +
+                (rightRotate6(e) ^ rightRotate11(e) ^ rightRotate25(e)) +
+                ((e & f) ^ ((~e) & g));
+        temp2 = (rightRotate2(a) ^ rightRotate13(a) ^ rightRotate22(a)) +
+                ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+}
+
+// Rotate every 32-bit word in a vector right by a number of bits.
+#define sha256_ror128(x, bits) \
+    (_mm_or_si128(_mm_srli_epi32((x), (bits)), \
+                  _mm_slli_epi32((x), 32 - (bits))))
+#define sha256_ror256(x, bits) \
+    (_mm256_or_si256(_mm256_srli_epi32((x), (bits)), \
+                     _mm256_slli_epi32((x), 32 - (bits))))
+
+/**
+ * \brief Expands the next four words of the SHA-256 message schedule
+ * using SSSE3.
+ *
+ * \param x0 Words W[t-16] to W[t-13].
+ * \param x1 Words W[t-12] to W[t-9].
+ * \param x2 Words W[t-8] to W[t-5].
+ * \param x3 Words W[t-4] to W[t-1].
+ * \return Words W[t] to W[t+3].
+ *
+ * The sigma1 term for W[t+2] and W[t+3] depends upon W[t] and W[t+1],
+ * so the expansion is done in two halves.
+ */
+CRYPTO_TARGET("ssse3")
+static inline __m128i sha256_expand_ssse3
+    (__m128i x0, __m128i x1, __m128i x2, __m128i x3)
+{
+    __m128i w15 = _mm_alignr_epi8(x1, x0, 4);
+    __m128i w7 = _mm_alignr_epi8(x3, x2, 4);
+    __m128i t = _mm_add_epi32(_mm_add_epi32(x0, w7),
+        _mm_xor_si128(_mm_xor_si128(sha256_ror128(w15, 7),
+                                    sha256_ror128(w15, 18)),
+                      _mm_srli_epi32(w15, 3)));
+    __m128i w2 = _mm_srli_si128(x3, 8);
+    t = _mm_add_epi32(t,
+        _mm_xor_si128(_mm_xor_si128(sha256_ror128(w2, 17),
+                                    sha256_ror128(w2, 19)),
+                      _mm_srli_epi32(w2, 10)));
+    w2 = _mm_slli_si128(t, 8);
+    return _mm_add_epi32(t,
+        _mm_xor_si128(_mm_xor_si128(sha256_ror128(w2, 17),
+                                    sha256_ror128(w2, 19)),
+                      _mm_srli_epi32(w2, 10)));
+}
+
+/**
+ * \brief Processes 512-bit chunks using an SSSE3 message schedule
+ * and scalar rounds.
+ */
+CRYPTO_TARGET("ssse3")
+static void sha256_blocks_ssse3(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+    const __m128i swap = _mm_set_epi64x
+        (0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    uint32_t wk[64] __attribute__((aligned(16)));
+    while (blocks > 0) {
+        __m128i x0 = _mm_shuffle_epi8
+            (_mm_loadu_si128((const __m128i *)data), swap);
+        __m128i x1 = _mm_shuffle_epi8
+            (_mm_loadu_si128((const __m128i *)(data + 16)), swap);
+        __m128i x2 = _mm_shuffle_epi8
+            (_mm_loadu_si128((const __m128i *)(data + 32)), swap);
+        __m128i x3 = _mm_shuffle_epi8
+            (_mm_loadu_si128((const __m128i *)(data + 48)), swap);
+        for (uint8_t index = 0; index < 64; index += 4) {
+            _mm_store_si128((__m128i *)(wk + index), _mm_add_epi32
+                (x0, _mm_loadu_si128((const __m128i *)(sha256_k + index))));
+            __m128i next = sha256_expand_ssse3(x0, x1, x2, x3);
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+            x3 = next;
+        }
+        sha256_rounds(h, wk);
+        data += 64;
+        --blocks;
+    }
+    clean(wk);
+}
+
+/**
+ * \brief Expands the next four words of the SHA-256 message schedule
+ * for two chunks at once using AVX2.
+ *
+ * Each 128-bit lane holds the schedule for a separate chunk.  The
+ * alignr and byte shift instructions operate within lanes, so the
+ * expansion is identical to sha256_expand_ssse3().
+ */
+CRYPTO_TARGET("avx2")
+static inline __m256i sha256_expand_avx2
+    (__m256i x0, __m256i x1, __m256i x2, __m256i x3)
+{
+    __m256i w15 = _mm256_alignr_epi8(x1, x0, 4);
+    __m256i w7 = _mm256_alignr_epi8(x3, x2, 4);
+    __m256i t = _mm256_add_epi32(_mm256_add_epi32(x0, w7),
+        _mm256_xor_si256(_mm256_xor_si256(sha256_ror256(w15, 7),
+                                          sha256_ror256(w15, 18)),
+                         _mm256_srli_epi32(w15, 3)));
+    __m256i w2 = _mm256_srli_si256(x3, 8);
+    t = _mm256_add_epi32(t,
+        _mm256_xor_si256(_mm256_xor_si256(sha256_ror256(w2, 17),
+                                          sha256_ror256(w2, 19)),
+                         _mm256_srli_epi32(w2, 10)));
+    w2 = _mm256_slli_si256(t, 8);
+    return _mm256_add_epi32(t,
+        _mm256_xor_si256(_mm256_xor_si256(sha256_ror256(w2, 17),
+                                          sha256_ror256(w2, 19)),
+                         _mm256_srli_epi32(w2, 10)));
+}
+
+// Loads the same 16 bytes from two consecutive chunks into the
+// low and high lanes of an AVX2 vector and byte-swaps the words.
+#define sha256_load2(data, offset, swap) \
+    (_mm256_shuffle_epi8(_mm256_inserti128_si256(_mm256_castsi128_si256( \
+        _mm_loadu_si128((const __m128i *)((data) + (offset)))), \
+        _mm_loadu_si128((const __m128i *)((data) + 64 + (offset))), 1), \
+        (swap)))
+
+/**
+ * \brief Processes 512-bit chunks using an AVX2 message schedule that
+ * expands two chunks at a time, with scalar rounds.
+ */
+CRYPTO_TARGET("avx2")
+static void sha256_blocks_avx2(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+    const __m256i swap = _mm256_set_epi64x
+        (0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL,
+         0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    uint32_t wk0[64] __attribute__((aligned(16)));
+    uint32_t wk1[64] __attribute__((aligned(16)));
+    while (blocks >= 2) {
+        __m256i x0 = sha256_load2(data, 0, swap);
+        __m256i x1 = sha256_load2(data, 16, swap);
+        __m256i x2 = sha256_load2(data, 32, swap);
+        __m256i x3 = sha256_load2(data, 48, swap);
+        for (uint8_t index = 0; index < 64; index += 4) {
+            __m256i t = _mm256_add_epi32(x0, _mm256_broadcastsi128_si256
+                (_mm_loadu_si128((const __m128i *)(sha256_k + index))));
+            _mm_store_si128((__m128i *)(wk0 + index),
+                            _mm256_castsi256_si128(t));
+            _mm_store_si128((__m128i *)(wk1 + index),
+                            _mm256_extracti128_si256(t, 1));
+            __m256i next = sha256_expand_avx2(x0, x1, x2, x3);
+            x0 = x1;
+            x1 = x2;
+            x2 = x3;
+            x3 = next;
+        }
+        sha256_rounds(h, wk0);
+        sha256_rounds(h, wk1);
+        data += 128;
+        blocks -= 2;
+    }
+    clean(wk0);
+    clean(wk1);
+    if (blocks)
+        sha256_blocks_ssse3(h, data, blocks);
+}
+
+// Performs four rounds of SHA-256 using the SHA extensions, with the
+// message words for the rounds in "msg" and the round constants at "kp".
+#define sha256_ni_rounds(msg, kp) \
+    do { \
+        tmp = _mm_add_epi32((msg), _mm_loadu_si128((const __m128i *)(kp))); \
+        state1 = _mm_sha256rnds2_epu32(state1, state0, tmp); \
+        tmp = _mm_shuffle_epi32(tmp, 0x0E); \
+        state0 = _mm_sha256rnds2_epu32(state0, state1, tmp); \
+    } while (0)
+
+// Completes the expansion of "next" from the previous two message vectors.
+#define sha256_ni_expand(next, prev, cur) \
+    do { \
+        (next) = _mm_add_epi32((next), _mm_alignr_epi8((cur), (prev), 4)); \
+        (next) = _mm_sha256msg2_epu32((next), (cur)); \
+    } while (0)
+
+/**
+ * \brief Processes 512-bit chunks using the x86 SHA extensions.
+ *
+ * The SHA extensions operate on the state in the order ABEF and CDGH,
+ * so the state is permuted on entry and exit.
+ */
+CRYPTO_TARGET("sha,sse4.1")
+static void sha256_blocks_shani(uint32_t *h, const uint8_t *data, size_t blocks)
+{
+    const __m128i swap = _mm_set_epi64x
+        (0x0c0d0e0f08090a0bULL, 0x0405060700010203ULL);
+    __m128i state0, state1, tmp;
+    __m128i m0, m1, m2, m3;
+    __m128i save0, save1;
+
+    // Convert the state from ABCD/EFGH into ABEF/CDGH.
+    tmp = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)h), 0xB1);
+    state1 = _mm_shuffle_epi32(_mm_loadu_si128((const __m128i *)(h + 4)), 0x1B);
+    state0 = _mm_alignr_epi8(tmp, state1, 8);
+    state1 = _mm_blend_epi16(state1, tmp, 0xF0);
+
+    while (blocks > 0) {
+        save0 = state0;
+        save1 = state1;
+
+        // Rounds 0 to 15 use the message words directly.
+        m0 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)data), swap);
+        sha256_ni_rounds(m0, sha256_k);
+        m1 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 16)), swap);
+        sha256_ni_rounds(m1, sha256_k + 4);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        m2 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 32)), swap);
+        sha256_ni_rounds(m2, sha256_k + 8);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+        m3 = _mm_shuffle_epi8(_mm_loadu_si128((const __m128i *)(data + 48)), swap);
+        sha256_ni_rounds(m3, sha256_k + 12);
+        sha256_ni_expand(m0, m2, m3);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+
+        // Rounds 16 to 51 expand the schedule as they go.
+        sha256_ni_rounds(m0, sha256_k + 16);
+        sha256_ni_expand(m1, m3, m0);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+        sha256_ni_rounds(m1, sha256_k + 20);
+        sha256_ni_expand(m2, m0, m1);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        sha256_ni_rounds(m2, sha256_k + 24);
+        sha256_ni_expand(m3, m1, m2);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+        sha256_ni_rounds(m3, sha256_k + 28);
+        sha256_ni_expand(m0, m2, m3);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+        sha256_ni_rounds(m0, sha256_k + 32);
+        sha256_ni_expand(m1, m3, m0);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+        sha256_ni_rounds(m1, sha256_k + 36);
+        sha256_ni_expand(m2, m0, m1);
+        m0 = _mm_sha256msg1_epu32(m0, m1);
+        sha256_ni_rounds(m2, sha256_k + 40);
+        sha256_ni_expand(m3, m1, m2);
+        m1 = _mm_sha256msg1_epu32(m1, m2);
+        sha256_ni_rounds(m3, sha256_k + 44);
+        sha256_ni_expand(m0, m2, m3);
+        m2 = _mm_sha256msg1_epu32(m2, m3);
+        sha256_ni_rounds(m0, sha256_k + 48);
+        sha256_ni_expand(m1, m3, m0);
+        m3 = _mm_sha256msg1_epu32(m3, m0);
+
+        // Rounds 52 to 63 finish off the schedule.
+        sha256_ni_rounds(m1, sha256_k + 52);
+        sha256_ni_expand(m2, m0, m1);
+        sha256_ni_rounds(m2, sha256_k + 56);
+        sha256_ni_expand(m3, m1, m2);
+        sha256_ni_rounds(m3, sha256_k + 60);
+
+        state0 = _mm_add_epi32(state0, save0);
+        state1 = _mm_add_epi32(state1, save1);
+        data += 64;
+        --blocks;
+    }
+
+    // Convert the state from ABEF/CDGH back into ABCD/EFGH.
+    tmp = _mm_shuffle_epi32(state0, 0x1B);
+    state1 = _mm_shuffle_epi32(state1, 0xB1);
+    state0 = _mm_blend_epi16(tmp, state1, 0xF0);
+    state1 = _mm_alignr_epi8(state1, tmp, 8);
+    _mm_storeu_si128((__m128i *)h, state0);
+    _mm_storeu_si128((__m128i *)(h + 4), state1);
+}
+
+/**
+ * \brief Selects the best SHA-256 backend for the host CPU.
+ *
+ * \return A pointer to the backend, or NULL to use the portable
+ * processChunk() implementation.
+ */
+static sha256_blocks_t sha256_backend()
+{
+    static sha256_blocks_t backend = 0;
+    static bool selected = false;
+    if (!selected) {
+        if (crypto_cpu_has(CRYPTO_CPU_SHA | CRYPTO_CPU_SSE41))
+            backend = sha256_blocks_shani;
+        else if (crypto_cpu_has(CRYPTO_CPU_AVX2))
+            backend = sha256_blocks_avx2;
+        else if (crypto_cpu_has(CRYPTO_CPU_SSSE3))
+            backend = sha256_blocks_ssse3;
+        selected = true;
+    }
+    return backend;
+}
+
+#endif // CRYPTO_X86_SIMD
@@ -0,0 +1,322 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "MultiHash.h"
+#include "SHA256.h"
+#include "Crypto.h"
+#include "utility/CpuUtil.h"
+#include "utility/SHA2Util.h"
+#include "utility/EndianUtil.h"
+#include <string.h>
+
+/**
+ * \class SHA256Multi MultiHash.h <MultiHash.h>
+ * \brief Hashes several independent messages with SHA-256 at once.
+ *
+ * Hashing lots of short messages one at a time through SHA256 leaves
+ * most of the SIMD unit idle on host CPUs.  This class instead
+ * transposes the state of several messages so that each SIMD lane
+ * holds the state for a separate message, and then runs the
+ * compression function on all lanes at once:
+ *
+ * \code
+ * const void *data[4] = {frame1, frame2, frame3, frame4};
+ * size_t lens[4] = {len1, len2, len3, len4};
+ * uint8_t *hashes[4] = {hash1, hash2, hash3, hash4};
+ * SHA256Multi::hash(hashes, data, lens, 4);
+ * \endcode
+ *
+ * The messages may have different lengths, but throughput is best
+ * when they are of similar length because a batch runs until its
+ * longest message has been hashed.  Each output buffer must be at
+ * least HASH_SIZE bytes in length.
+ *
+ * On x86 hosts with AVX-512 there are 16 lanes, with AVX2 there are 8,
+ * and otherwise there are 4 lanes using SSE2.  On x86 hosts with the
+ * SHA extensions, and on other platforms, the messages are hashed one
+ * at a time with SHA256 because that is faster than the SIMD lanes.
+ *
+ * \sa SHA512Multi, BLAKE2sMulti, SHA256
+ */
+
+/**
+ * \var SHA256Multi::HASH_SIZE
+ * \brief Constant for the size of the hash output of SHA256Multi.
+ */
+
+/**
+ * \var SHA256Multi::MAX_LANES
+ * \brief Maximum number of lanes that may be returned by lanes().
+ */
+
+#if defined(CRYPTO_X86_SIMD)
+
+typedef uint32_t sha256_v4 __attribute__((vector_size(16)));
+typedef uint32_t sha256_v8 __attribute__((vector_size(32)));
+typedef uint32_t sha256_v16 __attribute__((vector_size(64)));
+
+// Initial hash value for SHA-256.
+static uint32_t const hashStart[8] = {
+    0x6a09e667, 0xbb67ae85, 0x3c6ef372, 0xa54ff53a,
+    0x510e527f, 0x9b05688c, 0x1f83d9ab, 0x5be0cd19
+};
+
+#define sha256_ror(x, bits) (((x) >> (bits)) | ((x) << (32 - (bits))))
+
+/**
+ * \brief Runs the SHA-256 compression function on all lanes.
+ *
+ * \param hash The transposed hash state, one vector per word.
+ * \param w The transposed message block, which is expanded in-place.
+ */
+template <typename V>
+static inline __attribute__((always_inline))
+void sha256_multi_compress(V *hash, V *w)
+{
+    V a = hash[0];
+    V b = hash[1];
+    V c = hash[2];
+    V d = hash[3];
+    V e = hash[4];
+    V f = hash[5];
+    V g = hash[6];
+    V h = hash[7];
+    V temp1, temp2;
+#pragma GCC unroll 64
+    for (uint8_t index = 0; index < 64; ++index) {
+        if (index >= 16) {
+            temp1 = w[(index - 15) & 0x0F];
+            temp2 = w[(index - 2) & 0x0F];
+            w[index & 0x0F] +=
+                w[(index - 7) & 0x0F] +
+                (sha256_ror(temp1, 7) ^ sha256_ror(temp1, 18) ^ (temp1 >> 3)) +
+                (sha256_ror(temp2, 17) ^ sha256_ror(temp2, 19) ^ (temp2 >> 10));
+        }
+        temp1 = h + sha256_k[index] + w[index & 0x0F] +
+                (sha256_ror(e, 6) ^ sha256_ror(e, 11) ^ sha256_ror(e, 25)) +
+                ((e & f) ^ ((~e) & g));
+        temp2 = (sha256_ror(a, 2) ^ sha256_ror(a, 13) ^ sha256_ror(a, 22)) +
+                ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+}
+
+/**
+ * \brief Transposes the next chunk of up to N messages into word order.
+ *
+ * Lanes that have already finished, or that are unused in this batch,
+ * are given a dummy all-zeroes chunk.
+ */
+template <unsigned N>
+static inline __attribute__((always_inline))
+void sha256_multi_transpose(uint32_t words[16][N], const uint8_t *const *data,
+                            uint8_t tail[N][128], const size_t *full,
+                            const size_t *total, unsigned count, size_t block)
+{
+    static uint8_t const dummy[64] = {0};
+    for (unsigned lane = 0; lane < N; ++lane) {
+        const uint8_t *chunk;
+        if (lane >= count || block >= total[lane])
+            chunk = dummy;
+        else if (block < full[lane])
+            chunk = data[lane] + block * 64;
+        else
+            chunk = tail[lane] + (block - full[lane]) * 64;
+        for (unsigned index = 0; index < 16; ++index) {
+            uint32_t word;
+            memcpy(&word, chunk + index * 4, sizeof(word));
+            words[index][lane] = be32toh(word);
+        }
+    }
+}
+
+/**
+ * \brief Hashes up to N messages in parallel using N-lane vectors.
+ *
+ * Each message is split into the whole chunks that are read directly
+ * from the caller's buffer and one or two padded tail chunks.  Lanes
+ * that finish early keep running on a dummy chunk, but their hash
+ * value has already been written out by then.
+ */
+template <typename V, unsigned N>
+static inline __attribute__((always_inline))
+void sha256_multi_lanes(uint8_t *const *hashes, const uint8_t *const *data,
+                        const size_t *lens, unsigned count)
+{
+    uint8_t tail[N][128];
+    size_t full[N];
+    size_t total[N];
+    size_t maxBlocks = 0;
+    uint32_t words[2][16][N] __attribute__((aligned(sizeof(V))));
+    V h[8];
+    V w[16];
+    unsigned lane, index;
+
+    // Format the padded tail chunks for each message.
+    for (lane = 0; lane < count; ++lane) {
+        size_t len = lens[lane];
+        size_t rem = len % 64;
+        size_t tailSize = (rem <= (64 - 9)) ? 64 : 128;
+        uint64_t bits = ((uint64_t)len) << 3;
+        full[lane] = len / 64;
+        memcpy(tail[lane], data[lane] + full[lane] * 64, rem);
+        tail[lane][rem] = 0x80;
+        memset(tail[lane] + rem + 1, 0, tailSize - 8 - (rem + 1));
+        for (index = 0; index < 8; ++index)
+            tail[lane][tailSize - 1 - index] = (uint8_t)(bits >> (index * 8));
+        total[lane] = full[lane] + tailSize / 64;
+        if (total[lane] > maxBlocks)
+            maxBlocks = total[lane];
+    }
+
+    // Broadcast the initial hash value to all lanes.
+    for (index = 0; index < 8; ++index)
+        h[index] = (V){} + hashStart[index];
+
+    // Transpose and compress the chunks for all lanes at once.  The next
+    // chunk is transposed before compressing the current one so that the
+    // scalar stores have retired by the time we load them as vectors.
+    sha256_multi_transpose<N>(words[0], data, tail, full, total, count, 0);
+    for (size_t block = 0; block < maxBlocks; ++block) {
+        memcpy(w, words[block & 1], sizeof(w));
+        if ((block + 1) < maxBlocks) {
+            sha256_multi_transpose<N>(words[(block + 1) & 1], data, tail,
+                                      full, total, count, block + 1);
+        }
+        sha256_multi_compress<V>(h, w);
+        for (lane = 0; lane < count; ++lane) {
+            if ((block + 1) != total[lane])
+                continue;
+            for (index = 0; index < 8; ++index) {
+                uint32_t word = htobe32(h[index][lane]);
+                memcpy(hashes[lane] + index * 4, &word, sizeof(word));
+            }
+        }
+    }
+
+    clean(tail);
+    clean(words);
+    clean(h);
+    clean(w);
+}
+
+CRYPTO_TARGET("avx512f")
+static void sha256_multi_avx512(uint8_t *const *hashes, const uint8_t *const *data,
+                                const size_t *lens, unsigned count)
+{
+    sha256_multi_lanes<sha256_v16, 16>(hashes, data, lens, count);
+}
+
+CRYPTO_TARGET("avx2")
+static void sha256_multi_avx2(uint8_t *const *hashes, const uint8_t *const *data,
+                              const size_t *lens, unsigned count)
+{
+    sha256_multi_lanes<sha256_v8, 8>(hashes, data, lens, count);
+}
+
+static void sha256_multi_sse2(uint8_t *const *hashes, const uint8_t *const *data,
+                              const size_t *lens, unsigned count)
+{
+    sha256_multi_lanes<sha256_v4, 4>(hashes, data, lens, count);
+}
+
+#endif // CRYPTO_X86_SIMD
+
+/**
+ * \brief Returns the number of messages that are hashed in parallel
+ * on this platform.
+ *
+ * Callers can use this to size their batches.  Any number of messages
+ * can be passed to hash(), but it is most efficient when the count is
+ * a multiple of lanes().
+ */
+size_t SHA256Multi::lanes()
+{
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_SHA | CRYPTO_CPU_SSE41))
+        return 1;
+    else if (crypto_cpu_has(CRYPTO_CPU_AVX512F))
+        return 16;
+    else if (crypto_cpu_has(CRYPTO_CPU_AVX2))
+        return 8;
+    else
+        return 4;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * \brief Hashes a batch of independent messages with SHA-256.
+ *
+ * \param hashes Array of \a count pointers to buffers that receive the
+ * hash outputs.  Each buffer must be at least HASH_SIZE bytes in length.
+ * \param data Array of \a count pointers to the messages to hash.
+ * \param lens Array of \a count message lengths in bytes.
+ * \param count Number of messages to hash.
+ *
+ * The results are identical to hashing each message with SHA256.
+ */
+void SHA256Multi::hash(uint8_t *const *hashes, const void *const *data,
+                       const size_t *lens, size_t count)
+{
+    const uint8_t *const *d = (const uint8_t *const *)data;
+#if defined(CRYPTO_X86_SIMD)
+    size_t n = lanes();
+    while (count > 0 && n > 1) {
+        unsigned batch = (count < n) ? (unsigned)count : (unsigned)n;
+        if (n == 16)
+            sha256_multi_avx512(hashes, d, lens, batch);
+        else if (n == 8)
+            sha256_multi_avx2(hashes, d, lens, batch);
+        else
+            sha256_multi_sse2(hashes, d, lens, batch);
+        hashes += batch;
+        d += batch;
+        lens += batch;
+        count -= batch;
+    }
+#endif
+    if (count > 0) {
+        SHA256 sha256;
+        for (size_t posn = 0; posn < count; ++posn) {
+            sha256.reset();
+            sha256.update(d[posn], lens[posn]);
+            sha256.finalize(hashes[posn], HASH_SIZE);
+        }
+    }
+}
@@ -0,0 +1,116 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "MultiHash.h"
+#include "KeccakCore.h"
+#include "SHA3.h"
+#include "utility/CpuUtil.h"
+
+/**
+ * \class SHA3_256Multi MultiHash.h <MultiHash.h>
+ * \brief Hashes several independent messages with SHA3-256 at once.
+ *
+ * This class uses KeccakCoreX4 to run the sponge functions for four
+ * messages in lock-step, with one message per 64-bit element of the
+ * SIMD registers on x86 hosts:
+ *
+ * \code
+ * const void *data[4] = {frame1, frame2, frame3, frame4};
+ * size_t lens[4] = {len1, len2, len3, len4};
+ * uint8_t *hashes[4] = {hash1, hash2, hash3, hash4};
+ * SHA3_256Multi::hash(hashes, data, lens, 4);
+ * \endcode
+ *
+ * The messages may have different lengths, but throughput is best
+ * when they are of similar length because a batch runs until its
+ * longest message has been hashed.  Each output buffer must be at
+ * least HASH_SIZE bytes in length.
+ *
+ * On x86 hosts there are 4 lanes.  On other platforms the messages are
+ * hashed one at a time with SHA3_256.
+ *
+ * \sa SHAKE128Multi, SHAKE256Multi, KeccakCoreX4, SHA3_256
+ */
+
+/**
+ * \var SHA3_256Multi::HASH_SIZE
+ * \brief Constant for the size of the hash output of SHA3_256Multi.
+ */
+
+/**
+ * \var SHA3_256Multi::MAX_LANES
+ * \brief Maximum number of lanes that may be returned by lanes().
+ */
+
+/**
+ * \brief Returns the number of messages that are hashed in parallel
+ * on this platform.
+ *
+ * Callers can use this to size their batches.  Any number of messages
+ * can be passed to hash(), but it is most efficient when the count is
+ * a multiple of lanes().
+ */
+size_t SHA3_256Multi::lanes()
+{
+#if defined(CRYPTO_X86_SIMD)
+    return KeccakCoreX4::LANES;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * \brief Hashes a batch of independent messages with SHA3-256.
+ *
+ * \param hashes Array of \a count pointers to buffers that receive the
+ * hash outputs.  Each buffer must be at least HASH_SIZE bytes in length.
+ * \param data Array of \a count pointers to the messages to hash.
+ * \param lens Array of \a count message lengths in bytes.
+ * \param count Number of messages to hash.
+ *
+ * The results are identical to hashing each message with SHA3_256.
+ */
+void SHA3_256Multi::hash(uint8_t *const *hashes, const void *const *data,
+                         const size_t *lens, size_t count)
+{
+    const uint8_t *const *d = (const uint8_t *const *)data;
+#if defined(CRYPTO_X86_SIMD)
+    KeccakCoreX4 core;
+    core.setCapacity(512);
+    while (count > 0) {
+        unsigned batch = (count < KeccakCoreX4::LANES)
+                       ? (unsigned)count : (unsigned)KeccakCoreX4::LANES;
+        core.spongeLanes(hashes, HASH_SIZE, d, lens, batch, 0x06);
+        hashes += batch;
+        d += batch;
+        lens += batch;
+        count -= batch;
+    }
+#else
+    SHA3_256 sha3;
+    for (size_t posn = 0; posn < count; ++posn) {
+        sha3.reset();
+        sha3.update(d[posn], lens[posn]);
+        sha3.finalize(hashes[posn], HASH_SIZE);
+    }
+#endif
+}
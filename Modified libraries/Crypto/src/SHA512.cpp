@@ -25,7 +25,12 @@
 #include "utility/RotateUtil.h"
 #include "utility/EndianUtil.h"
 #include "utility/ProgMemUtil.h"
+#include "utility/CpuUtil.h"
+#include "utility/SHA2Util.h"
 #include <string.h>
+#if defined(CRYPTO_X86_SIMD)
+#include <immintrin.h>
+#endif
 
 /**
  * \class SHA512 SHA512.h <SHA512.h>
@@ -33,6 +38,9 @@
  *
  * Reference: http://en.wikipedia.org/wiki/SHA-2
  *
+ * On x86 hosts, the message schedule will be expanded with AVX2 or SSSE3
+ * if the CPU supports them.  The choice is made at runtime.
+ *
  * \sa SHA224, SHA256, SHA3_512, BLAKE2b
  */
 
@@ -46,6 +54,47 @@
  * \brief Constant for the block size of SHA512.
  */
 
+// Round constants for SHA-512.
+uint64_t const sha512_k[80] PROGMEM = {
+    0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL,
+    0xE9B5DBA58189DBBCULL, 0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL,
+    0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL, 0xD807AA98A3030242ULL,
+    0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
+    0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL,
+    0xC19BF174CF692694ULL, 0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL,
+    0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL, 0x2DE92C6F592B0275ULL,
+    0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
+    0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL,
+    0xBF597FC7BEEF0EE4ULL, 0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL,
+    0x06CA6351E003826FULL, 0x142929670A0E6E70ULL, 0x27B70A8546D22FFCULL,
+    0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
+    0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL,
+    0x92722C851482353BULL, 0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL,
+    0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL, 0xD192E819D6EF5218ULL,
+    0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
+    0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL,
+    0x34B0BCB5E19B48A8ULL, 0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL,
+    0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL, 0x748F82EE5DEFB2FCULL,
+    0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
+    0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL,
+    0xC67178F2E372532BULL, 0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL,
+    0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL, 0x06F067AA72176FBAULL,
+    0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
+    0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL,
+    0x431D67C49C100D4CULL, 0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL,
+    0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL
+};
+
+#if defined(CRYPTO_X86_SIMD)
+
+// Function that processes one or more 1024-bit chunks directly from
+// a big-endian input buffer and adds the result into the hash value.
+typedef void (*sha512_blocks_t)(uint64_t *h, const uint8_t *data, size_t blocks);
+
+static sha512_blocks_t sha512_backend();
+
+#endif
+
 /**
  * \brief Constructs a SHA-512 hash object.
  */
@@ -98,6 +147,20 @@ void SHA512::update(const void *data, size_t len)
     // Break the input up into 1024-bit chunks and process each in turn.
     const uint8_t *d = (const uint8_t *)data;
     while (len > 0) {
+#if defined(CRYPTO_X86_SIMD)
+        // If the chunk buffer is empty and there is an accelerated
+        // backend, then process whole chunks directly from the input.
+        if (state.chunkSize == 0 && len >= 128) {
+            sha512_blocks_t blocks = sha512_backend();
+            if (blocks) {
+                size_t count = len / 128;
+                (*blocks)(state.h, d, count);
+                d += count * 128;
+                len -= count * 128;
+                continue;
+            }
+        }
+#endif
         uint8_t size = 128 - state.chunkSize;
         if (size > len)
             size = len;
@@ -176,36 +239,13 @@ void SHA512::finalizeHMAC(const void *key, size_t keyLen, void *hash, size_t has
  */
 void SHA512::processChunk()
 {
-    // Round constants for SHA-512.
-    static uint64_t const k[80] PROGMEM = {
-        0x428A2F98D728AE22ULL, 0x7137449123EF65CDULL, 0xB5C0FBCFEC4D3B2FULL,
-        0xE9B5DBA58189DBBCULL, 0x3956C25BF348B538ULL, 0x59F111F1B605D019ULL,
-        0x923F82A4AF194F9BULL, 0xAB1C5ED5DA6D8118ULL, 0xD807AA98A3030242ULL,
-        0x12835B0145706FBEULL, 0x243185BE4EE4B28CULL, 0x550C7DC3D5FFB4E2ULL,
-        0x72BE5D74F27B896FULL, 0x80DEB1FE3B1696B1ULL, 0x9BDC06A725C71235ULL,
-        0xC19BF174CF692694ULL, 0xE49B69C19EF14AD2ULL, 0xEFBE4786384F25E3ULL,
-        0x0FC19DC68B8CD5B5ULL, 0x240CA1CC77AC9C65ULL, 0x2DE92C6F592B0275ULL,
-        0x4A7484AA6EA6E483ULL, 0x5CB0A9DCBD41FBD4ULL, 0x76F988DA831153B5ULL,
-        0x983E5152EE66DFABULL, 0xA831C66D2DB43210ULL, 0xB00327C898FB213FULL,
-        0xBF597FC7BEEF0EE4ULL, 0xC6E00BF33DA88FC2ULL, 0xD5A79147930AA725ULL,
-        0x06CA6351E003826FULL, 0x142929670A0E6E70ULL, 0x27B70A8546D22FFCULL,
-        0x2E1B21385C26C926ULL, 0x4D2C6DFC5AC42AEDULL, 0x53380D139D95B3DFULL,
-        0x650A73548BAF63DEULL, 0x766A0ABB3C77B2A8ULL, 0x81C2C92E47EDAEE6ULL,
-        0x92722C851482353BULL, 0xA2BFE8A14CF10364ULL, 0xA81A664BBC423001ULL,
-        0xC24B8B70D0F89791ULL, 0xC76C51A30654BE30ULL, 0xD192E819D6EF5218ULL,
-        0xD69906245565A910ULL, 0xF40E35855771202AULL, 0x106AA07032BBD1B8ULL,
-        0x19A4C116B8D2D0C8ULL, 0x1E376C085141AB53ULL, 0x2748774CDF8EEB99ULL,
-        0x34B0BCB5E19B48A8ULL, 0x391C0CB3C5C95A63ULL, 0x4ED8AA4AE3418ACBULL,
-        0x5B9CCA4F7763E373ULL, 0x682E6FF3D6B2B8A3ULL, 0x748F82EE5DEFB2FCULL,
-        0x78A5636F43172F60ULL, 0x84C87814A1F0AB72ULL, 0x8CC702081A6439ECULL,
-        0x90BEFFFA23631E28ULL, 0xA4506CEBDE82BDE9ULL, 0xBEF9A3F7B2C67915ULL,
-        0xC67178F2E372532BULL, 0xCA273ECEEA26619CULL, 0xD186B8C721C0C207ULL,
-        0xEADA7DD6CDE0EB1EULL, 0xF57D4F7FEE6ED178ULL, 0x06F067AA72176FBAULL,
-        0x0A637DC5A2C898A6ULL, 0x113F9804BEF90DAEULL, 0x1B710B35131C471BULL,
-        0x28DB77F523047D84ULL, 0x32CAAB7B40C72493ULL, 0x3C9EBE0A15C9BEBCULL,
-        0x431D67C49C100D4CULL, 0x4CC5D4BECB3E42B6ULL, 0x597F299CFC657E2AULL,
-        0x5FCB6FAB3AD6FAECULL, 0x6C44198C4A475817ULL
-    };
+#if defined(CRYPTO_X86_SIMD)
+    sha512_blocks_t blocks = sha512_backend();
+    if (blocks) {
+        (*blocks)(state.h, (const uint8_t *)state.w, 1);
+        return;
+    }
+#endif
 
     // Convert the first 16 words from big endian to host byte order.
     uint8_t index;
@@ -225,7 +265,7 @@ void SHA512::processChunk()
     // Perform the first 16 rounds of the compression function main loop.
     uint64_t temp1, temp2;
     for (index = 0; index < 16; ++index) {
-        temp1 = h + pgm_read_qword(k + index) + state.w[index] +
+        temp1 = h + pgm_read_qword(sha512_k + index) + state.w[index] +
                 (rightRotate14_64(e) ^ rightRotate18_64(e) ^
                  rightRotate41_64(e)) + ((e & f) ^ ((~e) & g));
         temp2 = (rightRotate28_64(a) ^ rightRotate34_64(a) ^
@@ -255,7 +295,7 @@ void SHA512::processChunk()
                  (temp2 >> 6));
 
         // Perform the round.
-        temp1 = h + pgm_read_qword(k + index) + temp1 +
+        temp1 = h + pgm_read_qword(sha512_k + index) + temp1 +
                 (rightRotate14_64(e) ^ rightRotate18_64(e) ^
                  rightRotate41_64(e)) + ((e & f) ^ ((~e) & g));
         temp2 = (rightRotate28_64(a) ^ rightRotate34_64(a) ^
@@ -283,3 +323,217 @@ void SHA512::processChunk()
     // Attempt to clean up the stack.
     a = b = c = d = e = f = g = h = temp1 = temp2 = 0;
 }
+
+#if defined(CRYPTO_X86_SIMD)
+
+/**
+ * \brief Performs the 80 rounds of SHA-512 on a pre-expanded message
+ * schedule that has already had the round constants added to it.
+ *
+ * \param hash The hash value to update.
+ * \param wk The 80 words of W[t] + K[t] for the chunk.
+ */
+static inline __attribute__((always_inline))
+void sha512_rounds(uint64_t *hash, const uint64_t *wk)
+{
+    uint64_t a = hash[0];
+    uint64_t b = hash[1];
+    uint64_t c = hash[2];
+    uint64_t d = hash[3];
+    uint64_t e = hash[4];
+    uint64_t f = hash[5];
+    uint64_t g = hash[6];
+    uint64_t h = hash[7];
+    uint64_t temp1, temp2;
+    for (uint8_t index = 0; index < 80; ++index) {
+        temp1 = h + wk[index] +
+                (rightRotate14_64(e) ^ rightRotate18_64(e) ^
+                 rightRotate41_64(e)) + ((e & f) ^ ((~e) & g));
+        temp2 = (rightRotate28_64(a) ^ rightRotate34_64(a) ^
+                 rightRotate39_64(a)) + ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+}
+
+// Rotate every 64-bit word in a vector right by a number of bits.
+#define sha512_ror128(x, bits) \
+    (_mm_or_si128(_mm_srli_epi64((x), (bits)), \
+                  _mm_slli_epi64((x), 64 - (bits))))
+#define sha512_ror256(x, bits) \
+    (_mm256_or_si256(_mm256_srli_epi64((x), (bits)), \
+                     _mm256_slli_epi64((x), 64 - (bits))))
+
+/**
+ * \brief Expands the next two words of the SHA-512 message schedule
+ * using SSSE3.
+ *
+ * \param x Words W[t-16] to W[t-1], two per vector.
+ * \return Words W[t] and W[t+1].
+ *
+ * Unlike SHA-256, the sigma1 term for W[t+1] only depends upon W[t-1]
+ * so both words can be expanded at once.
+ */
+CRYPTO_TARGET("ssse3")
+static inline __m128i sha512_expand_ssse3(const __m128i *x)
+{
+    __m128i w15 = _mm_alignr_epi8(x[1], x[0], 8);
+    __m128i w7 = _mm_alignr_epi8(x[5], x[4], 8);
+    return _mm_add_epi64(_mm_add_epi64(x[0], w7), _mm_add_epi64(
+        _mm_xor_si128(_mm_xor_si128(sha512_ror128(w15, 1),
+                                    sha512_ror128(w15, 8)),
+                      _mm_srli_epi64(w15, 7)),
+        _mm_xor_si128(_mm_xor_si128(sha512_ror128(x[7], 19),
+                                    sha512_ror128(x[7], 61)),
+                      _mm_srli_epi64(x[7], 6))));
+}
+
+/**
+ * \brief Processes 1024-bit chunks using an SSSE3 message schedule
+ * and scalar rounds.
+ */
+CRYPTO_TARGET("ssse3")
+static void sha512_blocks_ssse3(uint64_t *h, const uint8_t *data, size_t blocks)
+{
+    const __m128i swap = _mm_set_epi64x
+        (0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+    uint64_t wk[80] __attribute__((aligned(16)));
+    __m128i x[8];
+    uint8_t index;
+    while (blocks > 0) {
+        for (index = 0; index < 8; ++index) {
+            x[index] = _mm_shuffle_epi8(_mm_loadu_si128
+                ((const __m128i *)(data + index * 16)), swap);
+        }
+        for (index = 0; index < 80; index += 2) {
+            _mm_store_si128((__m128i *)(wk + index), _mm_add_epi64
+                (x[0], _mm_loadu_si128((const __m128i *)(sha512_k + index))));
+            __m128i next = sha512_expand_ssse3(x);
+            x[0] = x[1];
+            x[1] = x[2];
+            x[2] = x[3];
+            x[3] = x[4];
+            x[4] = x[5];
+            x[5] = x[6];
+            x[6] = x[7];
+            x[7] = next;
+        }
+        sha512_rounds(h, wk);
+        data += 128;
+        --blocks;
+    }
+    clean(wk);
+    clean(x);
+}
+
+/**
+ * \brief Expands the next two words of the SHA-512 message schedule
+ * for two chunks at once using AVX2.
+ *
+ * Each 128-bit lane holds the schedule for a separate chunk.
+ */
+CRYPTO_TARGET("avx2")
+static inline __m256i sha512_expand_avx2(const __m256i *x)
+{
+    __m256i w15 = _mm256_alignr_epi8(x[1], x[0], 8);
+    __m256i w7 = _mm256_alignr_epi8(x[5], x[4], 8);
+    return _mm256_add_epi64(_mm256_add_epi64(x[0], w7), _mm256_add_epi64(
+        _mm256_xor_si256(_mm256_xor_si256(sha512_ror256(w15, 1),
+                                          sha512_ror256(w15, 8)),
+                         _mm256_srli_epi64(w15, 7)),
+        _mm256_xor_si256(_mm256_xor_si256(sha512_ror256(x[7], 19),
+                                          sha512_ror256(x[7], 61)),
+                         _mm256_srli_epi64(x[7], 6))));
+}
+
+/**
+ * \brief Processes 1024-bit chunks using an AVX2 message schedule that
+ * expands two chunks at a time, with scalar rounds.
+ */
+CRYPTO_TARGET("avx2")
+static void sha512_blocks_avx2(uint64_t *h, const uint8_t *data, size_t blocks)
+{
+    if (blocks < 2) {
+        // Not worth setting up the two-chunk schedule for a single chunk.
+        sha512_blocks_ssse3(h, data, blocks);
+        return;
+    }
+    const __m256i swap = _mm256_set_epi64x
+        (0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL,
+         0x08090a0b0c0d0e0fULL, 0x0001020304050607ULL);
+    uint64_t wk0[80] __attribute__((aligned(16)));
+    uint64_t wk1[80] __attribute__((aligned(16)));
+    __m256i x[8];
+    uint8_t index;
+    while (blocks >= 2) {
+        for (index = 0; index < 8; ++index) {
+            x[index] = _mm256_shuffle_epi8(_mm256_inserti128_si256
+                (_mm256_castsi128_si256(_mm_loadu_si128
+                    ((const __m128i *)(data + index * 16))),
+                 _mm_loadu_si128((const __m128i *)(data + 128 + index * 16)),
+                 1), swap);
+        }
+        for (index = 0; index < 80; index += 2) {
+            __m256i t = _mm256_add_epi64(x[0], _mm256_broadcastsi128_si256
+                (_mm_loadu_si128((const __m128i *)(sha512_k + index))));
+            _mm_store_si128((__m128i *)(wk0 + index),
+                            _mm256_castsi256_si128(t));
+            _mm_store_si128((__m128i *)(wk1 + index),
+                            _mm256_extracti128_si256(t, 1));
+            __m256i next = sha512_expand_avx2(x);
+            x[0] = x[1];
+            x[1] = x[2];
+            x[2] = x[3];
+            x[3] = x[4];
+            x[4] = x[5];
+            x[5] = x[6];
+            x[6] = x[7];
+            x[7] = next;
+        }
+        sha512_rounds(h, wk0);
+        sha512_rounds(h, wk1);
+        data += 256;
+        blocks -= 2;
+    }
+    clean(wk0);
+    clean(wk1);
+    clean(x);
+    if (blocks)
+        sha512_blocks_ssse3(h, data, blocks);
+}
+
+/**
+ * \brief Selects the best SHA-512 backend for the host CPU.
+ *
+ * \return A pointer to the backend, or NULL to use the portable
+ * processChunk() implementation.
+ */
+static sha512_blocks_t sha512_backend()
+{
+    static sha512_blocks_t backend = 0;
+    static bool selected = false;
+    if (!selected) {
+        if (crypto_cpu_has(CRYPTO_CPU_AVX2))
+            backend = sha512_blocks_avx2;
+        else if (crypto_cpu_has(CRYPTO_CPU_SSSE3))
+            backend = sha512_blocks_ssse3;
+        selected = true;
+    }
+    return backend;
+}
+
+#endif // CRYPTO_X86_SIMD
@@ -0,0 +1,286 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "MultiHash.h"
+#include "SHA512.h"
+#include "Crypto.h"
+#include "utility/CpuUtil.h"
+#include "utility/SHA2Util.h"
+#include "utility/EndianUtil.h"
+#include <string.h>
+
+/**
+ * \class SHA512Multi MultiHash.h <MultiHash.h>
+ * \brief Hashes several independent messages with SHA-512 at once.
+ *
+ * This class works the same way as SHA256Multi, with each SIMD lane
+ * holding the 64-bit state words for a separate message.  On x86 hosts
+ * with AVX-512 there are 8 lanes and with AVX2 there are 4 lanes.
+ * Otherwise the messages are hashed one at a time with SHA512.
+ *
+ * \sa SHA256Multi, BLAKE2sMulti, SHA512
+ */
+
+/**
+ * \var SHA512Multi::HASH_SIZE
+ * \brief Constant for the size of the hash output of SHA512Multi.
+ */
+
+/**
+ * \var SHA512Multi::MAX_LANES
+ * \brief Maximum number of lanes that may be returned by lanes().
+ */
+
+#if defined(CRYPTO_X86_SIMD)
+
+typedef uint64_t sha512_v4 __attribute__((vector_size(32)));
+typedef uint64_t sha512_v8 __attribute__((vector_size(64)));
+
+// Initial hash value for SHA-512.
+static uint64_t const hashStart[8] = {
+    0x6A09E667F3BCC908ULL, 0xBB67AE8584CAA73BULL, 0x3C6EF372FE94F82BULL,
+    0xA54FF53A5F1D36F1ULL, 0x510E527FADE682D1ULL, 0x9B05688C2B3E6C1FULL,
+    0x1F83D9ABFB41BD6BULL, 0x5BE0CD19137E2179ULL
+};
+
+#define sha512_ror(x, bits) (((x) >> (bits)) | ((x) << (64 - (bits))))
+
+/**
+ * \brief Runs the SHA-512 compression function on all lanes.
+ *
+ * \param hash The transposed hash state, one vector per word.
+ * \param w The transposed message block, which is expanded in-place.
+ */
+template <typename V>
+static inline __attribute__((always_inline))
+void sha512_multi_compress(V *hash, V *w)
+{
+    V a = hash[0];
+    V b = hash[1];
+    V c = hash[2];
+    V d = hash[3];
+    V e = hash[4];
+    V f = hash[5];
+    V g = hash[6];
+    V h = hash[7];
+    V temp1, temp2;
+#pragma GCC unroll 80
+    for (uint8_t index = 0; index < 80; ++index) {
+        if (index >= 16) {
+            temp1 = w[(index - 15) & 0x0F];
+            temp2 = w[(index - 2) & 0x0F];
+            w[index & 0x0F] +=
+                w[(index - 7) & 0x0F] +
+                (sha512_ror(temp1, 1) ^ sha512_ror(temp1, 8) ^ (temp1 >> 7)) +
+                (sha512_ror(temp2, 19) ^ sha512_ror(temp2, 61) ^ (temp2 >> 6));
+        }
+        temp1 = h + sha512_k[index] + w[index & 0x0F] +
+                (sha512_ror(e, 14) ^ sha512_ror(e, 18) ^ sha512_ror(e, 41)) +
+                ((e & f) ^ ((~e) & g));
+        temp2 = (sha512_ror(a, 28) ^ sha512_ror(a, 34) ^ sha512_ror(a, 39)) +
+                ((a & b) ^ (a & c) ^ (b & c));
+        h = g;
+        g = f;
+        f = e;
+        e = d + temp1;
+        d = c;
+        c = b;
+        b = a;
+        a = temp1 + temp2;
+    }
+    hash[0] += a;
+    hash[1] += b;
+    hash[2] += c;
+    hash[3] += d;
+    hash[4] += e;
+    hash[5] += f;
+    hash[6] += g;
+    hash[7] += h;
+}
+
+/**
+ * \brief Transposes the next chunk of up to N messages into word order.
+ *
+ * Lanes that have already finished, or that are unused in this batch,
+ * are given a dummy all-zeroes chunk.
+ */
+template <unsigned N>
+static inline __attribute__((always_inline))
+void sha512_multi_transpose(uint64_t words[16][N], const uint8_t *const *data,
+                            uint8_t tail[N][256], const size_t *full,
+                            const size_t *total, unsigned count, size_t block)
+{
+    static uint8_t const dummy[128] = {0};
+    for (unsigned lane = 0; lane < N; ++lane) {
+        const uint8_t *chunk;
+        if (lane >= count || block >= total[lane])
+            chunk = dummy;
+        else if (block < full[lane])
+            chunk = data[lane] + block * 128;
+        else
+            chunk = tail[lane] + (block - full[lane]) * 128;
+        for (unsigned index = 0; index < 16; ++index) {
+            uint64_t word;
+            memcpy(&word, chunk + index * 8, sizeof(word));
+            words[index][lane] = be64toh(word);
+        }
+    }
+}
+
+/**
+ * \brief Hashes up to N messages in parallel using N-lane vectors.
+ */
+template <typename V, unsigned N>
+static inline __attribute__((always_inline))
+void sha512_multi_lanes(uint8_t *const *hashes, const uint8_t *const *data,
+                        const size_t *lens, unsigned count)
+{
+    uint8_t tail[N][256];
+    size_t full[N];
+    size_t total[N];
+    size_t maxBlocks = 0;
+    uint64_t words[2][16][N] __attribute__((aligned(sizeof(V))));
+    V h[8];
+    V w[16];
+    unsigned lane, index;
+
+    // Format the padded tail chunks for each message.  The high 64 bits
+    // of the 128-bit length are only non-zero for enormous messages.
+    for (lane = 0; lane < count; ++lane) {
+        size_t len = lens[lane];
+        size_t rem = len % 128;
+        size_t tailSize = (rem <= (128 - 17)) ? 128 : 256;
+        uint64_t bitsLow = ((uint64_t)len) << 3;
+        uint64_t bitsHigh = ((uint64_t)len) >> 61;
+        full[lane] = len / 128;
+        memcpy(tail[lane], data[lane] + full[lane] * 128, rem);
+        tail[lane][rem] = 0x80;
+        memset(tail[lane] + rem + 1, 0, tailSize - 16 - (rem + 1));
+        bitsLow = htobe64(bitsLow);
+        bitsHigh = htobe64(bitsHigh);
+        memcpy(tail[lane] + tailSize - 16, &bitsHigh, sizeof(bitsHigh));
+        memcpy(tail[lane] + tailSize - 8, &bitsLow, sizeof(bitsLow));
+        total[lane] = full[lane] + tailSize / 128;
+        if (total[lane] > maxBlocks)
+            maxBlocks = total[lane];
+    }
+
+    // Broadcast the initial hash value to all lanes.
+    for (index = 0; index < 8; ++index)
+        h[index] = (V){} + hashStart[index];
+
+    // Transpose and compress the chunks for all lanes at once.
+    sha512_multi_transpose<N>(words[0], data, tail, full, total, count, 0);
+    for (size_t block = 0; block < maxBlocks; ++block) {
+        memcpy(w, words[block & 1], sizeof(w));
+        if ((block + 1) < maxBlocks) {
+            sha512_multi_transpose<N>(words[(block + 1) & 1], data, tail,
+                                      full, total, count, block + 1);
+        }
+        sha512_multi_compress<V>(h, w);
+        for (lane = 0; lane < count; ++lane) {
+            if ((block + 1) != total[lane])
+                continue;
+            for (index = 0; index < 8; ++index) {
+                uint64_t word = htobe64(h[index][lane]);
+                memcpy(hashes[lane] + index * 8, &word, sizeof(word));
+            }
+        }
+    }
+
+    clean(tail);
+    clean(words);
+    clean(h);
+    clean(w);
+}
+
+CRYPTO_TARGET("avx512f")
+static void sha512_multi_avx512(uint8_t *const *hashes, const uint8_t *const *data,
+                                const size_t *lens, unsigned count)
+{
+    sha512_multi_lanes<sha512_v8, 8>(hashes, data, lens, count);
+}
+
+CRYPTO_TARGET("avx2")
+static void sha512_multi_avx2(uint8_t *const *hashes, const uint8_t *const *data,
+                              const size_t *lens, unsigned count)
+{
+    sha512_multi_lanes<sha512_v4, 4>(hashes, data, lens, count);
+}
+
+#endif // CRYPTO_X86_SIMD
+
+/**
+ * \brief Returns the number of messages that are hashed in parallel
+ * on this platform.
+ *
+ * \sa SHA256Multi::lanes()
+ */
+size_t SHA512Multi::lanes()
+{
+#if defined(CRYPTO_X86_SIMD)
+    if (crypto_cpu_has(CRYPTO_CPU_AVX512F))
+        return 8;
+    else if (crypto_cpu_has(CRYPTO_CPU_AVX2))
+        return 4;
+#endif
+    return 1;
+}
+
+/**
+ * \brief Hashes a batch of independent messages with SHA-512.
+ *
+ * \param hashes Array of \a count pointers to buffers that receive the
+ * hash outputs.  Each buffer must be at least HASH_SIZE bytes in length.
+ * \param data Array of \a count pointers to the messages to hash.
+ * \param lens Array of \a count message lengths in bytes.
+ * \param count Number of messages to hash.
+ *
+ * The results are identical to hashing each message with SHA512.
+ */
+void SHA512Multi::hash(uint8_t *const *hashes, const void *const *data,
+                       const size_t *lens, size_t count)
+{
+    const uint8_t *const *d = (const uint8_t *const *)data;
+#if defined(CRYPTO_X86_SIMD)
+    size_t n = lanes();
+    while (count > 0 && n > 1) {
+        unsigned batch = (count < n) ? (unsigned)count : (unsigned)n;
+        if (n == 8)
+            sha512_multi_avx512(hashes, d, lens, batch);
+        else
+            sha512_multi_avx2(hashes, d, lens, batch);
+        hashes += batch;
+        d += batch;
+        lens += batch;
+        count -= batch;
+    }
+#endif
+    if (count > 0) {
+        SHA512 sha512;
+        for (size_t posn = 0; posn < count; ++posn) {
+            sha512.reset();
+            sha512.update(d[posn], lens[posn]);
+            sha512.finalize(hashes[posn], HASH_SIZE);
+        }
+    }
+}
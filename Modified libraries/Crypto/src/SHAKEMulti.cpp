@@ -0,0 +1,195 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "MultiHash.h"
+#include "KeccakCore.h"
+#include "SHAKE.h"
+#include "utility/CpuUtil.h"
+
+/**
+ * \class SHAKE128Multi MultiHash.h <MultiHash.h>
+ * \brief Runs the SHAKE128 extendable output function on several
+ * independent inputs at once.
+ *
+ * This is useful for deriving keys or other material for many devices
+ * at the same time.  Each input is absorbed and then \a outLen bytes of
+ * output are squeezed, exactly as though each input had been passed to
+ * SHAKE128::update() followed by a single call to SHAKE128::extend():
+ *
+ * \code
+ * const void *ids[4] = {id1, id2, id3, id4};
+ * size_t lens[4] = {len1, len2, len3, len4};
+ * uint8_t *keys[4] = {key1, key2, key3, key4};
+ * SHAKE128Multi::extend(keys, 32, ids, lens, 4);
+ * \endcode
+ *
+ * On x86 hosts there are 4 lanes.  On other platforms the inputs are
+ * processed one at a time with SHAKE128.
+ *
+ * \sa SHAKE256Multi, SHA3_256Multi, KeccakCoreX4, SHAKE128
+ */
+
+/**
+ * \var SHAKE128Multi::MAX_LANES
+ * \brief Maximum number of lanes that may be returned by lanes().
+ */
+
+/**
+ * \class SHAKE256Multi MultiHash.h <MultiHash.h>
+ * \brief Runs the SHAKE256 extendable output function on several
+ * independent inputs at once.
+ *
+ * This class works the same way as SHAKE128Multi, but with the capacity
+ * of SHAKE256.
+ *
+ * \sa SHAKE128Multi, SHA3_256Multi, KeccakCoreX4, SHAKE256
+ */
+
+/**
+ * \var SHAKE256Multi::MAX_LANES
+ * \brief Maximum number of lanes that may be returned by lanes().
+ */
+
+#if !defined(CRYPTO_X86_SIMD)
+
+/**
+ * \brief Runs SHAKE on a batch of inputs one at a time.
+ *
+ * \param shake The SHAKE object to use.
+ * \param outputs Array of \a count pointers to the output buffers.
+ * \param outLen Number of bytes of output to produce for each input.
+ * \param data Array of \a count pointers to the inputs.
+ * \param lens Array of \a count input lengths in bytes.
+ * \param count Number of inputs.
+ */
+static void shake_single(SHAKE *shake, uint8_t *const *outputs,
+                         size_t outLen, const uint8_t *const *data,
+                         const size_t *lens, size_t count)
+{
+    for (size_t posn = 0; posn < count; ++posn) {
+        shake->reset();
+        shake->update(data[posn], lens[posn]);
+        shake->extend(outputs[posn], outLen);
+    }
+}
+
+#endif
+
+/**
+ * \brief Returns the number of inputs that are processed in parallel
+ * on this platform.
+ *
+ * Callers can use this to size their batches.  Any number of inputs
+ * can be passed to extend(), but it is most efficient when the count is
+ * a multiple of lanes().
+ */
+size_t SHAKE128Multi::lanes()
+{
+#if defined(CRYPTO_X86_SIMD)
+    return KeccakCoreX4::LANES;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * \brief Runs SHAKE128 on a batch of independent inputs.
+ *
+ * \param outputs Array of \a count pointers to buffers that receive the
+ * output.  Each buffer must be at least \a outLen bytes in length.
+ * \param outLen Number of bytes of output to produce for each input.
+ * \param data Array of \a count pointers to the inputs.
+ * \param lens Array of \a count input lengths in bytes.
+ * \param count Number of inputs.
+ */
+void SHAKE128Multi::extend(uint8_t *const *outputs, size_t outLen,
+                           const void *const *data, const size_t *lens,
+                           size_t count)
+{
+    const uint8_t *const *d = (const uint8_t *const *)data;
+#if defined(CRYPTO_X86_SIMD)
+    KeccakCoreX4 core;
+    core.setCapacity(256);
+    while (count > 0) {
+        unsigned batch = (count < KeccakCoreX4::LANES)
+                       ? (unsigned)count : (unsigned)KeccakCoreX4::LANES;
+        core.spongeLanes(outputs, outLen, d, lens, batch, 0x1F);
+        outputs += batch;
+        d += batch;
+        lens += batch;
+        count -= batch;
+    }
+#else
+    SHAKE128 shake;
+    shake_single(&shake, outputs, outLen, d, lens, count);
+#endif
+}
+
+/**
+ * \brief Returns the number of inputs that are processed in parallel
+ * on this platform.
+ *
+ * Callers can use this to size their batches.  Any number of inputs
+ * can be passed to extend(), but it is most efficient when the count is
+ * a multiple of lanes().
+ */
+size_t SHAKE256Multi::lanes()
+{
+#if defined(CRYPTO_X86_SIMD)
+    return KeccakCoreX4::LANES;
+#else
+    return 1;
+#endif
+}
+
+/**
+ * \brief Runs SHAKE256 on a batch of independent inputs.
+ *
+ * \param outputs Array of \a count pointers to buffers that receive the
+ * output.  Each buffer must be at least \a outLen bytes in length.
+ * \param outLen Number of bytes of output to produce for each input.
+ * \param data Array of \a count pointers to the inputs.
+ * \param lens Array of \a count input lengths in bytes.
+ * \param count Number of inputs.
+ */
+void SHAKE256Multi::extend(uint8_t *const *outputs, size_t outLen,
+                           const void *const *data, const size_t *lens,
+                           size_t count)
+{
+    const uint8_t *const *d = (const uint8_t *const *)data;
+#if defined(CRYPTO_X86_SIMD)
+    KeccakCoreX4 core;
+    core.setCapacity(512);
+    while (count > 0) {
+        unsigned batch = (count < KeccakCoreX4::LANES)
+                       ? (unsigned)count : (unsigned)KeccakCoreX4::LANES;
+        core.spongeLanes(outputs, outLen, d, lens, batch, 0x1F);
+        outputs += batch;
+        d += batch;
+        lens += batch;
+        count -= batch;
+    }
+#else
+    SHAKE256 shake;
+    shake_single(&shake, outputs, outLen, d, lens, count);
+#endif
+}
@@ -0,0 +1,169 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#include "TurboSHAKE.h"
+
+/**
+ * \class TurboSHAKE TurboSHAKE.h <TurboSHAKE.h>
+ * \brief Abstract base class for the TurboSHAKE Extendable-Output
+ * Functions (XOFs).
+ *
+ * TurboSHAKE is the same sponge construction as SHAKE, but it uses the
+ * 12-round KECCAK-p[1600, 12] permutation instead of the 24 rounds of
+ * KECCAK-f[1600].  It is roughly twice as fast as SHAKE.
+ *
+ * The input is padded with a domain separation byte between 0x01 and
+ * 0x7F, which defaults to 0x1F.  Call reset(uint8_t) to select a
+ * different domain.
+ *
+ * Reference: https://www.rfc-editor.org/rfc/rfc9861
+ *
+ * \sa TurboSHAKE128, TurboSHAKE256, KangarooTwelve, SHAKE
+ */
+
+/**
+ * \brief Constructs a TurboSHAKE object.
+ *
+ * \param capacity The capacity of the Keccak sponge function in bits which
+ * should be a multiple of 64 and between 64 and 1536.
+ */
+TurboSHAKE::TurboSHAKE(size_t capacity)
+    : _domain(0x1F)
+    , finalized(false)
+{
+    core.setCapacity(capacity);
+    core.setRounds(12);
+}
+
+/**
+ * \brief Destroys this TurboSHAKE object after clearing all sensitive
+ * information.
+ */
+TurboSHAKE::~TurboSHAKE()
+{
+}
+
+size_t TurboSHAKE::blockSize() const
+{
+    return core.blockSize();
+}
+
+void TurboSHAKE::reset()
+{
+    core.reset();
+    finalized = false;
+}
+
+/**
+ * \brief Resets the XOF and selects a new domain separation byte.
+ *
+ * \param domain The domain separation byte, between 0x01 and 0x7F.
+ *
+ * \sa domain()
+ */
+void TurboSHAKE::reset(uint8_t domain)
+{
+    _domain = domain;
+    reset();
+}
+
+void TurboSHAKE::update(const void *data, size_t len)
+{
+    if (finalized)
+        reset();
+    core.update(data, len);
+}
+
+void TurboSHAKE::extend(uint8_t *data, size_t len)
+{
+    if (!finalized) {
+        core.pad(_domain);
+        finalized = true;
+    }
+    core.extract(data, len);
+}
+
+void TurboSHAKE::encrypt(uint8_t *output, const uint8_t *input, size_t len)
+{
+    if (!finalized) {
+        core.pad(_domain);
+        finalized = true;
+    }
+    core.encrypt(output, input, len);
+}
+
+void TurboSHAKE::clear()
+{
+    core.clear();
+    finalized = false;
+}
+
+/**
+ * \fn uint8_t TurboSHAKE::domain() const
+ * \brief Returns the domain separation byte for this XOF.
+ *
+ * \sa reset(uint8_t)
+ */
+
+/**
+ * \class TurboSHAKE128 TurboSHAKE.h <TurboSHAKE.h>
+ * \brief TurboSHAKE Extendable-Output Function (XOF) with 128-bit security.
+ *
+ * Reference: https://www.rfc-editor.org/rfc/rfc9861
+ *
+ * \sa TurboSHAKE256, TurboSHAKE, KangarooTwelve
+ */
+
+/**
+ * \fn TurboSHAKE128::TurboSHAKE128()
+ * \brief Constructs a TurboSHAKE object with 128-bit security.
+ */
+
+/**
+ * \brief Destroys this TurboSHAKE128 object after clearing all sensitive
+ * information.
+ */
+TurboSHAKE128::~TurboSHAKE128()
+{
+}
+
+/**
+ * \class TurboSHAKE256 TurboSHAKE.h <TurboSHAKE.h>
+ * \brief TurboSHAKE Extendable-Output Function (XOF) with 256-bit security.
+ *
+ * Reference: https://www.rfc-editor.org/rfc/rfc9861
+ *
+ * \sa TurboSHAKE128, TurboSHAKE, KangarooTwelve
+ */
+
+/**
+ * \fn TurboSHAKE256::TurboSHAKE256()
+ * \brief Constructs a TurboSHAKE object with 256-bit security.
+ */
+
+/**
+ * \brief Destroys this TurboSHAKE256 object after clearing all sensitive
+ * information.
+ */
+TurboSHAKE256::~TurboSHAKE256()
+{
+}
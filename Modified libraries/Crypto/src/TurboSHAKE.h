@@ -0,0 +1,70 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_TURBOSHAKE_h
+#define CRYPTO_TURBOSHAKE_h
+
+#include "XOF.h"
+#include "KeccakCore.h"
+
+class TurboSHAKE : public XOF
+{
+public:
+    virtual ~TurboSHAKE();
+
+    size_t blockSize() const;
+
+    void reset();
+    void reset(uint8_t domain);
+    void update(const void *data, size_t len);
+
+    void extend(uint8_t *data, size_t len);
+    void encrypt(uint8_t *output, const uint8_t *input, size_t len);
+
+    void clear();
+
+    uint8_t domain() const { return _domain; }
+
+protected:
+    TurboSHAKE(size_t capacity);
+
+private:
+    KeccakCore core;
+    uint8_t _domain;
+    bool finalized;
+};
+
+class TurboSHAKE128 : public TurboSHAKE
+{
+public:
+    TurboSHAKE128() : TurboSHAKE(256) {}
+    virtual ~TurboSHAKE128();
+};
+
+class TurboSHAKE256 : public TurboSHAKE
+{
+public:
+    TurboSHAKE256() : TurboSHAKE(512) {}
+    virtual ~TurboSHAKE256();
+};
+
+#endif
@@ -23,6 +23,8 @@
 #include "XTS.h"
 #include "Crypto.h"
 #include "GF128.h"
+#include "AES.h"
+#include "utility/StaticUtil.h"
 #include <string.h>
 
 /**
@@ -149,12 +151,6 @@ bool XTSCommon::setTweak(const uint8_t *tweak, size_t len)
     return true;
 }
 
-#define xorTweak(output, input, tweak) \
-    do { \
-        for (uint8_t i = 0; i < 16; ++i) \
-            (output)[i] = (input)[i] ^ ((const uint8_t *)(tweak))[i]; \
-    } while (0)
-
 /**
  * \brief Encrypts an entire sector of data.
  *
@@ -168,6 +164,69 @@ bool XTSCommon::setTweak(const uint8_t *tweak, size_t len)
  * \sa decryptSector(), setKey(), setTweak()
  */
 void XTSCommon::encryptSector(uint8_t *output, const uint8_t *input)
+{
+    encryptSectorWith(*blockCipher1, output, input);
+}
+
+/**
+ * \brief Decrypts an entire sector of data.
+ *
+ * \param output The output buffer to write the plaintext to, which can
+ * be the same as \a input.
+ * \param input The input buffer to read the ciphertext from.
+ *
+ * The \a input and \a output buffers must be at least sectorSize()
+ * bytes in length.
+ *
+ * \sa encryptSector(), setKey(), setTweak()
+ */
+void XTSCommon::decryptSector(uint8_t *output, const uint8_t *input)
+{
+    decryptSectorWith(*blockCipher1, output, input);
+}
+
+/**
+ * \brief Clears all security-sensitive state from this XTS object.
+ */
+void XTSCommon::clear()
+{
+    clean(twk);
+    blockCipher1->clear();
+    blockCipher2->clear();
+}
+
+/**
+ * \fn void XTSCommon::setBlockCiphers(BlockCipher *cipher1, BlockCipher *cipher2)
+ * \brief Sets the two block ciphers to use for XTS mode.
+ *
+ * \param cipher1 Points to the first block cipher object, which must be
+ * capable of both encryption and decryption.
+ * \param cipher2 Points to the second block cipher object, which must be
+ * capable of both encryption but does not need to be capable of decryption.
+ *
+ * Both block ciphers must have a 128-bit block size.
+ */
+
+#define xorTweak(output, input, tweak) \
+    do { \
+        for (uint8_t i = 0; i < 16; ++i) \
+            (output)[i] = (input)[i] ^ ((const uint8_t *)(tweak))[i]; \
+    } while (0)
+
+/**
+ * \brief Encrypts an entire sector using a specific block cipher object.
+ *
+ * \param cipher The first block cipher, which is either the one that was
+ * passed to setBlockCiphers() or a StaticBlockCipher wrapper around it.
+ * \param output The output buffer to write the ciphertext to.
+ * \param input The input buffer to read the plaintext from.
+ *
+ * This is the implementation of encryptSector().  It is a template so
+ * that StaticXTS can instantiate it on the concrete block cipher type.
+ * The tweak must have already been encrypted by setTweak().
+ */
+template <typename B>
+void XTSCommon::encryptSectorWith(B &cipher, uint8_t *output, const uint8_t *input)
 {
     size_t sectLast = sectSize & ~15;
     size_t posn = 0;
@@ -176,7 +235,7 @@ void XTSCommon::encryptSector(uint8_t *output, const uint8_t *input)
     while (posn < sectLast) {
         // Process all complete 16-byte blocks.
         xorTweak(output, input, t);
-        blockCipher1->encryptBlock(output, output);
+        cipher.encryptBlock(output, output);
         xorTweak(output, output, t);
         GF128::dblXTS(t);
         input += 16;
@@ -195,24 +254,23 @@ void XTSCommon::encryptSector(uint8_t *output, const uint8_t *input)
             output[leftOver] = temp;
         }
         xorTweak(output, output, t);
-        blockCipher1->encryptBlock(output, output);
+        cipher.encryptBlock(output, output);
         xorTweak(output, output, t);
     }
 }
 
 /**
- * \brief Decrypts an entire sector of data.
+ * \brief Decrypts an entire sector using a specific block cipher object.
  *
- * \param output The output buffer to write the plaintext to, which can
- * be the same as \a input.
+ * \param cipher The first block cipher, which is either the one that was
+ * passed to setBlockCiphers() or a StaticBlockCipher wrapper around it.
+ * \param output The output buffer to write the plaintext to.
  * \param input The input buffer to read the ciphertext from.
  *
- * The \a input and \a output buffers must be at least sectorSize()
- * bytes in length.
- *
- * \sa encryptSector(), setKey(), setTweak()
+ * This is the implementation of decryptSector().
  */
-void XTSCommon::decryptSector(uint8_t *output, const uint8_t *input)
+template <typename B>
+void XTSCommon::decryptSectorWith(B &cipher, uint8_t *output, const uint8_t *input)
 {
     size_t sectLast = sectSize & ~15;
     size_t posn = 0;
@@ -223,7 +281,7 @@ void XTSCommon::decryptSector(uint8_t *output, const uint8_t *input)
     while (posn < sectLast) {
         // Process all complete 16-byte blocks.
         xorTweak(output, input, t);
-        blockCipher1->decryptBlock(output, output);
+        cipher.decryptBlock(output, output);
         xorTweak(output, output, t);
         GF128::dblXTS(t);
         input += 16;
@@ -242,7 +300,7 @@ void XTSCommon::decryptSector(uint8_t *output, const uint8_t *input)
         memcpy(u, t, sizeof(t));
         GF128::dblXTS(t);
         xorTweak(output, input, t);
-        blockCipher1->decryptBlock(output, output);
+        cipher.decryptBlock(output, output);
         xorTweak(output, output, t);
 
         // Swap the left-over bytes in the last two blocks.
@@ -255,32 +313,19 @@ void XTSCommon::decryptSector(uint8_t *output, const uint8_t *input)
 
         // Decrypt the second-last block using the second-last tweak.
         xorTweak(output, output, u);
-        blockCipher1->decryptBlock(output, output);
+        cipher.decryptBlock(output, output);
         xorTweak(output, output, u);
     }
 }
 
-/**
- * \brief Clears all security-sensitive state from this XTS object.
- */
-void XTSCommon::clear()
-{
-    clean(twk);
-    blockCipher1->clear();
-    blockCipher2->clear();
-}
-
-/**
- * \fn void XTSCommon::setBlockCiphers(BlockCipher *cipher1, BlockCipher *cipher2)
- * \brief Sets the two block ciphers to use for XTS mode.
- *
- * \param cipher1 Points to the first block cipher object, which must be
- * capable of both encryption and decryption.
- * \param cipher2 Points to the second block cipher object, which must be
- * capable of both encryption but does not need to be capable of decryption.
- *
- * Both block ciphers must have a 128-bit block size.
- */
+// Instantiate the loops for the Static templates on the algorithms
+// that are listed in utility/StaticUtil.h.
+#define XTS_STATIC(T) \
+    template void XTSCommon::encryptSectorWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *); \
+    template void XTSCommon::decryptSectorWith< StaticBlockCipher<T> > \
+        (StaticBlockCipher<T> &, uint8_t *, const uint8_t *);
+CRYPTO_STATIC_BLOCK_CIPHERS(XTS_STATIC)
 
 /**
  * \class XTSSingleKeyCommon XTS.h <XTS.h>
@@ -435,3 +480,59 @@ bool XTSSingleKeyCommon::setKey(const uint8_t *key, size_t len)
  * \fn XTSSingleKey::~XTSSingleKey()
  * \brief Clears all sensitive information and destroys this object.
  */
+
+/**
+ * \class StaticXTS XTS.h <XTS.h>
+ * \brief Implementation of the XTS mode that is specialized on concrete
+ * 128-bit block ciphers.
+ *
+ * This class behaves the same as XTS except that encryptSector() and
+ * decryptSector() call T1::encryptBlock() and T1::decryptBlock() directly
+ * for each block of the sector instead of through the BlockCipher virtual
+ * function table.  The tweak is only encrypted once per sector, so the
+ * second cipher T2 is still called through BlockCipher.  T1 must be one
+ * of the AES classes.
+ *
+ * encryptSector() and decryptSector() are not virtual in XTSCommon.
+ * Calling them through a reference to XTSCommon will produce the same
+ * result, but without the benefit of static dispatch.
+ *
+ * \sa XTS, StaticXTSSingleKey, StaticBlockCipher
+ */
+
+/**
+ * \fn StaticXTS::StaticXTS()
+ * \brief Constructs an object for encrypting sectors in XTS mode.
+ *
+ * This constructor should be followed by a call to setSectorSize().
+ * The default sector size is 512 bytes.
+ */
+
+/**
+ * \fn StaticXTS::~StaticXTS()
+ * \brief Clears all sensitive information and destroys this object.
+ */
+
+/**
+ * \class StaticXTSSingleKey XTS.h <XTS.h>
+ * \brief Implementation of the single-key XTS mode that is specialized
+ * on a concrete 128-bit block cipher.
+ *
+ * This is the single-key equivalent of StaticXTS.
+ *
+ * \sa XTSSingleKey, StaticXTS
+ */
+
+/**
+ * \fn StaticXTSSingleKey::StaticXTSSingleKey()
+ * \brief Constructs an object for encrypting sectors in XTS mode
+ * with a single key instead of two split keys.
+ *
+ * This constructor should be followed by a call to setSectorSize().
+ * The default sector size is 512 bytes.
+ */
+
+/**
+ * \fn StaticXTSSingleKey::~StaticXTSSingleKey()
+ * \brief Clears all sensitive information and destroys this object.
+ */
@@ -54,6 +54,11 @@ protected:
         blockCipher2 = cipher2;
     }
 
+    template <typename B>
+    void encryptSectorWith(B &cipher, uint8_t *output, const uint8_t *input);
+    template <typename B>
+    void decryptSectorWith(B &cipher, uint8_t *output, const uint8_t *input);
+
 private:
     BlockCipher *blockCipher1;
     BlockCipher *blockCipher2;
@@ -98,4 +103,49 @@ private:
     T cipher;
 };
 
+template <typename T1, typename T2 = T1>
+class StaticXTS : public XTSCommon
+{
+public:
+    StaticXTS() { setBlockCiphers(&cipher1, &cipher2); }
+    ~StaticXTS() {}
+
+    void encryptSector(uint8_t *output, const uint8_t *input)
+    {
+        StaticBlockCipher<T1> direct(cipher1);
+        encryptSectorWith(direct, output, input);
+    }
+    void decryptSector(uint8_t *output, const uint8_t *input)
+    {
+        StaticBlockCipher<T1> direct(cipher1);
+        decryptSectorWith(direct, output, input);
+    }
+
+private:
+    T1 cipher1;
+    T2 cipher2;
+};
+
+template <typename T>
+class StaticXTSSingleKey : public XTSSingleKeyCommon
+{
+public:
+    StaticXTSSingleKey() { setBlockCiphers(&cipher, &cipher); }
+    ~StaticXTSSingleKey() {}
+
+    void encryptSector(uint8_t *output, const uint8_t *input)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        encryptSectorWith(direct, output, input);
+    }
+    void decryptSector(uint8_t *output, const uint8_t *input)
+    {
+        StaticBlockCipher<T> direct(cipher);
+        decryptSectorWith(direct, output, input);
+    }
+
+private:
+    T cipher;
+};
+
 #endif
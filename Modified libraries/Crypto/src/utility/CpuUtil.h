@@ -0,0 +1,65 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_CPUUTIL_H
+#define CRYPTO_CPUUTIL_H
+
+#include <inttypes.h>
+
+// Host builds on x86 can make use of SIMD units and instruction set
+// extensions like SHA-NI.  The code for each extension is compiled with
+// a function-specific target attribute and selected at runtime, so the
+// same binary will still run on older CPUs that lack the extension.
+// Define CRYPTO_NO_X86_SIMD to force the portable code everywhere.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && \
+        !defined(CRYPTO_NO_X86_SIMD)
+#define CRYPTO_X86_SIMD 1
+#endif
+
+#if defined(CRYPTO_X86_SIMD)
+
+// Marks a function as being compiled for a specific instruction set.
+#define CRYPTO_TARGET(x)    __attribute__((target(x)))
+
+// Feature bits that are returned by crypto_cpu_features().
+#define CRYPTO_CPU_SSSE3    0x0001
+#define CRYPTO_CPU_SSE41    0x0002
+#define CRYPTO_CPU_SSE42    0x0004
+#define CRYPTO_CPU_AVX      0x0008
+#define CRYPTO_CPU_AVX2     0x0010
+#define CRYPTO_CPU_AVX512F  0x0020
+#define CRYPTO_CPU_SHA      0x0040
+#define CRYPTO_CPU_BMI2     0x0080
+#define CRYPTO_CPU_ADX      0x0100
+#define CRYPTO_CPU_AVX512VL 0x0200
+
+uint32_t crypto_cpu_features();
+
+// Determine if the CPU supports all of the features in a mask.
+inline bool crypto_cpu_has(uint32_t features)
+{
+    return (crypto_cpu_features() & features) == features;
+}
+
+#endif // CRYPTO_X86_SIMD
+
+#endif
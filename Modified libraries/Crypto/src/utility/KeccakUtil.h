@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_KECCAKUTIL_H
+#define CRYPTO_KECCAKUTIL_H
+
+#include <inttypes.h>
+
+// Helpers for fully unrolled implementations of KECCAK-p[1600] that keep
+// the state in local variables.  The lane type may be uint64_t or a GCC
+// vector of uint64_t values to permute several independent states at once.
+
+// Round constants for KECCAK-f[1600].
+static uint64_t const keccakp_rc[24] = {
+    0x0000000000000001ULL, 0x0000000000008082ULL, 0x800000000000808AULL,
+    0x8000000080008000ULL, 0x000000000000808BULL, 0x0000000080000001ULL,
+    0x8000000080008081ULL, 0x8000000000008009ULL, 0x000000000000008AULL,
+    0x0000000000000088ULL, 0x0000000080008009ULL, 0x000000008000000AULL,
+    0x000000008000808BULL, 0x800000000000008BULL, 0x8000000000008089ULL,
+    0x8000000000008003ULL, 0x8000000000008002ULL, 0x8000000000000080ULL,
+    0x000000000000800AULL, 0x800000008000000AULL, 0x8000000080008081ULL,
+    0x8000000000008080ULL, 0x0000000080000001ULL, 0x8000000080008008ULL
+};
+
+// Perform a single round of KECCAK-p[1600] on the lanes in the A variables
+// and write the result to the E variables.  The lanes are named after the
+// rows "b, g, k, m, s" and the columns "a, e, i, o, u".  The "rotate"
+// argument is a macro that rotates a lane left by a number of bits.
+//
+// The lanes Abe, Abi, Ago, Aki, Ami, and Asa are kept in complemented form
+// between rounds ("lane complementing"), which changes the chi step so
+// that it needs only 5 NOT operations per round instead of 25.
+#define keccakp_round(A, E, rotate, rc) \
+    do { \
+        /* Step mapping theta */ \
+        Ca = A##ba ^ A##ga ^ A##ka ^ A##ma ^ A##sa; \
+        Ce = A##be ^ A##ge ^ A##ke ^ A##me ^ A##se; \
+        Ci = A##bi ^ A##gi ^ A##ki ^ A##mi ^ A##si; \
+        Co = A##bo ^ A##go ^ A##ko ^ A##mo ^ A##so; \
+        Cu = A##bu ^ A##gu ^ A##ku ^ A##mu ^ A##su; \
+        Da = Cu ^ rotate(Ce, 1); \
+        De = Ca ^ rotate(Ci, 1); \
+        Di = Ce ^ rotate(Co, 1); \
+        Do = Ci ^ rotate(Cu, 1); \
+        Du = Co ^ rotate(Ca, 1); \
+        \
+        /* Step mappings rho, pi, chi, and iota one row at a time */ \
+        Bba = A##ba ^ Da; \
+        Bbe = rotate(A##ge ^ De, 44); \
+        Bbi = rotate(A##ki ^ Di, 43); \
+        Bbo = rotate(A##mo ^ Do, 21); \
+        Bbu = rotate(A##su ^ Du, 14); \
+        E##ba = Bba ^ (Bbe | Bbi) ^ (rc); \
+        E##be = Bbe ^ ((~Bbi) | Bbo); \
+        E##bi = Bbi ^ (Bbo & Bbu); \
+        E##bo = Bbo ^ (Bbu | Bba); \
+        E##bu = Bbu ^ (Bba & Bbe); \
+        \
+        Bga = rotate(A##bo ^ Do, 28); \
+        Bge = rotate(A##gu ^ Du, 20); \
+        Bgi = rotate(A##ka ^ Da, 3); \
+        Bgo = rotate(A##me ^ De, 45); \
+        Bgu = rotate(A##si ^ Di, 61); \
+        E##ga = Bga ^ (Bge | Bgi); \
+        E##ge = Bge ^ (Bgi & Bgo); \
+        E##gi = Bgi ^ (Bgo | (~Bgu)); \
+        E##go = Bgo ^ (Bgu | Bga); \
+        E##gu = Bgu ^ (Bga & Bge); \
+        \
+        Bka = rotate(A##be ^ De, 1); \
+        Bke = rotate(A##gi ^ Di, 6); \
+        Bki = rotate(A##ko ^ Do, 25); \
+        Bko = rotate(A##mu ^ Du, 8); \
+        Bku = rotate(A##sa ^ Da, 18); \
+        E##ka = Bka ^ (Bke | Bki); \
+        E##ke = Bke ^ (Bki & Bko); \
+        E##ki = Bki ^ ((~Bko) & Bku); \
+        E##ko = (~Bko) ^ (Bku | Bka); \
+        E##ku = Bku ^ (Bka & Bke); \
+        \
+        Bma = rotate(A##bu ^ Du, 27); \
+        Bme = rotate(A##ga ^ Da, 36); \
+        Bmi = rotate(A##ke ^ De, 10); \
+        Bmo = rotate(A##mi ^ Di, 15); \
+        Bmu = rotate(A##so ^ Do, 56); \
+        E##ma = Bma ^ (Bme & Bmi); \
+        E##me = Bme ^ (Bmi | Bmo); \
+        E##mi = Bmi ^ ((~Bmo) | Bmu); \
+        E##mo = (~Bmo) ^ (Bmu & Bma); \
+        E##mu = Bmu ^ (Bma | Bme); \
+        \
+        Bsa = rotate(A##bi ^ Di, 62); \
+        Bse = rotate(A##go ^ Do, 55); \
+        Bsi = rotate(A##ku ^ Du, 39); \
+        Bso = rotate(A##ma ^ Da, 41); \
+        Bsu = rotate(A##se ^ De, 2); \
+        E##sa = Bsa ^ ((~Bse) & Bsi); \
+        E##se = (~Bse) ^ (Bsi | Bso); \
+        E##si = Bsi ^ (Bso & Bsu); \
+        E##so = Bso ^ (Bsu | Bsa); \
+        E##su = Bsu ^ (Bsa & Bse); \
+    } while (0)
+
+// Declares the local variables that are used by keccakp_round().
+#define keccakp_lanes(type) \
+    type Aba, Abe, Abi, Abo, Abu; \
+    type Aga, Age, Agi, Ago, Agu; \
+    type Aka, Ake, Aki, Ako, Aku; \
+    type Ama, Ame, Ami, Amo, Amu; \
+    type Asa, Ase, Asi, Aso, Asu; \
+    type Eba, Ebe, Ebi, Ebo, Ebu; \
+    type Ega, Ege, Egi, Ego, Egu; \
+    type Eka, Eke, Eki, Eko, Eku; \
+    type Ema, Eme, Emi, Emo, Emu; \
+    type Esa, Ese, Esi, Eso, Esu; \
+    type Bba, Bbe, Bbi, Bbo, Bbu; \
+    type Bga, Bge, Bgi, Bgo, Bgu; \
+    type Bka, Bke, Bki, Bko, Bku; \
+    type Bma, Bme, Bmi, Bmo, Bmu; \
+    type Bsa, Bse, Bsi, Bso, Bsu; \
+    type Ca, Ce, Ci, Co, Cu; \
+    type Da, De, Di, Do, Du
+
+#endif
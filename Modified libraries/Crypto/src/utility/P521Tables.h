@@ -0,0 +1,3073 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_P521TABLES_H
+#define CRYPTO_P521TABLES_H
+
+#include "LimbUtil.h"
+
+// Precomputed multiples of the P-521 generator G for fixed-base scalar
+// multiplication.  Every point is stored in affine form as the two values
+// (x, y) modulo 2^521 - 1, with the top partial limb expanded by the
+// LIMB_PARTIAL() macro from P521.cpp.
+//
+// The tables are generated by extras/gen_p521_tables.py and must not
+// be edited by hand.
+
+// Entry [i][k - 1] is the point k * 2^(16 * i) * G for k = 1..8.
+
+static limb_t const p521_comb[33][8][2][NUM_LIMBS_BITS(521)] PROGMEM = {
+    {   // (1..8) * 2^(16 * 0) * G
+        {{LIMB_PAIR(0xC2E5BD66, 0xF97E7E31), LIMB_PAIR(0x856A429B, 0x3348B3C1),
+          LIMB_PAIR(0xA2FFA8DE, 0xFE1DC127), LIMB_PAIR(0xEFE75928, 0xA14B5E77),
+          LIMB_PAIR(0x6B4D3DBA, 0xF828AF60), LIMB_PAIR(0x053FB521, 0x9C648139),
+          LIMB_PAIR(0x2395B442, 0x9E3ECB66), LIMB_PAIR(0x0404E9CD, 0x858E06B7),
+          LIMB_PARTIAL(0x0C6)},
+         {LIMB_PAIR(0x9FD16650, 0x88BE9476), LIMB_PAIR(0xA272C240, 0x353C7086),
+          LIMB_PAIR(0x3FAD0761, 0xC550B901), LIMB_PAIR(0x5EF42640, 0x97EE7299),
+          LIMB_PAIR(0x273E662C, 0x17AFBD17), LIMB_PAIR(0x579B4468, 0x98F54449),
+          LIMB_PAIR(0x2C7D1BD9, 0x5C8A5FB4), LIMB_PAIR(0x9A3BC004, 0x39296A78),
+          LIMB_PARTIAL(0x118)}},
+        {{LIMB_PAIR(0xBA6D783D, 0xF43E3933), LIMB_PAIR(0xD60FD967, 0xCF2FA364),
+          LIMB_PAIR(0x35C5AF41, 0xAA104A3A), LIMB_PAIR(0x6EF55507, 0xB3B204DA),
+          LIMB_PAIR(0xD769BE97, 0x2C6E5505), LIMB_PAIR(0x1CCC0635, 0x7403279B),
+          LIMB_PAIR(0x48C28274, 0x2FCB2881), LIMB_PAIR(0x277E7E68, 0x3C219024),
+          LIMB_PARTIAL(0x043)},
+         {LIMB_PAIR(0x61F41B02, 0x1BE356D6), LIMB_PAIR(0xEDC0F4F7, 0xEAFCBE95),
+          LIMB_PAIR(0x9A3248F4, 0x93937FA9), LIMB_PAIR(0x9F251F6B, 0xB3E377DE),
+          LIMB_PAIR(0x06C42DBB, 0xAB21A299), LIMB_PAIR(0x4DA97740, 0xC6B5107C),
+          LIMB_PAIR(0xEED3F0B5, 0xA7F3ECEE), LIMB_PAIR(0x6DB26700, 0xBB8CC7F8),
+          LIMB_PARTIAL(0x0F4)}},
+        {{LIMB_PAIR(0xDE37AD7D, 0xA5919D2E), LIMB_PAIR(0x2C32EA05, 0xAEB49086),
+          LIMB_PAIR(0xB59FE21B, 0x1DA6BD16), LIMB_PAIR(0x3A483205, 0xAD3F164A),
+          LIMB_PAIR(0x2D7A8DD1, 0xE5AD7A11), LIMB_PAIR(0x123D9AB9, 0xB52A6E5B),
+          LIMB_PAIR(0xB5959479, 0xD91D6A64), LIMB_PAIR(0xDE29195D, 0x3D352443),
+          LIMB_PARTIAL(0x1A7)},
+         {LIMB_PAIR(0xEE86C0E5, 0x5F588CA1), LIMB_PAIR(0x93A59042, 0xF105C9BC),
+          LIMB_PAIR(0xDEC3C70C, 0x2D5ACED1), LIMB_PAIR(0x8DC575B0, 0x2E2DD4CF),
+          LIMB_PAIR(0xA355CEEC, 0xD2F8AB1F), LIMB_PAIR(0x2A9D0317, 0xF1557FA8),
+          LIMB_PAIR(0xCAB814F2, 0x979F86C6), LIMB_PAIR(0xFA62DDD9, 0x9B03B97D),
+          LIMB_PARTIAL(0x13E)}},
+        {{LIMB_PAIR(0x871902F3, 0xFBC87412), LIMB_PAIR(0x08E5A5E2, 0xA1D5025B),
+          LIMB_PAIR(0x078AF066, 0xE8B88E9F), LIMB_PAIR(0xFE3D0750, 0x8659E24A),
+          LIMB_PAIR(0x41D3CEAC, 0x06C5D555), LIMB_PAIR(0x5FF39AFC, 0xC61C891C),
+          LIMB_PAIR(0x7C9070CD, 0x54B48348), LIMB_PAIR(0x2AC204C3, 0xB5DF64AE),
+          LIMB_PARTIAL(0x035)},
+         {LIMB_PAIR(0x346E4D0D, 0xE21F47FC), LIMB_PAIR(0x4699D1D9, 0xBB7FAEF0),
+          LIMB_PAIR(0xA95B85EE, 0x5224F750), LIMB_PAIR(0x4BA38540, 0x79F283E5),
+          LIMB_PAIR(0xF19907F2, 0x5AE63FE2), LIMB_PAIR(0xE6E32E1B, 0x5521AEF6),
+          LIMB_PAIR(0xB0B4ABB6, 0x73E0178E), LIMB_PAIR(0x1279D2B6, 0x096F8426),
+          LIMB_PARTIAL(0x082)}},
+        {{LIMB_PAIR(0xEC8F3078, 0xD5AB5096), LIMB_PAIR(0xD8931738, 0x29D7E1E6),
+          LIMB_PAIR(0x137E79A3, 0x7112FEAF), LIMB_PAIR(0x5E301423, 0x383C0C6D),
+          LIMB_PAIR(0xF177ACE4, 0xCF03DAB8), LIMB_PAIR(0xB53F0D24, 0x7A596EFD),
+          LIMB_PAIR(0xC04EB0BF, 0x3DBC3391), LIMB_PAIR(0x27A432C7, 0x2BF3C529),
+          LIMB_PARTIAL(0x065)},
+         {LIMB_PAIR(0xDEB090CB, 0x173CC3E8), LIMB_PAIR(0x7354F7F8, 0xD1F00725),
+          LIMB_PAIR(0x1CF5FF79, 0x31154021), LIMB_PAIR(0x072CF374, 0xBB6897C9),
+          LIMB_PAIR(0xA0347087, 0xEDD817C9), LIMB_PAIR(0x872E0051, 0x1CD8FE8E),
+          LIMB_PAIR(0x4A811291, 0x8A2B7311), LIMB_PAIR(0x6601D6EC, 0xE6EF1BDD),
+          LIMB_PARTIAL(0x15B)}},
+        {{LIMB_PAIR(0xF79206B9, 0x23731BED), LIMB_PAIR(0x57F380AE, 0x2F66E956),
+          LIMB_PAIR(0x9531BE8C, 0xE0727A23), LIMB_PAIR(0x153F7394, 0x5FBCCA16),
+          LIMB_PAIR(0xE4AB0152, 0x981506AD), LIMB_PAIR(0x7FD71CF3, 0x623D3097),
+          LIMB_PAIR(0x4480D195, 0x2EFF34F9), LIMB_PAIR(0xB5921953, 0x4569D6CD),
+          LIMB_PARTIAL(0x1EE)},
+         {LIMB_PAIR(0x58D44F17, 0x1EACCD78), LIMB_PAIR(0x5CA0DADE, 0x3DC7B8B5),
+          LIMB_PAIR(0xE274F220, 0xF96C984D), LIMB_PAIR(0x56648C9D, 0xCAB72D0E),
+          LIMB_PAIR(0x201A8A96, 0x7240A926), LIMB_PAIR(0xDA5A808E, 0x2AABBB73),
+          LIMB_PAIR(0x46E3B111, 0xE2DD2705), LIMB_PAIR(0xC64F586A, 0x0255AD0C),
+          LIMB_PARTIAL(0x1DE)}},
+        {{LIMB_PAIR(0x2816ECD4, 0x01CEAD88), LIMB_PAIR(0xFDC2619A, 0x6F953F50),
+          LIMB_PAIR(0xDCE3BBC4, 0xC9A6DF30), LIMB_PAIR(0xBFC698D8, 0x8C308D0A),
+          LIMB_PAIR(0xF7114C5D, 0xF018D2C2), LIMB_PAIR(0xF5483228, 0x5F22E0E8),
+          LIMB_PAIR(0x0B073A0C, 0xEEB65FDA), LIMB_PAIR(0x5B7F6346, 0xD5D1D99D),
+          LIMB_PARTIAL(0x056)},
+         {LIMB_PAIR(0x0525251B, 0x5C6B8BC9), LIMB_PAIR(0x5DDEFC7B, 0x9E76712A),
+          LIMB_PAIR(0x91CE1A5F, 0x9523A345), LIMB_PAIR(0xCDEC9E2B, 0x6BD0F293),
+          LIMB_PAIR(0x26CBDE55, 0x71DBD98A), LIMB_PAIR(0x2824F0DD, 0xB5C582D0),
+          LIMB_PAIR(0x39D68478, 0xD1D8317A), LIMB_PAIR(0xAAA2A110, 0x2D1B7D9B),
+          LIMB_PARTIAL(0x03D)}},
+        {{LIMB_PAIR(0xAA78CE68, 0x86F9EA54), LIMB_PAIR(0xA6F40405, 0xB56289B5),
+          LIMB_PAIR(0xC8D79E1A, 0x8B598C1B), LIMB_PAIR(0x579F49F0, 0x5BFEA5B8),
+          LIMB_PAIR(0xF826298F, 0x8B8A3B05), LIMB_PAIR(0x9B003E0A, 0xD4E29D8A),
+          LIMB_PAIR(0xB010E25B, 0xA8348396), LIMB_PAIR(0x301F7262, 0x22C40FB6),
+          LIMB_PARTIAL(0x008)},
+         {LIMB_PAIR(0x1F17801C, 0x8AD642F1), LIMB_PAIR(0x09471353, 0x9F3BA940),
+          LIMB_PAIR(0x65C57869, 0xF0BA0DF0), LIMB_PAIR(0x5911B4BF, 0x89E9C0AA),
+          LIMB_PAIR(0x0677A8F1, 0x5083DE61), LIMB_PAIR(0xE2C0715B, 0x44F8EDE9),
+          LIMB_PAIR(0x78853B9A, 0x48FDAB6E), LIMB_PAIR(0x42FC4820, 0x31911D55),
+          LIMB_PARTIAL(0x163)}}
+    },
+    {   // (1..8) * 2^(16 * 1) * G
+        {{LIMB_PAIR(0xCAA4BEC3, 0xA3480D58), LIMB_PAIR(0x5989E4A0, 0x38948993),
+          LIMB_PAIR(0x6F7BA4CA, 0x3F4D7B6C), LIMB_PAIR(0xD39CB2AE, 0xE2913A55),
+          LIMB_PAIR(0xD7BE6499, 0x615043EA), LIMB_PAIR(0xF504FEC3, 0x9D4C41CB),
+          LIMB_PAIR(0x8D44893B, 0x4F93DA96), LIMB_PAIR(0x9A7928E0, 0x33A7ACDC),
+          LIMB_PARTIAL(0x013)},
+         {LIMB_PAIR(0x48219A09, 0xC865844F), LIMB_PAIR(0x37426BDC, 0xA6D0B179),
+          LIMB_PAIR(0x284AE0E6, 0x7386A0A6), LIMB_PAIR(0xC2DC16FC, 0xDDD6CBA0),
+          LIMB_PAIR(0x2940D262, 0x77D2934D), LIMB_PAIR(0x741B88AB, 0x3AF6ED35),
+          LIMB_PAIR(0xA6DAE43F, 0x96F43A65), LIMB_PAIR(0x1414083B, 0xC7143535),
+          LIMB_PARTIAL(0x057)}},
+        {{LIMB_PAIR(0x24891F36, 0x394D5106), LIMB_PAIR(0x825FA293, 0xB4265C4F),
+          LIMB_PAIR(0xF6ECBD5E, 0x65A54B87), LIMB_PAIR(0x2A351A03, 0x6A2F900F),
+          LIMB_PAIR(0x8D1DAD9C, 0xFB26D52F), LIMB_PAIR(0xBA2C39CC, 0xBD651F19),
+          LIMB_PAIR(0xBB30ED5A, 0x2D5894F2), LIMB_PAIR(0x94732EC9, 0x4CC3F057),
+          LIMB_PARTIAL(0x0C3)},
+         {LIMB_PAIR(0x9BFEC4FF, 0x8C03CCDC), LIMB_PAIR(0xD52329C8, 0x4CE76352),
+          LIMB_PAIR(0x3995D109, 0x0A92CDF0), LIMB_PAIR(0x7518BA0C, 0x44D28A5D),
+          LIMB_PAIR(0xCE16A6A6, 0xBD74ECEF), LIMB_PAIR(0x123CB82F, 0xCAB52531),
+          LIMB_PAIR(0xF34E1C5F, 0x72065B99), LIMB_PAIR(0x03A9A916, 0x4949379F),
+          LIMB_PARTIAL(0x164)}},
+        {{LIMB_PAIR(0x0D67EE97, 0xD49BEA9D), LIMB_PAIR(0xF8CE59AA, 0x3B54996F),
+          LIMB_PAIR(0xF5862792, 0x609F5808), LIMB_PAIR(0xBF16A7B1, 0x8FFF6EE3),
+          LIMB_PAIR(0x9EF889A0, 0x2D515A91), LIMB_PAIR(0xCC6A85C3, 0x9FDAD17E),
+          LIMB_PAIR(0x54D161D4, 0xA93C168B), LIMB_PAIR(0xD42907B7, 0x269CBD3F),
+          LIMB_PARTIAL(0x077)},
+         {LIMB_PAIR(0xCC9BC5AE, 0xEFBDC466), LIMB_PAIR(0x9F2D0ABD, 0x56216332),
+          LIMB_PAIR(0x78B7F191, 0x567A46BC), LIMB_PAIR(0x55CB85EB, 0xFE6F5FFE),
+          LIMB_PAIR(0x1FA1E9B7, 0xB6A1BD3A), LIMB_PAIR(0xB23AA4A1, 0x92A1F94D),
+          LIMB_PAIR(0x85B417C5, 0x8706DF4E), LIMB_PAIR(0x72C38E1D, 0x80F8E279),
+          LIMB_PARTIAL(0x1F5)}},
+        {{LIMB_PAIR(0x76229445, 0xB3EE6763), LIMB_PAIR(0xFED827FE, 0xF39BDB10),
+          LIMB_PAIR(0x5ABBF64C, 0xBBD91777), LIMB_PAIR(0x29A83FA6, 0x260EE1D5),
+          LIMB_PAIR(0xE14C0321, 0xA0FB51A9), LIMB_PAIR(0x85203855, 0xE285DA42),
+          LIMB_PAIR(0x55550C91, 0x5C8AB2D2), LIMB_PAIR(0x5E3E844A, 0x88A94F05),
+          LIMB_PARTIAL(0x06C)},
+         {LIMB_PAIR(0x885E1B36, 0xE2C20AF1), LIMB_PAIR(0x5132EB84, 0x93632BFB),
+          LIMB_PAIR(0xEEC26E58, 0x8EC0A26A), LIMB_PAIR(0xC1A0B075, 0xA189AA9B),
+          LIMB_PAIR(0xFF4A93F9, 0x3786BE8F), LIMB_PAIR(0xE4302FC2, 0xAF4ACE63),
+          LIMB_PAIR(0x5856207E, 0xC19AE28D), LIMB_PAIR(0x5425099B, 0xCD791D4E),
+          LIMB_PARTIAL(0x13C)}},
+        {{LIMB_PAIR(0xA45742D3, 0x782A46B3), LIMB_PAIR(0x9AE4F831, 0x7FB395DC),
+          LIMB_PAIR(0x06715575, 0xAA0A2499), LIMB_PAIR(0x987995C6, 0x336DD153),
+          LIMB_PAIR(0x70D00FCB, 0x5678C82A), LIMB_PAIR(0x33B45F8B, 0xDC87A872),
+          LIMB_PAIR(0x3498DFA5, 0xD5B26900), LIMB_PAIR(0x410F7C71, 0xA8EF2E81),
+          LIMB_PARTIAL(0x0EC)},
+         {LIMB_PAIR(0x69A89D17, 0x00E42EF0), LIMB_PAIR(0x1DE60EE9, 0xDFD638D2),
+          LIMB_PAIR(0x8E2A3B24, 0x5E3E68A9), LIMB_PAIR(0xD7A07F7C, 0x19D1CC8A),
+          LIMB_PAIR(0x4D2C9B89, 0xD84E1809), LIMB_PAIR(0xFD778F5F, 0x7674BFD1),
+          LIMB_PAIR(0x1E2B3490, 0x962735A6), LIMB_PAIR(0xF535952D, 0x9AD592A5),
+          LIMB_PARTIAL(0x031)}},
+        {{LIMB_PAIR(0xAF63A6FF, 0x80D754CB), LIMB_PAIR(0x14970F91, 0xA4F718C1),
+          LIMB_PAIR(0xB184B25C, 0x33767545), LIMB_PAIR(0x26115598, 0xCB615B61),
+          LIMB_PAIR(0xB0EC3A99, 0xDDC1E848), LIMB_PAIR(0x7A9EE0F4, 0x238885AE),
+          LIMB_PAIR(0x70CFF1AF, 0x4F434C1A), LIMB_PAIR(0x04F92877, 0xA5D8F628),
+          LIMB_PARTIAL(0x103)},
+         {LIMB_PAIR(0xF5E7B21C, 0x889A468C), LIMB_PAIR(0x4F73F4C1, 0x42C6B128),
+          LIMB_PAIR(0xEA99C1C9, 0xC825355F), LIMB_PAIR(0xB8502CAB, 0xDFABD44E),
+          LIMB_PAIR(0x078FF997, 0x2C19C4F8), LIMB_PAIR(0xF948436E, 0x766BE192),
+          LIMB_PAIR(0xD3DCDF09, 0xC086DDD4), LIMB_PAIR(0x1D8FD86B, 0xF28F946C),
+          LIMB_PARTIAL(0x1FF)}},
+        {{LIMB_PAIR(0xAE4622FA, 0x9DDC754C), LIMB_PAIR(0x05C5947F, 0xAC04C429),
+          LIMB_PAIR(0x2DBFB6A4, 0x0B53D6DB), LIMB_PAIR(0x883C6D42, 0x1FB16F7B),
+          LIMB_PAIR(0xE5DBAB18, 0xE38B1745), LIMB_PAIR(0x0087B164, 0xA320F80A),
+          LIMB_PAIR(0x32CD4694, 0x4A5C274F), LIMB_PAIR(0x0855DC1F, 0xE32650C1),
+          LIMB_PARTIAL(0x0CE)},
+         {LIMB_PAIR(0x5997C5B5, 0xF1C1A8C5), LIMB_PAIR(0x2E051A16, 0x3A20FF07),
+          LIMB_PAIR(0x36A4BC59, 0xBAACCCE2), LIMB_PAIR(0x2C407BFD, 0x72AE4A19),
+          LIMB_PAIR(0xC128C710, 0x0ADA1E57), LIMB_PAIR(0xB2D91FF3, 0xF4CE04DB),
+          LIMB_PAIR(0x31FD0538, 0x8616DA87), LIMB_PAIR(0x245B59F8, 0x5C19B57F),
+          LIMB_PARTIAL(0x10B)}},
+        {{LIMB_PAIR(0x84357B3F, 0x44EDF8BE), LIMB_PAIR(0x588059D0, 0xE5DF9129),
+          LIMB_PAIR(0xAB7D5B23, 0x83E65CFA), LIMB_PAIR(0x2121A504, 0x79C2E198),
+          LIMB_PAIR(0xEB3BE7D1, 0xE6A19633), LIMB_PAIR(0x86B85BC4, 0xD9F88695),
+          LIMB_PAIR(0x79F2187C, 0x78508FA2), LIMB_PAIR(0x12254F09, 0xA2EB8FC0),
+          LIMB_PARTIAL(0x0AE)},
+         {LIMB_PAIR(0x2797D3FA, 0xB1A6704E), LIMB_PAIR(0x2C78669F, 0x95B4C268),
+          LIMB_PAIR(0x2997C68D, 0x5294A8E4), LIMB_PAIR(0x4085BAD5, 0x7246B061),
+          LIMB_PAIR(0x4159E5EF, 0x7CA017C2), LIMB_PAIR(0x87D1A013, 0xB8FE1A61),
+          LIMB_PAIR(0x44BC4EA3, 0xDBA0DCDE), LIMB_PAIR(0xA8CE296F, 0x1FDD53C6),
+          LIMB_PARTIAL(0x0FE)}}
+    },
+    {   // (1..8) * 2^(16 * 2) * G
+        {{LIMB_PAIR(0x008C7A44, 0xABF17FEB), LIMB_PAIR(0x7B12DEF4, 0xADE7917A),
+          LIMB_PAIR(0x3786B033, 0xBFBA65B8), LIMB_PAIR(0xF0D9F9F1, 0x8EF4AF44),
+          LIMB_PAIR(0xAB136CAE, 0x8F47615C), LIMB_PAIR(0xBCBD5D3E, 0xE42F100D),
+          LIMB_PAIR(0xF05F9B27, 0x8F3DC658), LIMB_PAIR(0xD6F2DBB2, 0xD95A6B2D),
+          LIMB_PARTIAL(0x08E)},
+         {LIMB_PAIR(0x46BBC412, 0x23BB06A5), LIMB_PAIR(0xD0135EB6, 0x15718699),
+          LIMB_PAIR(0xB4ED9E10, 0x8F1639C4), LIMB_PAIR(0xD7F644A0, 0x767FEE42),
+          LIMB_PAIR(0xFE8EC420, 0x668267B0), LIMB_PAIR(0x64E90133, 0xEC4F5482),
+          LIMB_PAIR(0x536D132B, 0x679E614E), LIMB_PAIR(0x174DF6C5, 0x0D72FBAF),
+          LIMB_PARTIAL(0x0A5)}},
+        {{LIMB_PAIR(0x2DE9B28F, 0xD256B607), LIMB_PAIR(0xCBEFE110, 0x286FC763),
+          LIMB_PAIR(0x138783FB, 0x736FF52A), LIMB_PAIR(0x4EBCD973, 0x6F6D822B),
+          LIMB_PAIR(0x85ECA174, 0x78C5A0B6), LIMB_PAIR(0x79EA21B7, 0xBFCC5AB6),
+          LIMB_PAIR(0x4937E0DA, 0x9CCB278D), LIMB_PAIR(0x2D009304, 0x9F50F442),
+          LIMB_PARTIAL(0x049)},
+         {LIMB_PAIR(0x29F8A798, 0x566947D7), LIMB_PAIR(0x81CC1ED4, 0x9793A905),
+          LIMB_PAIR(0x851115D4, 0x73DA631E), LIMB_PAIR(0xFC7DA6F5, 0xA0B5C181),
+          LIMB_PAIR(0x9F5A7634, 0xA70593D2), LIMB_PAIR(0x1E6250A8, 0xC9F71DF4),
+          LIMB_PAIR(0x7A97CD35, 0x2DFD1089), LIMB_PAIR(0xD4E0074A, 0xC3CDAC7E),
+          LIMB_PARTIAL(0x1FD)}},
+        {{LIMB_PAIR(0x7694F566, 0x8FD8DC49), LIMB_PAIR(0x1FA6E13C, 0xB2AB052D),
+          LIMB_PAIR(0x9AABC7CF, 0x7E4A708E), LIMB_PAIR(0x6B81F0F0, 0x68A9C33A),
+          LIMB_PAIR(0xF1F7CB07, 0x96E4988A), LIMB_PAIR(0xEA264C22, 0xDCA8D731),
+          LIMB_PAIR(0x21B3372F, 0x245371E3), LIMB_PAIR(0x308D2300, 0x02216476),
+          LIMB_PARTIAL(0x17A)},
+         {LIMB_PAIR(0x33696CFD, 0xEBF54116), LIMB_PAIR(0x419623A9, 0xA10C5784),
+          LIMB_PAIR(0x38FA84D5, 0x4C6A119C), LIMB_PAIR(0x6D4E5BAF, 0x5C8EEE64),
+          LIMB_PAIR(0x9B4959D5, 0x7F99D26D), LIMB_PAIR(0x174F417C, 0x58708101),
+          LIMB_PAIR(0x8294B72E, 0x48CAB8F3), LIMB_PAIR(0xD9710F9B, 0x828AAA19),
+          LIMB_PARTIAL(0x192)}},
+        {{LIMB_PAIR(0x02F799D8, 0xAED480E0), LIMB_PAIR(0xD635C04C, 0x021A2F24),
+          LIMB_PAIR(0x004D0ABD, 0xE49A60D8), LIMB_PAIR(0x4D8873BD, 0x58AB8FB0),
+          LIMB_PAIR(0x1ECD98F1, 0xF36A43C8), LIMB_PAIR(0xCD2F93F7, 0x555F15C4),
+          LIMB_PAIR(0x4EB95E03, 0x295D868D), LIMB_PAIR(0xB50553A1, 0x1AA8E425),
+          LIMB_PARTIAL(0x1DE)},
+         {LIMB_PAIR(0x78FCBF33, 0x2EFCE598), LIMB_PAIR(0xF4E93711, 0xC499E9FD),
+          LIMB_PAIR(0x0C6E6FAD, 0x0F5220AD), LIMB_PAIR(0x9FC9DA8C, 0xED0D0A9B),
+          LIMB_PAIR(0xF7813802, 0x84235958), LIMB_PAIR(0x62729B3D, 0xED21398E),
+          LIMB_PAIR(0x3C9BB158, 0xDF6C25AB), LIMB_PAIR(0xEDD78E48, 0x87D306D9),
+          LIMB_PARTIAL(0x085)}},
+        {{LIMB_PAIR(0x7845697D, 0xC661D6FB), LIMB_PAIR(0xAA69C353, 0x324380E1),
+          LIMB_PAIR(0x6961D564, 0x521E96D8), LIMB_PAIR(0xAF58E367, 0xB9D070FF),
+          LIMB_PAIR(0x5AC3B5A2, 0xABD851DF), LIMB_PAIR(0x530BAAEF, 0xEBC0BEF2),
+          LIMB_PAIR(0x358627A2, 0x054BF32B), LIMB_PAIR(0xA205B0CB, 0x0AB65C3A),
+          LIMB_PARTIAL(0x157)},
+         {LIMB_PAIR(0xA74CEC0E, 0x586C331E), LIMB_PAIR(0x2ECC3900, 0x2808851D),
+          LIMB_PAIR(0x8003E820, 0x0A695392), LIMB_PAIR(0x81FC784E, 0xA667A7B0),
+          LIMB_PAIR(0xF33BBD74, 0x64EDDA2D), LIMB_PAIR(0x29FF01CA, 0x13EE0437),
+          LIMB_PAIR(0x4EC28C03, 0x9192138C), LIMB_PAIR(0xD4E0F79C, 0x3DE5FC2B),
+          LIMB_PARTIAL(0x096)}},
+        {{LIMB_PAIR(0x22E41E28, 0x8EBA86B8), LIMB_PAIR(0x9D7A7103, 0xC26F7CAF),
+          LIMB_PAIR(0xE462090E, 0x5D0F792F), LIMB_PAIR(0xD18BB44B, 0xA5F8C81E),
+          LIMB_PAIR(0x3E291040, 0x2E4E6E57), LIMB_PAIR(0x0A9F9660, 0xE347369D),
+          LIMB_PAIR(0x3A680D61, 0x63BED10D), LIMB_PAIR(0xB03CCA7B, 0x8590210E),
+          LIMB_PARTIAL(0x063)},
+         {LIMB_PAIR(0x5322914B, 0xF8D8536F), LIMB_PAIR(0xC179FC5C, 0x26E2D5AC),
+          LIMB_PAIR(0xCC606124, 0xC7181A3F), LIMB_PAIR(0x474896C7, 0x7770DA72),
+          LIMB_PAIR(0xB25FB526, 0x2AAC427C), LIMB_PAIR(0x6C1F1086, 0xB3FCF016),
+          LIMB_PAIR(0xB67643B9, 0x14F06DD7), LIMB_PAIR(0x9E8C2F78, 0x5BF94287),
+          LIMB_PARTIAL(0x110)}},
+        {{LIMB_PAIR(0x95051804, 0xA09523FF), LIMB_PAIR(0xC6EF7FBA, 0xC4B33367),
+          LIMB_PAIR(0x292CD05C, 0x388C5AA3), LIMB_PAIR(0xDD93715E, 0xAE1B2CCE),
+          LIMB_PAIR(0x70D39632, 0xED7F02BE), LIMB_PAIR(0xD5169F74, 0xA9DB568E),
+          LIMB_PAIR(0xAEB2F9CC, 0x6EB4424E), LIMB_PAIR(0x78FC446A, 0x358F1F27),
+          LIMB_PARTIAL(0x0D7)},
+         {LIMB_PAIR(0x67694CA1, 0x3A4E0F64), LIMB_PAIR(0x2B1F54EE, 0xF50A6D56),
+          LIMB_PAIR(0x9BEF1F78, 0xCA01350C), LIMB_PAIR(0xC6237D11, 0x778A4C6B),
+          LIMB_PAIR(0xA79F4C15, 0x270ED37A), LIMB_PAIR(0xC6D4ACDF, 0x4E38060B),
+          LIMB_PAIR(0x1CEB1CCC, 0x5D39BA1C), LIMB_PAIR(0xE6D621C2, 0x94AB7FBA),
+          LIMB_PARTIAL(0x1A4)}},
+        {{LIMB_PAIR(0xAA9A08AB, 0xA0BEDE1B), LIMB_PAIR(0x1FC48289, 0xA3236453),
+          LIMB_PAIR(0x8C4E95C5, 0x27F83D5A), LIMB_PAIR(0xA98B2122, 0xD4E05998),
+          LIMB_PAIR(0x7D51821B, 0xE4118AEC), LIMB_PAIR(0x883CE4E9, 0x18AE6C6A),
+          LIMB_PAIR(0x0D65E4AF, 0x686D2A6E), LIMB_PAIR(0x68D87702, 0xCE00C727),
+          LIMB_PARTIAL(0x04B)},
+         {LIMB_PAIR(0x4C0B4B11, 0x8C8C0C98), LIMB_PAIR(0x977E63AA, 0x09C31A00),
+          LIMB_PAIR(0x42100B94, 0x1999F206), LIMB_PAIR(0xC4F0CF33, 0x7314DF12),
+          LIMB_PAIR(0x5F5DA290, 0x0BB59F1A), LIMB_PAIR(0x03D4FD95, 0xF08E85BC),
+          LIMB_PAIR(0xD6FB0524, 0xCB0B361F), LIMB_PAIR(0xF35D713F, 0x9192A173),
+          LIMB_PARTIAL(0x0B6)}}
+    },
+    {   // (1..8) * 2^(16 * 3) * G
+        {{LIMB_PAIR(0x1C3BE7EF, 0x62B63169), LIMB_PAIR(0x8074207D, 0xDAB254BF),
+          LIMB_PAIR(0x235A4C77, 0xF6F1466B), LIMB_PAIR(0xD3B01424, 0x66F8F60F),
+          LIMB_PAIR(0x3BAE9F80, 0x9DA54069), LIMB_PAIR(0x500F8A6C, 0x1A840763),
+          LIMB_PAIR(0xB25994B1, 0x542E2DD9), LIMB_PAIR(0x183B3CEE, 0x996307E5),
+          LIMB_PARTIAL(0x06E)},
+         {LIMB_PAIR(0xA4B301ED, 0x45E2AE85), LIMB_PAIR(0xE1FB6112, 0x0640D46D),
+          LIMB_PAIR(0x83FC8F4B, 0x7F102D19), LIMB_PAIR(0x4F30038E, 0x6EEECE3A),
+          LIMB_PAIR(0x912F39C3, 0x74D062F5), LIMB_PAIR(0x16906C7B, 0xA802A553),
+          LIMB_PAIR(0xE6D6E8C1, 0xA8D8C58F), LIMB_PAIR(0xA57B4387, 0x77CFD9BC),
+          LIMB_PARTIAL(0x1F0)}},
+        {{LIMB_PAIR(0x4268E7AC, 0x3B61C320), LIMB_PAIR(0x6DD3709F, 0xF9FEF197),
+          LIMB_PAIR(0x51F7146D, 0xABD3A2D5), LIMB_PAIR(0xF40188F9, 0x4C03D266),
+          LIMB_PAIR(0x088BAE58, 0x56E27DFD), LIMB_PAIR(0x03FA2B77, 0x5BA4660D),
+          LIMB_PAIR(0xA39FF216, 0x56889642), LIMB_PAIR(0xCA849201, 0xC11B9FEA),
+          LIMB_PARTIAL(0x07E)},
+         {LIMB_PAIR(0x1DBCA40D, 0x357C7797), LIMB_PAIR(0x6D3C6441, 0x23C449C2),
+          LIMB_PAIR(0x26CA2D6E, 0x6AD3B6A6), LIMB_PAIR(0xB2CA4AA6, 0x32CADCB3),
+          LIMB_PAIR(0xAD004AA8, 0xDDDC43E5), LIMB_PAIR(0x37600864, 0x7994E3AB),
+          LIMB_PAIR(0x76E4580E, 0xF09F2639), LIMB_PAIR(0xA270CD54, 0x6A2032A0),
+          LIMB_PARTIAL(0x17A)}},
+        {{LIMB_PAIR(0x8EAC672F, 0x2FA8A511), LIMB_PAIR(0x18B28A2F, 0xB58FE9A2),
+          LIMB_PAIR(0x69CB28AE, 0x0DB617AD), LIMB_PAIR(0xADCC6220, 0xAC90B7D8),
+          LIMB_PAIR(0x852A7529, 0x3113C468), LIMB_PAIR(0xDF7CF5CB, 0xAAC72C21),
+          LIMB_PAIR(0xE341E2CD, 0x3C1DAFAB), LIMB_PAIR(0x68E9CBF2, 0x8AECF2A3),
+          LIMB_PARTIAL(0x149)},
+         {LIMB_PAIR(0xC3ACFC2F, 0x1461A475), LIMB_PAIR(0x0CF6C4E7, 0x53EE5E37),
+          LIMB_PAIR(0xD20FCD4A, 0xBC89CD30), LIMB_PAIR(0x3CB0B266, 0xABF7AB38),
+          LIMB_PAIR(0xCF12EEC3, 0x6030727C), LIMB_PAIR(0x90F159A3, 0x9B3E7CB7),
+          LIMB_PAIR(0xB364C651, 0x60DDDE88), LIMB_PAIR(0x0FDE7B06, 0xA575474E),
+          LIMB_PARTIAL(0x0B2)}},
+        {{LIMB_PAIR(0x569614A3, 0x598766CE), LIMB_PAIR(0xD485CC29, 0xFC1534F1),
+          LIMB_PAIR(0x4F099A45, 0x1F5E87CE), LIMB_PAIR(0x387D4D84, 0x93E6071F),
+          LIMB_PAIR(0xA130F8BC, 0xA3F72298), LIMB_PAIR(0xEDD37225, 0x51372018),
+          LIMB_PAIR(0xB856F72D, 0x165340E9), LIMB_PAIR(0x9011BC47, 0x4D64EC74),
+          LIMB_PARTIAL(0x04C)},
+         {LIMB_PAIR(0x5B62D194, 0x975D2C0D), LIMB_PAIR(0x1BBD10BD, 0x845D25CB),
+          LIMB_PAIR(0x42EE849A, 0x1326F9D7), LIMB_PAIR(0xA333154C, 0x61F90228),
+          LIMB_PAIR(0x7500F71E, 0x4993F33D), LIMB_PAIR(0x1B6DCF4E, 0x3824DC40),
+          LIMB_PAIR(0xB65B8ECA, 0x1C71E193), LIMB_PAIR(0xDCA1396B, 0xA8DDC0C7),
+          LIMB_PARTIAL(0x1A3)}},
+        {{LIMB_PAIR(0x9D906490, 0x0DD159BF), LIMB_PAIR(0x9CF878DE, 0xF3167E2C),
+          LIMB_PAIR(0x9FE4E683, 0xB2BCE411), LIMB_PAIR(0xE82D628A, 0x1F7EDC9A),
+          LIMB_PAIR(0xCD23E4DF, 0xCF4A33AD), LIMB_PAIR(0x21CBFAF7, 0xC0A49058),
+          LIMB_PAIR(0x635E858E, 0x192FB797), LIMB_PAIR(0x325E6C47, 0x68DAD953),
+          LIMB_PARTIAL(0x0B7)},
+         {LIMB_PAIR(0x14E26CC9, 0x662DF578), LIMB_PAIR(0xC83FC419, 0x601A649F),
+          LIMB_PAIR(0xC80CFB85, 0x1AFE2549), LIMB_PAIR(0x0B949F46, 0xEF38EB32),
+          LIMB_PAIR(0x7B42E487, 0x5FDF3664), LIMB_PAIR(0xD509DF41, 0x7073C6AF),
+          LIMB_PAIR(0x066A0911, 0x7CB9E459), LIMB_PAIR(0x946811E0, 0xE397A29C),
+          LIMB_PARTIAL(0x08E)}},
+        {{LIMB_PAIR(0xA9C350AF, 0x35A51EEB), LIMB_PAIR(0x6097710D, 0x22821A63),
+          LIMB_PAIR(0x5F6EE6E1, 0xF5A5C2C9), LIMB_PAIR(0x69599BA9, 0x8F9F2012),
+          LIMB_PAIR(0x12918EA9, 0xED36867F), LIMB_PAIR(0x0EA832E9, 0xF1A5450D),
+          LIMB_PAIR(0x1E15E027, 0x58C5A731), LIMB_PAIR(0x00416B3D, 0x5A6460D6),
+          LIMB_PARTIAL(0x198)},
+         {LIMB_PAIR(0xCF8C23F6, 0xA0AFB24F), LIMB_PAIR(0x2D40BCA9, 0xDD6966EB),
+          LIMB_PAIR(0xBF132AB2, 0x7C8D20AA), LIMB_PAIR(0x7D32B64D, 0xC24EFB7D),
+          LIMB_PAIR(0x0C9547F5, 0x26D79338), LIMB_PAIR(0x1FB47F5A, 0x7E7D6225),
+          LIMB_PAIR(0x9A488725, 0xF1F5880D), LIMB_PAIR(0x38749037, 0x8EC9740D),
+          LIMB_PARTIAL(0x030)}},
+        {{LIMB_PAIR(0xB7C2CF3B, 0x40BC7A65), LIMB_PAIR(0x23C30518, 0x5043C6C7),
+          LIMB_PAIR(0x44DE8A14, 0xE7F93C65), LIMB_PAIR(0x89ED4019, 0x5F8B4F4E),
+          LIMB_PAIR(0x96F258D4, 0x52D6E1F5), LIMB_PAIR(0xBF255616, 0x23749D1D),
+          LIMB_PAIR(0xAA7F5F1E, 0xE03FEB69), LIMB_PAIR(0x0C563D0F, 0xDB07A6A9),
+          LIMB_PARTIAL(0x163)},
+         {LIMB_PAIR(0x9DF56623, 0xD4029081), LIMB_PAIR(0xC125A069, 0x18B71B89),
+          LIMB_PAIR(0xB7C6D7DD, 0xC4F119F0), LIMB_PAIR(0xE05C3E73, 0xE6588CF4),
+          LIMB_PAIR(0x876F22F1, 0x0CBC6A79), LIMB_PAIR(0xE6EEAEDC, 0xBF99DE26),
+          LIMB_PAIR(0x1B6ABA38, 0x9AA4741C), LIMB_PAIR(0xCE3A2DD3, 0xF7CC38A4),
+          LIMB_PARTIAL(0x19B)}},
+        {{LIMB_PAIR(0x4CA94CE3, 0x7BAD211D), LIMB_PAIR(0xD66CC144, 0x7B7BED87),
+          LIMB_PAIR(0xBB5EE0CE, 0x7EBA714B), LIMB_PAIR(0xF5EB8337, 0xC26E3A3C),
+          LIMB_PAIR(0x3DFEC21F, 0xE5C61798), LIMB_PAIR(0x117BA62A, 0x9C679E26),
+          LIMB_PAIR(0x1B6E1641, 0x6D67DB8C), LIMB_PAIR(0xE31C06D5, 0x1C2E077E),
+          LIMB_PARTIAL(0x1A2)},
+         {LIMB_PAIR(0xCDC2D75C, 0xC0D71279), LIMB_PAIR(0x09371B29, 0x0B15B147),
+          LIMB_PAIR(0xDC2CEB6C, 0xBA1F3359), LIMB_PAIR(0xBE25DAD5, 0x9A701873),
+          LIMB_PAIR(0xC8BFE287, 0x03C466B8), LIMB_PAIR(0x41EC3009, 0x9697F329),
+          LIMB_PAIR(0xB4A54990, 0x4E21E900), LIMB_PAIR(0xA99D3093, 0xEE1B53C8),
+          LIMB_PARTIAL(0x0D5)}}
+    },
+    {   // (1..8) * 2^(16 * 4) * G
+        {{LIMB_PAIR(0x689DBE3C, 0x94A182E2), LIMB_PAIR(0x02610256, 0x2D8EE166),
+          LIMB_PAIR(0xE6294291, 0x4D0CB259), LIMB_PAIR(0x0A7FCF2D, 0x244DB120),
+          LIMB_PAIR(0x8F58F3AF, 0xB50D34B0), LIMB_PAIR(0x13275075, 0x2AD4B9EC),
+          LIMB_PAIR(0xC96BFCFA, 0xA19BECCF), LIMB_PAIR(0x86F5BAF0, 0x1A5509DA),
+          LIMB_PARTIAL(0x185)},
+         {LIMB_PAIR(0x5AC043E6, 0xEFE1469C), LIMB_PAIR(0x7D273130, 0xC86B7721),
+          LIMB_PAIR(0x2606809A, 0x2324AF0C), LIMB_PAIR(0x21800FCB, 0x33A3324E),
+          LIMB_PAIR(0xA6B0D999, 0x8A38F30F), LIMB_PAIR(0xD038B182, 0x12DB51D0),
+          LIMB_PAIR(0xB3490FF5, 0x53CA86CC), LIMB_PAIR(0x7A935163, 0x2ECD7ECF),
+          LIMB_PARTIAL(0x16F)}},
+        {{LIMB_PAIR(0x4B374FF4, 0xF192B016), LIMB_PAIR(0x125FD529, 0x3AADED48),
+          LIMB_PAIR(0x5DFA717D, 0x57484AC4), LIMB_PAIR(0xA4B4E41E, 0x815B6549),
+          LIMB_PAIR(0x3153D4AF, 0xE230EA49), LIMB_PAIR(0x77769A23, 0xBD883B12),
+          LIMB_PAIR(0xAD605E32, 0xAE58965E), LIMB_PAIR(0x77179455, 0x4CC9CFCF),
+          LIMB_PARTIAL(0x0A5)},
+         {LIMB_PAIR(0x3F30741F, 0x5CFE2EA4), LIMB_PAIR(0x2565E3D7, 0x79C512A5),
+          LIMB_PAIR(0xAEA005BD, 0x9A4075AD), LIMB_PAIR(0x7FCA076D, 0x6B259327),
+          LIMB_PAIR(0x166A3678, 0x1EA80148), LIMB_PAIR(0xD75FDA30, 0x25075D36),
+          LIMB_PAIR(0xAD53E052, 0xD9F2BBA9), LIMB_PAIR(0x182AC606, 0x04FC6ADC),
+          LIMB_PARTIAL(0x090)}},
+        {{LIMB_PAIR(0xAA283027, 0xBB3CB4DA), LIMB_PAIR(0x4637A686, 0xB3284A11),
+          LIMB_PAIR(0x8D4D1678, 0x2F675F37), LIMB_PAIR(0x6BCE4A50, 0x4D2B46FE),
+          LIMB_PAIR(0x583AD60D, 0x65E0D06D), LIMB_PAIR(0x525EA4B7, 0xA897D633),
+          LIMB_PAIR(0x42BB371C, 0xE2AA9FCC), LIMB_PAIR(0xDD500E47, 0x8F91D296),
+          LIMB_PARTIAL(0x1BE)},
+         {LIMB_PAIR(0xAF7965F1, 0xC43C6CFF), LIMB_PAIR(0xA63638DF, 0x116C957C),
+          LIMB_PAIR(0xE5A3F8A7, 0x80C1361B), LIMB_PAIR(0xCC9582D3, 0xA1F87ABE),
+          LIMB_PAIR(0x2BEF1FF9, 0xD47BC010), LIMB_PAIR(0xF3FE712A, 0xDB660935),
+          LIMB_PAIR(0xCC584A15, 0x8CC56DCF), LIMB_PAIR(0xA035F2EF, 0x27984274),
+          LIMB_PARTIAL(0x19C)}},
+        {{LIMB_PAIR(0x0F0CCB51, 0x80398667), LIMB_PAIR(0x3654974A, 0xB87E1D01),
+          LIMB_PAIR(0xB2B29ED9, 0x7F58CF21), LIMB_PAIR(0xA3ADD337, 0x06C0E9AA),
+          LIMB_PAIR(0xE9D08FFB, 0xF13B35D0), LIMB_PAIR(0x96761627, 0xDD8BF44C),
+          LIMB_PAIR(0x758A3EF4, 0xA4A18C14), LIMB_PAIR(0xA0043ADB, 0x96A576DD),
+          LIMB_PARTIAL(0x13E)},
+         {LIMB_PAIR(0x632D95A3, 0x2BDE24F8), LIMB_PAIR(0x4C524829, 0x79F15EF1),
+          LIMB_PAIR(0x9BDABA19, 0xAADD863E), LIMB_PAIR(0xA962B707, 0xDDE053F4),
+          LIMB_PAIR(0x14258D98, 0xC598A2DE), LIMB_PAIR(0x061C235C, 0x9FA5A19D),
+          LIMB_PAIR(0xE8FFD32C, 0x0ED46510), LIMB_PAIR(0xEF78CEAC, 0x2AEA9DD1),
+          LIMB_PARTIAL(0x185)}},
+        {{LIMB_PAIR(0xB329F7D3, 0x2BB9D8B5), LIMB_PAIR(0x569EBA9B, 0x7E561B23),
+          LIMB_PAIR(0x09B7BCA0, 0x65FDAE93), LIMB_PAIR(0xEF327916, 0xF4206737),
+          LIMB_PAIR(0x8F7B2113, 0x2963CD69), LIMB_PAIR(0x9CC9532F, 0x3B22A38A),
+          LIMB_PAIR(0xB31DEF2F, 0x455C3790), LIMB_PAIR(0x931E5346, 0x9A6CCCD5),
+          LIMB_PARTIAL(0x0E6)},
+         {LIMB_PAIR(0x981C49A8, 0xE9860742), LIMB_PAIR(0xDAC58CFB, 0xC6BBFFEF),
+          LIMB_PAIR(0x7DCBBFA6, 0xF28CA98C), LIMB_PAIR(0x3E512F79, 0x6A53C5D4),
+          LIMB_PAIR(0xFEE0577D, 0x072D38F9), LIMB_PAIR(0x0B2260D2, 0x75FC677E),
+          LIMB_PAIR(0x8E97C4B8, 0xE1CE6A18), LIMB_PAIR(0x3D3B1E4A, 0x48308DFF),
+          LIMB_PARTIAL(0x109)}},
+        {{LIMB_PAIR(0xD19F496E, 0xD389B38C), LIMB_PAIR(0xDC520FB4, 0x9868052F),
+          LIMB_PAIR(0xBF6E877E, 0x698B397E), LIMB_PAIR(0x15D39A80, 0x7896E7AC),
+          LIMB_PAIR(0x057CE533, 0x3EECC9B5), LIMB_PAIR(0x001509B4, 0x00F6CFC7),
+          LIMB_PAIR(0xE01E25F6, 0x8C2C3D6E), LIMB_PAIR(0x0DD1056A, 0xF64A3E27),
+          LIMB_PARTIAL(0x0F4)},
+         {LIMB_PAIR(0xBA1BDE97, 0x192245F8), LIMB_PAIR(0x41E87ACC, 0xB68AA037),
+          LIMB_PAIR(0x49D24C74, 0x849CB6E4), LIMB_PAIR(0x2569DE67, 0x93C36F75),
+          LIMB_PAIR(0x30AD91A4, 0x93542A56), LIMB_PAIR(0xCD021165, 0xA802F2BF),
+          LIMB_PAIR(0xCECD5CDC, 0xF3EB185F), LIMB_PAIR(0xAE520746, 0x42EF43D9),
+          LIMB_PARTIAL(0x185)}},
+        {{LIMB_PAIR(0x70A75215, 0xCC39400A), LIMB_PAIR(0x7EBE4792, 0xD237B407),
+          LIMB_PAIR(0xD20C2507, 0xB2CF5C3B), LIMB_PAIR(0xDAA4C46D, 0xE7B00E11),
+          LIMB_PAIR(0x38CEC7A9, 0xA576029D), LIMB_PAIR(0xB05E1375, 0x699005E7),
+          LIMB_PAIR(0xF1B051BC, 0xB88D5837), LIMB_PAIR(0x44630F00, 0x054F8ABB),
+          LIMB_PARTIAL(0x060)},
+         {LIMB_PAIR(0xDA2BB0C3, 0xE53A8D17), LIMB_PAIR(0xAE7BDB56, 0xCFDD266C),
+          LIMB_PAIR(0xDB11C9B9, 0xD9551CEB), LIMB_PAIR(0x1FC5B3D0, 0x1A11AC22),
+          LIMB_PAIR(0xE161A118, 0x63056E13), LIMB_PAIR(0xF76B5E73, 0xDFD99567),
+          LIMB_PAIR(0x836F2217, 0x7F5F7283), LIMB_PAIR(0xAC0C57E8, 0x8323F67F),
+          LIMB_PARTIAL(0x01A)}},
+        {{LIMB_PAIR(0xEB5A169A, 0x2838CDBF), LIMB_PAIR(0xE1505D76, 0x25C826C4),
+          LIMB_PAIR(0xC512FAF2, 0x2D5B0FF8), LIMB_PAIR(0x1E5CD6D6, 0xCF831E69),
+          LIMB_PAIR(0xAF5EDA1F, 0x4540775C), LIMB_PAIR(0x5AD5605E, 0x4F4514DA),
+          LIMB_PAIR(0x2F87CFDF, 0x8472B1AE), LIMB_PAIR(0x9E338CE6, 0x07C8CBCC),
+          LIMB_PARTIAL(0x14D)},
+         {LIMB_PAIR(0xD9243216, 0x096AB718), LIMB_PAIR(0xE37CFF51, 0xE966635F),
+          LIMB_PAIR(0x0586EBBC, 0xCED8FB11), LIMB_PAIR(0x86ABE6F4, 0x3216D6AF),
+          LIMB_PAIR(0x1B77F4E2, 0x37392A30), LIMB_PAIR(0xB8EF62B3, 0xECC903AF),
+          LIMB_PAIR(0xFD74231E, 0x0453DC44), LIMB_PAIR(0x57895508, 0x3CB3927B),
+          LIMB_PARTIAL(0x13C)}}
+    },
+    {   // (1..8) * 2^(16 * 5) * G
+        {{LIMB_PAIR(0x81128A65, 0x620AFF9A), LIMB_PAIR(0xD6A9D2C1, 0xA463FFE7),
+          LIMB_PAIR(0xDD4810EF, 0x2206277A), LIMB_PAIR(0xDD0687CA, 0x413EDD73),
+          LIMB_PAIR(0x249CEF0A, 0xF4B12EC9), LIMB_PAIR(0xC4B165CF, 0x14DD6665),
+          LIMB_PAIR(0xC5C070C3, 0x0CF86A23), LIMB_PAIR(0x84755F2C, 0x42354FE9),
+          LIMB_PARTIAL(0x131)},
+         {LIMB_PAIR(0x2E9C881E, 0x6F4741DF), LIMB_PAIR(0x43F26343, 0x2656911D),
+          LIMB_PAIR(0x1C82E8E5, 0xEBAE8AE4), LIMB_PAIR(0xF3900776, 0xCEB1CA37),
+          LIMB_PAIR(0x16721332, 0x07F2F8FE), LIMB_PAIR(0xAAD4911B, 0x59265673),
+          LIMB_PAIR(0xFC3BDA3F, 0xE8799EAB), LIMB_PAIR(0xFD073355, 0x55805723),
+          LIMB_PARTIAL(0x088)}},
+        {{LIMB_PAIR(0x7CE70EDF, 0x2B14935A), LIMB_PAIR(0xE3C6F5A6, 0x1D88D30E),
+          LIMB_PAIR(0x207E5973, 0xAA6220DE), LIMB_PAIR(0x64B5E637, 0x692B3FF0),
+          LIMB_PAIR(0xFF0EB748, 0x04C9DDC8), LIMB_PAIR(0x44978142, 0x9E5EC39E),
+          LIMB_PAIR(0xFA674339, 0x9CC06266), LIMB_PAIR(0xDD3E430D, 0xE0D13DCD),
+          LIMB_PARTIAL(0x1ED)},
+         {LIMB_PAIR(0xF38BD4CE, 0x74604722), LIMB_PAIR(0x49DA70F3, 0x473E4D35),
+          LIMB_PAIR(0x07D72EFC, 0x12288755), LIMB_PAIR(0x0A7521DE, 0xDF89A505),
+          LIMB_PAIR(0x4C1A6866, 0x67417656), LIMB_PAIR(0x3F7A0EAD, 0xE2C33023),
+          LIMB_PAIR(0xA7474DC1, 0x5E100468), LIMB_PAIR(0xDCC02D45, 0xA47CA1A5),
+          LIMB_PARTIAL(0x01B)}},
+        {{LIMB_PAIR(0xD7C3E500, 0x79B40005), LIMB_PAIR(0xA7CBE47D, 0x99957461),
+          LIMB_PAIR(0x53A81EEB, 0x1DBA911D), LIMB_PAIR(0x54CAC621, 0x50049C2A),
+          LIMB_PAIR(0x5C8458C0, 0xC3052CE6), LIMB_PAIR(0x5CD9822E, 0xD4E4CC28),
+          LIMB_PAIR(0x9C89113B, 0xA64BD2BA), LIMB_PAIR(0x24A9A360, 0x616F47F3),
+          LIMB_PARTIAL(0x000)},
+         {LIMB_PAIR(0x36BB95E6, 0xB309B385), LIMB_PAIR(0xEEB3AF75, 0xF7808DA5),
+          LIMB_PAIR(0xFFEF855A, 0xC9EB3A68), LIMB_PAIR(0xDA981F49, 0x0D7C5382),
+          LIMB_PAIR(0x5A29FE14, 0x2176630E), LIMB_PAIR(0x4B6DD847, 0x7C59C56F),
+          LIMB_PAIR(0x15C998CD, 0x363FC081), LIMB_PAIR(0x1C0E00D7, 0x28B9018E),
+          LIMB_PARTIAL(0x09C)}},
+        {{LIMB_PAIR(0x2C51AB39, 0xC9D22D53), LIMB_PAIR(0x2F02748E, 0x0BB42C88),
+          LIMB_PAIR(0x47E18934, 0x576C89C8), LIMB_PAIR(0xB9513257, 0xF34CDC49),
+          LIMB_PAIR(0x9ED107A2, 0xAF97DF12), LIMB_PAIR(0xEEAD8F82, 0x860263DA),
+          LIMB_PAIR(0xFE11C289, 0x6147D39B), LIMB_PAIR(0xF41158F1, 0x3B94B3EB),
+          LIMB_PARTIAL(0x113)},
+         {LIMB_PAIR(0xF747D887, 0xC4C84D7C), LIMB_PAIR(0xF71F1726, 0x9A54F1A2),
+          LIMB_PAIR(0xDAF5817F, 0xB4A79290), LIMB_PAIR(0x7893855D, 0x33DD5DF8),
+          LIMB_PAIR(0xF6953979, 0x567A1293), LIMB_PAIR(0x0EAC5025, 0xF0C76BB6),
+          LIMB_PAIR(0xBB498D81, 0x863FC87A), LIMB_PAIR(0xE9B3C11D, 0xF5D4E58E),
+          LIMB_PARTIAL(0x16A)}},
+        {{LIMB_PAIR(0x96F52213, 0xF02EBE95), LIMB_PAIR(0x62F9F1E9, 0x2ABA2DFC),
+          LIMB_PAIR(0x934EF9F0, 0x7BBDDE57), LIMB_PAIR(0xA417AF58, 0xD5C7882E),
+          LIMB_PAIR(0xDCDF7815, 0x55CDFE89), LIMB_PAIR(0x8470A435, 0xF79051B1),
+          LIMB_PAIR(0x7E8593E8, 0x364DA0AA), LIMB_PAIR(0x975A5F81, 0x02C3D160),
+          LIMB_PARTIAL(0x034)},
+         {LIMB_PAIR(0xCCD37734, 0x59493183), LIMB_PAIR(0xE645E991, 0x085A8CD2),
+          LIMB_PAIR(0x8C4B4A86, 0x2D54D266), LIMB_PAIR(0x7B4079BE, 0x96CF84CF),
+          LIMB_PAIR(0xBA683F56, 0x4ABADE40), LIMB_PAIR(0xB5457B07, 0xFB29C00B),
+          LIMB_PAIR(0x92AE7F9B, 0x6ED5FD35), LIMB_PAIR(0xB5A9D039, 0xB1F1A25F),
+          LIMB_PARTIAL(0x0CA)}},
+        {{LIMB_PAIR(0x0C7723E0, 0x6503932F), LIMB_PAIR(0xA8934788, 0xD185AF25),
+          LIMB_PAIR(0x792232F4, 0x5BC1660C), LIMB_PAIR(0xC2CCD476, 0xCFB04AAB),
+          LIMB_PAIR(0x16844FE7, 0x59E84FEE), LIMB_PAIR(0x09C31AD5, 0x736C2CD8),
+          LIMB_PAIR(0x99058585, 0xDF442154), LIMB_PAIR(0xC3F2B46E, 0xF3B79464),
+          LIMB_PARTIAL(0x1D3)},
+         {LIMB_PAIR(0x089E2E4F, 0x282464C7), LIMB_PAIR(0x17D8EEE1, 0xBE9D0BFA),
+          LIMB_PAIR(0xFCF3E876, 0x7934AED1), LIMB_PAIR(0xD4E606B9, 0x76465104),
+          LIMB_PAIR(0xFA4412CB, 0xF114EFB4), LIMB_PAIR(0xF1FC8480, 0x8F9F32D2),
+          LIMB_PAIR(0x5C340A29, 0x2879C785), LIMB_PAIR(0xD570BCEF, 0x3D28E8A7),
+          LIMB_PARTIAL(0x178)}},
+        {{LIMB_PAIR(0xD326FFB6, 0x8ACD524B), LIMB_PAIR(0x9E731029, 0x4A1091A3),
+          LIMB_PAIR(0x600D299A, 0xB056D998), LIMB_PAIR(0xB78EBF7F, 0xFB695C26),
+          LIMB_PAIR(0x73CC7F48, 0x2B83E30C), LIMB_PAIR(0x4BCB6645, 0xF2364E61),
+          LIMB_PAIR(0x837638C3, 0x6A707650), LIMB_PAIR(0x21528A26, 0x6D1652BF),
+          LIMB_PARTIAL(0x034)},
+         {LIMB_PAIR(0x6D2B8FC3, 0x353DC81F), LIMB_PAIR(0x8627A2E4, 0xFD300391),
+          LIMB_PAIR(0x1179264C, 0x5F7C2565), LIMB_PAIR(0xAF46D535, 0x69856301),
+          LIMB_PAIR(0x16F35CBC, 0xDFCD6CBD), LIMB_PAIR(0x4FE07645, 0x5D2268FB),
+          LIMB_PAIR(0x29CAC6AA, 0x2CA719DD), LIMB_PAIR(0x8CBE9556, 0x9F8FCB72),
+          LIMB_PARTIAL(0x17C)}},
+        {{LIMB_PAIR(0xEEA8D666, 0x20084293), LIMB_PAIR(0x12780DED, 0x01AFA6AE),
+          LIMB_PAIR(0x5B79D11C, 0xDBCE851A), LIMB_PAIR(0x09B895B3, 0x280A43A0),
+          LIMB_PAIR(0x77C59C03, 0x95C92E1A), LIMB_PAIR(0x6B9EC1B8, 0xD9960637),
+          LIMB_PAIR(0x7BEACE14, 0x08C0BB00), LIMB_PAIR(0xEB76C9BE, 0xD0BA7943),
+          LIMB_PARTIAL(0x1B6)},
+         {LIMB_PAIR(0x15A51540, 0xA14D2A3F), LIMB_PAIR(0x7211BA73, 0xFD25FFCB),
+          LIMB_PAIR(0xCBEEDFAC, 0x020EFE82), LIMB_PAIR(0xAA5301E5, 0xDC5B6591),
+          LIMB_PAIR(0xE1708393, 0x25D3413F), LIMB_PAIR(0xB0A1E5CF, 0x9A3FFF34),
+          LIMB_PAIR(0xD310F9AE, 0x1892F1B7), LIMB_PAIR(0x9DF3548D, 0x3EC31F62),
+          LIMB_PARTIAL(0x17C)}}
+    },
+    {   // (1..8) * 2^(16 * 6) * G
+        {{LIMB_PAIR(0x2FEDA8AC, 0x336B0622), LIMB_PAIR(0x0C0B391C, 0x4658AE22),
+          LIMB_PAIR(0x1F2119D0, 0xE12F058F), LIMB_PAIR(0x495525A1, 0xA1F96C94),
+          LIMB_PAIR(0xCD7D9F17, 0x32EFC7AE), LIMB_PAIR(0xBEA7A5EB, 0x34E4FE2A),
+          LIMB_PAIR(0x7135C5F5, 0x0EFD2492), LIMB_PAIR(0xB83241FF, 0xD7A04EB2),
+          LIMB_PARTIAL(0x036)},
+         {LIMB_PAIR(0x9CA40933, 0xF11B8E76), LIMB_PAIR(0xD06857C8, 0x1951CD54),
+          LIMB_PAIR(0x29F13914, 0x0E9124F6), LIMB_PAIR(0x3D67D0CD, 0xE6EBBBE3),
+          LIMB_PAIR(0xBF16F9C2, 0x5483A2BC), LIMB_PAIR(0x255EA8CA, 0xD4E4EA52),
+          LIMB_PAIR(0x734EEF50, 0xEE0DB0B5), LIMB_PAIR(0x16207775, 0x54434B51),
+          LIMB_PARTIAL(0x017)}},
+        {{LIMB_PAIR(0xA597628A, 0xE67AD2A7), LIMB_PAIR(0x47DEB6B6, 0x424DFE89),
+          LIMB_PAIR(0x0ECACA8E, 0x42669BDC), LIMB_PAIR(0xD86F6549, 0xAE7A2F64),
+          LIMB_PAIR(0x652A2E24, 0x3858F56B), LIMB_PAIR(0x50291825, 0x8E5611A6),
+          LIMB_PAIR(0x20FEB545, 0x21C20611), LIMB_PAIR(0xCD63163A, 0x4E550A9E),
+          LIMB_PARTIAL(0x05F)},
+         {LIMB_PAIR(0xB3B110BC, 0x4FABBB26), LIMB_PAIR(0x036DE290, 0xEBE74805),
+          LIMB_PAIR(0x33789748, 0xDE88D2D6), LIMB_PAIR(0xDBF7865D, 0x56A1B7B8),
+          LIMB_PAIR(0xE8707CF0, 0x0646D53D), LIMB_PAIR(0x64108A0B, 0xCFB67FAE),
+          LIMB_PAIR(0xA32160EE, 0x04F1401B), LIMB_PAIR(0x5F462A78, 0x5998552D),
+          LIMB_PARTIAL(0x056)}},
+        {{LIMB_PAIR(0x7B1A7381, 0x44D1DCB6), LIMB_PAIR(0x541488C5, 0x88AF97D4),
+          LIMB_PAIR(0xE065E612, 0x6D9DFF01), LIMB_PAIR(0x20E73756, 0x61FBE70F),
+          LIMB_PAIR(0x41379C43, 0x493B9080), LIMB_PAIR(0x8391C070, 0x7D969BE1),
+          LIMB_PAIR(0x8A3B0242, 0x04BC1AE1), LIMB_PAIR(0x946C7856, 0x417D5158),
+          LIMB_PARTIAL(0x0EA)},
+         {LIMB_PAIR(0x17F7E492, 0x45F996F3), LIMB_PAIR(0x0704EFEC, 0xB2904E51),
+          LIMB_PAIR(0x7CB6CF84, 0x0F89BAB9), LIMB_PAIR(0x98E07858, 0x32A4D458),
+          LIMB_PAIR(0xA1BE9838, 0x7202EFB9), LIMB_PAIR(0x4E8743DA, 0x98A4E8AF),
+          LIMB_PAIR(0x657D4C74, 0x605CF158), LIMB_PAIR(0x7E0EBA38, 0xCCB12E26),
+          LIMB_PARTIAL(0x0EE)}},
+        {{LIMB_PAIR(0x083E8647, 0x80E86D53), LIMB_PAIR(0xE6BF14C4, 0x4C143F8D),
+          LIMB_PAIR(0xD250DDF8, 0x98965BEB), LIMB_PAIR(0x97F5F7CE, 0x66AD16A0),
+          LIMB_PAIR(0x91CA08F9, 0xF3B79E6A), LIMB_PAIR(0x5555AE35, 0xC8478BB2),
+          LIMB_PAIR(0x3048210B, 0xA3B1085A), LIMB_PAIR(0xC2E9F129, 0x400E0A3F),
+          LIMB_PARTIAL(0x1F1)},
+         {LIMB_PAIR(0xEF069132, 0x73DD8AAB), LIMB_PAIR(0x66348212, 0x4AA4C725),
+          LIMB_PAIR(0x36F78446, 0x44B84C94), LIMB_PAIR(0x68C9B6CB, 0xF835DA50),
+          LIMB_PAIR(0xA3536E11, 0x66B8E1D9), LIMB_PAIR(0x4F4541D4, 0x29FFBB21),
+          LIMB_PAIR(0xA43E5D3E, 0xCDB5BAFF), LIMB_PAIR(0xD75F692A, 0xCA8FCA6D),
+          LIMB_PARTIAL(0x1D6)}},
+        {{LIMB_PAIR(0x97FAABFF, 0x3875C2C9), LIMB_PAIR(0x0A8A8A3E, 0x7D2E0B15),
+          LIMB_PAIR(0xE5C00FA1, 0x1E9892E4), LIMB_PAIR(0x8271DA55, 0xFDAE6C4A),
+          LIMB_PAIR(0xD0C98F92, 0xBEA2C42B), LIMB_PAIR(0x49F83707, 0x229FB76C),
+          LIMB_PAIR(0x062755E8, 0xFE084798), LIMB_PAIR(0xDBD4F518, 0x5D5D514D),
+          LIMB_PARTIAL(0x1E9)},
+         {LIMB_PAIR(0xE9EB3349, 0x7037FC7C), LIMB_PAIR(0xA3F25B16, 0x80D2AC4B),
+          LIMB_PAIR(0x4B46B33C, 0x37BEBC0D), LIMB_PAIR(0xF5ECE30D, 0x90DEC4B5),
+          LIMB_PAIR(0x98259B5D, 0xA3AE4977), LIMB_PAIR(0xEA2D121B, 0xC60C07B4),
+          LIMB_PAIR(0x36D24A42, 0x2B431681), LIMB_PAIR(0xDB64A83E, 0xDAAF2349),
+          LIMB_PARTIAL(0x1B5)}},
+        {{LIMB_PAIR(0xACB36FAB, 0xE54530F5), LIMB_PAIR(0xFE671BC5, 0xD60DE27E),
+          LIMB_PAIR(0x36AB4B55, 0x1D09E4DB), LIMB_PAIR(0x8DF1734C, 0x20AC6261),
+          LIMB_PAIR(0x2FAB1D3A, 0x83CEC1A0), LIMB_PAIR(0x4172E7F4, 0xE959E73C),
+          LIMB_PAIR(0x1D55FB65, 0x38D56B08), LIMB_PAIR(0x584A03D9, 0x1398CB97),
+          LIMB_PARTIAL(0x187)},
+         {LIMB_PAIR(0x81712E45, 0xA2153162), LIMB_PAIR(0x13244B84, 0x2F77CC7C),
+          LIMB_PAIR(0x5E636322, 0xE28F7A31), LIMB_PAIR(0x76B88D74, 0xEA81C6D1),
+          LIMB_PAIR(0xA66229E1, 0x35D59E53), LIMB_PAIR(0x2B114039, 0x5A1CCFCB),
+          LIMB_PAIR(0xDE1C4BD6, 0x6371A053), LIMB_PAIR(0xC0AB1C97, 0x526E9698),
+          LIMB_PARTIAL(0x1D1)}},
+        {{LIMB_PAIR(0x47C3D608, 0x19911D13), LIMB_PAIR(0x258CE1C1, 0x267573DA),
+          LIMB_PAIR(0x5D563B12, 0xB378183F), LIMB_PAIR(0x84A1EC2B, 0x2A09AC78),
+          LIMB_PAIR(0x991D1F10, 0x5AC59A10), LIMB_PAIR(0xEDB7CA7D, 0x9F58D55E),
+          LIMB_PAIR(0x7E3B9893, 0xFD41710B), LIMB_PAIR(0x2D7F8E00, 0x4572D510),
+          LIMB_PARTIAL(0x15E)},
+         {LIMB_PAIR(0x706B8E8E, 0xD25F4424), LIMB_PAIR(0x75653D00, 0xF38550CF),
+          LIMB_PAIR(0xD9940106, 0xCB55F785), LIMB_PAIR(0xB52EF320, 0xC0BA5C65),
+          LIMB_PAIR(0x3777F7B4, 0x86450684), LIMB_PAIR(0x85C22A24, 0x24D73B7B),
+          LIMB_PAIR(0xF53B1338, 0xC7F1AC86), LIMB_PAIR(0x454E8CF9, 0x8D4BF141),
+          LIMB_PARTIAL(0x11C)}},
+        {{LIMB_PAIR(0x4D9B67C0, 0xBDA14ABF), LIMB_PAIR(0xBF9AC0B2, 0x54478DFA),
+          LIMB_PAIR(0xCA457B40, 0x08943AED), LIMB_PAIR(0xF18006C3, 0xD82F3D75),
+          LIMB_PAIR(0x48F5E818, 0x434D99A1), LIMB_PAIR(0xC5422AD5, 0x600C40E3),
+          LIMB_PAIR(0x4361F89D, 0x8A629459), LIMB_PAIR(0x9C176983, 0x25FD287B),
+          LIMB_PARTIAL(0x003)},
+         {LIMB_PAIR(0x9D02479B, 0x5465DEB6), LIMB_PAIR(0xACF06848, 0x61FD5B4F),
+          LIMB_PAIR(0x47787599, 0xBDA65F85), LIMB_PAIR(0x23280FCC, 0x1689CDCE),
+          LIMB_PAIR(0x62E25557, 0xB2EFD35D), LIMB_PAIR(0x9C9F12B4, 0x19FD6073),
+          LIMB_PAIR(0x3A87DAE1, 0xAF9A3943), LIMB_PAIR(0xC5A84A92, 0x20DD9C0A),
+          LIMB_PARTIAL(0x101)}}
+    },
+    {   // (1..8) * 2^(16 * 7) * G
+        {{LIMB_PAIR(0xC6884CE1, 0xC2D7EAA1), LIMB_PAIR(0x9FAF6322, 0xD7B35C4F),
+          LIMB_PAIR(0x337EA884, 0x8D1A1D85), LIMB_PAIR(0x0F946EBE, 0xBCC6A809),
+          LIMB_PAIR(0x754FB8D2, 0x45EAB172), LIMB_PAIR(0x91DBD926, 0x1E0B251E),
+          LIMB_PAIR(0xFDCE8503, 0x4B61112A), LIMB_PAIR(0x15FA4759, 0x80737C49),
+          LIMB_PARTIAL(0x00A)},
+         {LIMB_PAIR(0x40260E22, 0x1973C88B), LIMB_PAIR(0xE48DCA69, 0x83078CB7),
+          LIMB_PAIR(0xB199E3EB, 0x4815D67F), LIMB_PAIR(0x7B4DE5D3, 0xF57BDE1F),
+          LIMB_PAIR(0xE139DC10, 0x88A1EBB5), LIMB_PAIR(0x6689DD21, 0x7C20E7C6),
+          LIMB_PAIR(0x80884875, 0x40CBA346), LIMB_PAIR(0x39171E05, 0x5C821402),
+          LIMB_PARTIAL(0x062)}},
+        {{LIMB_PAIR(0x4E187FFF, 0x922F12DD), LIMB_PAIR(0x2FAA9F8A, 0x5EDC9B96),
+          LIMB_PAIR(0xC854C83D, 0xB7C218F8), LIMB_PAIR(0x65052D62, 0x3DFCBF32),
+          LIMB_PAIR(0x053D38C2, 0xBD809261), LIMB_PAIR(0x31D0C279, 0xF871B4BE),
+          LIMB_PAIR(0xF30B4A34, 0x6DB21156), LIMB_PAIR(0x8DB71E6A, 0xB5060514),
+          LIMB_PARTIAL(0x0D9)},
+         {LIMB_PAIR(0x6BEDC91D, 0xA08CE4A8), LIMB_PAIR(0xA0BAE827, 0xDF89CAC0),
+          LIMB_PAIR(0xAA3F520F, 0xC035A514), LIMB_PAIR(0xDA672398, 0xD5E9631F),
+          LIMB_PAIR(0x7150A93D, 0x8A5C3486), LIMB_PAIR(0x0D1A66E5, 0xE176D6C3),
+          LIMB_PAIR(0x74A2379C, 0x1AEBD738), LIMB_PAIR(0x279C3EB9, 0x42D11FE6),
+          LIMB_PARTIAL(0x139)}},
+        {{LIMB_PAIR(0xCB4C6645, 0xF2937EDE), LIMB_PAIR(0x1B68F3AE, 0x1E8DDA6D),
+          LIMB_PAIR(0x5C45EAE7, 0x25A8CBCA), LIMB_PAIR(0xB1A328E4, 0x6F07C48E),
+          LIMB_PAIR(0xEF4B3917, 0x473A67AC), LIMB_PAIR(0x208C0836, 0x5E4EEAC1),
+          LIMB_PAIR(0xEC92F538, 0xCA67351B), LIMB_PAIR(0x177CF537, 0x34A8F9F8),
+          LIMB_PARTIAL(0x15A)},
+         {LIMB_PAIR(0xB9A3216B, 0x7D7F6D7A), LIMB_PAIR(0x0ED36D7F, 0xA4AD0BAB),
+          LIMB_PAIR(0xD4B646CD, 0xD58507F3), LIMB_PAIR(0xA2950840, 0xBD275213),
+          LIMB_PAIR(0x76C25F08, 0x00F031C0), LIMB_PAIR(0x3F46258D, 0x300E0A0C),
+          LIMB_PAIR(0xA03DFBD7, 0x6CE16CD6), LIMB_PAIR(0x40C879F4, 0x35E0211D),
+          LIMB_PARTIAL(0x001)}},
+        {{LIMB_PAIR(0x62383E65, 0xA0333497), LIMB_PAIR(0x681092C0, 0x4F94F82B),
+          LIMB_PAIR(0x78A19CA7, 0x583B4503), LIMB_PAIR(0x50E7EA14, 0x81C69ED0),
+          LIMB_PAIR(0x2042E0A5, 0xBDE43E88), LIMB_PAIR(0x6A9F7938, 0x752A9D3E),
+          LIMB_PAIR(0xAF321417, 0x865464D9), LIMB_PAIR(0xB5794804, 0x5BCC326F),
+          LIMB_PARTIAL(0x00A)},
+         {LIMB_PAIR(0xB958F657, 0x7714AFCA), LIMB_PAIR(0x6E725914, 0x3B927DB4),
+          LIMB_PAIR(0x7FD9A9D8, 0x9EF1925C), LIMB_PAIR(0xBE7E139E, 0xED13FDFD),
+          LIMB_PAIR(0x6E80A43F, 0x5B57AA06), LIMB_PAIR(0x810F9412, 0xC9C221BE),
+          LIMB_PAIR(0x04EC7D73, 0xE6536F3A), LIMB_PAIR(0xDB4D13E7, 0x77765DB5),
+          LIMB_PARTIAL(0x19B)}},
+        {{LIMB_PAIR(0x84924113, 0x21FE770F), LIMB_PAIR(0x0AB300CB, 0x2C5D0612),
+          LIMB_PAIR(0xED6C7197, 0xE1699E81), LIMB_PAIR(0xF5948795, 0xDEC38F45),
+          LIMB_PAIR(0x3A48DA6C, 0x79DB54B8), LIMB_PAIR(0xB3F3AF61, 0x95F9D633),
+          LIMB_PAIR(0xA772F809, 0x3E4E733D), LIMB_PAIR(0x605E477F, 0x48DBE53A),
+          LIMB_PARTIAL(0x142)},
+         {LIMB_PAIR(0x86F2714F, 0x5AB3454E), LIMB_PAIR(0x939B3218, 0x87D83DE7),
+          LIMB_PAIR(0x96D16FF0, 0xB980FBC0), LIMB_PAIR(0xDD96A283, 0xBA3CFAAD),
+          LIMB_PAIR(0x16C3B69F, 0xED413244), LIMB_PAIR(0x968C773E, 0x57968830),
+          LIMB_PAIR(0xED4D4DFA, 0xF315B38C), LIMB_PAIR(0xA24CFB0F, 0xA013ACC5),
+          LIMB_PARTIAL(0x0CA)}},
+        {{LIMB_PAIR(0x24E3C650, 0xD064803E), LIMB_PAIR(0x3B9AEC0E, 0xA9010930),
+          LIMB_PAIR(0x19F6F56C, 0x407B3932), LIMB_PAIR(0xD143BE9B, 0x045D7E95),
+          LIMB_PAIR(0x47A9533B, 0x2933B6BE), LIMB_PAIR(0x2BC7F731, 0x01B01EC6),
+          LIMB_PAIR(0x043E4C5D, 0x723ABD9A), LIMB_PAIR(0x25C4E8AF, 0xCD8A1BFD),
+          LIMB_PARTIAL(0x095)},
+         {LIMB_PAIR(0x6D8A2F90, 0xD719EDED), LIMB_PAIR(0x8B5C2378, 0x08B7C6AF),
+          LIMB_PAIR(0xC01DF5DF, 0x027C6CB7), LIMB_PAIR(0x155CBCE9, 0x1C020CE0),
+          LIMB_PAIR(0x3DEB94D9, 0xC3AEED93), LIMB_PAIR(0xA6F7FEE3, 0x2CAE43C7),
+          LIMB_PAIR(0x7512EF37, 0x54637A4A), LIMB_PAIR(0x81582BD4, 0x3B643660),
+          LIMB_PARTIAL(0x1E8)}},
+        {{LIMB_PAIR(0x7E59DDE8, 0xC6D7698F), LIMB_PAIR(0x08AAB860, 0xB1AB83AC),
+          LIMB_PAIR(0xC7FCAC6B, 0xE1972059), LIMB_PAIR(0x656119BD, 0xDE4446AE),
+          LIMB_PAIR(0xF9F8D976, 0x8DFBBEDE), LIMB_PAIR(0x009BE348, 0xE3B8E6D2),
+          LIMB_PAIR(0x974CB79F, 0xA8EAD6EE), LIMB_PAIR(0xB7A415BF, 0x4A566503),
+          LIMB_PARTIAL(0x002)},
+         {LIMB_PAIR(0x24C0D839, 0xD661701B), LIMB_PAIR(0x11C338CB, 0x6A3200D1),
+          LIMB_PAIR(0x37F3769B, 0x5016BA32), LIMB_PAIR(0xA00F1D08, 0xF4396987),
+          LIMB_PAIR(0x2ADD49AE, 0x16ABF906), LIMB_PAIR(0x04F3DBD4, 0x17DC53E8),
+          LIMB_PAIR(0x54A44690, 0x9EE15F53), LIMB_PAIR(0xA27E4C96, 0xAAA77F7E),
+          LIMB_PARTIAL(0x0BF)}},
+        {{LIMB_PAIR(0xDEF62F7A, 0x86DD8F04), LIMB_PAIR(0xCC9E5065, 0x42CD01B9),
+          LIMB_PAIR(0x43275C45, 0xD50B8556), LIMB_PAIR(0x9814155E, 0x404E04A5),
+          LIMB_PAIR(0x266B665E, 0xF7E62F98), LIMB_PAIR(0x86EEDC55, 0xD68E806E),
+          LIMB_PAIR(0x4332001B, 0xB23E4BF3), LIMB_PAIR(0x366D78C2, 0xE0B405B2),
+          LIMB_PARTIAL(0x150)},
+         {LIMB_PAIR(0xD49D6C3B, 0x6E4C1160), LIMB_PAIR(0x7CE72D17, 0x10C20964),
+          LIMB_PAIR(0x5475D05D, 0x0C0BA532), LIMB_PAIR(0x1523A4F9, 0x77D8DC83),
+          LIMB_PAIR(0x5693CDC6, 0xB053A8BE), LIMB_PAIR(0xE947E953, 0x5E0897A3),
+          LIMB_PAIR(0x7899D5D6, 0xDE13F451), LIMB_PAIR(0xCA78C763, 0xBAFCA001),
+          LIMB_PARTIAL(0x013)}}
+    },
+    {   // (1..8) * 2^(16 * 8) * G
+        {{LIMB_PAIR(0x6A3CF15F, 0x9AECAE2D), LIMB_PAIR(0x9C959376, 0xD9D0B49A),
+          LIMB_PAIR(0x57CC7E25, 0x4AAD9454), LIMB_PAIR(0x3876FE58, 0x68361832),
+          LIMB_PAIR(0x2BD9DC24, 0xCCC6F2D8), LIMB_PAIR(0x605BAFBE, 0x3970525C),
+          LIMB_PAIR(0xA2C5499D, 0xF17524ED), LIMB_PAIR(0xB0C7BF4F, 0xE30B69D5),
+          LIMB_PARTIAL(0x05F)},
+         {LIMB_PAIR(0xB5D073B0, 0xA71532AD), LIMB_PAIR(0xB4FB97B3, 0x37159FB3),
+          LIMB_PAIR(0x7A1FFF6D, 0x15B655B2), LIMB_PAIR(0x9E08A89C, 0x55AC89EE),
+          LIMB_PAIR(0xBC027776, 0x13CFAB6B), LIMB_PAIR(0x9DECE9A9, 0xA57A7F28),
+          LIMB_PAIR(0xC03A1D45, 0x65A3D815), LIMB_PAIR(0x95515DBA, 0xE5CD61EA),
+          LIMB_PARTIAL(0x100)}},
+        {{LIMB_PAIR(0xD44E9B1C, 0x64107659), LIMB_PAIR(0x599694F3, 0xDFE2B3ED),
+          LIMB_PAIR(0x55939FEF, 0x348B1634), LIMB_PAIR(0x0B2F8B7A, 0xEB5FB186),
+          LIMB_PAIR(0x5A1469B5, 0x19D2BECF), LIMB_PAIR(0x6BEA8F5A, 0x24C67FF9),
+          LIMB_PAIR(0x5924FDE9, 0x1A4037A8), LIMB_PAIR(0xFE0231AE, 0xDD0E9ACE),
+          LIMB_PARTIAL(0x0F0)},
+         {LIMB_PAIR(0x37CEE8E6, 0x5B3F06A2), LIMB_PAIR(0x7E4A80A6, 0x3CCC49C6),
+          LIMB_PAIR(0x05B38A1C, 0xE8729CC4), LIMB_PAIR(0x1F4373F1, 0xA5132339),
+          LIMB_PAIR(0xB3A773F0, 0x1DAC8246), LIMB_PAIR(0x0193D5B1, 0x9824B498),
+          LIMB_PAIR(0xC4DB540A, 0xB63E677A), LIMB_PAIR(0x5F10A7C1, 0x9C74537F),
+          LIMB_PARTIAL(0x094)}},
+        {{LIMB_PAIR(0x4CE9ABD3, 0x21CBB2C7), LIMB_PAIR(0x45073C39, 0x7F157A48),
+          LIMB_PAIR(0x0DE2380E, 0xBC887F72), LIMB_PAIR(0x6F96A397, 0x295BAD1C),
+          LIMB_PAIR(0x8FF6DAFF, 0x9BB39BE4), LIMB_PAIR(0xD80498E3, 0x65B52767),
+          LIMB_PAIR(0x02B936A0, 0x1B075294), LIMB_PAIR(0xB90EC0FC, 0x04C89F2F),
+          LIMB_PARTIAL(0x0B4)},
+         {LIMB_PAIR(0xF3BF4B3D, 0x47F62CE6), LIMB_PAIR(0x0E3E0BD4, 0xF7992125),
+          LIMB_PAIR(0xA14A6183, 0xE1555BF8), LIMB_PAIR(0x67F3936C, 0x8169E025),
+          LIMB_PAIR(0x846CE4B0, 0x62DAE8AE), LIMB_PAIR(0xFE0B0558, 0xCEE40B04),
+          LIMB_PAIR(0x8FE270E1, 0x520C3E20), LIMB_PAIR(0xC44DE629, 0xA1F2420E),
+          LIMB_PARTIAL(0x150)}},
+        {{LIMB_PAIR(0xBC875BAE, 0xC773FAAC), LIMB_PAIR(0x08DC8719, 0x5AD3CC94),
+          LIMB_PAIR(0x6FD3DBDE, 0x23A9CF66), LIMB_PAIR(0xA4C8D8FE, 0xF9C47B69),
+          LIMB_PAIR(0xFC6D9E13, 0xAEFDCD39), LIMB_PAIR(0x2EF2FFF0, 0x3647F3A9),
+          LIMB_PAIR(0x1F53EE3C, 0x7FBF9D74), LIMB_PAIR(0x85E5A502, 0x9199963D),
+          LIMB_PARTIAL(0x0EF)},
+         {LIMB_PAIR(0x3AD5B178, 0x19117374), LIMB_PAIR(0xF086FDF5, 0xA5892671),
+          LIMB_PAIR(0xAEABB8B1, 0xA828F5BE), LIMB_PAIR(0x62711D4B, 0xA9C1A33E),
+          LIMB_PAIR(0x01E1DE48, 0xF8A2E9B1), LIMB_PAIR(0x568801DA, 0xE5EB2DE9),
+          LIMB_PAIR(0x5F2F8052, 0x3E0B7A84), LIMB_PAIR(0xDDB76FFA, 0x074D3C36),
+          LIMB_PARTIAL(0x160)}},
+        {{LIMB_PAIR(0x4D0A48D1, 0x3CA5AE61), LIMB_PAIR(0x7F021444, 0x39648CEC),
+          LIMB_PAIR(0x1E90C6DD, 0x3C92B252), LIMB_PAIR(0x94A49837, 0x776994BC),
+          LIMB_PAIR(0x7DDBF5B2, 0x53E54C20), LIMB_PAIR(0xD4576141, 0xFAF593C7),
+          LIMB_PAIR(0x26CC7AB2, 0x17E000C2), LIMB_PAIR(0x0BF5318A, 0x9484DE38),
+          LIMB_PARTIAL(0x1C9)},
+         {LIMB_PAIR(0x97546078, 0x7AA1D4D3), LIMB_PAIR(0xF1E5FD32, 0x06B60EE9),
+          LIMB_PAIR(0x8447917D, 0xCE10BDF0), LIMB_PAIR(0x0E3DE8AB, 0x40FD8D61),
+          LIMB_PAIR(0x34E29CC4, 0xA3C917AF), LIMB_PAIR(0x2C27DE76, 0xA7BB1B54),
+          LIMB_PAIR(0x31E6C453, 0x69929799), LIMB_PAIR(0x2F185B22, 0xC668FBE4),
+          LIMB_PARTIAL(0x142)}},
+        {{LIMB_PAIR(0xAF0603F0, 0x953B8CA7), LIMB_PAIR(0x7E21E713, 0x4B5ECED7),
+          LIMB_PAIR(0x2864DCA9, 0x427652E1), LIMB_PAIR(0x16CBFBB1, 0x547F5FB5),
+          LIMB_PAIR(0xF75F17F1, 0x6AD85C7E), LIMB_PAIR(0x8222107E, 0x469AF794),
+          LIMB_PAIR(0x9BEF1085, 0x20D4C8E7), LIMB_PAIR(0x152552E6, 0x867D4D0B),
+          LIMB_PARTIAL(0x142)},
+         {LIMB_PAIR(0xF3F26574, 0xBB5FFB0C), LIMB_PAIR(0x15CD38C0, 0x047C1BC0),
+          LIMB_PAIR(0x76F8E575, 0x76C5DBF1), LIMB_PAIR(0x20D33C17, 0xF7EB7B0E),
+          LIMB_PAIR(0x6D879E9E, 0x1E9CC21E), LIMB_PAIR(0x40CA3223, 0xEB2EDC83),
+          LIMB_PAIR(0x290D165F, 0xB0AA90A8), LIMB_PAIR(0x23C1EF71, 0x7C17D3B2),
+          LIMB_PARTIAL(0x055)}},
+        {{LIMB_PAIR(0xC1E4A87C, 0x80FD3DD3), LIMB_PAIR(0xE63E847B, 0xF2230946),
+          LIMB_PAIR(0x477178B7, 0x9D51E3A3), LIMB_PAIR(0x60B2E4DE, 0x06B089A4),
+          LIMB_PAIR(0x53CCD5F0, 0xF98E4CDC), LIMB_PAIR(0xE9E18AEC, 0xFABA504A),
+          LIMB_PAIR(0x34DBA1CA, 0x22B799BE), LIMB_PAIR(0xA4C9CA6E, 0x75409D50),
+          LIMB_PARTIAL(0x0F9)},
+         {LIMB_PAIR(0x617902E1, 0xEC619962), LIMB_PAIR(0x4C58C299, 0xED26BE73),
+          LIMB_PAIR(0x6D1C30E8, 0x083E94E4), LIMB_PAIR(0x8BE269BD, 0x2C8F7115),
+          LIMB_PAIR(0xE0FED762, 0xF7C13EA9), LIMB_PAIR(0xB517E55B, 0xB6C9BEA0),
+          LIMB_PAIR(0xAEB4BEC0, 0x7D656933), LIMB_PAIR(0xCA01BF37, 0xF386FED9),
+          LIMB_PARTIAL(0x07D)}},
+        {{LIMB_PAIR(0x66FD07CA, 0x1036EB9B), LIMB_PAIR(0x6B7FB490, 0x6CA52CC1),
+          LIMB_PAIR(0xD3E0C270, 0x512E973E), LIMB_PAIR(0x73D92D11, 0x889980BF),
+          LIMB_PAIR(0xA4005EEA, 0x38B4CFE4), LIMB_PAIR(0x8CEB4313, 0xB6F992CC),
+          LIMB_PAIR(0x6DAF7C23, 0xD0AC2F8D), LIMB_PAIR(0xE32A93CB, 0x1CCFBF17),
+          LIMB_PARTIAL(0x0C2)},
+         {LIMB_PAIR(0x2F508CCA, 0x7BD9D6F1), LIMB_PAIR(0x595A72AF, 0xE82D7171),
+          LIMB_PAIR(0x97512873, 0x25D02976), LIMB_PAIR(0x8CF39FBC, 0xEFC1DE8B),
+          LIMB_PAIR(0x9A1237F4, 0x25E6B77F), LIMB_PAIR(0xD4D98B5D, 0x9F3B73E7),
+          LIMB_PAIR(0xECCB07FE, 0xE1FDA62B), LIMB_PAIR(0x625350CF, 0xDB813B03),
+          LIMB_PARTIAL(0x014)}}
+    },
+    {   // (1..8) * 2^(16 * 9) * G
+        {{LIMB_PAIR(0xC4D6AB08, 0x69CAD3CC), LIMB_PAIR(0x3B8990B8, 0x3ADB5777),
+          LIMB_PAIR(0x8D958801, 0xD0CAD8CE), LIMB_PAIR(0x6D728F9E, 0xCB572E66),
+          LIMB_PAIR(0xCD5131FC, 0xE3D9E7C4), LIMB_PAIR(0x6145DC06, 0xAFCEB6B0),
+          LIMB_PAIR(0xE213043A, 0x12ECD392), LIMB_PAIR(0x3A64C87C, 0xBD599294),
+          LIMB_PARTIAL(0x00B)},
+         {LIMB_PAIR(0xF6EA9CF1, 0x8623BDBB), LIMB_PAIR(0x547AA650, 0x3AAD9495),
+          LIMB_PAIR(0xBEB27159, 0xD3D853FC), LIMB_PAIR(0x30B40833, 0x3D25A648),
+          LIMB_PAIR(0xDEC51BD1, 0x12D188E8), LIMB_PAIR(0xB348C3FA, 0x836330D2),
+          LIMB_PAIR(0x73C2EA59, 0x9DF50CFE), LIMB_PAIR(0x61DED0B8, 0xB5DFFB20),
+          LIMB_PARTIAL(0x18A)}},
+        {{LIMB_PAIR(0x0C62942A, 0xE843D035), LIMB_PAIR(0xD8920CD4, 0xEB792FC5),
+          LIMB_PAIR(0x90BE6FD2, 0x3FA4154E), LIMB_PAIR(0xCE2557AB, 0x002631CB),
+          LIMB_PAIR(0x226742B6, 0xB37B952A), LIMB_PAIR(0xFEAFDC24, 0xA7658C0A),
+          LIMB_PAIR(0xB5A09597, 0x62A7DE67), LIMB_PAIR(0x9BB3CFDE, 0x25074F6A),
+          LIMB_PARTIAL(0x15E)},
+         {LIMB_PAIR(0xD03CF65D, 0xE6DB0F49), LIMB_PAIR(0x0347DFF1, 0x1187C8B4),
+          LIMB_PAIR(0x6E4CE605, 0xDEA41116), LIMB_PAIR(0x22313708, 0xAC0CA353),
+          LIMB_PAIR(0xB6A5CADE, 0x395DDEE3), LIMB_PAIR(0xC6D80C86, 0xF31ABCB1),
+          LIMB_PAIR(0xA07F0747, 0x013371B1), LIMB_PAIR(0x8F55B804, 0xF5423189),
+          LIMB_PARTIAL(0x14D)}},
+        {{LIMB_PAIR(0x18A82CCD, 0x6B8F8304), LIMB_PAIR(0x1B132B2C, 0xC3C56001),
+          LIMB_PAIR(0x8DED65A4, 0xAFB9250D), LIMB_PAIR(0x945B6410, 0x921B4635),
+          LIMB_PAIR(0x9F168610, 0x100306BD), LIMB_PAIR(0x66EDAB88, 0xDAE04ED3),
+          LIMB_PAIR(0xD86B2664, 0x4EDAB84E), LIMB_PAIR(0xC815C6B2, 0xDEDAA28C),
+          LIMB_PARTIAL(0x142)},
+         {LIMB_PAIR(0x7B7161C2, 0xDB8265F1), LIMB_PAIR(0x8F11558C, 0xF022683F),
+          LIMB_PAIR(0xCF5FE6EF, 0xB8859F1F), LIMB_PAIR(0xAD90BE7E, 0x7419ABD8),
+          LIMB_PAIR(0x24AA372C, 0x8289C33F), LIMB_PAIR(0x7C9D3BE5, 0x3871CB40),
+          LIMB_PAIR(0xB3034315, 0x55402906), LIMB_PAIR(0xA7E70821, 0xAE557332),
+          LIMB_PARTIAL(0x014)}},
+        {{LIMB_PAIR(0x40817AA5, 0x42458CFC), LIMB_PAIR(0x560CC12B, 0x96F15F13),
+          LIMB_PAIR(0x4400B1E3, 0xF96EA203), LIMB_PAIR(0x6EBC6B8E, 0x266C2A62),
+          LIMB_PAIR(0x2B374CBC, 0x98EBD5D4), LIMB_PAIR(0x97F946A4, 0x15C1F4FD),
+          LIMB_PAIR(0x33A07357, 0x759238AE), LIMB_PAIR(0x2E3338C4, 0x6DE75CFE),
+          LIMB_PARTIAL(0x0AC)},
+         {LIMB_PAIR(0xA1D6BAD6, 0xF73DFD08), LIMB_PAIR(0x72566188, 0x32228F5F),
+          LIMB_PAIR(0x0497DD53, 0xEA587FED), LIMB_PAIR(0x2C1673C2, 0xAD4C4A56),
+          LIMB_PAIR(0xADE968FF, 0x8C8DCEC4), LIMB_PAIR(0xDEF7FEAE, 0x77BF520E),
+          LIMB_PAIR(0x7E6A19CB, 0x856BB798), LIMB_PAIR(0xB7FB508C, 0xC289274D),
+          LIMB_PARTIAL(0x050)}},
+        {{LIMB_PAIR(0xCA0544A7, 0xBAA18E98), LIMB_PAIR(0xED60926D, 0x1FA840A3),
+          LIMB_PAIR(0xF583BF44, 0xC901285B), LIMB_PAIR(0x2F2744DD, 0x1E658554),
+          LIMB_PAIR(0x033574B7, 0x7D1F3FAB), LIMB_PAIR(0x5D34D187, 0x29BF8B27),
+          LIMB_PAIR(0x013F2B8A, 0x02018A3B), LIMB_PAIR(0x7D0B0654, 0x7C0D108F),
+          LIMB_PARTIAL(0x1D6)},
+         {LIMB_PAIR(0xDBB51651, 0x56E335F2), LIMB_PAIR(0x0CA2BFD0, 0xB0FAA53C),
+          LIMB_PAIR(0xA9CF1059, 0x519B0979), LIMB_PAIR(0x82E7A7E9, 0x5073CBC9),
+          LIMB_PAIR(0x9C56804B, 0x59D59D16), LIMB_PAIR(0x6F1FDA98, 0x8AA44138),
+          LIMB_PAIR(0x71430784, 0xB59516A7), LIMB_PAIR(0x5EE4C065, 0x7E4742E7),
+          LIMB_PARTIAL(0x013)}},
+        {{LIMB_PAIR(0xE32413F4, 0xFCB62E6E), LIMB_PAIR(0x91774519, 0x50F16401),
+          LIMB_PAIR(0x40A47E38, 0x0663934C), LIMB_PAIR(0x0875802E, 0xB076A14B),
+          LIMB_PAIR(0x0226B719, 0x8E263A07), LIMB_PAIR(0x876EBD60, 0x56A9874C),
+          LIMB_PAIR(0xDE28C9A5, 0xDA1C858B), LIMB_PAIR(0x5D0FE6C5, 0x5D2DFC54),
+          LIMB_PARTIAL(0x087)},
+         {LIMB_PAIR(0xF0C26523, 0x0B8814F1), LIMB_PAIR(0xBEFC1AF0, 0x50C49512),
+          LIMB_PAIR(0xC96A9945, 0xF350E279), LIMB_PAIR(0x19BC1CCA, 0x4DC59836),
+          LIMB_PAIR(0xEFBE83AC, 0xA3278CC6), LIMB_PAIR(0xC8A9BC08, 0x7946939A),
+          LIMB_PAIR(0x13B63E38, 0x8F614292), LIMB_PAIR(0x853B2360, 0x83EEB455),
+          LIMB_PARTIAL(0x0EC)}},
+        {{LIMB_PAIR(0x8D439A2A, 0x956E5BAB), LIMB_PAIR(0x45CDAA3E, 0x70731E9D),
+          LIMB_PAIR(0x57720254, 0x3E13BF09), LIMB_PAIR(0x97E84B98, 0x87759C0C),
+          LIMB_PAIR(0x5D558933, 0x73E76343), LIMB_PAIR(0x1C8E0B0D, 0x63981174),
+          LIMB_PAIR(0x4D59454F, 0xBCFCB1C0), LIMB_PAIR(0xC266E0C9, 0x230D81F0),
+          LIMB_PARTIAL(0x185)},
+         {LIMB_PAIR(0xBD01132F, 0x21F9D779), LIMB_PAIR(0xB24D193A, 0xF2FEC285),
+          LIMB_PAIR(0x23E6C8D7, 0x248513EC), LIMB_PAIR(0x50EF338C, 0xCA611EBF),
+          LIMB_PAIR(0x21E42C9E, 0x8276397C), LIMB_PAIR(0x9F6E2FED, 0x0A88DB63),
+          LIMB_PAIR(0x42F1FA0E, 0x54547994), LIMB_PAIR(0xC6CA6F09, 0x3DA19301),
+          LIMB_PARTIAL(0x1DC)}},
+        {{LIMB_PAIR(0xDE6BAFE8, 0x2491A894), LIMB_PAIR(0xEE9EB4C2, 0x8AA13AC5),
+          LIMB_PAIR(0x31B2D1FE, 0x1623B9DF), LIMB_PAIR(0x1A5B21EF, 0x1FB69CA8),
+          LIMB_PAIR(0x290D231C, 0x722F1BE3), LIMB_PAIR(0xB93891F0, 0x8D2A56EE),
+          LIMB_PAIR(0x48A2DC2A, 0xB534845B), LIMB_PAIR(0x3E2A9160, 0xE4FADAFC),
+          LIMB_PARTIAL(0x0CA)},
+         {LIMB_PAIR(0x810034B4, 0x7F9D50B8), LIMB_PAIR(0xE8703F93, 0xFEBDA319),
+          LIMB_PAIR(0x44CAA3D9, 0xECAE1008), LIMB_PAIR(0xBB5E0DC6, 0x21767275),
+          LIMB_PAIR(0xAC64FB7E, 0x529817CD), LIMB_PAIR(0x31B97B4F, 0x984CB5BD),
+          LIMB_PAIR(0x8BA3A593, 0x33000D28), LIMB_PAIR(0x9003A472, 0x950B9C14),
+          LIMB_PARTIAL(0x039)}}
+    },
+    {   // (1..8) * 2^(16 * 10) * G
+        {{LIMB_PAIR(0x378CAB85, 0x11446EFE), LIMB_PAIR(0xBC48BF6D, 0x4C3C68CF),
+          LIMB_PAIR(0x64C19BAF, 0x5E514661), LIMB_PAIR(0xD5CBB135, 0xC0F00735),
+          LIMB_PAIR(0xA693B1A9, 0x5D4844A7), LIMB_PAIR(0x9579FDAF, 0x517A4871),
+          LIMB_PAIR(0x532C1E6E, 0x5EAD064B), LIMB_PAIR(0x4135ECB1, 0x60207C2D),
+          LIMB_PARTIAL(0x172)},
+         {LIMB_PAIR(0x843DC902, 0x4B033A37), LIMB_PAIR(0xC27A9863, 0xB2D3664C),
+          LIMB_PAIR(0x18280E54, 0xF4EBDC35), LIMB_PAIR(0xAE02B757, 0xAC7789A6),
+          LIMB_PAIR(0x10DD96F8, 0x50084BA4), LIMB_PAIR(0x1F5F6349, 0xCC345937),
+          LIMB_PAIR(0xFDEE6F84, 0x5F65ACA8), LIMB_PAIR(0x02D841CF, 0x4AAC5F59),
+          LIMB_PARTIAL(0x1B9)}},
+        {{LIMB_PAIR(0x532856CA, 0x7C44096F), LIMB_PAIR(0x4D701F46, 0xF054AC94),
+          LIMB_PAIR(0x8DE81577, 0x1BF992E7), LIMB_PAIR(0xA90A4D2E, 0x871D2DF2),
+          LIMB_PAIR(0x775CABE3, 0x963357A5), LIMB_PAIR(0xBAE3AC5D, 0x2E92D83D),
+          LIMB_PAIR(0x415BE4DB, 0xC39E645C), LIMB_PAIR(0x9781B22F, 0xBCCA60E2),
+          LIMB_PARTIAL(0x1C9)},
+         {LIMB_PAIR(0xFC5374ED, 0x638CF76C), LIMB_PAIR(0x24278420, 0xFFBFBC7A),
+          LIMB_PAIR(0xE7668BC6, 0xDE577D69), LIMB_PAIR(0xBAB7B568, 0x88444FDE),
+          LIMB_PAIR(0x59D220A6, 0x4CB8237B), LIMB_PAIR(0x25B582EB, 0x02186C1C),
+          LIMB_PAIR(0x9B639F32, 0xE4A04CB1), LIMB_PAIR(0x4590E20D, 0xD12B0E64),
+          LIMB_PARTIAL(0x0AB)}},
+        {{LIMB_PAIR(0x638C39DC, 0xFEBD71BD), LIMB_PAIR(0x016E39F1, 0x599852C1),
+          LIMB_PAIR(0x96EB6AF6, 0x678D5442), LIMB_PAIR(0x1EA773FF, 0x4A1CE1D0),
+          LIMB_PAIR(0x62AD7D21, 0x23FA5FFD), LIMB_PAIR(0x8C41D004, 0x845CAB52),
+          LIMB_PAIR(0xBB683C2A, 0x60A4CA10), LIMB_PAIR(0x586ABA40, 0x62092692),
+          LIMB_PARTIAL(0x110)},
+         {LIMB_PAIR(0x08262627, 0xDD30D6A1), LIMB_PAIR(0xAAB1312E, 0x410CD76D),
+          LIMB_PAIR(0x87EF2A6D, 0xD7816548), LIMB_PAIR(0x740171C0, 0x9CA850C7),
+          LIMB_PAIR(0xF4E746E6, 0x6881C9BA), LIMB_PAIR(0xDF470442, 0x20B5F165),
+          LIMB_PAIR(0xA625D961, 0x09F109D2), LIMB_PAIR(0xC1D1DF61, 0x64CF9864),
+          LIMB_PARTIAL(0x078)}},
+        {{LIMB_PAIR(0xBB55F47E, 0xDD0F09B1), LIMB_PAIR(0xBE55C9D6, 0xFACBDEF0),
+          LIMB_PAIR(0xBB62C5EE, 0x8B8B1A9C), LIMB_PAIR(0xEB8F0BBD, 0x617FF446),
+          LIMB_PAIR(0x5C1EFE94, 0x24176F92), LIMB_PAIR(0x962F4019, 0xF27AE452),
+          LIMB_PAIR(0x220FC04D, 0x3B812A15), LIMB_PAIR(0xCC92239D, 0xB17B1B9B),
+          LIMB_PARTIAL(0x05C)},
+         {LIMB_PAIR(0x8A465257, 0x9200F2E4), LIMB_PAIR(0xFBB69960, 0xC8CA2A1C),
+          LIMB_PAIR(0x5A8FF2AA, 0x5410EF87), LIMB_PAIR(0xE11B6896, 0x87BC97B0),
+          LIMB_PAIR(0x52263F49, 0x1D3A4969), LIMB_PAIR(0xCCA15D27, 0x2ED88B0B),
+          LIMB_PAIR(0x765C9300, 0x90AB34C1), LIMB_PAIR(0xD2630404, 0x719D9BC7),
+          LIMB_PARTIAL(0x010)}},
+        {{LIMB_PAIR(0x7C4C1251, 0x22AF165C), LIMB_PAIR(0xB49D08A6, 0x0638EF62),
+          LIMB_PAIR(0x18ED98CC, 0x80DFF986), LIMB_PAIR(0xA541C5E5, 0x8E3B7186),
+          LIMB_PAIR(0xD0F729D4, 0x3C309734), LIMB_PAIR(0x2F30C85C, 0xC3439363),
+          LIMB_PAIR(0x3B099E11, 0xD90474FA), LIMB_PAIR(0x06C8C546, 0xDC726A4A),
+          LIMB_PARTIAL(0x13B)},
+         {LIMB_PAIR(0x1A531C8F, 0x06792436), LIMB_PAIR(0x3C2633CF, 0xCB5C860E),
+          LIMB_PAIR(0xDCDE99CB, 0xFEF97B7E), LIMB_PAIR(0xE4C02691, 0x085E6288),
+          LIMB_PAIR(0x353255D8, 0x08C3E30C), LIMB_PAIR(0xBF01A904, 0xE50A641C),
+          LIMB_PAIR(0x108D6EB6, 0xBE2980B1), LIMB_PAIR(0xED2BDE9D, 0xD5547FB7),
+          LIMB_PARTIAL(0x0DD)}},
+        {{LIMB_PAIR(0x8D9E9C1E, 0x6366CC83), LIMB_PAIR(0x7CF6EA2B, 0x6DA8B24C),
+          LIMB_PAIR(0x34A0C6DD, 0xCF34AC08), LIMB_PAIR(0xE3A1BEA6, 0x957954DD),
+          LIMB_PAIR(0xF4060336, 0x2EA0EF68), LIMB_PAIR(0xA84FDF5D, 0xE61893A5),
+          LIMB_PAIR(0x7BF522C5, 0x03CACAB4), LIMB_PAIR(0x0DBF1790, 0x823249DD),
+          LIMB_PARTIAL(0x145)},
+         {LIMB_PAIR(0xAB3E90D0, 0x2EA0344D), LIMB_PAIR(0x2BCCCC9C, 0x5C70CC71),
+          LIMB_PAIR(0x0063E840, 0x5EEC2755), LIMB_PAIR(0xBE50D3A5, 0x3983CB1B),
+          LIMB_PAIR(0x7B09FF44, 0x462B3DC2), LIMB_PAIR(0xDD6B34BB, 0xF779391E),
+          LIMB_PAIR(0xBBF36F70, 0x6C00D9B8), LIMB_PAIR(0xF82EE371, 0x9E0EB0D1),
+          LIMB_PARTIAL(0x080)}},
+        {{LIMB_PAIR(0xF443807C, 0x7881C53C), LIMB_PAIR(0x861089DC, 0x95060F3C),
+          LIMB_PAIR(0x0B096123, 0x0B406684), LIMB_PAIR(0x86A8D5F6, 0xBAFDECBB),
+          LIMB_PAIR(0x5C89A0A2, 0x2F5961BF), LIMB_PAIR(0x6AC1191D, 0x3034175A),
+          LIMB_PAIR(0x4F1CBA38, 0x7521B10B), LIMB_PAIR(0xA7CF95B1, 0x96EE1BA8),
+          LIMB_PARTIAL(0x1AA)},
+         {LIMB_PAIR(0x13DFF296, 0x51B2B27B), LIMB_PAIR(0x10683230, 0xA3597D71),
+          LIMB_PAIR(0xF1026F39, 0x82C4A1CE), LIMB_PAIR(0x363F89B3, 0x9ACDB7EA),
+          LIMB_PAIR(0x30BAD05E, 0x14E0797F), LIMB_PAIR(0xC9F5C1CF, 0x4BCB9331),
+          LIMB_PAIR(0xC248CD02, 0x2DA2F33F), LIMB_PAIR(0xCE32B8E1, 0xE9409B9F),
+          LIMB_PARTIAL(0x072)}},
+        {{LIMB_PAIR(0xD15E752D, 0x41B4D05B), LIMB_PAIR(0x46E78FAF, 0xCE20B1F8),
+          LIMB_PAIR(0x08D808B5, 0xB529CC01), LIMB_PAIR(0x2210CF60, 0xD934F10F),
+          LIMB_PAIR(0xE41ECA93, 0x9F2E7E1B), LIMB_PAIR(0x4D82D15D, 0xC09DA7A9),
+          LIMB_PAIR(0xA1ED7860, 0x45A84216), LIMB_PAIR(0xE6BE684E, 0x9F6FA43D),
+          LIMB_PARTIAL(0x109)},
+         {LIMB_PAIR(0xECF53A79, 0x592BD464), LIMB_PAIR(0x349754ED, 0x9DAC1BB8),
+          LIMB_PAIR(0x84339A7D, 0x79BBE622), LIMB_PAIR(0xF9F4FA5A, 0x29C3D4AA),
+          LIMB_PAIR(0x16DC4698, 0x4788CDA8), LIMB_PAIR(0x5C3060EF, 0xF94EA449),
+          LIMB_PAIR(0xCB3C2B37, 0xC5F4191D), LIMB_PAIR(0xFF69861A, 0xEB720D23),
+          LIMB_PARTIAL(0x026)}}
+    },
+    {   // (1..8) * 2^(16 * 11) * G
+        {{LIMB_PAIR(0xDA44FF51, 0xB342D85D), LIMB_PAIR(0xD08596FF, 0x54BA0522),
+          LIMB_PAIR(0xB0AC99C2, 0x3DA8E8CE), LIMB_PAIR(0x91F37DCB, 0xCEBE6A96),
+          LIMB_PAIR(0xC24D7D1C, 0x8EBAD3D9), LIMB_PAIR(0xC75945EF, 0xF11A4319),
+          LIMB_PAIR(0xED1AC001, 0xD4DFE534), LIMB_PAIR(0x1A521E4D, 0x745E2772),
+          LIMB_PARTIAL(0x0C4)},
+         {LIMB_PAIR(0xDF65E0BB, 0x745E5B41), LIMB_PAIR(0x3B84ED58, 0xF8887B53),
+          LIMB_PAIR(0x9C0684EA, 0x1A54BC47), LIMB_PAIR(0xCE9C7672, 0xFD4F1D36),
+          LIMB_PAIR(0xCE5730FC, 0x490BC265), LIMB_PAIR(0x8430ADB9, 0x2FA1AD6D),
+          LIMB_PAIR(0xB7DB19B4, 0x0F117BDC), LIMB_PAIR(0x9C246E44, 0xBD339A78),
+          LIMB_PARTIAL(0x05B)}},
+        {{LIMB_PAIR(0xE19A881C, 0x5F8FD91A), LIMB_PAIR(0x8CF8A2C3, 0x355105B0),
+          LIMB_PAIR(0x2810E499, 0x442B9778), LIMB_PAIR(0xDA7972C5, 0x930D835A),
+          LIMB_PAIR(0x555EF4D8, 0xD2266522), LIMB_PAIR(0x64E05B06, 0x943D9ADB),
+          LIMB_PAIR(0x42FC02FA, 0x480BD27F), LIMB_PAIR(0x699E5B7E, 0x9265B289),
+          LIMB_PARTIAL(0x08D)},
+         {LIMB_PAIR(0x55C7CD14, 0xB60DF9C8), LIMB_PAIR(0x270E2672, 0x62131E73),
+          LIMB_PAIR(0x672942B7, 0xE6983794), LIMB_PAIR(0x817DB72E, 0xBF8C55D1),
+          LIMB_PAIR(0x08A5963D, 0xC3785F36), LIMB_PAIR(0x8F39218C, 0x4A664609),
+          LIMB_PAIR(0x1B5B49CC, 0x95C86854), LIMB_PAIR(0x178DF85C, 0x045A0243),
+          LIMB_PARTIAL(0x019)}},
+        {{LIMB_PAIR(0xB666FF60, 0xCCC1BB64), LIMB_PAIR(0xBA04B5C3, 0xE786F358),
+          LIMB_PAIR(0x384C0AD4, 0xBCD5E56D), LIMB_PAIR(0xD0372BBD, 0x5D22436F),
+          LIMB_PAIR(0xA061A543, 0xFEEA9ED9), LIMB_PAIR(0xFA3D34BE, 0x6F81F168),
+          LIMB_PAIR(0x4BA47193, 0xF52059D2), LIMB_PAIR(0x4ADA65AD, 0x5FF05589),
+          LIMB_PARTIAL(0x06F)},
+         {LIMB_PAIR(0x6D4CABF2, 0x346ADED5), LIMB_PAIR(0x4F1A8EE1, 0x65E4B11F),
+          LIMB_PAIR(0x07EBA73A, 0x1521718B), LIMB_PAIR(0xD16D7D56, 0x8A2F32BA),
+          LIMB_PAIR(0xD3ACBB17, 0x01D49595), LIMB_PAIR(0xD3F62095, 0x67625FAA),
+          LIMB_PAIR(0x613B6059, 0x7C3CBECF), LIMB_PAIR(0x6118C496, 0x3908F650),
+          LIMB_PARTIAL(0x16B)}},
+        {{LIMB_PAIR(0xCAB2443D, 0x06494428), LIMB_PAIR(0x6AFD7840, 0xC52AD2D8),
+          LIMB_PAIR(0xFCE7B5F7, 0x8EF6E0A6), LIMB_PAIR(0xA82AE7E3, 0x6151D2B3),
+          LIMB_PAIR(0x14E3B825, 0x08ABB38A), LIMB_PAIR(0x366CADA3, 0x9782E6F9),
+          LIMB_PAIR(0x5076C2FF, 0x9F0127B2), LIMB_PAIR(0x2D812ED5, 0x2F29B728),
+          LIMB_PARTIAL(0x04F)},
+         {LIMB_PAIR(0x04E049F5, 0x7142E7E0), LIMB_PAIR(0xD7F99E76, 0x9338A870),
+          LIMB_PAIR(0x72A90177, 0xF7E4837B), LIMB_PAIR(0x11AACD17, 0xA7BFF799),
+          LIMB_PAIR(0xD1D10B06, 0x5442D6F2), LIMB_PAIR(0x5ECC3F54, 0x986E7BC4),
+          LIMB_PAIR(0x31286FE1, 0x02CF3818), LIMB_PAIR(0xCD383EAC, 0x5CDC56D1),
+          LIMB_PARTIAL(0x02D)}},
+        {{LIMB_PAIR(0xC80291F9, 0x7303EC69), LIMB_PAIR(0x0C9FF7F4, 0x0F2C6439),
+          LIMB_PAIR(0xF3ADA285, 0x96C08EA0), LIMB_PAIR(0xDEAE887C, 0x3CB50F3D),
+          LIMB_PAIR(0xFEFE26DC, 0xABA571FA), LIMB_PAIR(0x6C6F1071, 0x4E4DBA33),
+          LIMB_PAIR(0xF02BDA38, 0xF5796982), LIMB_PAIR(0x40485DE2, 0xA59C60B1),
+          LIMB_PARTIAL(0x0A1)},
+         {LIMB_PAIR(0xCAB044F7, 0x28D7C281), LIMB_PAIR(0x515D247A, 0xA5EB04FE),
+          LIMB_PAIR(0xBA014B10, 0x5B42D919), LIMB_PAIR(0xDE221CC1, 0xB150B4FB),
+          LIMB_PAIR(0x22A5A502, 0xB5CB8C3A), LIMB_PAIR(0xCC37E34A, 0x62C0DA97),
+          LIMB_PAIR(0x9E827814, 0x4B9BFB1F), LIMB_PAIR(0xC97679AC, 0x96666256),
+          LIMB_PARTIAL(0x0E6)}},
+        {{LIMB_PAIR(0x8B894AC8, 0x415FAB9A), LIMB_PAIR(0x64822449, 0xB189914D),
+          LIMB_PAIR(0x0F4B9444, 0x0ABFDBF5), LIMB_PAIR(0xEB96CF1F, 0xA333E872),
+          LIMB_PAIR(0xB8C5318A, 0x91D3473D), LIMB_PAIR(0x24D09CB4, 0xBB5740E6),
+          LIMB_PAIR(0x5B5D73EA, 0xEBE6EF7F), LIMB_PAIR(0x09F67393, 0xBE333388),
+          LIMB_PARTIAL(0x0FC)},
+         {LIMB_PAIR(0x1FFA22B4, 0x9970D38E), LIMB_PAIR(0x003E55F9, 0x00D1FB74),
+          LIMB_PAIR(0x820F7BFD, 0x0D1EF824), LIMB_PAIR(0x73FC040D, 0x43521251),
+          LIMB_PAIR(0xE51B5870, 0x295F8A66), LIMB_PAIR(0x3DBFE159, 0xCEACB67D),
+          LIMB_PAIR(0xA218D2FE, 0x0EE77417), LIMB_PAIR(0xF3B7D44A, 0x25A0E0A9),
+          LIMB_PARTIAL(0x0F8)}},
+        {{LIMB_PAIR(0x83EF0448, 0xC1F76984), LIMB_PAIR(0xFB276974, 0xC4D18389),
+          LIMB_PAIR(0xE52836C2, 0xFEF2C810), LIMB_PAIR(0xC09E4020, 0x3687104B),
+          LIMB_PAIR(0x0CC4BF06, 0xEC3248EF), LIMB_PAIR(0xC401078B, 0x38DAA51B),
+          LIMB_PAIR(0x57BC72F2, 0x84BD9F61), LIMB_PAIR(0x003676EB, 0x68B23E45),
+          LIMB_PARTIAL(0x09D)},
+         {LIMB_PAIR(0xD78B9D6B, 0x22526E98), LIMB_PAIR(0xC4F28366, 0xC4CCDC71),
+          LIMB_PAIR(0x1C646B9D, 0x7DD12D94), LIMB_PAIR(0x931BD51B, 0x0CC00136),
+          LIMB_PAIR(0x512EC8A6, 0xFEBF1E1E), LIMB_PAIR(0xBDC888B1, 0x6BC281F6),
+          LIMB_PAIR(0xF6AB354F, 0x0BC271F3), LIMB_PAIR(0x30C4E559, 0x27D1EE76),
+          LIMB_PARTIAL(0x038)}},
+        {{LIMB_PAIR(0x4ACCCF77, 0x12427D32), LIMB_PAIR(0xFB77F869, 0x3194664F),
+          LIMB_PAIR(0x61A58E24, 0x07E01CAC), LIMB_PAIR(0x91BF22B5, 0xC506637B),
+          LIMB_PAIR(0xDD2D701A, 0xCE7D0251), LIMB_PAIR(0xBEFC0D7F, 0xF9A662D4),
+          LIMB_PAIR(0x2C6C9454, 0xA54117BA), LIMB_PAIR(0x6978E919, 0x31864E41),
+          LIMB_PARTIAL(0x07C)},
+         {LIMB_PAIR(0x9D971044, 0xBBE41902), LIMB_PAIR(0xF8F24116, 0x68742001),
+          LIMB_PAIR(0x3E4A40EC, 0x6D006593), LIMB_PAIR(0x82771429, 0x9FC1B8E2),
+          LIMB_PAIR(0x2E7968CA, 0x59B2F934), LIMB_PAIR(0x470DD353, 0x4817F90B),
+          LIMB_PAIR(0x7E2C1429, 0x3D32E10F), LIMB_PAIR(0x00206509, 0x43E9474E),
+          LIMB_PARTIAL(0x076)}}
+    },
+    {   // (1..8) * 2^(16 * 12) * G
+        {{LIMB_PAIR(0x6DEBBCF6, 0xFDF7681D), LIMB_PAIR(0x600EA3C3, 0xE21AEF25),
+          LIMB_PAIR(0xBB30B75B, 0x181FB048), LIMB_PAIR(0x8D8B7B4F, 0xF9D8C43D),
+          LIMB_PAIR(0xCA68EC32, 0x3D3BC6DE), LIMB_PAIR(0xAF1641EB, 0x6D469252),
+          LIMB_PAIR(0x10252291, 0x1BE3C9BA), LIMB_PAIR(0x8FA4C10B, 0xB57F2C32),
+          LIMB_PARTIAL(0x155)},
+         {LIMB_PAIR(0x9EA96C94, 0x599E10E5), LIMB_PAIR(0x40593CE0, 0x4426DEB7),
+          LIMB_PAIR(0x2D48D29F, 0x948D9286), LIMB_PAIR(0xC03F5CC5, 0xD3AD8E54),
+          LIMB_PAIR(0x219CD0D4, 0x53FE15E4), LIMB_PAIR(0x0C8FC479, 0x03B91421),
+          LIMB_PAIR(0xE5AA96E6, 0xA023C978), LIMB_PAIR(0xEDB69F81, 0xDEE00502),
+          LIMB_PARTIAL(0x0B7)}},
+        {{LIMB_PAIR(0x200AD609, 0x28904911), LIMB_PAIR(0x3505C98B, 0x6FB2B663),
+          LIMB_PAIR(0x17AD4ABA, 0x1BF6E6B5), LIMB_PAIR(0xDBD8E9B0, 0x6D0E654F),
+          LIMB_PAIR(0xF588FBB6, 0x8DB772C1), LIMB_PAIR(0xA292489E, 0x5C2B736F),
+          LIMB_PAIR(0xB902A7C9, 0xEAC6E04A), LIMB_PAIR(0xB2DBAFAD, 0x249C84E7),
+          LIMB_PARTIAL(0x10B)},
+         {LIMB_PAIR(0x29DE2306, 0x2CBC0390), LIMB_PAIR(0xBFC36A57, 0xAC01D1A5),
+          LIMB_PAIR(0xBACD8B95, 0x89F1A059), LIMB_PAIR(0x3E92C99A, 0x2E1E095A),
+          LIMB_PAIR(0x07B4E976, 0xF172BAD6), LIMB_PAIR(0x35885013, 0xDCE0B2E4),
+          LIMB_PAIR(0x7FA11B87, 0x9A0C5556), LIMB_PAIR(0x7EAB7AD3, 0x1DF0DFD6),
+          LIMB_PARTIAL(0x08C)}},
+        {{LIMB_PAIR(0x6A7E545F, 0x3555F75C), LIMB_PAIR(0x7A15BD6C, 0x1EA37A8E),
+          LIMB_PAIR(0x66F5C712, 0x188207A3), LIMB_PAIR(0x4926901E, 0x0FC45BD9),
+          LIMB_PAIR(0xD34B1E01, 0xC55D2D8C), LIMB_PAIR(0xD84F7268, 0xFC75E1AF),
+          LIMB_PAIR(0xBEC74EE3, 0xDED24E68), LIMB_PAIR(0xB82806BA, 0x0F611682),
+          LIMB_PARTIAL(0x0E2)},
+         {LIMB_PAIR(0xF1943440, 0x5454065A), LIMB_PAIR(0xD01B257E, 0x88291BFF),
+          LIMB_PAIR(0xC6AE2502, 0x6EACA283), LIMB_PAIR(0x8A74CBE8, 0x88F29CE0),
+          LIMB_PAIR(0xADCE5E80, 0x6DDB3AE9), LIMB_PAIR(0xBD911187, 0x93DF4593),
+          LIMB_PAIR(0xA6B62E07, 0x16BDC203), LIMB_PAIR(0xE8EAAC95, 0x3A0AD818),
+          LIMB_PARTIAL(0x11F)}},
+        {{LIMB_PAIR(0xCD7BBB6A, 0x1206EA28), LIMB_PAIR(0xC63062FA, 0xEFF556D0),
+          LIMB_PAIR(0xDEB86A3A, 0x8AD321FA), LIMB_PAIR(0xF78FCDC3, 0x9EA9FBDA),
+          LIMB_PAIR(0x0E8C80A8, 0x3EF406CB), LIMB_PAIR(0x0F593D36, 0xC168B597),
+          LIMB_PAIR(0xC352A3A0, 0xD6456267), LIMB_PAIR(0x32C5A9A8, 0x303BD083),
+          LIMB_PARTIAL(0x102)},
+         {LIMB_PAIR(0xE680D0F9, 0xBF911F73), LIMB_PAIR(0xBC1A1B47, 0xB12FCCA8),
+          LIMB_PAIR(0xEF8024F6, 0xB8264577), LIMB_PAIR(0xF66AE119, 0x9D17B8B7),
+          LIMB_PAIR(0x75B33227, 0xB135DFC2), LIMB_PAIR(0x96E667C2, 0x4CBF0D6D),
+          LIMB_PAIR(0xBA373B24, 0xFFF742BE), LIMB_PAIR(0x776CBD3B, 0x218E787E),
+          LIMB_PARTIAL(0x0CC)}},
+        {{LIMB_PAIR(0xEFB91DE7, 0x1F8215F9), LIMB_PAIR(0x8A2F74D9, 0xF3ADD5D0),
+          LIMB_PAIR(0xA520D556, 0x56433008), LIMB_PAIR(0x8628AC75, 0xB6DF83C5),
+          LIMB_PAIR(0x7390EEA0, 0xF3C38EA2), LIMB_PAIR(0x6078A673, 0xB1AADF0F),
+          LIMB_PAIR(0x27B6B8FB, 0xA9E08328), LIMB_PAIR(0xF3B7CE53, 0x22E64291),
+          LIMB_PARTIAL(0x17F)},
+         {LIMB_PAIR(0x6E69500A, 0xB3E7AE4C), LIMB_PAIR(0xC441E02C, 0x740B9752),
+          LIMB_PAIR(0xF503D4A0, 0x3D04D6DC), LIMB_PAIR(0x862F3496, 0x22490A59),
+          LIMB_PAIR(0xB2472177, 0x0F4A62AA), LIMB_PAIR(0x79720C85, 0x668475B9),
+          LIMB_PAIR(0xED9B4FD9, 0xF6EBEB0B), LIMB_PAIR(0x914E8BF4, 0x8A5A6926),
+          LIMB_PARTIAL(0x0F2)}},
+        {{LIMB_PAIR(0xE97EA880, 0x4231DA59), LIMB_PAIR(0x45262614, 0x5D4C0487),
+          LIMB_PAIR(0x36AEEAEE, 0x37186437), LIMB_PAIR(0xBBAA66CB, 0x17229D1D),
+          LIMB_PAIR(0xA5D41097, 0x342DAF59), LIMB_PAIR(0x5080F051, 0x5FC2CC01),
+          LIMB_PAIR(0x0E6527BE, 0x657C05A2), LIMB_PAIR(0x949E36EC, 0x3E61C315),
+          LIMB_PARTIAL(0x008)},
+         {LIMB_PAIR(0xD8A5319F, 0x961BDC35), LIMB_PAIR(0x74708CD1, 0x5B8F4DB8),
+          LIMB_PAIR(0x4726604C, 0x901D2856), LIMB_PAIR(0xCCC10400, 0xE35AD211),
+          LIMB_PAIR(0x94004A0F, 0x5A9B1205), LIMB_PAIR(0x5C8EAABD, 0xDBF493BF),
+          LIMB_PAIR(0xBAFF6FD2, 0x6CCC828B), LIMB_PAIR(0x77E9A126, 0x83003F10),
+          LIMB_PARTIAL(0x0B9)}},
+        {{LIMB_PAIR(0x4C2A4CEF, 0x3D91EA60), LIMB_PAIR(0x3DE838AD, 0x8DE8F69C),
+          LIMB_PAIR(0x538C37D7, 0x9A725723), LIMB_PAIR(0x7948B4EC, 0x3923FA07),
+          LIMB_PAIR(0xD23E67F0, 0xD1A25D23), LIMB_PAIR(0x396FBC50, 0xA2D7B9D7),
+          LIMB_PAIR(0x1D36F98C, 0x8F8504E4), LIMB_PAIR(0x59191798, 0xAA9E5851),
+          LIMB_PARTIAL(0x147)},
+         {LIMB_PAIR(0xE3DB7296, 0x8EDBF0C2), LIMB_PAIR(0x81FC8F30, 0x677A2996),
+          LIMB_PAIR(0xB727E6AA, 0x05E27B8D), LIMB_PAIR(0x03113B4E, 0x4F5A9A69),
+          LIMB_PAIR(0x3ED42117, 0x9D4724E8), LIMB_PAIR(0x72FCB859, 0x06C0B8A5),
+          LIMB_PAIR(0xAD040B87, 0xECDCF4D8), LIMB_PAIR(0x8CDA9EB0, 0xE6BB9A0E),
+          LIMB_PARTIAL(0x1D4)}},
+        {{LIMB_PAIR(0x1236BEC1, 0x6287BBCA), LIMB_PAIR(0x608E6B5C, 0xC16EABD8),
+          LIMB_PAIR(0x15FCD3C6, 0x253193EF), LIMB_PAIR(0xDA5FE623, 0xD4EE71C7),
+          LIMB_PAIR(0xAC806CB8, 0x62531449), LIMB_PAIR(0x90D7E00D, 0x9152CF16),
+          LIMB_PAIR(0xD20A1668, 0xA1E05703), LIMB_PAIR(0xBBF588DA, 0x6480D486),
+          LIMB_PARTIAL(0x14F)},
+         {LIMB_PAIR(0xFE2753E3, 0x37F70AB3), LIMB_PAIR(0x023EBDF8, 0x562F4A46),
+          LIMB_PAIR(0x89CAF63A, 0x97358D7D), LIMB_PAIR(0xAB4B1DFB, 0x387422A7),
+          LIMB_PAIR(0x2C8C3421, 0x80D65496), LIMB_PAIR(0xDB8E13CD, 0x7D338B4B),
+          LIMB_PAIR(0xAC590192, 0xA535529D), LIMB_PAIR(0xA6760430, 0x39A28761),
+          LIMB_PARTIAL(0x0C7)}}
+    },
+    {   // (1..8) * 2^(16 * 13) * G
+        {{LIMB_PAIR(0xC4C762BC, 0x0FC6C549), LIMB_PAIR(0x4E5EB96F, 0xC43915E3),
+          LIMB_PAIR(0xD1BB0B5B, 0xAD88EE68), LIMB_PAIR(0x3F1F26A3, 0x484A9FAD),
+          LIMB_PAIR(0x2BC15E9D, 0x0D93055C), LIMB_PAIR(0x06D26BB7, 0xA745ABBB),
+          LIMB_PAIR(0x464F0731, 0xF60ED3B8), LIMB_PAIR(0xEA9058BF, 0x963D8D94),
+          LIMB_PARTIAL(0x039)},
+         {LIMB_PAIR(0x7B67B298, 0x4608AC08), LIMB_PAIR(0xC85CF812, 0x3BAF2AE6),
+          LIMB_PAIR(0x0D25BEDF, 0xB30AEC55), LIMB_PAIR(0x7CE48459, 0x58149350),
+          LIMB_PAIR(0xD3C41E2D, 0xFCB39F45), LIMB_PAIR(0x126E11A7, 0x48D241A0),
+          LIMB_PAIR(0x909A1621, 0x7B425421), LIMB_PAIR(0xE746BF4B, 0x9BB349DD),
+          LIMB_PARTIAL(0x0AB)}},
+        {{LIMB_PAIR(0xA52D1421, 0x8F45148D), LIMB_PAIR(0x09DAF522, 0xE89923FD),
+          LIMB_PAIR(0xC8F15492, 0x112CA311), LIMB_PAIR(0x469E61FB, 0x91B33CCB),
+          LIMB_PAIR(0xFB2AB91B, 0x040DE443), LIMB_PAIR(0x4F9B32E8, 0xB9D124FD),
+          LIMB_PAIR(0xF07573BD, 0x84DA47A9), LIMB_PAIR(0xAACDD14F, 0x93B7EE6B),
+          LIMB_PARTIAL(0x064)},
+         {LIMB_PAIR(0x4BE64122, 0xB3AF161F), LIMB_PAIR(0x149C5475, 0x5946D2EC),
+          LIMB_PAIR(0x256A1ECB, 0xDC04FCD0), LIMB_PAIR(0x327E7A8D, 0x4FC571B7),
+          LIMB_PAIR(0x9580EDCB, 0x5206EA55), LIMB_PAIR(0xF20A94C0, 0x7F41A742),
+          LIMB_PAIR(0xF7FE1FBB, 0x1BFDDFF0), LIMB_PAIR(0xE2F1FDDC, 0x3860B232),
+          LIMB_PARTIAL(0x1CA)}},
+        {{LIMB_PAIR(0x10392DB1, 0x9DE5C6D8), LIMB_PAIR(0x7912DAE2, 0xF58B3C58),
+          LIMB_PAIR(0xC559FD2E, 0xA367F217), LIMB_PAIR(0x466A352B, 0x78F2AABB),
+          LIMB_PAIR(0xE8271660, 0xFF58D1A3), LIMB_PAIR(0x8BD06035, 0x0D06FA5B),
+          LIMB_PAIR(0xFEA2895A, 0x026934B2), LIMB_PAIR(0xB7E1A1FF, 0x99899ABC),
+          LIMB_PARTIAL(0x187)},
+         {LIMB_PAIR(0x55BB32EC, 0xFD0BCBB3), LIMB_PAIR(0x7F5D72D8, 0xAC96A04D),
+          LIMB_PAIR(0xD939D606, 0x0D5626E3), LIMB_PAIR(0x04504A8B, 0x145BBEF6),
+          LIMB_PAIR(0xE4132C27, 0x4D946B4E), LIMB_PAIR(0x3EC1CFEB, 0x4E7887FB),
+          LIMB_PAIR(0xE1D6E0E6, 0xEDEBCC5B), LIMB_PAIR(0x2BF4379C, 0xEB42BD23),
+          LIMB_PARTIAL(0x0FA)}},
+        {{LIMB_PAIR(0x155C337B, 0x7EAEFE12), LIMB_PAIR(0xC7186596, 0x357F27CE),
+          LIMB_PAIR(0x654DBBEB, 0x90C26C69), LIMB_PAIR(0xA1B63A6A, 0x6BCCA278),
+          LIMB_PAIR(0x8EDD9123, 0x776B7A92), LIMB_PAIR(0x6C6DA5E9, 0xB2BEF507),
+          LIMB_PAIR(0x0E3C747B, 0x805ED3AA), LIMB_PAIR(0x659DF2EF, 0x298EF458),
+          LIMB_PARTIAL(0x098)},
+         {LIMB_PAIR(0x35A79F8D, 0xE3DD8939), LIMB_PAIR(0xA1972C6B, 0x672B109C),
+          LIMB_PAIR(0x07953A4D, 0xAD41CBAE), LIMB_PAIR(0xD206DE77, 0xDE07527F),
+          LIMB_PAIR(0xB61D9811, 0x1F55A4C0), LIMB_PAIR(0x7A75360E, 0x929D56D5),
+          LIMB_PAIR(0x5032EFE6, 0x9F2BECFF), LIMB_PAIR(0x60F0622C, 0x0DE654C7),
+          LIMB_PARTIAL(0x018)}},
+        {{LIMB_PAIR(0x632B1ECF, 0x971B8F03), LIMB_PAIR(0xE4B06088, 0x4052AE98),
+          LIMB_PAIR(0x5AEE5313, 0x323C3E29), LIMB_PAIR(0x635E62C0, 0x7574C5DE),
+          LIMB_PAIR(0xF0595C76, 0x2F53804C), LIMB_PAIR(0xBF3BC3AF, 0x2ECD2BC5),
+          LIMB_PAIR(0xFABA7271, 0x5C7EFEC0), LIMB_PAIR(0x867C13BC, 0xDB04A6EE),
+          LIMB_PARTIAL(0x155)},
+         {LIMB_PAIR(0xCE3FF1E4, 0xD971CB39), LIMB_PAIR(0x7F56172F, 0x15D128CB),
+          LIMB_PAIR(0x4B6EE708, 0xA1DF4ABB), LIMB_PAIR(0x3C9EBBEA, 0x06A4BC6C),
+          LIMB_PAIR(0xB3FA98D4, 0x766544EB), LIMB_PAIR(0xA2C44D89, 0x78399E61),
+          LIMB_PAIR(0xA25D711D, 0xA6EF214C), LIMB_PAIR(0xDB54091B, 0x643648C3),
+          LIMB_PARTIAL(0x0BD)}},
+        {{LIMB_PAIR(0x7E90D114, 0x5836D62A), LIMB_PAIR(0x95A519C6, 0x661E32F3),
+          LIMB_PAIR(0x69BACBAE, 0x9C1082C8), LIMB_PAIR(0xF10CBFAD, 0x5A4BBB58),
+          LIMB_PAIR(0x7C1BE909, 0x04EE0B06), LIMB_PAIR(0x8EA7768A, 0xC726F052),
+          LIMB_PAIR(0x5B1B777E, 0xD82148C7), LIMB_PAIR(0x82E33686, 0x0B9F20BF),
+          LIMB_PARTIAL(0x172)},
+         {LIMB_PAIR(0xCBE4B02C, 0x2CB030B0), LIMB_PAIR(0x8382C749, 0xBAEFED9F),
+          LIMB_PAIR(0x1DAFDDA6, 0x8DF9D1D0), LIMB_PAIR(0xFE045A44, 0x9F4B2CC1),
+          LIMB_PAIR(0x9CEFB90C, 0xDC102609), LIMB_PAIR(0x9027BB0B, 0x577098DF),
+          LIMB_PAIR(0xB6260AFF, 0xA13DEC95), LIMB_PAIR(0x5011ACD4, 0xD45A8C13),
+          LIMB_PARTIAL(0x16D)}},
+        {{LIMB_PAIR(0x0F694063, 0x4DC3246F), LIMB_PAIR(0xAEBD3125, 0xED3DD53C),
+          LIMB_PAIR(0x0E985D76, 0x9B3BE97F), LIMB_PAIR(0x9A5EC60C, 0x37EB09EA),
+          LIMB_PAIR(0xF0C7D07C, 0x14FD9893), LIMB_PAIR(0x7FC04709, 0xE085E642),
+          LIMB_PAIR(0x80FC7AA4, 0xD56DB4A7), LIMB_PAIR(0x4398A2C4, 0x16ECF07A),
+          LIMB_PARTIAL(0x0BA)},
+         {LIMB_PAIR(0xF48054E8, 0x672219F5), LIMB_PAIR(0xC56E157F, 0x116743EE),
+          LIMB_PAIR(0xFD5885C4, 0xE9B616AC), LIMB_PAIR(0x1BBE92E4, 0xA9DBC3E3),
+          LIMB_PAIR(0x1FB4DD56, 0x0E3BC901), LIMB_PAIR(0x590246F5, 0x51D3A59D),
+          LIMB_PAIR(0xFDBADCE8, 0x6B003576), LIMB_PAIR(0x09A1973F, 0xE8DDFD6B),
+          LIMB_PARTIAL(0x1E0)}},
+        {{LIMB_PAIR(0xEA8DC4AE, 0x50E39FD1), LIMB_PAIR(0x5FD16C88, 0xC68D8B0F),
+          LIMB_PAIR(0x0CED75AB, 0xC95F46E9), LIMB_PAIR(0x7375E952, 0x845EE394),
+          LIMB_PAIR(0x3C14B1C2, 0x5865161D), LIMB_PAIR(0x399431AC, 0xE29AE3A6),
+          LIMB_PAIR(0xF0FECA0E, 0x02D1C6EA), LIMB_PAIR(0x24F35B02, 0x76059DAD),
+          LIMB_PARTIAL(0x081)},
+         {LIMB_PAIR(0x3AC6A96E, 0x29FEFCA1), LIMB_PAIR(0x5D01C1D8, 0x260A7F7D),
+          LIMB_PAIR(0x3EF9812F, 0x63FA3603), LIMB_PAIR(0xF9404B6D, 0xAB1A91C9),
+          LIMB_PAIR(0xA9406E88, 0x32555CFD), LIMB_PAIR(0x5B63890D, 0x666EAE1C),
+          LIMB_PAIR(0xFE9605E0, 0x22EC92AA), LIMB_PAIR(0x3235E860, 0xDE2A8510),
+          LIMB_PARTIAL(0x0C3)}}
+    },
+    {   // (1..8) * 2^(16 * 14) * G
+        {{LIMB_PAIR(0x1733B3C3, 0x7DDF4705), LIMB_PAIR(0xF4A25D85, 0x7C7878A3),
+          LIMB_PAIR(0x29AD09A6, 0x4D86F57C), LIMB_PAIR(0xB26D5C69, 0xA97D4AB6),
+          LIMB_PAIR(0x04B07913, 0x71CC9250), LIMB_PAIR(0xB4C0B7B2, 0x08A84131),
+          LIMB_PAIR(0x5119F83E, 0x388FC8AA), LIMB_PAIR(0x6BFDA0CB, 0x23A3BD0B),
+          LIMB_PARTIAL(0x07E)},
+         {LIMB_PAIR(0x8E549373, 0xDFC7C844), LIMB_PAIR(0xB52AD215, 0x439DC785),
+          LIMB_PAIR(0xFB9DE6DC, 0x9E157E18), LIMB_PAIR(0x8793D562, 0x9283C331),
+          LIMB_PAIR(0x33DDC16C, 0x79F9EC90), LIMB_PAIR(0xCEFF5086, 0xED0DBB7F),
+          LIMB_PAIR(0x8765145E, 0xFA466807), LIMB_PAIR(0xA3B387B7, 0xBA9411A9),
+          LIMB_PARTIAL(0x176)}},
+        {{LIMB_PAIR(0x10E10587, 0x319885D1), LIMB_PAIR(0x609853A4, 0x2DA8979A),
+          LIMB_PAIR(0x89B08EF5, 0xFE907FE3), LIMB_PAIR(0x1A97D9DC, 0xA3A338A6),
+          LIMB_PAIR(0xD7E3FB92, 0xA5AD1A9A), LIMB_PAIR(0x7A0136E3, 0x77A3BFC0),
+          LIMB_PAIR(0xAA6ED29A, 0x99634588), LIMB_PAIR(0xEF4787B6, 0x41F148BE),
+          LIMB_PARTIAL(0x0DC)},
+         {LIMB_PAIR(0xEBF698BD, 0xB8671195), LIMB_PAIR(0xE2974EE2, 0x323B6965),
+          LIMB_PAIR(0x84C20702, 0x1411C670), LIMB_PAIR(0xBA4BC1ED, 0x840B396E),
+          LIMB_PAIR(0xEECFF9A6, 0xD857A525), LIMB_PAIR(0xD2D6829B, 0x0AFAD4F4),
+          LIMB_PAIR(0xBF6CE02C, 0x84EF6315), LIMB_PAIR(0xCCC6B333, 0xC38FE857),
+          LIMB_PARTIAL(0x01B)}},
+        {{LIMB_PAIR(0x6F07EEF9, 0x2D9BA7E3), LIMB_PAIR(0xEB692362, 0x46EF4CE6),
+          LIMB_PAIR(0x2FA2CDC9, 0xA869EE26), LIMB_PAIR(0x642A2378, 0x5B7D3A81),
+          LIMB_PAIR(0xD4D6BCD4, 0xC024410A), LIMB_PAIR(0x21CEAFEF, 0x88CC0F71),
+          LIMB_PAIR(0xE04AF152, 0xEEE011EB), LIMB_PAIR(0x7829107F, 0x9CF87D1D),
+          LIMB_PARTIAL(0x02E)},
+         {LIMB_PAIR(0xE07147B1, 0x49260571), LIMB_PAIR(0x0CA0C303, 0x63258346),
+          LIMB_PAIR(0x6602E056, 0xF1CDA5AE), LIMB_PAIR(0x81A45861, 0x418B6186),
+          LIMB_PAIR(0xD1921FA5, 0xCBF17FCD), LIMB_PAIR(0xE07A08F1, 0x355E5D1A),
+          LIMB_PAIR(0xA26B6B2F, 0x3F4F5BB0), LIMB_PAIR(0xADE69B50, 0x898CA884),
+          LIMB_PARTIAL(0x08F)}},
+        {{LIMB_PAIR(0x1C417FAD, 0x1A00FC11), LIMB_PAIR(0x3FBA7366, 0x8816DD0B),
+          LIMB_PAIR(0x32C0E5A9, 0xB3A54992), LIMB_PAIR(0x9EC0FA14, 0xB6A63478),
+          LIMB_PAIR(0xA8D8615E, 0x880B10B8), LIMB_PAIR(0x3ABBE5FB, 0xE3635BB8),
+          LIMB_PAIR(0x4DE9BE52, 0x62A209F6), LIMB_PAIR(0x82B76CF9, 0xAC41CCE1),
+          LIMB_PARTIAL(0x1C5)},
+         {LIMB_PAIR(0x7DD1E73F, 0x287C7BC7), LIMB_PAIR(0x1F8C7D2C, 0x072BB2AC),
+          LIMB_PAIR(0x3AF5565C, 0x399011FB), LIMB_PAIR(0x5E2A7E13, 0x787B9484),
+          LIMB_PAIR(0x5761AE9C, 0x5858C3DF), LIMB_PAIR(0x6D2875DA, 0xF0F831AE),
+          LIMB_PAIR(0xAE9C82F1, 0xD5F5BF2D), LIMB_PAIR(0xB247A36E, 0x191B45FB),
+          LIMB_PARTIAL(0x1DD)}},
+        {{LIMB_PAIR(0xFE772021, 0x1D2D4AB0), LIMB_PAIR(0x041053D5, 0xD6E75054),
+          LIMB_PAIR(0x5705D868, 0xDB480D2E), LIMB_PAIR(0x6AA63E89, 0xF68A09F7),
+          LIMB_PAIR(0x379A4D0C, 0x0BCF4C31), LIMB_PAIR(0xB681873C, 0xCBC0C737),
+          LIMB_PAIR(0xB886D407, 0xDB6931A6), LIMB_PAIR(0xF84E033D, 0x0FBAA44B),
+          LIMB_PARTIAL(0x056)},
+         {LIMB_PAIR(0x4F90A0FC, 0x5339B4F3), LIMB_PAIR(0x8EBC0B28, 0x2743F681),
+          LIMB_PAIR(0xF7DB2715, 0x37567E5B), LIMB_PAIR(0xA5B1053A, 0xF339C91A),
+          LIMB_PAIR(0x8125EBFB, 0xDE65F718), LIMB_PAIR(0x6BF4ED15, 0x32F7C06D),
+          LIMB_PAIR(0x40353DCF, 0x8071D1AA), LIMB_PAIR(0x3C994068, 0xB8FDDDD9),
+          LIMB_PARTIAL(0x198)}},
+        {{LIMB_PAIR(0xB6965640, 0x1C081356), LIMB_PAIR(0x90C7A0F0, 0x7A01B389),
+          LIMB_PAIR(0x874007EE, 0xF72FDBA4), LIMB_PAIR(0xDCDDEFA2, 0x6BD85D94),
+          LIMB_PAIR(0x48DB2FA6, 0x80FBDE7E), LIMB_PAIR(0x4A319DAD, 0x60B2BE1C),
+          LIMB_PAIR(0xEE51FB71, 0x996217FB), LIMB_PAIR(0xE0EDB983, 0x85F1B13B),
+          LIMB_PARTIAL(0x12B)},
+         {LIMB_PAIR(0xECFB1D0D, 0xDF53AA14), LIMB_PAIR(0x760A217C, 0xDD77FC37),
+          LIMB_PAIR(0x99B56FBD, 0x659BF31E), LIMB_PAIR(0xACA3E106, 0xD0F042EB),
+          LIMB_PAIR(0x1F907EA8, 0x50C215BA), LIMB_PAIR(0xA4EF5F48, 0xC6BB892C),
+          LIMB_PAIR(0xFEB86870, 0xC3BEB73B), LIMB_PAIR(0x4123F812, 0x04B740BD),
+          LIMB_PARTIAL(0x07C)}},
+        {{LIMB_PAIR(0x6016E8F8, 0xD50C9FCF), LIMB_PAIR(0xB8C12F9A, 0x27F12C32),
+          LIMB_PAIR(0x08E0E13C, 0x2E13FD2B), LIMB_PAIR(0x89E659EF, 0xE48A1BCE),
+          LIMB_PAIR(0xF62A49D6, 0x1BBE7F01), LIMB_PAIR(0xD417E497, 0x87E0CA4F),
+          LIMB_PAIR(0x364EE9CF, 0x1CF55A48), LIMB_PAIR(0xF66635A7, 0xF4FBC7EA),
+          LIMB_PARTIAL(0x1A6)},
+         {LIMB_PAIR(0x3EB12A0B, 0xBE3E5511), LIMB_PAIR(0x462EBDCD, 0xAFFCAD4B),
+          LIMB_PAIR(0xE8F4D182, 0xF6F097AC), LIMB_PAIR(0x404A92FE, 0xDB1FE0F2),
+          LIMB_PAIR(0x4FC084EB, 0x9E2A5159), LIMB_PAIR(0x7AF882B2, 0x6ACD3A8E),
+          LIMB_PAIR(0x9602FC6B, 0x17654A57), LIMB_PAIR(0x71DE39CF, 0x1307D122),
+          LIMB_PARTIAL(0x0DE)}},
+        {{LIMB_PAIR(0x2540E5C8, 0x470BFDD4), LIMB_PAIR(0x057592EC, 0xC2C849A1),
+          LIMB_PAIR(0x2F886637, 0xD8F4B30D), LIMB_PAIR(0x25BA43E0, 0xCE56D150),
+          LIMB_PAIR(0xF200D2FB, 0xCACA4A05), LIMB_PAIR(0x95D80545, 0x38FDFB35),
+          LIMB_PAIR(0x22418951, 0xE274649F), LIMB_PAIR(0xCB7437BE, 0x155BADB2),
+          LIMB_PARTIAL(0x0A4)},
+         {LIMB_PAIR(0xC828A666, 0x09195792), LIMB_PAIR(0x53F59336, 0x3CEAF453),
+          LIMB_PAIR(0x43850A1D, 0x3982E196), LIMB_PAIR(0xF2D2AFBD, 0x02F8077D),
+          LIMB_PAIR(0x6A6946FA, 0x83197E1E), LIMB_PAIR(0xC4FFAD53, 0xF158B0B4),
+          LIMB_PAIR(0x853B51DA, 0x12559573), LIMB_PAIR(0x8D35C9DE, 0x8838409E),
+          LIMB_PARTIAL(0x19C)}}
+    },
+    {   // (1..8) * 2^(16 * 15) * G
+        {{LIMB_PAIR(0x21DD6E7A, 0x0F8341FE), LIMB_PAIR(0xEA93E5C1, 0x5C106F8E),
+          LIMB_PAIR(0xAD0114BC, 0x8E2AD8E9), LIMB_PAIR(0xF059D291, 0x277EF823),
+          LIMB_PAIR(0xDC50FD78, 0xED4A28E5), LIMB_PAIR(0x89CDF20D, 0xA0719651),
+          LIMB_PAIR(0x1FDE162C, 0xE393B264), LIMB_PAIR(0x30A5B16D, 0xD383B86D),
+          LIMB_PARTIAL(0x041)},
+         {LIMB_PAIR(0xAD6DBEAF, 0x04B8115B), LIMB_PAIR(0xA996519B, 0x7D7F0BB9),
+          LIMB_PAIR(0x9C397C91, 0xAB54D4C8), LIMB_PAIR(0x77A6A3E3, 0x1750B97D),
+          LIMB_PAIR(0x14554321, 0x1637909B), LIMB_PAIR(0x7A5AEEA3, 0x7311DA68),
+          LIMB_PAIR(0x52130453, 0x1F91A0FD), LIMB_PAIR(0x86753F28, 0x4338B3D6),
+          LIMB_PARTIAL(0x14C)}},
+        {{LIMB_PAIR(0x4CF92B1F, 0x99A1DAA9), LIMB_PAIR(0xCF013530, 0xB08A7BDE),
+          LIMB_PAIR(0x1576E51B, 0xCBE6C7BC), LIMB_PAIR(0xE6C13E9F, 0x9F88C296),
+          LIMB_PAIR(0x6370791C, 0x13FDC955), LIMB_PAIR(0xA42B1973, 0xADEFAC0D),
+          LIMB_PAIR(0x12CB2FFC, 0xE69418A4), LIMB_PAIR(0x62EAE4E0, 0xAF05CE97),
+          LIMB_PARTIAL(0x05B)},
+         {LIMB_PAIR(0x65E89A12, 0xADB36E65), LIMB_PAIR(0x53131BD7, 0xDE7FEE58),
+          LIMB_PAIR(0xABFFA9C1, 0x7335C5CB), LIMB_PAIR(0x92947061, 0xABF94BC3),
+          LIMB_PAIR(0x6109BC5B, 0x11D2E02B), LIMB_PAIR(0x8A097CDA, 0xFC1FC1D2),
+          LIMB_PAIR(0xF3D5DB21, 0x4512FBB6), LIMB_PAIR(0x336A3D5F, 0xD40E8637),
+          LIMB_PARTIAL(0x13B)}},
+        {{LIMB_PAIR(0xE411C88B, 0x3671D520), LIMB_PAIR(0xAF747CAA, 0xE56D2622),
+          LIMB_PAIR(0x3F298A36, 0x8C2D939F), LIMB_PAIR(0x38B36307, 0xD09F955E),
+          LIMB_PAIR(0xACFE3A5F, 0x7AEF92FD), LIMB_PAIR(0x3C3413E3, 0xAA1B543A),
+          LIMB_PAIR(0x85E8EEA2, 0xA68BCF75), LIMB_PAIR(0x57271AB1, 0x1C33B909),
+          LIMB_PARTIAL(0x175)},
+         {LIMB_PAIR(0x0993374B, 0xE829B548), LIMB_PAIR(0x3758FA53, 0x93ACE6B4),
+          LIMB_PAIR(0xFB48D303, 0x378932AD), LIMB_PAIR(0x7B9ACA58, 0xA0BE54CD),
+          LIMB_PAIR(0x07D56BFC, 0x6F020D2F), LIMB_PAIR(0x332D5724, 0x661CC6DF),
+          LIMB_PAIR(0x4702E14E, 0xE1C67B4C), LIMB_PAIR(0xFE0CE1F4, 0x6D7E1534),
+          LIMB_PARTIAL(0x165)}},
+        {{LIMB_PAIR(0xB7C097FD, 0x70EAE5E2), LIMB_PAIR(0xBECC7C65, 0x690C65C6),
+          LIMB_PAIR(0xBEB8A529, 0xF684CE2C), LIMB_PAIR(0x772826C5, 0xFB5BD6FA),
+          LIMB_PAIR(0x3B0D8680, 0x12025C31), LIMB_PAIR(0xCBEF00AD, 0x8F20FAC7),
+          LIMB_PAIR(0x6FC66AC3, 0xB810BF45), LIMB_PAIR(0xC7878181, 0xA960E1B3),
+          LIMB_PARTIAL(0x1A1)},
+         {LIMB_PAIR(0xF6103B53, 0x85A5E619), LIMB_PAIR(0xFC14A4B5, 0xCC4CF223),
+          LIMB_PAIR(0x977A8C64, 0x68985B1F), LIMB_PAIR(0xFE82447C, 0x410EAF63),
+          LIMB_PAIR(0x0453D341, 0xE2038149), LIMB_PAIR(0x719258DE, 0xE1D008AD),
+          LIMB_PAIR(0x3410D895, 0x26C1B177), LIMB_PAIR(0x45BAE984, 0x93CAD3DA),
+          LIMB_PARTIAL(0x12F)}},
+        {{LIMB_PAIR(0x9DE748B4, 0xB83FDB66), LIMB_PAIR(0x0C41F158, 0xC46F8100),
+          LIMB_PAIR(0xB8F8F374, 0xADE8932F), LIMB_PAIR(0xC7AB11FE, 0x5728E8AA),
+          LIMB_PAIR(0x601535D1, 0xA3BE4365), LIMB_PAIR(0x50C52B71, 0xF366F0D4),
+          LIMB_PAIR(0x84DB7699, 0x6E008600), LIMB_PAIR(0x32BD9061, 0x39C5934C),
+          LIMB_PARTIAL(0x003)},
+         {LIMB_PAIR(0x9C964A3F, 0x4C5F3AB4), LIMB_PAIR(0x69A70BA7, 0x30EE02C3),
+          LIMB_PAIR(0x1699B55B, 0xE4F4E772), LIMB_PAIR(0xF2104682, 0x957EFD09),
+          LIMB_PAIR(0x298947D8, 0x7BE1BDB0), LIMB_PAIR(0xA6CE37DA, 0x128BE588),
+          LIMB_PAIR(0x5110D219, 0x10F0ABBB), LIMB_PAIR(0x6C433528, 0xFE63DE4B),
+          LIMB_PARTIAL(0x0A5)}},
+        {{LIMB_PAIR(0xBCBCF019, 0xEE8B94E0), LIMB_PAIR(0x952A5A75, 0xA3965127),
+          LIMB_PAIR(0xBD99B8E6, 0x5D306FFD), LIMB_PAIR(0xF7F77F82, 0x9726ACFC),
+          LIMB_PAIR(0x333E69A2, 0x52A8C48F), LIMB_PAIR(0xE5310F8C, 0x2561B47E),
+          LIMB_PAIR(0xDDBA50AD, 0x5C707992), LIMB_PAIR(0xD49F9302, 0xCA39FEC1),
+          LIMB_PARTIAL(0x197)},
+         {LIMB_PAIR(0x3330C1DE, 0x773374E0), LIMB_PAIR(0x12186692, 0x3C186E5A),
+          LIMB_PAIR(0x2A07FE4F, 0x7C50D77C), LIMB_PAIR(0xEC8CB87F, 0xB0387D01),
+          LIMB_PAIR(0x24AF7E0D, 0x891A7415), LIMB_PAIR(0x5DCE5454, 0xACD3FC80),
+          LIMB_PAIR(0x257238D4, 0x2A92F9CB), LIMB_PAIR(0x4415B2A6, 0x25075CBC),
+          LIMB_PARTIAL(0x06F)}},
+        {{LIMB_PAIR(0x30AE5727, 0x64F0AE66), LIMB_PAIR(0xCCFE2F46, 0xEB7FEE1C),
+          LIMB_PAIR(0xC17226F5, 0xCB52D65C), LIMB_PAIR(0x4BDE2FF6, 0x11BFDD3C),
+          LIMB_PAIR(0x22F56523, 0x14593DBA), LIMB_PAIR(0xE5A07B06, 0x7549C2A8),
+          LIMB_PAIR(0xA259420C, 0x27E857B0), LIMB_PAIR(0xD795BF2B, 0x5F2702CF),
+          LIMB_PARTIAL(0x0CE)},
+         {LIMB_PAIR(0x99EF6F42, 0x50247B77), LIMB_PAIR(0xA9496281, 0xC5D4D501),
+          LIMB_PAIR(0x848EE90A, 0xC2898FD0), LIMB_PAIR(0x3B105EA7, 0x5916DF47),
+          LIMB_PAIR(0xA3FC2A93, 0xC963D568), LIMB_PAIR(0xA71E69FF, 0x4F5DBD88),
+          LIMB_PAIR(0xED98520A, 0xB1DFB820), LIMB_PAIR(0x5BBB0779, 0xF91D6E9E),
+          LIMB_PARTIAL(0x10E)}},
+        {{LIMB_PAIR(0xDB3002CE, 0x6BCE4008), LIMB_PAIR(0x03FE67EF, 0xE109980C),
+          LIMB_PAIR(0x1CD61540, 0x35F07720), LIMB_PAIR(0x723C0EF2, 0xB0ADFBA4),
+          LIMB_PAIR(0x60CA9A5B, 0x811B1008), LIMB_PAIR(0xC0D112C6, 0xEDD17F04),
+          LIMB_PAIR(0x49688782, 0x8CC7CC5F), LIMB_PAIR(0xD5F89C31, 0x716F36BB),
+          LIMB_PARTIAL(0x031)},
+         {LIMB_PAIR(0x1D19D891, 0x700CB92A), LIMB_PAIR(0x2DAA7A23, 0xB9991826),
+          LIMB_PAIR(0xD9AD0C74, 0x834CD1FD), LIMB_PAIR(0x82C919DA, 0xD74EE376),
+          LIMB_PAIR(0x97696DEE, 0x65693534), LIMB_PAIR(0x12E9AB53, 0xE2615C6E),
+          LIMB_PAIR(0x090BBDF3, 0x4BE93A40), LIMB_PAIR(0x63437098, 0xB8110696),
+          LIMB_PARTIAL(0x162)}}
+    },
+    {   // (1..8) * 2^(16 * 16) * G
+        {{LIMB_PAIR(0xEAFFD713, 0xA87650D1), LIMB_PAIR(0xA797AD44, 0xEC781C97),
+          LIMB_PAIR(0xB4BCAC17, 0x1E94ACCD), LIMB_PAIR(0xB3981CC9, 0x2284F96F),
+          LIMB_PAIR(0x091634EB, 0xB8B2EF57), LIMB_PAIR(0xCAD053D0, 0x4ACCF5E8),
+          LIMB_PAIR(0x5D1EF480, 0x0ECA4F9B), LIMB_PAIR(0xD6E76957, 0x1598EF27),
+          LIMB_PARTIAL(0x131)},
+         {LIMB_PAIR(0xB72D8840, 0x7CBC9061), LIMB_PAIR(0x86A5BA36, 0xE611924D),
+          LIMB_PAIR(0xE066D292, 0xE02E9CA8), LIMB_PAIR(0xA68A0466, 0xDB092F52),
+          LIMB_PAIR(0x0C0B18F8, 0xF5D97F5D), LIMB_PAIR(0x5C99B95C, 0xB5E17146),
+          LIMB_PAIR(0x9D3D6ACF, 0x1BAFBE74), LIMB_PAIR(0xF370BD5F, 0x606103FE),
+          LIMB_PARTIAL(0x13B)}},
+        {{LIMB_PAIR(0x46E69DAF, 0x272EC596), LIMB_PAIR(0x79B09A47, 0x348D7ACD),
+          LIMB_PAIR(0xD806F931, 0x8731070B), LIMB_PAIR(0x011D80CA, 0xE1191599),
+          LIMB_PAIR(0x1B8CD947, 0xD001CED0), LIMB_PAIR(0x78A6654E, 0x31DD3C98),
+          LIMB_PAIR(0xC6409599, 0xDE8DBD0C), LIMB_PAIR(0x691B6141, 0xB8939D44),
+          LIMB_PARTIAL(0x17A)},
+         {LIMB_PAIR(0x9C45660B, 0x146FDD62), LIMB_PAIR(0xA6283D26, 0xEB9A13D3),
+          LIMB_PAIR(0xC9E2A86B, 0xB99E7E66), LIMB_PAIR(0xE626A5EA, 0x926EE0AB),
+          LIMB_PAIR(0xE8A93DED, 0xF01EC218), LIMB_PAIR(0x040FB497, 0x8562B91A),
+          LIMB_PAIR(0x6DDD2F63, 0x25FA595F), LIMB_PAIR(0xA2612413, 0x9389FFFC),
+          LIMB_PARTIAL(0x0D2)}},
+        {{LIMB_PAIR(0x6599420C, 0xC65023DB), LIMB_PAIR(0x2DE4F201, 0xD5F25993),
+          LIMB_PAIR(0x325DB6DE, 0xDF04EB7F), LIMB_PAIR(0x088C5B7B, 0xBA7A4C67),
+          LIMB_PAIR(0x14FFF349, 0x42880303), LIMB_PAIR(0xCED29B1C, 0x5D8C5AC1),
+          LIMB_PAIR(0xA9D0FF4F, 0xBA44893A), LIMB_PAIR(0xED3F3117, 0xC94974BA),
+          LIMB_PARTIAL(0x10F)},
+         {LIMB_PAIR(0xFFE235F6, 0xD804DAFC), LIMB_PAIR(0x67C31EFD, 0x1701E38D),
+          LIMB_PAIR(0x6B9307C1, 0xD6B49909), LIMB_PAIR(0x1FA96EBA, 0xF33C7496),
+          LIMB_PAIR(0x92099D0B, 0xFAB4F9F8), LIMB_PAIR(0x6D5334F5, 0x3CC5ED86),
+          LIMB_PAIR(0xC94E6D74, 0x41745249), LIMB_PAIR(0xDD4B2B7C, 0x27EF9399),
+          LIMB_PARTIAL(0x18F)}},
+        {{LIMB_PAIR(0x47EDD0E3, 0xD1A48C68), LIMB_PAIR(0x253C6BB5, 0xFEFB60BE),
+          LIMB_PAIR(0x5AB3E95D, 0x7265EBB7), LIMB_PAIR(0xF058192C, 0xC8D1B679),
+          LIMB_PAIR(0xFA21C3EB, 0xCDC478D6), LIMB_PAIR(0x10B2B221, 0xDF6360DC),
+          LIMB_PAIR(0x1101D18E, 0x824B28A7), LIMB_PAIR(0xE04269D1, 0x4BC043F1),
+          LIMB_PARTIAL(0x032)},
+         {LIMB_PAIR(0x5D49E112, 0xA342984E), LIMB_PAIR(0x4E80CD3B, 0x981AC554),
+          LIMB_PAIR(0x2C45F14D, 0x489EDE32), LIMB_PAIR(0x0671C724, 0xB97B3BA5),
+          LIMB_PAIR(0xBAE2CD87, 0x3818C351), LIMB_PAIR(0x61521947, 0xF3719C92),
+          LIMB_PAIR(0xA8252D72, 0xB9116ED9), LIMB_PAIR(0x9C406F54, 0x992761ED),
+          LIMB_PARTIAL(0x141)}},
+        {{LIMB_PAIR(0x1FFEBCA8, 0x9B27FAE4), LIMB_PAIR(0xC5C859D5, 0xE9F906D8),
+          LIMB_PAIR(0x36E50ADE, 0xA3B727FF), LIMB_PAIR(0xD7685714, 0x95307CF6),
+          LIMB_PAIR(0xB12746CD, 0xDDC0DF1F), LIMB_PAIR(0x38D91211, 0x46128492),
+          LIMB_PAIR(0x1D3EC9C2, 0x09CB00C7), LIMB_PAIR(0x556AEC93, 0x45BCC736),
+          LIMB_PARTIAL(0x147)},
+         {LIMB_PAIR(0x3B06B817, 0x08CAAAF7), LIMB_PAIR(0x6F0EF309, 0x7664BB13),
+          LIMB_PAIR(0xF9D1878D, 0x6AE38711), LIMB_PAIR(0xF8BE5C1F, 0x30BE2E46),
+          LIMB_PAIR(0x79E9064E, 0x6158AE6F), LIMB_PAIR(0x6FBEDEA7, 0x52E5CBE0),
+          LIMB_PAIR(0x6DEF5C69, 0x0B8F64E7), LIMB_PAIR(0xD1F043ED, 0x6AEA5E7C),
+          LIMB_PARTIAL(0x0B6)}},
+        {{LIMB_PAIR(0xECC0A759, 0x8A651D57), LIMB_PAIR(0x0C397ADB, 0x3FB5FEA9),
+          LIMB_PAIR(0xAB6247D5, 0x9F04790A), LIMB_PAIR(0xC823801D, 0xB1269A13),
+          LIMB_PAIR(0xD2F4034B, 0x19D61215), LIMB_PAIR(0xB579382E, 0x8814EB23),
+          LIMB_PAIR(0xEEA3E4E7, 0x0C2023B1), LIMB_PAIR(0x2B5E1EA5, 0x5D6F0375),
+          LIMB_PARTIAL(0x195)},
+         {LIMB_PAIR(0xBC9FBC6A, 0x26176EF3), LIMB_PAIR(0x636333E0, 0x88AF6C5D),
+          LIMB_PAIR(0xBC520078, 0x90F1A752), LIMB_PAIR(0x53B93FE0, 0x9D7FDD83),
+          LIMB_PAIR(0xF4CA8BC0, 0x54FA1A12), LIMB_PAIR(0x78F683EB, 0xB899D0CE),
+          LIMB_PAIR(0xF129CC78, 0xBA2E014C), LIMB_PAIR(0x3620B670, 0x268CC1D7),
+          LIMB_PARTIAL(0x0AF)}},
+        {{LIMB_PAIR(0x6939F7CC, 0x30FF765E), LIMB_PAIR(0xE29539FA, 0x6B45FE45),
+          LIMB_PAIR(0x3DE8DEFF, 0x9BEE02F0), LIMB_PAIR(0x422BB010, 0x5CFB4D5B),
+          LIMB_PAIR(0x66C50B56, 0x864E6A6F), LIMB_PAIR(0x3CB97C42, 0x2B36BAEF),
+          LIMB_PAIR(0xF6376684, 0x5A2FDF30), LIMB_PAIR(0xB8064230, 0x5FBF2F7A),
+          LIMB_PARTIAL(0x11B)},
+         {LIMB_PAIR(0x208CCE19, 0x6394407D), LIMB_PAIR(0xF4A37C9E, 0x0FBE4793),
+          LIMB_PAIR(0x602CFFDB, 0x635DC6AA), LIMB_PAIR(0xACE2DAF5, 0x914F6669),
+          LIMB_PAIR(0xF042C02D, 0xD66F7167), LIMB_PAIR(0xDC027BE7, 0xFE264CEF),
+          LIMB_PAIR(0xF4742027, 0xA345D34A), LIMB_PAIR(0x06F4FDAF, 0x2E4E5757),
+          LIMB_PARTIAL(0x05D)}},
+        {{LIMB_PAIR(0xB9F59031, 0xDFBFA8C0), LIMB_PAIR(0xA5E17023, 0x683DF70B),
+          LIMB_PAIR(0x42CE28B7, 0x07958FDC), LIMB_PAIR(0xC6D4DC78, 0xB8965B5B),
+          LIMB_PAIR(0x6E4B4290, 0x78441B9A), LIMB_PAIR(0xEA4B4AA1, 0x3909E659),
+          LIMB_PAIR(0x29B6CD62, 0x9C8F59C6), LIMB_PAIR(0x19A026CC, 0xF400A019),
+          LIMB_PARTIAL(0x0CF)},
+         {LIMB_PAIR(0xF77FA34F, 0x09844EDE), LIMB_PAIR(0x95B4ACFA, 0x9DA8CDC4),
+          LIMB_PAIR(0x4D52835B, 0x5BB76207), LIMB_PAIR(0x9C0584E1, 0xC39505E2),
+          LIMB_PAIR(0x6C4F318E, 0x4C9A0F29), LIMB_PAIR(0x7D87F206, 0xDD1A8F41),
+          LIMB_PAIR(0x95EC312C, 0x423805CD), LIMB_PAIR(0x9304343E, 0x21639F51),
+          LIMB_PARTIAL(0x092)}}
+    },
+    {   // (1..8) * 2^(16 * 17) * G
+        {{LIMB_PAIR(0xCECDF0DC, 0x0E13C1DD), LIMB_PAIR(0xEEB9AA6C, 0xACD530B6),
+          LIMB_PAIR(0x0AF8D3A8, 0xBE3C0FC8), LIMB_PAIR(0xCE44AE8B, 0xEE67F380),
+          LIMB_PAIR(0x3854B528, 0x9ADC5636), LIMB_PAIR(0x130F4497, 0x527F7F90),
+          LIMB_PAIR(0xE80C35CE, 0xEE085713), LIMB_PAIR(0x190FAE23, 0x29BC4B3E),
+          LIMB_PARTIAL(0x064)},
+         {LIMB_PAIR(0xDBB3838A, 0x17EA6FB5), LIMB_PAIR(0xB425AF89, 0x192ECA92),
+          LIMB_PAIR(0x85A94659, 0x5FD3BFCF), LIMB_PAIR(0xDAA4B4CC, 0x8D75B3F5),
+          LIMB_PAIR(0x9BEE144F, 0xBACC18B8), LIMB_PAIR(0xFF60EC49, 0x57591774),
+          LIMB_PAIR(0x2363AC43, 0x319CBA95), LIMB_PAIR(0x472EE36C, 0x6C0D079E),
+          LIMB_PARTIAL(0x0F0)}},
+        {{LIMB_PAIR(0x7333EEA3, 0x28CD16CE), LIMB_PAIR(0x845655FC, 0x601AB611),
+          LIMB_PAIR(0x57ED4BF8, 0xF18179D9), LIMB_PAIR(0x172167C2, 0xA704B004),
+          LIMB_PAIR(0x82E3FCF3, 0xE22EC703), LIMB_PAIR(0xE64C4745, 0x4CD9BD0D),
+          LIMB_PAIR(0xEC9737E7, 0xD1EB58DF), LIMB_PAIR(0xE6658AAC, 0x540C29E8),
+          LIMB_PARTIAL(0x124)},
+         {LIMB_PAIR(0x4B18BB58, 0x4F35D47D), LIMB_PAIR(0xD4BE21BC, 0x3EE2A66A),
+          LIMB_PAIR(0x052B60FD, 0x9D3D69A1), LIMB_PAIR(0x8F07EB0D, 0x556347EF),
+          LIMB_PAIR(0x165AF89B, 0x66014006), LIMB_PAIR(0x31E62CC0, 0x808EB843),
+          LIMB_PAIR(0x309553A1, 0xFD119574), LIMB_PAIR(0x7656234D, 0x4945B9CD),
+          LIMB_PARTIAL(0x060)}},
+        {{LIMB_PAIR(0xA5D3A5D9, 0x580EC898), LIMB_PAIR(0x9B2E3634, 0x0E28A410),
+          LIMB_PAIR(0x01745208, 0x102192B6), LIMB_PAIR(0xF59C2C84, 0x4D825DC6),
+          LIMB_PAIR(0x7668CB0E, 0xD2B9B7F6), LIMB_PAIR(0x71E242ED, 0xF05D43BB),
+          LIMB_PAIR(0x4CCA8CB4, 0x23F73DC2), LIMB_PAIR(0xC7CB313D, 0x7234064E),
+          LIMB_PARTIAL(0x0E9)},
+         {LIMB_PAIR(0x3A3635BC, 0xF4B4B560), LIMB_PAIR(0xD9802D9B, 0xFEC87A30),
+          LIMB_PAIR(0x3E418320, 0x9C4D252A), LIMB_PAIR(0x2EB17033, 0xC8C7B693),
+          LIMB_PAIR(0x2E742B43, 0xC0AA375C), LIMB_PAIR(0xC02C9434, 0xB69BD932),
+          LIMB_PAIR(0xB6A13B4F, 0x9D910EB8), LIMB_PAIR(0xE6C4A9B3, 0x5B554917),
+          LIMB_PARTIAL(0x030)}},
+        {{LIMB_PAIR(0xB30C227F, 0x05BFABAD), LIMB_PAIR(0x9CA0D9F2, 0x163A0112),
+          LIMB_PAIR(0x4A448FFA, 0x448F630B), LIMB_PAIR(0xF52D44F0, 0x7A304FDC),
+          LIMB_PAIR(0xF50356E7, 0x4CEB9902), LIMB_PAIR(0xC43B436B, 0xE7615AB1),
+          LIMB_PAIR(0xD63F192D, 0x9FD56374), LIMB_PAIR(0x418BD616, 0x38470C8F),
+          LIMB_PARTIAL(0x0D1)},
+         {LIMB_PAIR(0x9554D529, 0x4B42C145), LIMB_PAIR(0x2BFE7BC9, 0x5556CF8B),
+          LIMB_PAIR(0x94EB909C, 0xE28B6F89), LIMB_PAIR(0x637DCAAB, 0xC00748EE),
+          LIMB_PAIR(0xFC076BF8, 0xF71E0FCF), LIMB_PAIR(0xB580D617, 0x57642F92),
+          LIMB_PAIR(0x1D91F20C, 0x755FDF2E), LIMB_PAIR(0xDD5AB14E, 0x9C3C9C86),
+          LIMB_PARTIAL(0x187)}},
+        {{LIMB_PAIR(0xC9C4F27A, 0x36E215CD), LIMB_PAIR(0x651A2560, 0xC5D2E709),
+          LIMB_PAIR(0xEF794A32, 0xD4A5BD4F), LIMB_PAIR(0xAA33F31C, 0xB1771BA6),
+          LIMB_PAIR(0x057DA3E5, 0xF4C791A4), LIMB_PAIR(0x90EC819A, 0x3547E13D),
+          LIMB_PAIR(0xD10059E2, 0x2E6971EF), LIMB_PAIR(0x7804F13A, 0xF19C250C),
+          LIMB_PARTIAL(0x048)},
+         {LIMB_PAIR(0x113453AA, 0x968A695D), LIMB_PAIR(0x0CC6EE85, 0xB904A5B5),
+          LIMB_PAIR(0xABDC4582, 0x272F50FE), LIMB_PAIR(0x556B5A9F, 0x7B14D09C),
+          LIMB_PAIR(0xC7FE5D92, 0x2ED5EF74), LIMB_PAIR(0xFCD4A5C5, 0x3C32A9E1),
+          LIMB_PAIR(0xDFFFF064, 0xAC5F1B7B), LIMB_PAIR(0x67BA52AE, 0xA28FA361),
+          LIMB_PARTIAL(0x056)}},
+        {{LIMB_PAIR(0x87950112, 0x8DFA4473), LIMB_PAIR(0xE8D5C1AA, 0xD032940A),
+          LIMB_PAIR(0x3379771D, 0xEB909E67), LIMB_PAIR(0xA336A4F3, 0xE780D40D),
+          LIMB_PAIR(0xCE022106, 0x318E1A69), LIMB_PAIR(0x8702E3C8, 0x36B6B174),
+          LIMB_PAIR(0xF8E60CED, 0x327E8DB4), LIMB_PAIR(0x8380C97E, 0x9C1A790B),
+          LIMB_PARTIAL(0x08F)},
+         {LIMB_PAIR(0xC6534A9A, 0x8EEC3CAA), LIMB_PAIR(0x56CFDCF4, 0x650FA0D5),
+          LIMB_PAIR(0x58C3798C, 0xFE45E2CE), LIMB_PAIR(0xA60E6872, 0x320FAC25),
+          LIMB_PAIR(0xEF983104, 0xB399EC98), LIMB_PAIR(0xBE57C16E, 0x133C9F01),
+          LIMB_PAIR(0x3B73B0A7, 0x9736E754), LIMB_PAIR(0xB48F9618, 0x12C0CE90),
+          LIMB_PARTIAL(0x155)}},
+        {{LIMB_PAIR(0x6F0C982D, 0x32187B6A), LIMB_PAIR(0x2106BDC5, 0x811425B3),
+          LIMB_PAIR(0x878BF63A, 0xF2636CA0), LIMB_PAIR(0x3C1696BF, 0xA42B1436),
+          LIMB_PAIR(0x53EE54C8, 0x0BB71458), LIMB_PAIR(0x37C638B3, 0x2C43B3AC),
+          LIMB_PAIR(0xF4464091, 0x9A404C2E), LIMB_PAIR(0x7509002E, 0x7CDB0CD2),
+          LIMB_PARTIAL(0x1FE)},
+         {LIMB_PAIR(0xEA37A696, 0xD333DB10), LIMB_PAIR(0xD5914E15, 0xAC1F2FE8),
+          LIMB_PAIR(0x522FCB80, 0x91744924), LIMB_PAIR(0x17E64A4B, 0x186A0551),
+          LIMB_PAIR(0x174E2689, 0x51DCD48B), LIMB_PAIR(0x0F429C85, 0x84AE67EC),
+          LIMB_PAIR(0xBA520A90, 0xACD5C1C5), LIMB_PAIR(0x20138359, 0x30654522),
+          LIMB_PARTIAL(0x0A5)}},
+        {{LIMB_PAIR(0xA7C8FC21, 0x2FF940BF), LIMB_PAIR(0xA6A86C6B, 0x9B3CBEEE),
+          LIMB_PAIR(0x171573A2, 0x5CD96C7D), LIMB_PAIR(0x12CB3013, 0x49BB08E8),
+          LIMB_PAIR(0x34B92D91, 0xDDBA493E), LIMB_PAIR(0xEF35E196, 0xA56F49A5),
+          LIMB_PAIR(0x2CDCA6C3, 0x7A454C1C), LIMB_PAIR(0x684D25FC, 0xB9C038AE),
+          LIMB_PARTIAL(0x1B7)},
+         {LIMB_PAIR(0xAF46C7EE, 0x15ADC72D), LIMB_PAIR(0x5EAF9891, 0x21450DB2),
+          LIMB_PAIR(0x53A32B0A, 0x115517E1), LIMB_PAIR(0xE26D8171, 0x5BD9D862),
+          LIMB_PAIR(0x3F8E37E8, 0x991737BF), LIMB_PAIR(0x531A836D, 0xCBB33580),
+          LIMB_PAIR(0x3D976493, 0x96AFF021), LIMB_PAIR(0xCA69B662, 0x9BE26568),
+          LIMB_PARTIAL(0x0BE)}}
+    },
+    {   // (1..8) * 2^(16 * 18) * G
+        {{LIMB_PAIR(0x6E640A8D, 0xBF2FFCB7), LIMB_PAIR(0xA0B5A07E, 0x63479501),
+          LIMB_PAIR(0x5F36F2E7, 0x55BB3001), LIMB_PAIR(0x058A676A, 0x9890F999),
+          LIMB_PAIR(0x455C0D27, 0xD9EE341B), LIMB_PAIR(0x18E08FC8, 0x6C95780C),
+          LIMB_PAIR(0x442A075D, 0xEB63A675), LIMB_PAIR(0xFB69DA00, 0xCE46A1A5),
+          LIMB_PARTIAL(0x06B)},
+         {LIMB_PAIR(0xF3ED6253, 0x8C618934), LIMB_PAIR(0x6E9433B4, 0xE0034244),
+          LIMB_PAIR(0x4260B2C5, 0x989B9921), LIMB_PAIR(0xD9DF4747, 0x11699804),
+          LIMB_PAIR(0x763A7F63, 0x125FE61F), LIMB_PAIR(0xC6EC395A, 0xA972786D),
+          LIMB_PAIR(0xB7B7B8C6, 0x662F9FE7), LIMB_PAIR(0x5456556E, 0xFB644A61),
+          LIMB_PARTIAL(0x08A)}},
+        {{LIMB_PAIR(0xB0BB44D8, 0xED29C2FF), LIMB_PAIR(0xFA00DDAB, 0x0874C2A5),
+          LIMB_PAIR(0x065A4A5E, 0x9398E8A2), LIMB_PAIR(0x91AAB917, 0xA6E19526),
+          LIMB_PAIR(0x667898DE, 0x20A816AC), LIMB_PAIR(0x4B94A66C, 0xDA4B9793),
+          LIMB_PAIR(0xB00E36E2, 0x6FEE1473), LIMB_PAIR(0x93A46CE6, 0xCD9958D7),
+          LIMB_PARTIAL(0x00F)},
+         {LIMB_PAIR(0xA362872F, 0xEAB9FA64), LIMB_PAIR(0x95457FB6, 0x87CC55B0),
+          LIMB_PAIR(0x3C702019, 0xE3E3F13D), LIMB_PAIR(0xFF6208C0, 0xE025B3C8),
+          LIMB_PAIR(0xD8B8F87C, 0x8FCD5B2F), LIMB_PAIR(0x789BC9ED, 0xCF9DED31),
+          LIMB_PAIR(0x18D40F49, 0x74742448), LIMB_PAIR(0x46C33140, 0xBF14E1F0),
+          LIMB_PARTIAL(0x16D)}},
+        {{LIMB_PAIR(0xA3A5A2A2, 0x0AA08334), LIMB_PAIR(0xDCFC5939, 0x7B1E2F91),
+          LIMB_PAIR(0x673E221A, 0xE1C64158), LIMB_PAIR(0xCB3319D0, 0xA9CE2061),
+          LIMB_PAIR(0x977A9B41, 0xB359C34B), LIMB_PAIR(0xB7F9FC83, 0xC127AF82),
+          LIMB_PAIR(0x81166C12, 0x18ADA734), LIMB_PAIR(0x092D64D4, 0x1C4C48FB),
+          LIMB_PARTIAL(0x0EE)},
+         {LIMB_PAIR(0x4C5015C4, 0xFED1A8DA), LIMB_PAIR(0x526E1897, 0xEFD54478),
+          LIMB_PAIR(0x75BBDC91, 0x0AC4F640), LIMB_PAIR(0x910661EC, 0xC0774CCE),
+          LIMB_PAIR(0xC30CCC07, 0x699BB035), LIMB_PAIR(0x80952CCF, 0x836B7B17),
+          LIMB_PAIR(0x9788BDC1, 0x03B8BFEF), LIMB_PAIR(0xFD47A69D, 0xB24604C5),
+          LIMB_PARTIAL(0x0D6)}},
+        {{LIMB_PAIR(0x7E198AEC, 0x35E7AF92), LIMB_PAIR(0xAD58220E, 0x2937B845),
+          LIMB_PAIR(0x625B0972, 0x9C8C65CC), LIMB_PAIR(0x1A9911C8, 0x91991D8A),
+          LIMB_PAIR(0x0A4EF588, 0xC9F134D9), LIMB_PAIR(0x0E01D57F, 0x1CBE5C25),
+          LIMB_PAIR(0x85251D47, 0x4C31016E), LIMB_PAIR(0x52DC527C, 0xC5877776),
+          LIMB_PARTIAL(0x18E)},
+         {LIMB_PAIR(0xD429C5F4, 0xA9232336), LIMB_PAIR(0xBFABB412, 0x60454705),
+          LIMB_PAIR(0x794CC5C2, 0xF5F84846), LIMB_PAIR(0xBFC8532D, 0x1BD49EA0),
+          LIMB_PAIR(0x3042CD43, 0xD4B45B2C), LIMB_PAIR(0x374AB02B, 0x49590033),
+          LIMB_PAIR(0xEE464C45, 0x78770266), LIMB_PAIR(0xDA262362, 0x0A33044E),
+          LIMB_PARTIAL(0x144)}},
+        {{LIMB_PAIR(0x720AEBB3, 0xC17C5414), LIMB_PAIR(0x7089E6BF, 0xEAA1A7B9),
+          LIMB_PAIR(0x36DE9F22, 0x9EE50BA1), LIMB_PAIR(0x5B3BF8DD, 0x4BEB0068),
+          LIMB_PAIR(0x5B3F6992, 0x330E8C04), LIMB_PAIR(0x6E7A978C, 0xF477636D),
+          LIMB_PAIR(0x9543861A, 0x5799678A), LIMB_PAIR(0x810077E6, 0xCEB7D074),
+          LIMB_PARTIAL(0x019)},
+         {LIMB_PAIR(0xCAFEF71C, 0x0D20DB6D), LIMB_PAIR(0x35FA4E9F, 0xB1C02CBA),
+          LIMB_PAIR(0x4630EE0E, 0xEB662868), LIMB_PAIR(0x88265202, 0xDA4BBE8C),
+          LIMB_PAIR(0xE1AA127C, 0x71B53DC3), LIMB_PAIR(0x0ABCAA62, 0xF4E2E52F),
+          LIMB_PAIR(0xF8F6C926, 0xE4C4CC96), LIMB_PAIR(0x14AAF997, 0xF9CF5BA4),
+          LIMB_PARTIAL(0x1E0)}},
+        {{LIMB_PAIR(0x88098F73, 0xF946AB51), LIMB_PAIR(0xFFD8BC23, 0xE98C6E73),
+          LIMB_PAIR(0x98758F69, 0x30D30A3C), LIMB_PAIR(0xBC8E359C, 0x302D5F8F),
+          LIMB_PAIR(0xFCD2F1FC, 0xADAA2FF6), LIMB_PAIR(0x4ADEC57A, 0x694DE81C),
+          LIMB_PAIR(0x97698A60, 0x69735A5A), LIMB_PAIR(0x2D55531D, 0x15BBAE8C),
+          LIMB_PARTIAL(0x164)},
+         {LIMB_PAIR(0x8C6B2D9B, 0x2398ABF0), LIMB_PAIR(0x9EC5EE96, 0x258BDC0E),
+          LIMB_PAIR(0xA9BF887E, 0x80ACA75C), LIMB_PAIR(0xD1495AD2, 0x3E3ADC8C),
+          LIMB_PAIR(0x62D2F571, 0x1A30F948), LIMB_PAIR(0x989DDA10, 0xEBDBF063),
+          LIMB_PAIR(0x74D3EFAE, 0x86BDDEDE), LIMB_PAIR(0xC749C868, 0xA42598AA),
+          LIMB_PARTIAL(0x1F4)}},
+        {{LIMB_PAIR(0xC936A7E5, 0x6AF0B935), LIMB_PAIR(0xD4A248AB, 0xDE94D724),
+          LIMB_PAIR(0x594E53B7, 0x0491C733), LIMB_PAIR(0x1CCD7088, 0x238EF534),
+          LIMB_PAIR(0x4F5052C3, 0xAF0E791E), LIMB_PAIR(0x10C3411D, 0x70CBEA81),
+          LIMB_PAIR(0x577D38BC, 0x6B7C8574), LIMB_PAIR(0x4EA6A924, 0x00E147AE),
+          LIMB_PARTIAL(0x085)},
+         {LIMB_PAIR(0x497B793D, 0xCAB57E2A), LIMB_PAIR(0xEDF47059, 0x3F642966),
+          LIMB_PAIR(0x2EB66B98, 0xA276326D), LIMB_PAIR(0xA76E1221, 0xEBA64255),
+          LIMB_PAIR(0xD23677B9, 0x698FD276), LIMB_PAIR(0x45A0625D, 0xCBB46374),
+          LIMB_PAIR(0x50B672EB, 0x5D92DDDC), LIMB_PAIR(0x0839333C, 0xBEF8CCD0),
+          LIMB_PARTIAL(0x091)}},
+        {{LIMB_PAIR(0x96139042, 0x225420C3), LIMB_PAIR(0x5BCF13CB, 0x90A38D5C),
+          LIMB_PAIR(0x99D999B0, 0xB99A43AE), LIMB_PAIR(0x50A20372, 0x5BBBE4D4),
+          LIMB_PAIR(0x45A7EDA6, 0xAA924202), LIMB_PAIR(0x8BB2A5B6, 0x49543E05),
+          LIMB_PAIR(0x97D32F2D, 0xBD115564), LIMB_PAIR(0x5D680F19, 0xC57D1AF9),
+          LIMB_PARTIAL(0x16F)},
+         {LIMB_PAIR(0x5FF37259, 0x93AF0511), LIMB_PAIR(0x9B9CC398, 0x89C88BEF),
+          LIMB_PAIR(0xA91987B5, 0x85526FF5), LIMB_PAIR(0xDFBF9615, 0x8B7BB52A),
+          LIMB_PAIR(0x0839C531, 0x25767D03), LIMB_PAIR(0x1CD9033E, 0x6B15AA2E),
+          LIMB_PAIR(0xDFAE7D95, 0x47490261), LIMB_PAIR(0xE7E1E8ED, 0x4EE02157),
+          LIMB_PARTIAL(0x15D)}}
+    },
+    {   // (1..8) * 2^(16 * 19) * G
+        {{LIMB_PAIR(0xEEC6E312, 0x163A9E62), LIMB_PAIR(0x459162D8, 0xD11432C1),
+          LIMB_PAIR(0xA25D4934, 0xDDE7D941), LIMB_PAIR(0x8D868AAD, 0x9067028E),
+          LIMB_PAIR(0x5B6E3D21, 0xB71B1708), LIMB_PAIR(0xE95D3C7F, 0xAED73637),
+          LIMB_PAIR(0x1DCE0D78, 0x51BCC93C), LIMB_PAIR(0x504A9D0B, 0x2F45D06A),
+          LIMB_PARTIAL(0x0BE)},
+         {LIMB_PAIR(0x300B2478, 0xEC12EA4B), LIMB_PAIR(0xF2A48388, 0x91AC6EED),
+          LIMB_PAIR(0x7A7631AD, 0xFBDC1BBA), LIMB_PAIR(0x79D5F4CE, 0x5B2669CB),
+          LIMB_PAIR(0x48C8F025, 0x219D64F9), LIMB_PAIR(0xAADB5873, 0xADCAAB29),
+          LIMB_PAIR(0x671BD673, 0x3B07AF1C), LIMB_PAIR(0xB7F2D8F5, 0xE66E7C67),
+          LIMB_PARTIAL(0x0C9)}},
+        {{LIMB_PAIR(0x2BC15CA5, 0xF03E2684), LIMB_PAIR(0xBF196674, 0x0B130B09),
+          LIMB_PAIR(0x56217F5F, 0x3C275387), LIMB_PAIR(0x349ACA89, 0xB26D17D4),
+          LIMB_PAIR(0x0269BF70, 0x3FAF1859), LIMB_PAIR(0xB288736A, 0x3CDEB74F),
+          LIMB_PAIR(0x7E38EA96, 0xEBA8F600), LIMB_PAIR(0x51DA8C99, 0xD24052C8),
+          LIMB_PARTIAL(0x15E)},
+         {LIMB_PAIR(0xB2F51CDB, 0xA5582BAC), LIMB_PAIR(0xD0A7F7C7, 0xA325B5CB),
+          LIMB_PAIR(0x09931317, 0x065A27F0), LIMB_PAIR(0xCDDC78EC, 0x1ABD17B6),
+          LIMB_PAIR(0x37962CE7, 0xD8FD4269), LIMB_PAIR(0x002CF3C2, 0x5D8403C8),
+          LIMB_PAIR(0xE3EB09A4, 0xE62F5305), LIMB_PAIR(0xEEAF6FB3, 0x1900F36C),
+          LIMB_PARTIAL(0x10A)}},
+        {{LIMB_PAIR(0x92701A9A, 0xD142BFA9), LIMB_PAIR(0x47539E92, 0x0B59D014),
+          LIMB_PAIR(0x8724475B, 0x7CEFEC6E), LIMB_PAIR(0xBCFD641F, 0x5C77D10D),
+          LIMB_PAIR(0xDD42EB47, 0x4946DBAB), LIMB_PAIR(0x14F1C33B, 0x4AE66C3A),
+          LIMB_PAIR(0x4C9F2C71, 0x05BA3E75), LIMB_PAIR(0x1FC0F7B7, 0xB618A507),
+          LIMB_PARTIAL(0x065)},
+         {LIMB_PAIR(0x7C169A16, 0xDD94EE05), LIMB_PAIR(0x5A337E5E, 0xA29E2619),
+          LIMB_PAIR(0x9AD816B6, 0x30E106EB), LIMB_PAIR(0x1A17810A, 0xB91E66F7),
+          LIMB_PAIR(0x5B672E86, 0x46ABF80D), LIMB_PAIR(0xF89626FF, 0x0F40F077),
+          LIMB_PAIR(0x8B67B224, 0xA474DFBE), LIMB_PAIR(0x8053AA79, 0x9D3AF924),
+          LIMB_PARTIAL(0x1FF)}},
+        {{LIMB_PAIR(0xF79421D8, 0xCFDC285D), LIMB_PAIR(0x8674686E, 0x26328998),
+          LIMB_PAIR(0x1ED73CD0, 0xF991086E), LIMB_PAIR(0xA36BD06D, 0x65046369),
+          LIMB_PAIR(0x72ADCD0A, 0x9712BB0B), LIMB_PAIR(0x5FAF9C7C, 0x9B2D422F),
+          LIMB_PAIR(0x51491C47, 0x7E3989F8), LIMB_PAIR(0x09AEEAD9, 0x9FC24BF8),
+          LIMB_PARTIAL(0x029)},
+         {LIMB_PAIR(0x0370ACB9, 0x8584EE84), LIMB_PAIR(0xEA40417D, 0xED56C569),
+          LIMB_PAIR(0x57B4CB9A, 0x64435875), LIMB_PAIR(0x91D35C5F, 0x752C5FA6),
+          LIMB_PAIR(0xABD0EB6F, 0xBBCF8703), LIMB_PAIR(0xC233DB59, 0x0DD72D15),
+          LIMB_PAIR(0x692BAAE3, 0xF2B7A1AB), LIMB_PAIR(0x7BAADFBE, 0x6EE63437),
+          LIMB_PARTIAL(0x111)}},
+        {{LIMB_PAIR(0x7938D98E, 0x97DEFE3D), LIMB_PAIR(0xFD0BEC69, 0xE2458FEA),
+          LIMB_PAIR(0x8B42DDBB, 0x7DF8D2B5), LIMB_PAIR(0xFF39914C, 0xA82AAB40),
+          LIMB_PAIR(0xD30F07E6, 0x78549B01), LIMB_PAIR(0x1331557E, 0x253F8C46),
+          LIMB_PAIR(0x19648CCE, 0x771750D9), LIMB_PAIR(0xD045BC36, 0x96AD6776),
+          LIMB_PARTIAL(0x0F2)},
+         {LIMB_PAIR(0xE08B83F8, 0x4A2EE334), LIMB_PAIR(0x2E3086DE, 0x3E9C4CB7),
+          LIMB_PAIR(0x9936BAB0, 0x913EAE4B), LIMB_PAIR(0xD23CD36A, 0x3CF83551),
+          LIMB_PAIR(0xDFD27D4A, 0x7C51D84A), LIMB_PAIR(0x4D006EDD, 0x2595A90F),
+          LIMB_PAIR(0x61CC7BE7, 0xB2D5C684), LIMB_PAIR(0xA4B310F9, 0xBB02BD59),
+          LIMB_PARTIAL(0x18A)}},
+        {{LIMB_PAIR(0x8EFB0157, 0xCAA72706), LIMB_PAIR(0xF08F035C, 0x713A7F37),
+          LIMB_PAIR(0xAA4FD5E2, 0xFF58C6A1), LIMB_PAIR(0x00A48205, 0x760B0660),
+          LIMB_PAIR(0x55F07CB4, 0x4A39E666), LIMB_PAIR(0x67558061, 0x0F6BEDAC),
+          LIMB_PAIR(0x66A118FD, 0x9EAA88C2), LIMB_PAIR(0x97D29CA9, 0x8D9EA75C),
+          LIMB_PARTIAL(0x190)},
+         {LIMB_PAIR(0xBC6094F3, 0x50A4BC7A), LIMB_PAIR(0x68F17D91, 0x105120CE),
+          LIMB_PAIR(0x4E559F9A, 0x514FDECA), LIMB_PAIR(0xE8D688CA, 0x414F4C0E),
+          LIMB_PAIR(0x24DE5AC2, 0x1B915554), LIMB_PAIR(0x298823DB, 0x5D983C0E),
+          LIMB_PAIR(0x43264448, 0xA5373212), LIMB_PAIR(0x86EEDE9B, 0x4BAF77E9),
+          LIMB_PARTIAL(0x1CD)}},
+        {{LIMB_PAIR(0x3110EF21, 0x47212CD8), LIMB_PAIR(0x7DAB31DA, 0x351356CA),
+          LIMB_PAIR(0x777A302F, 0x5C31ADD7), LIMB_PAIR(0xDC66A1C6, 0x44844EB4),
+          LIMB_PAIR(0x28384807, 0x559F3FB4), LIMB_PAIR(0xFF78DEE6, 0x95DAB974),
+          LIMB_PAIR(0xFB20857B, 0x2FE12E92), LIMB_PAIR(0xEF499BBA, 0x41436000),
+          LIMB_PARTIAL(0x106)},
+         {LIMB_PAIR(0x9DF7B969, 0x5E0E5F36), LIMB_PAIR(0xDC819D59, 0x2C96F308),
+          LIMB_PAIR(0x11CF4119, 0x3258DB74), LIMB_PAIR(0x76676D2F, 0x6246DA54),
+          LIMB_PAIR(0xCA079F54, 0x5BE278CF), LIMB_PAIR(0x6E36452F, 0x61AB6EB0),
+          LIMB_PAIR(0x461FC9A3, 0xE7742741), LIMB_PAIR(0x6A926FE5, 0x252FB638),
+          LIMB_PARTIAL(0x171)}},
+        {{LIMB_PAIR(0x38693D3A, 0x70C5ACDC), LIMB_PAIR(0x38F054F9, 0x9EDEE682),
+          LIMB_PAIR(0x2960CEEE, 0x16E053F2), LIMB_PAIR(0x28BFE7B1, 0x5926857C),
+          LIMB_PAIR(0x6145F8D1, 0xB9F7420E), LIMB_PAIR(0x9C0298EF, 0x9E0C42F5),
+          LIMB_PAIR(0xDD7D9FC6, 0x50B7210E), LIMB_PAIR(0xD7BE096F, 0xF9E4BD53),
+          LIMB_PARTIAL(0x078)},
+         {LIMB_PAIR(0xED19FC57, 0x428C2455), LIMB_PAIR(0x56AA75DB, 0x9E8F777D),
+          LIMB_PAIR(0xA671D991, 0x4CAEBA30), LIMB_PAIR(0xEAE0F53E, 0x5F927D79),
+          LIMB_PAIR(0x9E4C2A5B, 0x00D6AD36), LIMB_PAIR(0xA2E12D0A, 0xC8811438),
+          LIMB_PAIR(0xB2AEB4B1, 0xA36D664E), LIMB_PAIR(0x929A8748, 0x74E76676),
+          LIMB_PARTIAL(0x191)}}
+    },
+    {   // (1..8) * 2^(16 * 20) * G
+        {{LIMB_PAIR(0xAB9923D7, 0x5F47DDB9), LIMB_PAIR(0x8E3FAC52, 0x839865D4),
+          LIMB_PAIR(0x647424B0, 0x0214E93F), LIMB_PAIR(0x31D65C6B, 0x266C909C),
+          LIMB_PAIR(0x51457FAC, 0x956DECA4), LIMB_PAIR(0xA85CE8A5, 0x8E8D240E),
+          LIMB_PAIR(0xA4D9B281, 0x736652C4), LIMB_PAIR(0xB77A526D, 0x131A4191),
+          LIMB_PARTIAL(0x08A)},
+         {LIMB_PAIR(0x32D8542E, 0xA8483195), LIMB_PAIR(0xC3F38387, 0x1F7A8E67),
+          LIMB_PAIR(0xD6797F2E, 0x162AC248), LIMB_PAIR(0x0A6A1118, 0xD26469E1),
+          LIMB_PAIR(0xF203102D, 0xB33AFF1F), LIMB_PAIR(0xAADF0AE9, 0x63A52154),
+          LIMB_PAIR(0x4BB313A7, 0xF0431DBB), LIMB_PAIR(0xCA9DA156, 0xF93C18FB),
+          LIMB_PARTIAL(0x15C)}},
+        {{LIMB_PAIR(0x9D53FF0E, 0x8A9E5665), LIMB_PAIR(0xC7CCBB62, 0xE4C4FCD2),
+          LIMB_PAIR(0xB60B6FAB, 0x95A2B7A2), LIMB_PAIR(0x9242B4D1, 0xCF39FDE5),
+          LIMB_PAIR(0x5B49D9F2, 0x43983F30), LIMB_PAIR(0x220EC7BA, 0x4B5FECE7),
+          LIMB_PAIR(0x221FB872, 0x10B1639C), LIMB_PAIR(0xF594795A, 0xF5955C1D),
+          LIMB_PARTIAL(0x08C)},
+         {LIMB_PAIR(0xEB1EEA2C, 0x73DD1711), LIMB_PAIR(0x74F9E73C, 0xF027DAE2),
+          LIMB_PAIR(0x89586CB5, 0x11C87D15), LIMB_PAIR(0x1380814F, 0x16BC03CF),
+          LIMB_PAIR(0x19693D82, 0xFBBBE67A), LIMB_PAIR(0x5B37AE4D, 0x9CA4B47E),
+          LIMB_PAIR(0xDC7860A0, 0xAD59BEEE), LIMB_PAIR(0x599CA348, 0x46FF6DED),
+          LIMB_PARTIAL(0x031)}},
+        {{LIMB_PAIR(0xDB0B7846, 0xE5D80096), LIMB_PAIR(0x907BAE46, 0x1EC79296),
+          LIMB_PAIR(0x362B9307, 0x6CB09D0D), LIMB_PAIR(0x2C89BA81, 0x76B5AC52),
+          LIMB_PAIR(0x7D83920B, 0x12D37CD2), LIMB_PAIR(0x8C031B82, 0x22A18F6B),
+          LIMB_PAIR(0x93822770, 0x8C1BD009), LIMB_PAIR(0x7528177A, 0xF5F69926),
+          LIMB_PARTIAL(0x1C1)},
+         {LIMB_PAIR(0xACB136B5, 0x1C08DB46), LIMB_PAIR(0x27D539F1, 0xD3BC1FE1),
+          LIMB_PAIR(0x59AA9DDB, 0xD87F1073), LIMB_PAIR(0x7E8A3E33, 0xD8487FF9),
+          LIMB_PAIR(0x60581C89, 0x3FA1A3F1), LIMB_PAIR(0xA5980F30, 0xE0379485),
+          LIMB_PAIR(0x6C7687E8, 0xE5D3C87E), LIMB_PAIR(0x5F6FF261, 0x6286E05D),
+          LIMB_PARTIAL(0x155)}},
+        {{LIMB_PAIR(0x8F87AE00, 0x47FE5151), LIMB_PAIR(0xB2D64637, 0xF49EBF83),
+          LIMB_PAIR(0xA1E86582, 0x11ECA7B4), LIMB_PAIR(0xCBDE2995, 0x58BB53F9),
+          LIMB_PAIR(0x04AF7663, 0xA620BBA2), LIMB_PAIR(0x7221BC31, 0x2A01040D),
+          LIMB_PAIR(0xA243AC9F, 0x1734531D), LIMB_PAIR(0x117D06E9, 0x1DCB67D6),
+          LIMB_PARTIAL(0x1AC)},
+         {LIMB_PAIR(0x43275FFD, 0x5BB6699B), LIMB_PAIR(0x3BFEA061, 0x4B141BE7),
+          LIMB_PAIR(0xDAE58347, 0x805D08B0), LIMB_PAIR(0x21EE35AF, 0xBBBBBAE3),
+          LIMB_PAIR(0xEF02B56D, 0xFA863BAF), LIMB_PAIR(0xB35E5127, 0x21460360),
+          LIMB_PAIR(0xDACDD7B7, 0xB64A8AC4), LIMB_PAIR(0x92B58B6A, 0x51582B4F),
+          LIMB_PARTIAL(0x172)}},
+        {{LIMB_PAIR(0x2E769805, 0x1C30F6C0), LIMB_PAIR(0x741916E0, 0xF4BA830A),
+          LIMB_PAIR(0x9A7F97D7, 0x6D44914E), LIMB_PAIR(0x2A5220CC, 0x873BE2FE),
+          LIMB_PAIR(0x77F0CD9A, 0x6C349086), LIMB_PAIR(0x5725527A, 0xA11F9DAA),
+          LIMB_PAIR(0xBCBB7F2C, 0xF691B79B), LIMB_PAIR(0x316C9811, 0x0C9D568B),
+          LIMB_PARTIAL(0x09C)},
+         {LIMB_PAIR(0x0F75AE83, 0xA0333545), LIMB_PAIR(0x507B1783, 0x904E5959),
+          LIMB_PAIR(0xD4DBD664, 0x92110DBD), LIMB_PAIR(0x061CC502, 0x767CFDAB),
+          LIMB_PAIR(0xAA2A0300, 0x3771EA16), LIMB_PAIR(0x35C82065, 0x3D8CFDCC),
+          LIMB_PAIR(0xBA413636, 0x1E0AFA55), LIMB_PAIR(0x1F73EF3B, 0x5C1D5F58),
+          LIMB_PARTIAL(0x19B)}},
+        {{LIMB_PAIR(0x39741A2B, 0x93D3BCE0), LIMB_PAIR(0x4061AB7C, 0xB01D4C3C),
+          LIMB_PAIR(0x3EB73F51, 0x35414F12), LIMB_PAIR(0x3AB93C71, 0x11E8D450),
+          LIMB_PAIR(0x854D537E, 0x267B1285), LIMB_PAIR(0xCB8C4C60, 0xB01F7B95),
+          LIMB_PAIR(0xDDADE44D, 0x88A4E72E), LIMB_PAIR(0xD3DCF9AE, 0x02B12BBA),
+          LIMB_PARTIAL(0x049)},
+         {LIMB_PAIR(0x421E0A96, 0xE2AAAC37), LIMB_PAIR(0xDBC73078, 0x38E4380E),
+          LIMB_PAIR(0xC671400A, 0x27D85636), LIMB_PAIR(0x31CC2FDB, 0x1A11C616),
+          LIMB_PAIR(0x8D500BC8, 0xB30DA04A), LIMB_PAIR(0x2A8D7E73, 0xFC6D9651),
+          LIMB_PAIR(0x53481B0F, 0x94DB2D96), LIMB_PAIR(0x85807051, 0x44BBAF96),
+          LIMB_PARTIAL(0x190)}},
+        {{LIMB_PAIR(0x13714771, 0x964975D7), LIMB_PAIR(0x8639C0A0, 0xEFB11E27),
+          LIMB_PAIR(0x6109122A, 0xA83B403A), LIMB_PAIR(0x3DB62A02, 0xC3120D86),
+          LIMB_PAIR(0x114181F7, 0x479F1597), LIMB_PAIR(0x4A902962, 0x2FD71BC1),
+          LIMB_PAIR(0xA616219C, 0x6B5A2225), LIMB_PAIR(0x86E78CA8, 0x2AABC22D),
+          LIMB_PARTIAL(0x022)},
+         {LIMB_PAIR(0x197ADCF4, 0x9037A233), LIMB_PAIR(0xDFEC0430, 0x9C676F3F),
+          LIMB_PAIR(0x92AB3514, 0x42ABA69B), LIMB_PAIR(0x64CB5C48, 0xB1B7B693),
+          LIMB_PAIR(0x0066EA08, 0x866D10CC), LIMB_PAIR(0xEA7DBC33, 0x13C190A6),
+          LIMB_PAIR(0x6D2D3558, 0x64EACE1D), LIMB_PAIR(0xCBB4A44B, 0xC2075B82),
+          LIMB_PARTIAL(0x0F0)}},
+        {{LIMB_PAIR(0x6305B1FA, 0x74F71C97), LIMB_PAIR(0xAAE6788B, 0x75C64449),
+          LIMB_PAIR(0xFC132537, 0x072B8B0A), LIMB_PAIR(0x96FD8BC3, 0xD66862F4),
+          LIMB_PAIR(0x5FF59F77, 0x32CB2F3A), LIMB_PAIR(0x58FFE8E1, 0x9667801B),
+          LIMB_PAIR(0x558302C6, 0x227B57A4), LIMB_PAIR(0x441664B4, 0x0C384F6E),
+          LIMB_PARTIAL(0x130)},
+         {LIMB_PAIR(0xC16BC635, 0x0CFD7A96), LIMB_PAIR(0xD846D4C0, 0xE8F67AF8),
+          LIMB_PAIR(0x3637D199, 0x7A398E33), LIMB_PAIR(0x11D7443B, 0x2648CDD1),
+          LIMB_PAIR(0x9843F169, 0xFE3BDC06), LIMB_PAIR(0xB42D2C33, 0x8192BFF3),
+          LIMB_PAIR(0xFD2B8FC0, 0x7CADDFDC), LIMB_PAIR(0x1456B53B, 0x42D12861),
+          LIMB_PARTIAL(0x1DB)}}
+    },
+    {   // (1..8) * 2^(16 * 21) * G
+        {{LIMB_PAIR(0xA79CB073, 0xADF5E06E), LIMB_PAIR(0x8BF180E6, 0xCB46ACA9),
+          LIMB_PAIR(0x835F8E22, 0x5BF0D9EB), LIMB_PAIR(0x7713F3AD, 0xD692CD20),
+          LIMB_PAIR(0xF0D87F74, 0xA33E9D7F), LIMB_PAIR(0xF602A362, 0x9F2B6950),
+          LIMB_PAIR(0xDFA4F77C, 0x27A4C70B), LIMB_PAIR(0x3C56080A, 0x99C699DD),
+          LIMB_PARTIAL(0x105)},
+         {LIMB_PAIR(0x95338FA8, 0xDFB1B255), LIMB_PAIR(0xD59E754D, 0xABADBA3A),
+          LIMB_PAIR(0x436E70FC, 0x2338452B), LIMB_PAIR(0xE07A21B6, 0x34CFB5B2),
+          LIMB_PAIR(0xF81EA5A2, 0x25DDB684), LIMB_PAIR(0xAA325FC8, 0x98F463C0),
+          LIMB_PAIR(0x94AEB02E, 0x963BBC80), LIMB_PAIR(0x434AB9FA, 0xA98FE976),
+          LIMB_PARTIAL(0x188)}},
+        {{LIMB_PAIR(0x204A966E, 0x9A7FC933), LIMB_PAIR(0x0D9680EC, 0x7C1C5915),
+          LIMB_PAIR(0x30415E73, 0x06436097), LIMB_PAIR(0x8EA44E8B, 0x574B0652),
+          LIMB_PAIR(0xF4B8FE58, 0xD35D1340), LIMB_PAIR(0xDAA40CA5, 0x81DDD1F4),
+          LIMB_PAIR(0xAC09937B, 0x5C908486), LIMB_PAIR(0x14C180DE, 0x467DFFA6),
+          LIMB_PARTIAL(0x034)},
+         {LIMB_PAIR(0x8000602E, 0xE6F97ACC), LIMB_PAIR(0x0F527147, 0x2650E957),
+          LIMB_PAIR(0x7C3923E6, 0x3AF58DD9), LIMB_PAIR(0x69F5CAFD, 0x67F7102E),
+          LIMB_PAIR(0x0ECB60FC, 0xF80E76C0), LIMB_PAIR(0x197F6BDB, 0xD3441285),
+          LIMB_PAIR(0x52050B0B, 0xDEED257A), LIMB_PAIR(0x0703C0EF, 0x8C28AFEA),
+          LIMB_PARTIAL(0x052)}},
+        {{LIMB_PAIR(0x56500523, 0x2EA6E184), LIMB_PAIR(0xF44D63FB, 0x566CCDD0),
+          LIMB_PAIR(0xB01114CC, 0x8CC0208D), LIMB_PAIR(0x11E5DD4E, 0xDB7BF613),
+          LIMB_PAIR(0xFF83D7B1, 0x65E4263E), LIMB_PAIR(0xD6DA83E9, 0x12D2924C),
+          LIMB_PAIR(0x78380401, 0x093BD190), LIMB_PAIR(0xFF97C4F9, 0xD2835BDB),
+          LIMB_PARTIAL(0x13C)},
+         {LIMB_PAIR(0x1D8E9521, 0xD3AE4C90), LIMB_PAIR(0x42DC5BBB, 0xE2C92A4C),
+          LIMB_PAIR(0x8C96057D, 0x478E934B), LIMB_PAIR(0xEC6155F7, 0x0E526187),
+          LIMB_PAIR(0x2BBE77D5, 0x3ACA950D), LIMB_PAIR(0x6E492364, 0xE7EDF96A),
+          LIMB_PAIR(0x2FE76745, 0xFC039FD2), LIMB_PAIR(0x53928C27, 0x68DFCE96),
+          LIMB_PARTIAL(0x0F3)}},
+        {{LIMB_PAIR(0xE225FBD9, 0xAB482B76), LIMB_PAIR(0xD3C33A7D, 0xD561F4CD),
+          LIMB_PAIR(0xCCB2F003, 0x18813777), LIMB_PAIR(0x24CEBCE8, 0xA1633775),
+          LIMB_PAIR(0x16ADB540, 0xDDBE587D), LIMB_PAIR(0x79E133CD, 0xBC0D225F),
+          LIMB_PAIR(0x32A4C54A, 0x8FA3D300), LIMB_PAIR(0x243DC5E5, 0xDED1ECE4),
+          LIMB_PARTIAL(0x024)},
+         {LIMB_PAIR(0xFFD4B7DD, 0x94CE92A3), LIMB_PAIR(0x5A8EFBD5, 0xEAC8E7A1),
+          LIMB_PAIR(0xA9DC648A, 0x0C842C3F), LIMB_PAIR(0x0D286101, 0x19172F46),
+          LIMB_PAIR(0xBECA770A, 0xC8681E80), LIMB_PAIR(0xA8795D3B, 0xFAAA1AB4),
+          LIMB_PAIR(0x63944868, 0xE8625D46), LIMB_PAIR(0x4F3254EB, 0xE13004F9),
+          LIMB_PARTIAL(0x104)}},
+        {{LIMB_PAIR(0xB7F3D4B1, 0xB0FECE2B), LIMB_PAIR(0x47B042FB, 0x8B6168AA),
+          LIMB_PAIR(0x01658A57, 0x207D9B0F), LIMB_PAIR(0x5CF0BB71, 0x52DEEBF2),
+          LIMB_PAIR(0x2FC808A8, 0xC678DCC7), LIMB_PAIR(0x75A39999, 0x8BEA9D09),
+          LIMB_PAIR(0x7042C5A7, 0xF26B5D2B), LIMB_PAIR(0xDBE12667, 0x58B1D1BB),
+          LIMB_PARTIAL(0x120)},
+         {LIMB_PAIR(0xD821C3EA, 0x10CF0B69), LIMB_PAIR(0xC684E985, 0x045A9342),
+          LIMB_PAIR(0x56BABDCB, 0x2245C17F), LIMB_PAIR(0xB40C5F7D, 0x7859852A),
+          LIMB_PAIR(0x35B36FE0, 0xCBC11CAF), LIMB_PAIR(0xDDC4ABE5, 0xCBCE03BA),
+          LIMB_PAIR(0x9E11EE36, 0xFA479726), LIMB_PAIR(0x8B993B9A, 0xC70CF89A),
+          LIMB_PARTIAL(0x13F)}},
+        {{LIMB_PAIR(0x0D9EA003, 0x2E911BB3), LIMB_PAIR(0xDD7BBB56, 0x50503FD6),
+          LIMB_PAIR(0xF43C710C, 0x23780725), LIMB_PAIR(0xD236028A, 0xF3854BC2),
+          LIMB_PAIR(0x85F08816, 0x0BB0CD70), LIMB_PAIR(0x78E34910, 0xAF2BA068),
+          LIMB_PAIR(0x558B8BAB, 0xB0AB1008), LIMB_PAIR(0xE24955DB, 0xE0676170),
+          LIMB_PARTIAL(0x049)},
+         {LIMB_PAIR(0x87B571F5, 0xE2B0161A), LIMB_PAIR(0x6209D9AD, 0x1676B334),
+          LIMB_PAIR(0xE2F86308, 0x402122EC), LIMB_PAIR(0x87D6F082, 0xBD0E3644),
+          LIMB_PAIR(0x64747111, 0x587EF7C4), LIMB_PAIR(0x8F3386A7, 0xE8EDFEEC),
+          LIMB_PAIR(0x3A489DB5, 0x2B70F933), LIMB_PAIR(0x442A278B, 0x819E1D7C),
+          LIMB_PARTIAL(0x025)}},
+        {{LIMB_PAIR(0x6EE24007, 0x731BE59D), LIMB_PAIR(0xB97EFD86, 0xE96884C4),
+          LIMB_PAIR(0xCF73D698, 0x9E4A2BBE), LIMB_PAIR(0x2EF12084, 0x7820A2D7),
+          LIMB_PAIR(0xC5692055, 0x1EBBF048), LIMB_PAIR(0xC1B300F9, 0x707194DA),
+          LIMB_PAIR(0xC0D5DC37, 0xF45FE3FE), LIMB_PAIR(0xDF061C3C, 0x20CB9BF6),
+          LIMB_PARTIAL(0x000)},
+         {LIMB_PAIR(0x49841247, 0xEF76E093), LIMB_PAIR(0x5673EEE7, 0x7E963D5C),
+          LIMB_PAIR(0xC5EAB79F, 0x135D2CA7), LIMB_PAIR(0xCEEB60E6, 0xF0D3AC04),
+          LIMB_PAIR(0x1D07B5F9, 0xDB33FC36), LIMB_PAIR(0xF1443AE5, 0x37EF4405),
+          LIMB_PAIR(0x6EC33BD0, 0xE4716FAE), LIMB_PAIR(0x4FD6F657, 0x3A6E33A1),
+          LIMB_PARTIAL(0x03F)}},
+        {{LIMB_PAIR(0x04E188FF, 0x6F01C261), LIMB_PAIR(0xC7FF2E86, 0x0D9BF057),
+          LIMB_PAIR(0xC8E36163, 0xF9CD2DD6), LIMB_PAIR(0xEC1562E8, 0xBFC6200B),
+          LIMB_PAIR(0x8AFB5102, 0x735836B4), LIMB_PAIR(0x035E1ED7, 0xB7A29E92),
+          LIMB_PAIR(0x5F2E5924, 0xB16B14CA), LIMB_PAIR(0x28630D59, 0xA77550A6),
+          LIMB_PARTIAL(0x032)},
+         {LIMB_PAIR(0x7418D27C, 0x7B4BC3EF), LIMB_PAIR(0x23B67ADB, 0xDF5C38B6),
+          LIMB_PAIR(0xEA3713C8, 0x168D61E3), LIMB_PAIR(0x1ABD92F8, 0x806F9549),
+          LIMB_PAIR(0x98EB3239, 0xE806AB7B), LIMB_PAIR(0xF09B81CB, 0x47F49E50),
+          LIMB_PAIR(0x06FD5BA3, 0x4324DA17), LIMB_PAIR(0x3193DD6B, 0xD54DC861),
+          LIMB_PARTIAL(0x03C)}}
+    },
+    {   // (1..8) * 2^(16 * 22) * G
+        {{LIMB_PAIR(0x0261ADA4, 0x674E392F), LIMB_PAIR(0x5BB103A8, 0x5AF762F5),
+          LIMB_PAIR(0xC9E8BF69, 0x281AD6A5), LIMB_PAIR(0x5C57AF63, 0xA88AD2E4),
+          LIMB_PAIR(0x3B909CE5, 0x7FBCE1F2), LIMB_PAIR(0x4A8C86DA, 0x37883DA8),
+          LIMB_PAIR(0x8FC8357A, 0x94F7C570), LIMB_PAIR(0xC7C21EA8, 0xA1F2FB59),
+          LIMB_PARTIAL(0x1AC)},
+         {LIMB_PAIR(0x1CBA57C5, 0x30C79E7B), LIMB_PAIR(0x6062FA39, 0xF71D84BE),
+          LIMB_PAIR(0xE2B9C131, 0x8FB70B03), LIMB_PAIR(0xCD862B12, 0xBB0F27E7),
+          LIMB_PAIR(0x4FFD6A0A, 0x2FEA1087), LIMB_PAIR(0x2A7A7B08, 0x17787158),
+          LIMB_PAIR(0x8653CE49, 0xF79606CC), LIMB_PAIR(0x629A5FF9, 0x9514C960),
+          LIMB_PARTIAL(0x1A0)}},
+        {{LIMB_PAIR(0x534DE721, 0x1FB30B26), LIMB_PAIR(0x4123D0BC, 0x46732866),
+          LIMB_PAIR(0x3A143F8E, 0xE4E83C0D), LIMB_PAIR(0x691180E2, 0xE1F5F92A),
+          LIMB_PAIR(0x081F7230, 0x5FB00E76), LIMB_PAIR(0x083C3776, 0x0E4E513D),
+          LIMB_PAIR(0xEB042C2D, 0x5B81EA91), LIMB_PAIR(0x00AF7F4E, 0x7A221CB2),
+          LIMB_PARTIAL(0x0E4)},
+         {LIMB_PAIR(0x31E75C9D, 0x7BFD3F91), LIMB_PAIR(0xA2C68D12, 0x8545ADAD),
+          LIMB_PAIR(0xF986AD9F, 0x01C295B9), LIMB_PAIR(0x41EB1F2F, 0x186952A5),
+          LIMB_PAIR(0xE802FFC8, 0x6F7E3E3E), LIMB_PAIR(0xB98FC92C, 0x704E75D0),
+          LIMB_PAIR(0x4800A8FB, 0xC233AFEE), LIMB_PAIR(0x549D5FA9, 0xD0111A57),
+          LIMB_PARTIAL(0x10B)}},
+        {{LIMB_PAIR(0xE5375E53, 0x238D0F45), LIMB_PAIR(0x60B1447C, 0xB576C6CA),
+          LIMB_PAIR(0x62216556, 0xA3A372A6), LIMB_PAIR(0x8649C9D5, 0xA36F6C4A),
+          LIMB_PAIR(0xAB50C2CB, 0x00E80B35), LIMB_PAIR(0x2556C5A2, 0x11E5520E),
+          LIMB_PAIR(0xD3AA02DF, 0xAC58D6F1), LIMB_PAIR(0x8B95FDDF, 0xD56BF822),
+          LIMB_PARTIAL(0x094)},
+         {LIMB_PAIR(0x2A513CC5, 0xD172331A), LIMB_PAIR(0x5EF6A6BA, 0x35EEE697),
+          LIMB_PAIR(0xB0ACDC95, 0x4F02B17F), LIMB_PAIR(0x1EB68058, 0x07EC621E),
+          LIMB_PAIR(0xDAC73D4C, 0xF266346C), LIMB_PAIR(0xECAB7DDA, 0xBE978E8A),
+          LIMB_PAIR(0x968C2EB6, 0xDA0244E8), LIMB_PAIR(0xCEE91ED9, 0x50B38345),
+          LIMB_PARTIAL(0x14B)}},
+        {{LIMB_PAIR(0xF8816103, 0x01188022), LIMB_PAIR(0xDB3855D8, 0x64E1C614),
+          LIMB_PAIR(0x29A7C0D2, 0xCD4BD4C2), LIMB_PAIR(0x4D5ECE84, 0xD7EC4289),
+          LIMB_PAIR(0x722FC703, 0x947A8BDC), LIMB_PAIR(0xBFEBACFF, 0xA4C09186),
+          LIMB_PAIR(0xDCF3B746, 0xF7FDA81E), LIMB_PAIR(0x435034FC, 0x3BF6DC1B),
+          LIMB_PARTIAL(0x0C8)},
+         {LIMB_PAIR(0x878B4418, 0x319FC666), LIMB_PAIR(0xCFA14A68, 0xD600347C),
+          LIMB_PAIR(0x912B3C2B, 0x5ABCF8FC), LIMB_PAIR(0xC5CD581D, 0xC82C5E12),
+          LIMB_PAIR(0x50A27865, 0x022F767C), LIMB_PAIR(0xEAD1F5F7, 0x5C606862),
+          LIMB_PAIR(0x2259D674, 0x2702E819), LIMB_PAIR(0xE02204AB, 0xAE371A48),
+          LIMB_PARTIAL(0x01B)}},
+        {{LIMB_PAIR(0x1D6F6E88, 0x2AF67B2B), LIMB_PAIR(0x58551562, 0x02B012D3),
+          LIMB_PAIR(0xCAFA5D8A, 0x6B82B1FE), LIMB_PAIR(0xE6FEFE9B, 0x7F82B4E2),
+          LIMB_PAIR(0xE6B8BBDC, 0xAC91D292), LIMB_PAIR(0xAEB0467D, 0x1E330708),
+          LIMB_PAIR(0xD2226EC1, 0xE5723339), LIMB_PAIR(0x11CE4198, 0xDCB1DFC4),
+          LIMB_PARTIAL(0x17C)},
+         {LIMB_PAIR(0xA74E39FB, 0x4C55853A), LIMB_PAIR(0x3E55ADD6, 0xDEADB934),
+          LIMB_PAIR(0x4D9052CE, 0xBB7F6B23), LIMB_PAIR(0x2F3E7BAD, 0xC3959003),
+          LIMB_PAIR(0xAD990758, 0x78636279), LIMB_PAIR(0x34BCB90B, 0xC476679E),
+          LIMB_PAIR(0xF9FE3F2A, 0x9AB2BADC), LIMB_PAIR(0x1B69EF65, 0x414A32C0),
+          LIMB_PARTIAL(0x0C1)}},
+        {{LIMB_PAIR(0x27F2F67E, 0x114453E7), LIMB_PAIR(0x46EDB75A, 0x71999602),
+          LIMB_PAIR(0x0714F2EC, 0x481CFC65), LIMB_PAIR(0xBD48C221, 0x7A359E11),
+          LIMB_PAIR(0xBF80FBDC, 0x6807F0B5), LIMB_PAIR(0x51B3A6FD, 0xDFE57FFF),
+          LIMB_PAIR(0xB6794229, 0xE58F3C47), LIMB_PAIR(0xDEF683BA, 0x7F22CF6A),
+          LIMB_PARTIAL(0x1A6)},
+         {LIMB_PAIR(0x8C39F9AF, 0x551BBAE2), LIMB_PAIR(0xB1E075DB, 0x5057C3A7),
+          LIMB_PAIR(0x9E0D386A, 0xEEEDD600), LIMB_PAIR(0x715B2507, 0x8D60B730),
+          LIMB_PAIR(0x840BE62E, 0xD65F990B), LIMB_PAIR(0x287CC361, 0x666437B2),
+          LIMB_PAIR(0x9CFE886B, 0x11C2019C), LIMB_PAIR(0xEBF4CE61, 0xBEEF8EB4),
+          LIMB_PARTIAL(0x008)}},
+        {{LIMB_PAIR(0xE2CCE69E, 0x422833D5), LIMB_PAIR(0x69FF8B37, 0x3C1C8BDB),
+          LIMB_PAIR(0xC9FB427F, 0x44D41DFB), LIMB_PAIR(0xC54A1824, 0x15BEE2DD),
+          LIMB_PAIR(0xE8CE4AEE, 0x9C804025), LIMB_PAIR(0x9E5665B2, 0x5BCC7E5D),
+          LIMB_PAIR(0x40B6270D, 0xF38636A0), LIMB_PAIR(0x60B6778E, 0x84CADA1A),
+          LIMB_PARTIAL(0x14B)},
+         {LIMB_PAIR(0x9B47CCBB, 0x28B4411B), LIMB_PAIR(0x6C368197, 0xE4BC1E91),
+          LIMB_PAIR(0x2562C900, 0xC0F36E6B), LIMB_PAIR(0x88C55430, 0xC60D5628),
+          LIMB_PAIR(0xFB81C20F, 0x2E9613DF), LIMB_PAIR(0x56872B5C, 0xFDD934ED),
+          LIMB_PAIR(0x187BBDDD, 0x6BACD3AD), LIMB_PAIR(0xD1E42D9B, 0xF6F821D7),
+          LIMB_PARTIAL(0x12E)}},
+        {{LIMB_PAIR(0xDE0D59FD, 0x15581925), LIMB_PAIR(0x1E668987, 0x861DBEF2),
+          LIMB_PAIR(0x81FDAEA7, 0x000CA036), LIMB_PAIR(0xB5007BF9, 0xEE45E5ED),
+          LIMB_PAIR(0x9485C5FB, 0xD9868050), LIMB_PAIR(0xE2A800B9, 0xD58CA541),
+          LIMB_PAIR(0x05E1BF66, 0xA0D643DF), LIMB_PAIR(0xBDCF7DA2, 0x3DB52CBF),
+          LIMB_PARTIAL(0x11C)},
+         {LIMB_PAIR(0x87AF7109, 0x0A1DB943), LIMB_PAIR(0xFD35138C, 0x33754C60),
+          LIMB_PAIR(0xFC19982A, 0x2BDFF118), LIMB_PAIR(0xD22CCC69, 0x2E8EB645),
+          LIMB_PAIR(0xC73E39D4, 0xA7873CD2), LIMB_PAIR(0x1D04FF18, 0xD024363E),
+          LIMB_PAIR(0x0CC6ABDB, 0x492503D6), LIMB_PAIR(0x185AB722, 0xADE16418),
+          LIMB_PARTIAL(0x15D)}}
+    },
+    {   // (1..8) * 2^(16 * 23) * G
+        {{LIMB_PAIR(0x75804DA9, 0x2A7E8AC1), LIMB_PAIR(0x8D50BDC6, 0x0B41F611),
+          LIMB_PAIR(0xD8FAFB1C, 0xCFA0A757), LIMB_PAIR(0xD231A6B0, 0x75540D94),
+          LIMB_PAIR(0x0C4FE03D, 0x524440FB), LIMB_PAIR(0xCE9738DD, 0xB8665FBF),
+          LIMB_PAIR(0x8F1BD64F, 0xBB74F6A8), LIMB_PAIR(0xBB8D6C67, 0x063AFA3C),
+          LIMB_PARTIAL(0x189)},
+         {LIMB_PAIR(0xA864385F, 0x259B9DA4), LIMB_PAIR(0x17C2597B, 0xDBAFC55C),
+          LIMB_PAIR(0x56BF5D23, 0xDE890ACB), LIMB_PAIR(0xF8455B59, 0xE51182C0),
+          LIMB_PAIR(0xC456E1C7, 0x75D51A03), LIMB_PAIR(0xB318E747, 0x9C7929C6),
+          LIMB_PAIR(0x39B3ED84, 0xAF23A7F1), LIMB_PAIR(0x910F4AB2, 0xEE136A2B),
+          LIMB_PARTIAL(0x1AC)}},
+        {{LIMB_PAIR(0x35E16743, 0x6E1B7D0B), LIMB_PAIR(0x54D72C65, 0xCAD975B3),
+          LIMB_PAIR(0x453B8906, 0x78F7434A), LIMB_PAIR(0x9690FA05, 0x8D140CAE),
+          LIMB_PAIR(0x31FE6BFF, 0x6C8E152A), LIMB_PAIR(0x418E415A, 0x1721155E),
+          LIMB_PAIR(0x77693D9F, 0x73B115DC), LIMB_PAIR(0x9BBECDF1, 0x1274EA40),
+          LIMB_PARTIAL(0x134)},
+         {LIMB_PAIR(0xF3354B80, 0x5953C5FE), LIMB_PAIR(0xBCDA146A, 0x1E60A291),
+          LIMB_PAIR(0x71EBE5D6, 0x1E20C5C5), LIMB_PAIR(0xCE4DFD53, 0x0BD949BF),
+          LIMB_PAIR(0x83280185, 0xE489A644), LIMB_PAIR(0x3743F2A4, 0x81908288),
+          LIMB_PAIR(0x81EC227D, 0x6126ED35), LIMB_PAIR(0x7FF6CFEF, 0xA4AAB290),
+          LIMB_PARTIAL(0x12B)}},
+        {{LIMB_PAIR(0xEF873F3E, 0x5D8C23C4), LIMB_PAIR(0xCE7BAE33, 0x2A29D680),
+          LIMB_PAIR(0xBC00FC8E, 0x5109E098), LIMB_PAIR(0x3CFAD961, 0x9BF92EFC),
+          LIMB_PAIR(0x62036BCF, 0x272DFA33), LIMB_PAIR(0xC2B13688, 0x5ABB516C),
+          LIMB_PAIR(0xDDCB08AB, 0xBFAD4CCC), LIMB_PAIR(0x4F260709, 0x05945B93),
+          LIMB_PARTIAL(0x043)},
+         {LIMB_PAIR(0x08A5F87F, 0x67FE093B), LIMB_PAIR(0x6C6FE1B1, 0x5F8E248A),
+          LIMB_PAIR(0xA3B887A2, 0xF54F710B), LIMB_PAIR(0x90F7E972, 0x12E1B687),
+          LIMB_PAIR(0x429CD6C6, 0x7002BD70), LIMB_PAIR(0xE896B58B, 0x0F010D4A),
+          LIMB_PAIR(0x1A7F5713, 0x44FB054B), LIMB_PAIR(0x65508714, 0xB9F30268),
+          LIMB_PARTIAL(0x173)}},
+        {{LIMB_PAIR(0xA567339C, 0xD414309F), LIMB_PAIR(0xDFF5FBCA, 0x4EE5C7A8),
+          LIMB_PAIR(0x064CC887, 0x33D8E6C3), LIMB_PAIR(0xCA553CBD, 0x15992EB4),
+          LIMB_PAIR(0x459DA20D, 0x3D733BB4), LIMB_PAIR(0xA682B305, 0x98C2DE2E),
+          LIMB_PAIR(0x5602ED92, 0x68C13BED), LIMB_PAIR(0xC3BF7B46, 0x639B79F1),
+          LIMB_PARTIAL(0x0B5)},
+         {LIMB_PAIR(0x289407E1, 0x93DE5E06), LIMB_PAIR(0xB05A27BE, 0xA8F2B4E1),
+          LIMB_PAIR(0x9F5A6BE0, 0x9D07927A), LIMB_PAIR(0xF1B97F94, 0x9A5D02E2),
+          LIMB_PAIR(0xF2DABBB9, 0x320DB20D), LIMB_PAIR(0x0C14980B, 0x99131333),
+          LIMB_PAIR(0xF888E761, 0x44845E16), LIMB_PAIR(0x63A5538F, 0x1BAEB180),
+          LIMB_PARTIAL(0x196)}},
+        {{LIMB_PAIR(0x9510D278, 0xF41D38D4), LIMB_PAIR(0x2C1AA285, 0xFA2C2B94),
+          LIMB_PAIR(0xD512246E, 0xDF7BB55C), LIMB_PAIR(0xCB15D14D, 0x980B046A),
+          LIMB_PAIR(0xDBAF8AD4, 0x3FE4F4D4), LIMB_PAIR(0xD3D4F7AC, 0x6CBFCE0E),
+          LIMB_PAIR(0xDEBBBC9C, 0x81FF0F46), LIMB_PAIR(0x6F1AADAB, 0x2550BC94),
+          LIMB_PARTIAL(0x0AC)},
+         {LIMB_PAIR(0x7488849F, 0x2CC18103), LIMB_PAIR(0xC1DD8868, 0x78DD9FB3),
+          LIMB_PAIR(0x37790AF2, 0xB433B8ED), LIMB_PAIR(0x896219FB, 0xFF3689C4),
+          LIMB_PAIR(0x0151C7D3, 0x0AAA321E), LIMB_PAIR(0xCDE3D282, 0x1F39B461),
+          LIMB_PAIR(0x5BE49EC6, 0x10B3783A), LIMB_PAIR(0x5462C805, 0xB8B801D3),
+          LIMB_PARTIAL(0x13A)}},
+        {{LIMB_PAIR(0x2553A1AF, 0x46EC5A84), LIMB_PAIR(0x9B9F05BD, 0xD41C6348),
+          LIMB_PAIR(0xB10D500C, 0x8FF28519), LIMB_PAIR(0xEBC991AB, 0xFF4F8D03),
+          LIMB_PAIR(0xD997D9BC, 0x57B6A954), LIMB_PAIR(0x8588D18D, 0x9FACDD08),
+          LIMB_PAIR(0xD61A6BD6, 0x7FB43E8B), LIMB_PAIR(0xACDD98C5, 0x62C8A561),
+          LIMB_PARTIAL(0x047)},
+         {LIMB_PAIR(0x52C911AA, 0x7CF6F1E1), LIMB_PAIR(0x8B0BDE06, 0xF9270C1E),
+          LIMB_PAIR(0x999F3E7E, 0xEE6D0874), LIMB_PAIR(0xA5F058AD, 0x85530601),
+          LIMB_PAIR(0x288B8E87, 0xF1A1D2CA), LIMB_PAIR(0x2EE84682, 0x13FDCD5B),
+          LIMB_PAIR(0x61AFA5FF, 0x031E7459), LIMB_PAIR(0x7D25B91E, 0xEED38B2D),
+          LIMB_PARTIAL(0x10F)}},
+        {{LIMB_PAIR(0x51D8C679, 0x976B0EB7), LIMB_PAIR(0xA55BEB39, 0x5308C32C),
+          LIMB_PAIR(0xB935189B, 0x43F46AE2), LIMB_PAIR(0x18420B08, 0xC29299EE),
+          LIMB_PAIR(0x94DC4570, 0xFE346CF4), LIMB_PAIR(0x53C6C99E, 0xC6207E3E),
+          LIMB_PAIR(0x5D708240, 0x3E202EC2), LIMB_PAIR(0x5D608C48, 0xC790BEC7),
+          LIMB_PARTIAL(0x082)},
+         {LIMB_PAIR(0xDB07B8AC, 0x6F30F944), LIMB_PAIR(0x6C090BC2, 0x7B4F2213),
+          LIMB_PAIR(0x2D325DCA, 0xD03A6097), LIMB_PAIR(0x3DAA7EC7, 0xD079042D),
+          LIMB_PAIR(0x039AEFCB, 0x959BF843), LIMB_PAIR(0x84ADD69C, 0x956DA50C),
+          LIMB_PAIR(0xBA49D06D, 0x2F47DAB7), LIMB_PAIR(0x7F80AC00, 0xA57F444F),
+          LIMB_PARTIAL(0x0D4)}},
+        {{LIMB_PAIR(0x525ABF32, 0x55417FFA), LIMB_PAIR(0x78067DFC, 0x1FF40E16),
+          LIMB_PAIR(0x2795EA6A, 0x431A0AE1), LIMB_PAIR(0xEF54C597, 0xC3DE691C),
+          LIMB_PAIR(0x95F9D2BB, 0x60A0C51B), LIMB_PAIR(0x82772F1A, 0x30840CA9),
+          LIMB_PAIR(0x96EB0344, 0xDDAF4604), LIMB_PAIR(0x8615D783, 0x03A9F6F4),
+          LIMB_PARTIAL(0x035)},
+         {LIMB_PAIR(0x33EDCFA4, 0x74598CB2), LIMB_PAIR(0xDE9DCCDE, 0xBB866BC9),
+          LIMB_PAIR(0x2A673BB2, 0x0C483116), LIMB_PAIR(0xFEE306A7, 0x3EDDD388),
+          LIMB_PAIR(0xC80EB5B9, 0x8785A002), LIMB_PAIR(0x1937371F, 0xE2BD81F7),
+          LIMB_PAIR(0x5684A105, 0x50164859), LIMB_PAIR(0x1F26E0DB, 0xF0F3FDDE),
+          LIMB_PARTIAL(0x119)}}
+    },
+    {   // (1..8) * 2^(16 * 24) * G
+        {{LIMB_PAIR(0x0BCF3B88, 0x442EBF30), LIMB_PAIR(0xDC5BFD2B, 0x4B863857),
+          LIMB_PAIR(0xC50960C2, 0x632A1056), LIMB_PAIR(0xC9D74020, 0xDBF49444),
+          LIMB_PAIR(0x78287D19, 0x335F464B), LIMB_PAIR(0x5C490A63, 0x0CF8D5C7),
+          LIMB_PAIR(0xD7D2D2C6, 0x4F9D9BD7), LIMB_PAIR(0xAD52D8A9, 0x1490FB61),
+          LIMB_PARTIAL(0x0EB)},
+         {LIMB_PAIR(0x34A088DB, 0x42AABE74), LIMB_PAIR(0x9E5B69EE, 0x871248C8),
+          LIMB_PAIR(0x55A87EDB, 0x7D624D6E), LIMB_PAIR(0xBAEE4473, 0x81BC0BCF),
+          LIMB_PAIR(0x9559A1B0, 0xF450C5AD), LIMB_PAIR(0xDF4C738C, 0xA604379C),
+          LIMB_PAIR(0x10EC0574, 0x36B304E2), LIMB_PAIR(0x8D8CF3D9, 0x948A50D3),
+          LIMB_PARTIAL(0x18E)}},
+        {{LIMB_PAIR(0x5565EB6E, 0xC6ECF2F5), LIMB_PAIR(0x2B260A3D, 0x05E89460),
+          LIMB_PAIR(0x32C54616, 0x459E2604), LIMB_PAIR(0x47DD43AC, 0xFBF40AAB),
+          LIMB_PAIR(0x9AD0B934, 0x54D5949F), LIMB_PAIR(0xCEA0EEF4, 0x992295A5),
+          LIMB_PAIR(0xD5520B7A, 0x8A5AF63C), LIMB_PAIR(0xA7F1FFDD, 0x536AE69F),
+          LIMB_PARTIAL(0x17B)},
+         {LIMB_PAIR(0x3F0BC9F5, 0xDDD868A7), LIMB_PAIR(0xBB82DC6D, 0xB33A39D1),
+          LIMB_PAIR(0x48953CE8, 0x878D8AA0), LIMB_PAIR(0x9802F566, 0xF2A35CE2),
+          LIMB_PAIR(0x07F25B60, 0xA2B9188A), LIMB_PAIR(0x0933CA89, 0xD01FED06),
+          LIMB_PAIR(0x3114F728, 0x89013FCE), LIMB_PAIR(0x87828FAD, 0x8128FDBE),
+          LIMB_PARTIAL(0x054)}},
+        {{LIMB_PAIR(0x58FEAF6B, 0x005D8EA9), LIMB_PAIR(0xF524807D, 0x9D2B24C0),
+          LIMB_PAIR(0x21D9535D, 0x96AF717B), LIMB_PAIR(0x4FBD0106, 0x5F9A6F42),
+          LIMB_PAIR(0xBA7D83DC, 0xA9DAC62A), LIMB_PAIR(0x62347736, 0xE2E5FF33),
+          LIMB_PAIR(0xB6605428, 0x1621A6D5), LIMB_PAIR(0xBC4BB252, 0xFC96AE5E),
+          LIMB_PARTIAL(0x19B)},
+         {LIMB_PAIR(0x21D079D5, 0x878EE5E4), LIMB_PAIR(0x2C46177F, 0x40395449),
+          LIMB_PAIR(0x183F779D, 0x334B26FA), LIMB_PAIR(0xCA226599, 0x8C07F237),
+          LIMB_PAIR(0x018C83CE, 0xE079FD96), LIMB_PAIR(0x664AB781, 0x62391DF0),
+          LIMB_PAIR(0x0B9565EC, 0xC3D390E3), LIMB_PAIR(0x8698FF98, 0x98227C5B),
+          LIMB_PARTIAL(0x1BB)}},
+        {{LIMB_PAIR(0x3F9FA837, 0xF20E17F1), LIMB_PAIR(0x07DB1380, 0x0F664948),
+          LIMB_PAIR(0x87F0C342, 0x5BCDC631), LIMB_PAIR(0xBD3F369B, 0x56C64ECC),
+          LIMB_PAIR(0x11C76666, 0x5E2DD968), LIMB_PAIR(0xDC4303EC, 0x77A37823),
+          LIMB_PAIR(0x74B208CF, 0xA88173A1), LIMB_PAIR(0x1AF41E96, 0x1C626895),
+          LIMB_PARTIAL(0x1C5)},
+         {LIMB_PAIR(0x65467B39, 0x72DA3514), LIMB_PAIR(0xCE45ABDB, 0xA97A3735),
+          LIMB_PAIR(0xC98EEE0C, 0xA1CB4A2C), LIMB_PAIR(0x94C63A07, 0x03DD02D4),
+          LIMB_PAIR(0x3B2689F6, 0xD22B087A), LIMB_PAIR(0x3043678E, 0x5A50B83C),
+          LIMB_PAIR(0x844A417C, 0x069ADF5F), LIMB_PAIR(0x983FCFC1, 0xA9EB7A19),
+          LIMB_PARTIAL(0x0C6)}},
+        {{LIMB_PAIR(0x0CC43FA1, 0x07AF0A7A), LIMB_PAIR(0xAC346374, 0x577DCC1C),
+          LIMB_PAIR(0xDC46A3EF, 0x0430BA5A), LIMB_PAIR(0x51D77F50, 0x19623A33),
+          LIMB_PAIR(0xC47EC055, 0xBB69E56E), LIMB_PAIR(0x367B694A, 0xADDDDE29),
+          LIMB_PAIR(0x7334CDC3, 0xBCC27634), LIMB_PAIR(0xB6DBBDAF, 0x3605A214),
+          LIMB_PARTIAL(0x08C)},
+         {LIMB_PAIR(0x333A23D4, 0xB9E26813), LIMB_PAIR(0x9DFD1C2E, 0xB4084043),
+          LIMB_PAIR(0x5948F69C, 0xB26958AA), LIMB_PAIR(0x836B04E9, 0x4E0E41CE),
+          LIMB_PAIR(0xAD2F0F9C, 0xE8781517), LIMB_PAIR(0xF398EADE, 0x44411CEB),
+          LIMB_PAIR(0x7CCA9C3D, 0xE0394B52), LIMB_PAIR(0x184812F2, 0x3692BB42),
+          LIMB_PARTIAL(0x1A5)}},
+        {{LIMB_PAIR(0x80E0C811, 0x4ABF6DE4), LIMB_PAIR(0xCF33E5AE, 0xFB0DB238),
+          LIMB_PAIR(0x65638F5A, 0x3F651318), LIMB_PAIR(0x41078C4B, 0x93E5D62E),
+          LIMB_PAIR(0xB4B44D9B, 0x53EC3D90), LIMB_PAIR(0x7DDCF3B9, 0x9FE56460),
+          LIMB_PAIR(0x79848B05, 0x47143850), LIMB_PAIR(0x9E60315D, 0xBD3495A9),
+          LIMB_PARTIAL(0x144)},
+         {LIMB_PAIR(0x670BEDEF, 0x90409B61), LIMB_PAIR(0xB61F1014, 0xF0B1BAF0),
+          LIMB_PAIR(0xCC4AD55F, 0xED3CCB5C), LIMB_PAIR(0xEBC6A449, 0x391B2125),
+          LIMB_PAIR(0xC399DDD3, 0x9F49AB65), LIMB_PAIR(0x03EDDC81, 0xF7706CA4),
+          LIMB_PAIR(0x579211FD, 0xE42D1379), LIMB_PAIR(0x1EDE88C3, 0x9452B0D1),
+          LIMB_PARTIAL(0x1FB)}},
+        {{LIMB_PAIR(0x9B5E849C, 0x96D64AF4), LIMB_PAIR(0x7D8BC95A, 0xF994BF47),
+          LIMB_PAIR(0x437F36AE, 0x75A4E5C0), LIMB_PAIR(0x7C7BCEC9, 0xEE75C710),
+          LIMB_PAIR(0x437C8987, 0x40F1BEBC), LIMB_PAIR(0xDB220F60, 0xEA8288DC),
+          LIMB_PAIR(0x1353D1D9, 0xF9C197BA), LIMB_PAIR(0x196C5B7E, 0x8128EC86),
+          LIMB_PARTIAL(0x1AE)},
+         {LIMB_PAIR(0xF41CCE83, 0x608268BD), LIMB_PAIR(0x49DBD8B9, 0xB061D942),
+          LIMB_PAIR(0x846039D6, 0x71A2710A), LIMB_PAIR(0x972580E9, 0xE2F432B4),
+          LIMB_PAIR(0x9BE7C986, 0x34F1A711), LIMB_PAIR(0xC02E5EDE, 0xEADEF54D),
+          LIMB_PAIR(0x8E9FCB26, 0xE215A5E8), LIMB_PAIR(0x1D8C7C29, 0x9A2A4F76),
+          LIMB_PARTIAL(0x1B4)}},
+        {{LIMB_PAIR(0xE0EA0BAE, 0x984DA95D), LIMB_PAIR(0x3AB813BA, 0x7769CFFA),
+          LIMB_PAIR(0x84CC8B68, 0x02FD64A7), LIMB_PAIR(0x5EA90ED5, 0x138655F2),
+          LIMB_PAIR(0x40B410C4, 0x71074C7C), LIMB_PAIR(0x4A05F173, 0xF3971B00),
+          LIMB_PAIR(0xD36B4F4D, 0x113D8242), LIMB_PAIR(0x4CDD1B0E, 0x63BD460F),
+          LIMB_PARTIAL(0x15B)},
+         {LIMB_PAIR(0x6DB9FE99, 0x26BFAF81), LIMB_PAIR(0x0A3C3A72, 0x001943C4),
+          LIMB_PAIR(0x8ADF321F, 0x258ECCEC), LIMB_PAIR(0xF50D775C, 0x8BF97F30),
+          LIMB_PAIR(0xE6899FBF, 0xA7B60597), LIMB_PAIR(0x49EABD50, 0x622BF2CB),
+          LIMB_PAIR(0xB19E9649, 0x9FF457E9), LIMB_PAIR(0xE2DBB651, 0x607570FD),
+          LIMB_PARTIAL(0x10A)}}
+    },
+    {   // (1..8) * 2^(16 * 25) * G
+        {{LIMB_PAIR(0x90185363, 0xF5C1A4C6), LIMB_PAIR(0x20C04ED5, 0x15F58FD9),
+          LIMB_PAIR(0xE913A1B2, 0xA7B46E0C), LIMB_PAIR(0x36F1D8C5, 0x1E7167C6),
+          LIMB_PAIR(0xBF5FCFB1, 0xF4FE6BFE), LIMB_PAIR(0xA6C2027B, 0xC46FAF10),
+          LIMB_PAIR(0x4E1F12F4, 0x45D59300), LIMB_PAIR(0x12185485, 0x46BCC873),
+          LIMB_PARTIAL(0x0CA)},
+         {LIMB_PAIR(0x6432C12B, 0x7C518071), LIMB_PAIR(0x90AE7556, 0xB7E004AD),
+          LIMB_PAIR(0xD8532693, 0xDF847160), LIMB_PAIR(0xA18B3802, 0x4D8C7B8A),
+          LIMB_PAIR(0x96872AF8, 0x90E25045), LIMB_PAIR(0xAECB6FAD, 0xE69D4894),
+          LIMB_PAIR(0x17D0FE85, 0x6DDAA06C), LIMB_PAIR(0x340C3528, 0x49F1A466),
+          LIMB_PARTIAL(0x0D9)}},
+        {{LIMB_PAIR(0x6DA18F9E, 0x64782A47), LIMB_PAIR(0x4A496E02, 0xB89E0B65),
+          LIMB_PAIR(0x501C3A88, 0x437A49F6), LIMB_PAIR(0x48A19F6E, 0xAE9EA087),
+          LIMB_PAIR(0x346D2069, 0xA787948B), LIMB_PAIR(0x532EED3D, 0xA6B9A3F1),
+          LIMB_PAIR(0x8AD26937, 0x728AB35E), LIMB_PAIR(0x041F4F43, 0x3CF24801),
+          LIMB_PARTIAL(0x1B0)},
+         {LIMB_PAIR(0xCBBAB58E, 0x5E272327), LIMB_PAIR(0xF8705FFB, 0xE4A3C5F9),
+          LIMB_PAIR(0xEDD26EE4, 0x2EDC1C8E), LIMB_PAIR(0xF26D033F, 0x1BD46FF5),
+          LIMB_PAIR(0xD87192FC, 0xCC566431), LIMB_PAIR(0x11764C8A, 0x03C7E406),
+          LIMB_PAIR(0x882A69AB, 0xEBB80E34), LIMB_PAIR(0x61A08D84, 0x7A7F6943),
+          LIMB_PARTIAL(0x11E)}},
+        {{LIMB_PAIR(0x58B77137, 0x68F4A4E0), LIMB_PAIR(0xF12F5BBF, 0xD8A34E67),
+          LIMB_PAIR(0x1E0619C2, 0x1781240F), LIMB_PAIR(0x498328BD, 0x44495373),
+          LIMB_PAIR(0x545B7D41, 0x98E9F61A), LIMB_PAIR(0x602A0C48, 0x767DB401),
+          LIMB_PAIR(0x806301DE, 0xE138E5E8), LIMB_PAIR(0x4B21AA89, 0x65A3883B),
+          LIMB_PARTIAL(0x12D)},
+         {LIMB_PAIR(0x0423FE94, 0x647B0078), LIMB_PAIR(0xFD276310, 0x424F483F),
+          LIMB_PAIR(0xD6A06303, 0xACA222FB), LIMB_PAIR(0xFFA52C17, 0x47162ACB),
+          LIMB_PAIR(0x9DE267FE, 0x7AE0C501), LIMB_PAIR(0x667A30C8, 0x998DC9BB),
+          LIMB_PAIR(0xAF48C727, 0x988CF192), LIMB_PAIR(0xDFA23A3F, 0x0A270986),
+          LIMB_PARTIAL(0x1FC)}},
+        {{LIMB_PAIR(0xC4646439, 0x5C9209C1), LIMB_PAIR(0x86C5D6BD, 0xCEB66985),
+          LIMB_PAIR(0x29E415B4, 0xA5F52258), LIMB_PAIR(0xE95D2A27, 0x18FFF2C1),
+          LIMB_PAIR(0xBE40C8D9, 0x21D464F1), LIMB_PAIR(0x059828CF, 0x11B4696E),
+          LIMB_PAIR(0x70F76AEC, 0x5C1F73C5), LIMB_PAIR(0x273E3F5B, 0x6019FADB),
+          LIMB_PARTIAL(0x12C)},
+         {LIMB_PAIR(0x3EEFAB44, 0x6D1FF591), LIMB_PAIR(0xBA2986B4, 0xF913524C),
+          LIMB_PAIR(0x290DCF2A, 0x96FC0B7A), LIMB_PAIR(0x061DF2A2, 0xF9E7AB52),
+          LIMB_PAIR(0xD47330A6, 0x66401173), LIMB_PAIR(0x8B9F749F, 0xFF2ACA18),
+          LIMB_PAIR(0x1AB42AC3, 0x8D4AC80F), LIMB_PAIR(0xA1378039, 0x10EC329E),
+          LIMB_PARTIAL(0x1AA)}},
+        {{LIMB_PAIR(0x9C1D86CC, 0xA5FC51EF), LIMB_PAIR(0x0B3FAAD3, 0x66A9B898),
+          LIMB_PAIR(0x21D124ED, 0x96C73C25), LIMB_PAIR(0x050626CE, 0x392440DB),
+          LIMB_PAIR(0x50A4A12A, 0x02BFB1AC), LIMB_PAIR(0x1742DDDD, 0xC70A3074),
+          LIMB_PAIR(0x47FE811D, 0xF1F9DAA6), LIMB_PAIR(0xFB3CE6CC, 0xD4BAA6B1),
+          LIMB_PARTIAL(0x16E)},
+         {LIMB_PAIR(0x09D96CE7, 0x09042D75), LIMB_PAIR(0x3315F77A, 0x4C92CE69),
+          LIMB_PAIR(0xA9C0D9F6, 0x4992B1F9), LIMB_PAIR(0xD18EC980, 0x7C0FFBAC),
+          LIMB_PAIR(0xA008AB38, 0x53D205DC), LIMB_PAIR(0xC908481D, 0xF0A098F7),
+          LIMB_PAIR(0x0BA397BE, 0x2BFFD363), LIMB_PAIR(0x49003F86, 0xCA36E99F),
+          LIMB_PARTIAL(0x0A2)}},
+        {{LIMB_PAIR(0xBE4BADB6, 0xA074FDB7), LIMB_PAIR(0x0DF5F046, 0x97B05495),
+          LIMB_PAIR(0xEAC3A8B1, 0x5A3F64E4), LIMB_PAIR(0x2971FAA1, 0xAFC5E013),
+          LIMB_PAIR(0x568E4A3A, 0xE6D4AE36), LIMB_PAIR(0x97479A2A, 0xEB0324BB),
+          LIMB_PAIR(0x66A2C69B, 0x2DCAF3D8), LIMB_PAIR(0x813F21EE, 0x9F9B5551),
+          LIMB_PARTIAL(0x0FD)},
+         {LIMB_PAIR(0xA13D686C, 0xEA8F05C8), LIMB_PAIR(0x3BDBD1DE, 0xF27EDB76),
+          LIMB_PAIR(0x5C65B0F4, 0xB2E5FD40), LIMB_PAIR(0x6CBD964F, 0x5E959C01),
+          LIMB_PAIR(0xDBC193A1, 0x02CCB301), LIMB_PAIR(0x013B972D, 0x34CA7ED9),
+          LIMB_PAIR(0x7EDE3F2F, 0x7191CD28), LIMB_PAIR(0x98BF4E0C, 0x1D07F457),
+          LIMB_PARTIAL(0x057)}},
+        {{LIMB_PAIR(0x20F12986, 0x284E98F3), LIMB_PAIR(0x749EA8D5, 0x3112BF24),
+          LIMB_PAIR(0x2782914D, 0x5FC7A2C4), LIMB_PAIR(0xD94786AF, 0xB2F7C229),
+          LIMB_PAIR(0xC7158280, 0x4B17BCAE), LIMB_PAIR(0xE6189A46, 0xA139D563),
+          LIMB_PAIR(0x83CC9173, 0x9C72E9C5), LIMB_PAIR(0xBE56B6A8, 0x5CD5A6A0),
+          LIMB_PARTIAL(0x1A5)},
+         {LIMB_PAIR(0x235A8051, 0x51F0E802), LIMB_PAIR(0xC4C5FB7C, 0x153DC987),
+          LIMB_PAIR(0x9868A706, 0xB549E9C7), LIMB_PAIR(0x9BDF5C1F, 0x71739008),
+          LIMB_PAIR(0xCCBEC99B, 0x0D04F60C), LIMB_PAIR(0x7F4BD294, 0xDE66C961),
+          LIMB_PAIR(0x51156724, 0xA787D95E), LIMB_PAIR(0xAE12B9B3, 0x7CE4B4A5),
+          LIMB_PARTIAL(0x091)}},
+        {{LIMB_PAIR(0xFB6618BD, 0xE7F35808), LIMB_PAIR(0x732EF576, 0x6ABB67E1),
+          LIMB_PAIR(0xCD0BFD8A, 0xACCABB44), LIMB_PAIR(0x83459746, 0x176FFA91),
+          LIMB_PAIR(0x85B88B2A, 0xCC129585), LIMB_PAIR(0xFFF151CE, 0x28D94486),
+          LIMB_PAIR(0x4C84BB00, 0xF55FCA16), LIMB_PAIR(0x9C3A42B6, 0x07CBC841),
+          LIMB_PARTIAL(0x0C6)},
+         {LIMB_PAIR(0x78788C39, 0x488400D0), LIMB_PAIR(0xD8EB1FDC, 0x15EBB100),
+          LIMB_PAIR(0xBDC05F72, 0x58DECAE3), LIMB_PAIR(0x5D56A2CF, 0x3BFDA4A7),
+          LIMB_PAIR(0x5AE6701E, 0x7EA3F8EC), LIMB_PAIR(0x3AAACAB3, 0x652E7E0B),
+          LIMB_PAIR(0x28609228, 0x267D2752), LIMB_PAIR(0x912EFD7E, 0x52DDC983),
+          LIMB_PARTIAL(0x029)}}
+    },
+    {   // (1..8) * 2^(16 * 26) * G
+        {{LIMB_PAIR(0x8FE6F511, 0x141838BF), LIMB_PAIR(0xEE745E2E, 0x8E9FF343),
+          LIMB_PAIR(0x02325306, 0x71DA9FD5), LIMB_PAIR(0xF0D0D68E, 0xA527B9BA),
+          LIMB_PAIR(0x31144649, 0xCE19B22C), LIMB_PAIR(0x0BFAA46C, 0xCA9B778B),
+          LIMB_PAIR(0x6CE31145, 0x66E689A7), LIMB_PAIR(0xD8D1DA21, 0xED43460D),
+          LIMB_PARTIAL(0x0BF)},
+         {LIMB_PAIR(0xC1669168, 0x241323F7), LIMB_PAIR(0x79B94B5A, 0x9934B3DE),
+          LIMB_PAIR(0xD9F9A406, 0xD332C1A2), LIMB_PAIR(0xE4A49EAC, 0xBE3EBE21),
+          LIMB_PAIR(0x678BE3ED, 0x4A00648E), LIMB_PAIR(0xFF09DB31, 0xC9F534EA),
+          LIMB_PAIR(0x5EFDD859, 0x2DE77406), LIMB_PAIR(0x00F5C7A5, 0x2C218CD8),
+          LIMB_PARTIAL(0x152)}},
+        {{LIMB_PAIR(0xEFD5CF86, 0xFE1B039A), LIMB_PAIR(0xC0945B5A, 0xC7FBCA26),
+          LIMB_PAIR(0x887A27A1, 0x6B30E2E0), LIMB_PAIR(0xE7CC98D9, 0x0883A38B),
+          LIMB_PAIR(0xFB2138F5, 0xA646C35B), LIMB_PAIR(0x74F0C200, 0x735769DF),
+          LIMB_PAIR(0x2AB20E1D, 0x9FCDF60A), LIMB_PAIR(0x1F2E11DC, 0x4E0ACC80),
+          LIMB_PARTIAL(0x13A)},
+         {LIMB_PAIR(0x15ABD8EA, 0x00CAF225), LIMB_PAIR(0xCB2E6E92, 0xE5F47384),
+          LIMB_PAIR(0xBE14FF19, 0xA9186F93), LIMB_PAIR(0x16CA5BB6, 0x4620D2C9),
+          LIMB_PAIR(0xBDDDE27B, 0x22D4FC0E), LIMB_PAIR(0xA1C81269, 0xD6F04A09),
+          LIMB_PAIR(0xFAC277D4, 0x25D65811), LIMB_PAIR(0x322AB775, 0x803293DB),
+          LIMB_PARTIAL(0x1E4)}},
+        {{LIMB_PAIR(0x0A823516, 0x323E1B7F), LIMB_PAIR(0x673254F7, 0x8F4E9152),
+          LIMB_PAIR(0x41599B9C, 0x5E5D7190), LIMB_PAIR(0xA1198ACC, 0x96BFBA24),
+          LIMB_PAIR(0xBBFCD72C, 0xB1B6E75B), LIMB_PAIR(0xF4894626, 0xFD5955F2),
+          LIMB_PAIR(0x898BBBFD, 0x109EDFEA), LIMB_PAIR(0x1F468074, 0xD3692904),
+          LIMB_PARTIAL(0x16A)},
+         {LIMB_PAIR(0x9BB7D749, 0x089D12A9), LIMB_PAIR(0x4FFC33D9, 0x893EBF25),
+          LIMB_PAIR(0x9097FF49, 0x6ED72C60), LIMB_PAIR(0xB4E1D91D, 0x9291E1EE),
+          LIMB_PAIR(0x72A07882, 0x0DBFE582), LIMB_PAIR(0xBE0636EC, 0xAC41065F),
+          LIMB_PAIR(0xF4234BD5, 0x43D74F8B), LIMB_PAIR(0x0A28FDEF, 0x01BFB085),
+          LIMB_PARTIAL(0x0B5)}},
+        {{LIMB_PAIR(0x1EC238D2, 0x9D0DBABB), LIMB_PAIR(0x37E67E7E, 0x3F6C4AF3),
+          LIMB_PAIR(0x64DEC6E9, 0xF7A6B094), LIMB_PAIR(0x2C2724CC, 0x1F53FD50),
+          LIMB_PAIR(0x51BCAA0C, 0x5F333D47), LIMB_PAIR(0xEBAE3589, 0x63CC89BA),
+          LIMB_PAIR(0xF0632831, 0x2B90AF90), LIMB_PAIR(0x4D18CFD3, 0x8F6AF6CD),
+          LIMB_PARTIAL(0x1CE)},
+         {LIMB_PAIR(0x76940E65, 0x8B34E445), LIMB_PAIR(0xC1C34C11, 0x264A0D8F),
+          LIMB_PAIR(0x4120AFC2, 0xD433303F), LIMB_PAIR(0xF7E738B8, 0x240A12D6),
+          LIMB_PAIR(0x6E921883, 0x574FA715), LIMB_PAIR(0x02D74E8C, 0x6B2BB33C),
+          LIMB_PAIR(0x0FE8E9B8, 0x7B193E24), LIMB_PAIR(0x506CC6D4, 0xBE954BAD),
+          LIMB_PARTIAL(0x11E)}},
+        {{LIMB_PAIR(0xD1A4A65E, 0x4054B365), LIMB_PAIR(0xA04B2F59, 0xFA395E2A),
+          LIMB_PAIR(0xBF63D17A, 0x1C6C3B41), LIMB_PAIR(0xABE2AAD0, 0xA639FB26),
+          LIMB_PAIR(0x0C9A565D, 0x008F8160), LIMB_PAIR(0x91061E61, 0xF5EFA9E6),
+          LIMB_PAIR(0x6E881F7F, 0x7731C2F7), LIMB_PAIR(0x9074B4AA, 0x3623CD7C),
+          LIMB_PARTIAL(0x016)},
+         {LIMB_PAIR(0x1037873E, 0x20BA924B), LIMB_PAIR(0xABCFD34E, 0x7B7107AC),
+          LIMB_PAIR(0x05E13406, 0xB492EBB9), LIMB_PAIR(0xF08FD2FA, 0x6DCC3342),
+          LIMB_PAIR(0x64126080, 0x08F3A1D3), LIMB_PAIR(0xFB5BF009, 0x8FB54869),
+          LIMB_PAIR(0x82442DCD, 0x5E661632), LIMB_PAIR(0x5C21D62A, 0xBAB2D8DD),
+          LIMB_PARTIAL(0x03D)}},
+        {{LIMB_PAIR(0x84C1985A, 0xC296B1F6), LIMB_PAIR(0xAA4F7132, 0x971547C5),
+          LIMB_PAIR(0x83E168CF, 0xE3705E11), LIMB_PAIR(0xC935A3DE, 0x8D00E588),
+          LIMB_PAIR(0x5262789B, 0x85315423), LIMB_PAIR(0x005F7C35, 0x46F2C2CA),
+          LIMB_PAIR(0x17EA733E, 0xFBFBADD2), LIMB_PAIR(0xC9E496A6, 0xB32A38B6),
+          LIMB_PARTIAL(0x0D8)},
+         {LIMB_PAIR(0xCEC8D3F9, 0xA82E95E5), LIMB_PAIR(0xE378BE9D, 0x8A1EFCA3),
+          LIMB_PAIR(0x8080D874, 0x6E114D07), LIMB_PAIR(0xFB9C056A, 0x514DC754),
+          LIMB_PAIR(0x66EF6C48, 0x5781BE89), LIMB_PAIR(0x34B1EBE3, 0x0586BD38),
+          LIMB_PAIR(0x8A8B161E, 0x0E31B44F), LIMB_PAIR(0xD4D62DD5, 0x20C2B78A),
+          LIMB_PARTIAL(0x1DB)}},
+        {{LIMB_PAIR(0xAEB0D0F0, 0xEA6E467A), LIMB_PAIR(0xEB5EE813, 0x9FA030D9),
+          LIMB_PAIR(0x515CDBF8, 0x9BE99873), LIMB_PAIR(0xA805D16A, 0xE608DB63),
+          LIMB_PAIR(0x9CE2F64B, 0x5E6255DD), LIMB_PAIR(0x7418BB31, 0x2D88FB42),
+          LIMB_PAIR(0xE7AC60BF, 0x147C74FE), LIMB_PAIR(0x672B0F90, 0x34DF0171),
+          LIMB_PARTIAL(0x04D)},
+         {LIMB_PAIR(0x77F1F4FE, 0x6C1F2671), LIMB_PAIR(0x138FA188, 0xF64D4242),
+          LIMB_PAIR(0x4C0097CA, 0x55AB5DDD), LIMB_PAIR(0xBDBDB465, 0x354BB5F3),
+          LIMB_PAIR(0x79060E68, 0xAD6142D5), LIMB_PAIR(0x1017B5FB, 0xD9ADC110),
+          LIMB_PAIR(0x9F510299, 0x656FFC3A), LIMB_PAIR(0x741EBE49, 0x568945BD),
+          LIMB_PARTIAL(0x09F)}},
+        {{LIMB_PAIR(0x63D7540B, 0x61D252DA), LIMB_PAIR(0xBA87605E, 0x5977687D),
+          LIMB_PAIR(0xF8F3558E, 0x53BE7D04), LIMB_PAIR(0x99F1AAF0, 0x76C4C49C),
+          LIMB_PAIR(0xCE8BF731, 0x129E0BFF), LIMB_PAIR(0x66A1555B, 0xCDDE32A1),
+          LIMB_PAIR(0xD4BC5B6A, 0xEDB9E9E5), LIMB_PAIR(0x52BC3C6F, 0x675B5D12),
+          LIMB_PARTIAL(0x130)},
+         {LIMB_PAIR(0x91B491F4, 0xFB3DABAE), LIMB_PAIR(0x9EA0B6D1, 0xEF1967C3),
+          LIMB_PAIR(0xE6370D8E, 0xB68A0E75), LIMB_PAIR(0xE2FFB7B5, 0x6DD017FC),
+          LIMB_PAIR(0x06D66169, 0x7E3DC826), LIMB_PAIR(0x56271658, 0x802B2690),
+          LIMB_PAIR(0xC3DA3C9F, 0x117A4EE3), LIMB_PAIR(0x167D09AF, 0x80BB9FCF),
+          LIMB_PARTIAL(0x0D0)}}
+    },
+    {   // (1..8) * 2^(16 * 27) * G
+        {{LIMB_PAIR(0xD6E1BD72, 0xA66CCCC8), LIMB_PAIR(0x4AE2FA5C, 0x1EA4E921),
+          LIMB_PAIR(0x2D021FA7, 0x66775AF2), LIMB_PAIR(0x2A4C4677, 0x6D711DFB),
+          LIMB_PAIR(0x5AE380B3, 0xDDAAE8BB), LIMB_PAIR(0x600F11FC, 0x53158994),
+          LIMB_PAIR(0xDA94D443, 0xFEB122DB), LIMB_PAIR(0xDFFC21DD, 0x7CBF1AFA),
+          LIMB_PARTIAL(0x006)},
+         {LIMB_PAIR(0x834BF891, 0x03CFA731), LIMB_PAIR(0x630B8032, 0x4E016085),
+          LIMB_PAIR(0x49DB4D96, 0x90CF9B59), LIMB_PAIR(0x335C9DDD, 0x96FD2614),
+          LIMB_PAIR(0x8E3B98FB, 0xC0214510), LIMB_PAIR(0x1DA2EA2F, 0x6DED0633),
+          LIMB_PAIR(0x9D0EAD76, 0x2BDA6D76), LIMB_PAIR(0xF3E4FBF2, 0x4BA00E99),
+          LIMB_PARTIAL(0x169)}},
+        {{LIMB_PAIR(0xEE70E781, 0x5FBF73AD), LIMB_PAIR(0x67793CF9, 0x29A81E4F),
+          LIMB_PAIR(0x80BF503E, 0xD7E9CCDF), LIMB_PAIR(0xD6EDDA9D, 0x6C06D49C),
+          LIMB_PAIR(0xD96E70F7, 0xC33C7EE6), LIMB_PAIR(0xEF6114B1, 0x30D7D644),
+          LIMB_PAIR(0xAB81AF49, 0x0615B576), LIMB_PAIR(0x5A09A31F, 0x56B8AF44),
+          LIMB_PARTIAL(0x076)},
+         {LIMB_PAIR(0x75CAC764, 0x32E0B334), LIMB_PAIR(0xDC2D7E31, 0x0B123DA0),
+          LIMB_PAIR(0xD11B58EA, 0x67D72E7A), LIMB_PAIR(0x961098ED, 0x93165A21),
+          LIMB_PAIR(0xDD1D2B8C, 0x4AE95E5A), LIMB_PAIR(0x7EE3715F, 0xC26794A0),
+          LIMB_PAIR(0xCD333782, 0x6887F532), LIMB_PAIR(0xAF37AEDE, 0x67E608D5),
+          LIMB_PARTIAL(0x179)}},
+        {{LIMB_PAIR(0x54203519, 0x20E1DBCB), LIMB_PAIR(0x6854FA65, 0x4731F4A6),
+          LIMB_PAIR(0xF769FD0A, 0x79D73800), LIMB_PAIR(0x86246CCE, 0x248F6752),
+          LIMB_PAIR(0x6D04D079, 0xB63DCA39), LIMB_PAIR(0x0FE5DE22, 0xC90D6EB8),
+          LIMB_PAIR(0x0760287E, 0x0BD86EE3), LIMB_PAIR(0x035A202B, 0x1687F7CC),
+          LIMB_PARTIAL(0x073)},
+         {LIMB_PAIR(0x5D18000D, 0x34FCAD34), LIMB_PAIR(0x9808E5C8, 0x8E27D9D2),
+          LIMB_PAIR(0x5483836F, 0x5A3199E5), LIMB_PAIR(0x62C5CAE8, 0xE786EC7C),
+          LIMB_PAIR(0x82F509DB, 0x22D732EE), LIMB_PAIR(0xB6898EAF, 0xDE5C5E2C),
+          LIMB_PAIR(0x8BB31048, 0x0F051A38), LIMB_PAIR(0xB732B905, 0x69536133),
+          LIMB_PARTIAL(0x003)}},
+        {{LIMB_PAIR(0xECFA8831, 0xAC333E4A), LIMB_PAIR(0x8A6D6E93, 0x9D08F6EF),
+          LIMB_PAIR(0xEA97FB6A, 0xF2EED835), LIMB_PAIR(0x070C46F2, 0xDDF44417),
+          LIMB_PAIR(0x37694EA3, 0x1E3159BF), LIMB_PAIR(0x8B7D6A05, 0xB0C4319C),
+          LIMB_PAIR(0x61F314FB, 0x0ABC7572), LIMB_PAIR(0x01A6047E, 0x0057F6C7),
+          LIMB_PARTIAL(0x1E7)},
+         {LIMB_PAIR(0x6AF8283B, 0x204CB3DD), LIMB_PAIR(0x44AB9EA7, 0x4EEDFA16),
+          LIMB_PAIR(0x93B7D9E5, 0x79F15699), LIMB_PAIR(0xD29DCC8A, 0xAAC8F0C7),
+          LIMB_PAIR(0x4800F5E5, 0xE293FD27), LIMB_PAIR(0xE22DA004, 0x6EC0A739),
+          LIMB_PAIR(0xB903094C, 0x8CBEE62F), LIMB_PAIR(0xA88C3BCE, 0x86DCB1FD),
+          LIMB_PARTIAL(0x1CC)}},
+        {{LIMB_PAIR(0x39E84CE3, 0x2373EAEB), LIMB_PAIR(0x0B9EC7B3, 0xBA04CA2E),
+          LIMB_PAIR(0xBD2194BD, 0xE2B50DD2), LIMB_PAIR(0x513F5EB8, 0xC663BB29),
+          LIMB_PAIR(0xB8E768D2, 0x46B010AC), LIMB_PAIR(0x9514B2AE, 0xC8DD6993),
+          LIMB_PAIR(0xAC22E17C, 0xF90F39CA), LIMB_PAIR(0xAC54AF6B, 0xA1420DC6),
+          LIMB_PARTIAL(0x16B)},
+         {LIMB_PAIR(0x8AF82DBB, 0x60F5772F), LIMB_PAIR(0xF75E8910, 0x7E43A57C),
+          LIMB_PAIR(0x233CEA7B, 0xC53B8A3C), LIMB_PAIR(0x98AF58B7, 0xE43935A7),
+          LIMB_PAIR(0xF772327B, 0xBF5354E9), LIMB_PAIR(0xD8F71CCC, 0xA022B423),
+          LIMB_PAIR(0x8037F9C6, 0x58E76A75), LIMB_PAIR(0x0DD3213E, 0x502B6D11),
+          LIMB_PARTIAL(0x001)}},
+        {{LIMB_PAIR(0x02ACD87A, 0xAE8B54D9), LIMB_PAIR(0x621F7759, 0xB4FADA66),
+          LIMB_PAIR(0x20D45BAA, 0xBBD22844), LIMB_PAIR(0x03FA5B60, 0xFFA85046),
+          LIMB_PAIR(0x365BD0A3, 0x1319EE91), LIMB_PAIR(0x140575E6, 0x0AC098DE),
+          LIMB_PAIR(0x59D35E15, 0xF6110984), LIMB_PAIR(0x60C4C232, 0x2AE56DC4),
+          LIMB_PARTIAL(0x1D1)},
+         {LIMB_PAIR(0xE5CA8913, 0xF0B1A965), LIMB_PAIR(0xBBDCEBAA, 0x1332685C),
+          LIMB_PAIR(0x4BC1D2A7, 0xD1E5D6E8), LIMB_PAIR(0x77A5D9B2, 0x5397B197),
+          LIMB_PAIR(0x0E3ABC64, 0x531B98D7), LIMB_PAIR(0x8EB05CD1, 0x40852921),
+          LIMB_PAIR(0x9BC7332E, 0xB1FF6C73), LIMB_PAIR(0xE26BD5D8, 0x18369F7A),
+          LIMB_PARTIAL(0x18B)}},
+        {{LIMB_PAIR(0xB04B2D70, 0x2600BAC3), LIMB_PAIR(0x4CF3F9F9, 0xA595B33F),
+          LIMB_PAIR(0xD99E871D, 0x21660D3E), LIMB_PAIR(0xA9394803, 0xEB5E976D),
+          LIMB_PAIR(0x8A1ED4EF, 0xE205F3CF), LIMB_PAIR(0x81DFBB0C, 0xAA94C332),
+          LIMB_PAIR(0x055BB2D8, 0x00F0CD08), LIMB_PAIR(0x5AFC00FB, 0xAD655248),
+          LIMB_PARTIAL(0x0A2)},
+         {LIMB_PAIR(0xA2BF8AFB, 0x9B28D5EB), LIMB_PAIR(0x4A8A5D19, 0x2196D770),
+          LIMB_PAIR(0xE884658E, 0x0ABD9B8D), LIMB_PAIR(0x16799F11, 0xADA571E8),
+          LIMB_PAIR(0x87CA21A3, 0xBE86DC57), LIMB_PAIR(0x3FE855DB, 0xAA5680F6),
+          LIMB_PAIR(0x1DB10908, 0x0B830860), LIMB_PAIR(0x8DCEB82A, 0x3ED53BC2),
+          LIMB_PARTIAL(0x0B4)}},
+        {{LIMB_PAIR(0x85F45EDD, 0x3A44DDE0), LIMB_PAIR(0x98309156, 0xC543BB64),
+          LIMB_PAIR(0x7597D0D0, 0x82D1CE82), LIMB_PAIR(0x8106CA3E, 0xB2DC0F22),
+          LIMB_PAIR(0x2C3A313A, 0x66F39447), LIMB_PAIR(0xA6CF2E03, 0xD8F6FCDA),
+          LIMB_PAIR(0x9E6BF40B, 0xED6E0E27), LIMB_PAIR(0x5B9A41AF, 0x7DCD3A30),
+          LIMB_PARTIAL(0x095)},
+         {LIMB_PAIR(0x12BE5B78, 0x0A870CEC), LIMB_PAIR(0x1406E140, 0x912C21C5),
+          LIMB_PAIR(0xD5E13CA1, 0x977417FD), LIMB_PAIR(0xB9E21E28, 0x9EDBAE8A),
+          LIMB_PAIR(0x13B2F069, 0x9FCE45EA), LIMB_PAIR(0x84F3CBF2, 0x25BD760B),
+          LIMB_PAIR(0x2489FD01, 0x29E0C3CE), LIMB_PAIR(0xEC62A766, 0xE16D31C1),
+          LIMB_PARTIAL(0x061)}}
+    },
+    {   // (1..8) * 2^(16 * 28) * G
+        {{LIMB_PAIR(0x8F69079E, 0x6D7EEDC4), LIMB_PAIR(0x4F03B92F, 0xF02E8E40),
+          LIMB_PAIR(0xCB76B181, 0xDF751116), LIMB_PAIR(0x234C1925, 0xC255EB2C),
+          LIMB_PAIR(0xA94AF9B2, 0xAF997D5E), LIMB_PAIR(0xD1374A41, 0x797F3DF0),
+          LIMB_PAIR(0x23986CDA, 0x357FD20B), LIMB_PAIR(0x1540ADB8, 0xF1CACCDA),
+          LIMB_PARTIAL(0x07D)},
+         {LIMB_PAIR(0xC01605A9, 0x2A04363C), LIMB_PAIR(0x7D7D1E54, 0x0D7CC0D8),
+          LIMB_PAIR(0xA0F9FD2B, 0x0515EB70), LIMB_PAIR(0xBB4EC5E8, 0x725D12A9),
+          LIMB_PAIR(0x3A6EB09A, 0xD1B5B8A3), LIMB_PAIR(0x87027D7B, 0xB6C836B1),
+          LIMB_PAIR(0xAAF9CD03, 0xF4773322), LIMB_PAIR(0x2500C647, 0x2FB3354E),
+          LIMB_PARTIAL(0x081)}},
+        {{LIMB_PAIR(0x41750B74, 0x83DA529B), LIMB_PAIR(0x76E28BF5, 0x9E431A5C),
+          LIMB_PAIR(0x7FDE2491, 0x225E2EB9), LIMB_PAIR(0xE7C469BC, 0x951E2CED),
+          LIMB_PAIR(0xF0E10C32, 0x35F384CA), LIMB_PAIR(0x2B1AADBC, 0xB8ED4A31),
+          LIMB_PAIR(0x7B797492, 0xD39393BA), LIMB_PAIR(0x47597F4B, 0xC82685F8),
+          LIMB_PARTIAL(0x0C9)},
+         {LIMB_PAIR(0x436E2563, 0xB04E1261), LIMB_PAIR(0x2DE3E4E7, 0xDC3E8305),
+          LIMB_PAIR(0xEE3DBBF4, 0xA32102BD), LIMB_PAIR(0x45F15EFB, 0xDFB53789),
+          LIMB_PAIR(0x6246965E, 0x34904B0B), LIMB_PAIR(0xAAC06CA8, 0xCD645C46),
+          LIMB_PAIR(0x358398F3, 0xD4E3F322), LIMB_PAIR(0xA54F3311, 0xAEBFE7C7),
+          LIMB_PARTIAL(0x1F3)}},
+        {{LIMB_PAIR(0xF2AFAE47, 0xFF2FA49C), LIMB_PAIR(0xF9F2B257, 0xA2C86068),
+          LIMB_PAIR(0x46CB76EE, 0x73DD56A4), LIMB_PAIR(0x7DC0A64C, 0xBFFB9F01),
+          LIMB_PAIR(0x44B4A4EE, 0x0EE2B60D), LIMB_PAIR(0x37C5959F, 0x49939F08),
+          LIMB_PAIR(0x78603DE3, 0xB302FCD1), LIMB_PAIR(0x4017C122, 0x03C2A220),
+          LIMB_PARTIAL(0x0A7)},
+         {LIMB_PAIR(0x57413107, 0x48ACDA97), LIMB_PAIR(0x4C01CAF8, 0xBD8F584D),
+          LIMB_PAIR(0x1AC29755, 0x38F448A7), LIMB_PAIR(0x6D29BF3E, 0xCC388483),
+          LIMB_PAIR(0x74401FED, 0x15C4BAF9), LIMB_PAIR(0x9023BC05, 0x7826E5CD),
+          LIMB_PAIR(0x4F459413, 0xC7A70D09), LIMB_PAIR(0x31896429, 0x1DE803C6),
+          LIMB_PARTIAL(0x0B8)}},
+        {{LIMB_PAIR(0xCEF34144, 0xABB0D91D), LIMB_PAIR(0x42B2A8BB, 0xBC5903FA),
+          LIMB_PAIR(0x38E4C5FA, 0xE279EF56), LIMB_PAIR(0x6D5B04EB, 0xB3416E9E),
+          LIMB_PAIR(0x7BB923CE, 0x44781918), LIMB_PAIR(0x2914A3A4, 0x58FEFA21),
+          LIMB_PAIR(0xE2C19F36, 0xB0456B2E), LIMB_PAIR(0xE92C1E50, 0x176361BB),
+          LIMB_PARTIAL(0x0B3)},
+         {LIMB_PAIR(0x824FDE34, 0xBC56A1AF), LIMB_PAIR(0x098A50FC, 0x33BFBFB3),
+          LIMB_PAIR(0xAB9CFA73, 0x6E720F55), LIMB_PAIR(0x08E4DFA2, 0xF1E104B9),
+          LIMB_PAIR(0x77865B2F, 0xB96B8ABD), LIMB_PAIR(0xA36740D1, 0x69EB257A),
+          LIMB_PAIR(0x26A50F43, 0xD73B946D), LIMB_PAIR(0x70CD91E7, 0x588E4A14),
+          LIMB_PARTIAL(0x07A)}},
+        {{LIMB_PAIR(0x13DC8B45, 0xD1DA41A1), LIMB_PAIR(0x8A639B8D, 0xF4886D24),
+          LIMB_PAIR(0xDEF9C5C3, 0xF3431CCE), LIMB_PAIR(0x8C204A2F, 0xAE07317D),
+          LIMB_PAIR(0xF3D6383A, 0xCBBD49A1), LIMB_PAIR(0x29BBE61E, 0x43D35932),
+          LIMB_PAIR(0x9643A1A8, 0x6BFA0609), LIMB_PAIR(0x2005A71F, 0x391499B2),
+          LIMB_PARTIAL(0x188)},
+         {LIMB_PAIR(0x79D0771B, 0x40774A7E), LIMB_PAIR(0x595038A1, 0x31987151),
+          LIMB_PAIR(0xC48B5063, 0xFF6DF557), LIMB_PAIR(0xC3751769, 0x26C03269),
+          LIMB_PAIR(0xD2D0CE99, 0x660C36CE), LIMB_PAIR(0xD3D79EA0, 0x71378E21),
+          LIMB_PAIR(0x30BE88EA, 0x7B2EC7EA), LIMB_PAIR(0xEAED0F73, 0x1B342D41),
+          LIMB_PARTIAL(0x16D)}},
+        {{LIMB_PAIR(0xE2C08642, 0x0F1B2A0E), LIMB_PAIR(0x19FBFFF6, 0xC1102275),
+          LIMB_PAIR(0x04574825, 0x3E491421), LIMB_PAIR(0x99552FDF, 0x058232D5),
+          LIMB_PAIR(0x0E083797, 0xA83F1A2F), LIMB_PAIR(0x860ACBCD, 0x7C387D90),
+          LIMB_PAIR(0xD59D4FFE, 0x7D8440D7), LIMB_PAIR(0x78F12D73, 0x45111FC7),
+          LIMB_PARTIAL(0x0A5)},
+         {LIMB_PAIR(0x28E9B450, 0x77ACF98E), LIMB_PAIR(0xA8129A6E, 0x0823B735),
+          LIMB_PAIR(0x8D1F0EF3, 0x1ABAA0F9), LIMB_PAIR(0xDEC36172, 0xC2FB1108),
+          LIMB_PAIR(0x855585E0, 0x4D486FD4), LIMB_PAIR(0x9D440B52, 0x27D00254),
+          LIMB_PAIR(0x5B964BAC, 0xC2B55613), LIMB_PAIR(0xA29F6FDE, 0x251AD413),
+          LIMB_PARTIAL(0x142)}},
+        {{LIMB_PAIR(0xE138D37E, 0x47DE9D47), LIMB_PAIR(0x3E7E1C87, 0x7387F369),
+          LIMB_PAIR(0x0A48AF71, 0x9C00813E), LIMB_PAIR(0xE8829FCD, 0x9DF47C63),
+          LIMB_PAIR(0x19E24A68, 0x7DC7C048), LIMB_PAIR(0x6942E130, 0x3D1823E1),
+          LIMB_PAIR(0xA2CD6199, 0x2F4440FF), LIMB_PAIR(0x98168AA8, 0xEBF60BE0),
+          LIMB_PARTIAL(0x049)},
+         {LIMB_PAIR(0x3B5F346C, 0x98969007), LIMB_PAIR(0xB79AE683, 0x00A0ECF9),
+          LIMB_PAIR(0xF8FB676F, 0x1B6F0DDB), LIMB_PAIR(0x7998C836, 0xD536D371),
+          LIMB_PAIR(0x9C4BC7CD, 0xE1DBDA54), LIMB_PAIR(0x71E12239, 0x2B752CA3),
+          LIMB_PAIR(0xC296C03D, 0xD633D0EE), LIMB_PAIR(0x9F6A0015, 0x548B37C5),
+          LIMB_PARTIAL(0x03F)}},
+        {{LIMB_PAIR(0x6ED0892B, 0x6ED1BBB7), LIMB_PAIR(0xB788BEF7, 0x4921306B),
+          LIMB_PAIR(0xBF3CDBDB, 0x7200D473), LIMB_PAIR(0xEEFDCE6C, 0xF1CB448F),
+          LIMB_PAIR(0x836591B0, 0x199B07A2), LIMB_PAIR(0x48FC6659, 0x804FF009),
+          LIMB_PAIR(0x3B8F405A, 0x69760059), LIMB_PAIR(0x9EF63732, 0x14755BE5),
+          LIMB_PARTIAL(0x103)},
+         {LIMB_PAIR(0x23383B1A, 0xD0A6D1B3), LIMB_PAIR(0xAE42CA1E, 0x50C7E33B),
+          LIMB_PAIR(0x2563BD12, 0x564B4655), LIMB_PAIR(0xFE7BAF1E, 0x48640D21),
+          LIMB_PAIR(0xF7717825, 0x6A0B495E), LIMB_PAIR(0xC7DF9FC0, 0x9E4AD9AE),
+          LIMB_PAIR(0xE038E19E, 0x4CEEA6A6), LIMB_PAIR(0x010887DE, 0xEA0E3BF8),
+          LIMB_PARTIAL(0x1DD)}}
+    },
+    {   // (1..8) * 2^(16 * 29) * G
+        {{LIMB_PAIR(0xCD5F918F, 0xE12D8922), LIMB_PAIR(0x49F73F1B, 0xEC7C1763),
+          LIMB_PAIR(0xC744EB3D, 0xCC5A3A14), LIMB_PAIR(0x782DBDA1, 0x2B96F342),
+          LIMB_PAIR(0xAB68DDE4, 0x87284905), LIMB_PAIR(0xE720668A, 0x647354B9),
+          LIMB_PAIR(0x739C4393, 0xE07DA694), LIMB_PAIR(0x2CC145F9, 0xBAE499BF),
+          LIMB_PARTIAL(0x1AE)},
+         {LIMB_PAIR(0x77C16DB0, 0x74EEEAA4), LIMB_PAIR(0xEB22CE92, 0x297624E8),
+          LIMB_PAIR(0x45098C91, 0x9D3944BC), LIMB_PAIR(0xFA4DC50C, 0x6FF31FA0),
+          LIMB_PAIR(0xCC40C211, 0x3C7FB6DA), LIMB_PAIR(0x96B4CD1C, 0x74D95DEC),
+          LIMB_PAIR(0xA6388941, 0x829423DB), LIMB_PAIR(0xFC3123B5, 0xAA2B7D45),
+          LIMB_PARTIAL(0x119)}},
+        {{LIMB_PAIR(0x33849BA6, 0x404216DB), LIMB_PAIR(0x7B42813F, 0x7979AB02),
+          LIMB_PAIR(0x117E27AA, 0xB0CABF29), LIMB_PAIR(0x5A0AB76D, 0x3E449CB6),
+          LIMB_PAIR(0x460B6964, 0x34EFBA77), LIMB_PAIR(0x6FEAD00B, 0x7553E0A6),
+          LIMB_PAIR(0x16963CF0, 0x8AC88571), LIMB_PAIR(0x017AD9D1, 0x01716CBE),
+          LIMB_PARTIAL(0x1F8)},
+         {LIMB_PAIR(0xD21FBD36, 0x30CFE5C1), LIMB_PAIR(0xDF1FE3B4, 0xC7A0E466),
+          LIMB_PAIR(0xC8EA2C29, 0xCA38FD1C), LIMB_PAIR(0x4E54630F, 0xDE2E2039),
+          LIMB_PAIR(0x885B124F, 0x3B152EC3), LIMB_PAIR(0xD39818C8, 0x704A1D76),
+          LIMB_PAIR(0x5207D2C2, 0x0E74A982), LIMB_PAIR(0xEC4D71A5, 0x2B2DC7C8),
+          LIMB_PARTIAL(0x1F8)}},
+        {{LIMB_PAIR(0x16E0F612, 0x01EF33CF), LIMB_PAIR(0xEEB7A33D, 0xBCCC51C3),
+          LIMB_PAIR(0x46A12C50, 0xCC35C1E3), LIMB_PAIR(0xB915B370, 0xD2151223),
+          LIMB_PAIR(0x3AFF625F, 0xB0303014), LIMB_PAIR(0xB76ED5C4, 0xB7E34E67),
+          LIMB_PAIR(0x10B988F7, 0xD5B48E22), LIMB_PAIR(0x57F1882F, 0x5EDADA05),
+          LIMB_PARTIAL(0x1EE)},
+         {LIMB_PAIR(0x26A93C88, 0x70919A61), LIMB_PAIR(0x11491A74, 0x2729BAF1),
+          LIMB_PAIR(0x541B2E39, 0x895470B5), LIMB_PAIR(0xC85FEF39, 0x88E52A03),
+          LIMB_PAIR(0x5B35AD5A, 0x605D4808), LIMB_PAIR(0x87561036, 0x3203783C),
+          LIMB_PAIR(0x546E9DE2, 0xAC1C8568), LIMB_PAIR(0x62D3BC75, 0x61C5703C),
+          LIMB_PARTIAL(0x192)}},
+        {{LIMB_PAIR(0xCE43380A, 0x493D8A3F), LIMB_PAIR(0x1511E823, 0x27D1657B),
+          LIMB_PAIR(0xE6112ECE, 0xF09125A7), LIMB_PAIR(0x18C2DDC1, 0xAFD3F482),
+          LIMB_PAIR(0x602AB092, 0xC1207AC1), LIMB_PAIR(0xF80FE3F9, 0x22FDFE83),
+          LIMB_PAIR(0xF479C304, 0x736AD27F), LIMB_PAIR(0x784CA960, 0xD1FC1905),
+          LIMB_PARTIAL(0x08F)},
+         {LIMB_PAIR(0x7FB35409, 0xE87798D2), LIMB_PAIR(0x61CFFD40, 0x86B02571),
+          LIMB_PAIR(0x63058303, 0x12D991F9), LIMB_PAIR(0x033F10C9, 0xEF9E933E),
+          LIMB_PAIR(0xB298A118, 0x8221774C), LIMB_PAIR(0x80DC2858, 0x95DCFD10),
+          LIMB_PAIR(0x68BFAA1F, 0x83747D71), LIMB_PAIR(0xA213129B, 0x03567035),
+          LIMB_PARTIAL(0x1DC)}},
+        {{LIMB_PAIR(0xD5AC5D48, 0x15AEA420), LIMB_PAIR(0x178C5A77, 0x6E11BF30),
+          LIMB_PAIR(0x2651DEE6, 0x01F1180D), LIMB_PAIR(0x59E7A8F6, 0xD7602ED4),
+          LIMB_PAIR(0xDE3746DE, 0x5D3EC901), LIMB_PAIR(0xE2400304, 0x314D1580),
+          LIMB_PAIR(0x65F15588, 0x08F82592), LIMB_PAIR(0xD9FFE64C, 0x22E8FF88),
+          LIMB_PARTIAL(0x1D2)},
+         {LIMB_PAIR(0x99E0F136, 0xF3F23ABC), LIMB_PAIR(0x0F1AE78C, 0xEF5D9484),
+          LIMB_PAIR(0xF6E34CA1, 0x616E957F), LIMB_PAIR(0x80B7054A, 0xE2E237B0),
+          LIMB_PAIR(0x92BAA214, 0x79877615), LIMB_PAIR(0xDD291296, 0xCD321299),
+          LIMB_PAIR(0x20D8BCF6, 0xF9B74ADB), LIMB_PAIR(0x31661404, 0xEFCF3236),
+          LIMB_PARTIAL(0x0E6)}},
+        {{LIMB_PAIR(0xF084380F, 0xEAA89410), LIMB_PAIR(0x458AB9E4, 0x9491F70E),
+          LIMB_PAIR(0x1D8EC684, 0x6B677205), LIMB_PAIR(0x1EF7E9ED, 0x1A9FC795),
+          LIMB_PAIR(0xB05C41EF, 0xC47E84EF), LIMB_PAIR(0xC6014E09, 0xEE377F78),
+          LIMB_PAIR(0x521171EB, 0x91D14A75), LIMB_PAIR(0x32361217, 0x1B11FBBC),
+          LIMB_PARTIAL(0x111)},
+         {LIMB_PAIR(0xA63BC7A1, 0xF789CC6B), LIMB_PAIR(0x9393B5CB, 0xBBD74F35),
+          LIMB_PAIR(0x0BB024A4, 0xB43FF617), LIMB_PAIR(0xA844508C, 0x73800410),
+          LIMB_PAIR(0xC5468780, 0x93A28632), LIMB_PAIR(0x2AEFA8C1, 0xC96C62E5),
+          LIMB_PAIR(0x7DF9B61F, 0xA500CE0B), LIMB_PAIR(0x369F304A, 0xB59527F2),
+          LIMB_PARTIAL(0x172)}},
+        {{LIMB_PAIR(0x052D2EA5, 0x68B81BE9), LIMB_PAIR(0x05294D6E, 0xEADFB531),
+          LIMB_PAIR(0xA3258647, 0xCD41F773), LIMB_PAIR(0xD70FD9D0, 0xF6B1C867),
+          LIMB_PAIR(0x7BE523E7, 0x9A89CC01), LIMB_PAIR(0x487EBF56, 0x2499D793),
+          LIMB_PAIR(0xC0D072A2, 0xC82CEFE8), LIMB_PAIR(0xE82CB4F8, 0x91C2BFBB),
+          LIMB_PARTIAL(0x105)},
+         {LIMB_PAIR(0x6705DCE5, 0xD705CF5A), LIMB_PAIR(0x4462A67C, 0xFCBE204E),
+          LIMB_PAIR(0x430D627F, 0x5E198BC3), LIMB_PAIR(0xE765991F, 0xE13DA562),
+          LIMB_PAIR(0x7032C5F8, 0xB6CFCA28), LIMB_PAIR(0x1783308A, 0x0868D9AB),
+          LIMB_PAIR(0xC8050C8C, 0xC5B628C6), LIMB_PAIR(0x3A93A8DE, 0x243E2EC1),
+          LIMB_PARTIAL(0x139)}},
+        {{LIMB_PAIR(0x910F4978, 0x461C1512), LIMB_PAIR(0x63D2EC28, 0x8CA7F0DD),
+          LIMB_PAIR(0x607CE3C5, 0xDA9297D2), LIMB_PAIR(0x81BB2DBB, 0x592BA13F),
+          LIMB_PAIR(0xF740C331, 0x157D4AC7), LIMB_PAIR(0x82C49AE7, 0x1D5311E7),
+          LIMB_PAIR(0x3BEC9A94, 0x5C304671), LIMB_PAIR(0x0A23AB8D, 0xD81FA25B),
+          LIMB_PARTIAL(0x1EE)},
+         {LIMB_PAIR(0xF51614FF, 0x6D8C6EFA), LIMB_PAIR(0x868B4FBC, 0x20CFD353),
+          LIMB_PAIR(0x2201AAC2, 0x9B9DBA15), LIMB_PAIR(0x8D1900D7, 0x6BBD8DED),
+          LIMB_PAIR(0xFA946925, 0x6CA3E71A), LIMB_PAIR(0xA0C3735A, 0x7381E45A),
+          LIMB_PAIR(0xB93D4FEE, 0xCD9DB7A2), LIMB_PAIR(0x45BDCE69, 0xAE401151),
+          LIMB_PARTIAL(0x1BB)}}
+    },
+    {   // (1..8) * 2^(16 * 30) * G
+        {{LIMB_PAIR(0x3FBADC57, 0x62A1F73E), LIMB_PAIR(0xB1BA2D35, 0xEABF4B68),
+          LIMB_PAIR(0x76F3BDE7, 0x711D7F63), LIMB_PAIR(0xB31C3FB3, 0x162F5183),
+          LIMB_PAIR(0xD7D716F7, 0x0DCD66FE), LIMB_PAIR(0xE46816D9, 0x6E1DBB78),
+          LIMB_PAIR(0xF833A6F7, 0x532831B8), LIMB_PAIR(0x4CFED0CF, 0x64191CCB),
+          LIMB_PARTIAL(0x190)},
+         {LIMB_PAIR(0x6D7824AD, 0xDB376339), LIMB_PAIR(0xB16A391B, 0x6B948AEF),
+          LIMB_PAIR(0x4AE9013E, 0x2D174FD6), LIMB_PAIR(0x16A57DE2, 0x9B5C22EE),
+          LIMB_PAIR(0x9E857A25, 0x3BFED1DA), LIMB_PAIR(0x4D644BBD, 0x635187A6),
+          LIMB_PAIR(0x6FE288AC, 0x94786E3A), LIMB_PAIR(0xECE25962, 0x827C8B03),
+          LIMB_PARTIAL(0x092)}},
+        {{LIMB_PAIR(0xD35B5ACD, 0x027F4FF2), LIMB_PAIR(0x9EEE8CAF, 0x0E0FEC35),
+          LIMB_PAIR(0x544C2A44, 0xA99AA6E2), LIMB_PAIR(0xA9DE5EE3, 0x0548945F),
+          LIMB_PAIR(0xC4C5263F, 0x02EE7FB3), LIMB_PAIR(0xC75A400D, 0x3FAE05EE),
+          LIMB_PAIR(0x3640DFC6, 0x50ECFF53), LIMB_PAIR(0xC0CECB87, 0xE57C180F),
+          LIMB_PARTIAL(0x0C2)},
+         {LIMB_PAIR(0x87BA8E83, 0x22B35043), LIMB_PAIR(0x1C652199, 0x6C47F5D2),
+          LIMB_PAIR(0x19F3260D, 0x2EC15D3D), LIMB_PAIR(0xE95FAEA6, 0xCF9E5050),
+          LIMB_PAIR(0xA4F5D193, 0x7ADC35CC), LIMB_PAIR(0x3DDEE652, 0xA7B0F1F3),
+          LIMB_PAIR(0x6E213C07, 0xDFB75124), LIMB_PAIR(0x7946DDC3, 0xE33A115A),
+          LIMB_PARTIAL(0x09F)}},
+        {{LIMB_PAIR(0xEF4B1B98, 0x6E965255), LIMB_PAIR(0x8BA97BF6, 0x3F63B6BD),
+          LIMB_PAIR(0x19BB0BA0, 0xC6CACADB), LIMB_PAIR(0x3C8EDCC4, 0x9F88F0C8),
+          LIMB_PAIR(0x1A489ACE, 0x3A2D4BC5), LIMB_PAIR(0x5529BB67, 0xAA3075B7),
+          LIMB_PAIR(0xFFBBD2BF, 0xCDB0C4D6), LIMB_PAIR(0x3A568FD4, 0x4A3B41D3),
+          LIMB_PARTIAL(0x146)},
+         {LIMB_PAIR(0xEFFA56AE, 0x46442711), LIMB_PAIR(0x47ACC062, 0x941858D8),
+          LIMB_PAIR(0x7434D565, 0x9480D79C), LIMB_PAIR(0x43322ECC, 0xA92E8859),
+          LIMB_PAIR(0x5F82931E, 0x650CD6DE), LIMB_PAIR(0x97876156, 0x4EF5D483),
+          LIMB_PAIR(0xAAF946F4, 0x04CA704A), LIMB_PAIR(0x0A95E02C, 0x75258AAC),
+          LIMB_PARTIAL(0x132)}},
+        {{LIMB_PAIR(0xD3CB8E9F, 0x7AAA8F37), LIMB_PAIR(0x1A73D853, 0x8F3B48A9),
+          LIMB_PAIR(0xEF285A53, 0x783EBBE7), LIMB_PAIR(0x1C3EF389, 0x4F9D9729),
+          LIMB_PAIR(0x6453DA69, 0x130F276C), LIMB_PAIR(0x834FACED, 0x76683273),
+          LIMB_PAIR(0xAF5AF17C, 0x026A3722), LIMB_PAIR(0xF08A5E50, 0xD588AA37),
+          LIMB_PARTIAL(0x16D)},
+         {LIMB_PAIR(0xBBDC76B3, 0x81B6610B), LIMB_PAIR(0x563A6902, 0x406785DD),
+          LIMB_PAIR(0xED775283, 0xE0755F6C), LIMB_PAIR(0x53B16D0A, 0x08D6C847),
+          LIMB_PAIR(0x654F906A, 0x48EBB570), LIMB_PAIR(0x184B373C, 0x3F0C62B7),
+          LIMB_PAIR(0x314D776A, 0xD6BB91B6), LIMB_PAIR(0x224744A7, 0xAB9BFB3A),
+          LIMB_PARTIAL(0x12F)}},
+        {{LIMB_PAIR(0xE4DC6C47, 0xA5566CAF), LIMB_PAIR(0xFD8F2789, 0x17226EF0),
+          LIMB_PAIR(0xC66FEEA4, 0xF6F20C86), LIMB_PAIR(0x54F41B79, 0x19F5E459),
+          LIMB_PAIR(0xA05AEA83, 0x4288C4B4), LIMB_PAIR(0xD8D42617, 0x107C800C),
+          LIMB_PAIR(0x2425EA3A, 0xA83D33A4), LIMB_PAIR(0xEEC9D772, 0x8DEA172B),
+          LIMB_PARTIAL(0x132)},
+         {LIMB_PAIR(0x9EF2A747, 0xF75FEE0F), LIMB_PAIR(0xBF360B7B, 0x107D2B54),
+          LIMB_PAIR(0x4C4DD036, 0x6A0B32F0), LIMB_PAIR(0xE843BDF6, 0x4733A40D),
+          LIMB_PAIR(0xAE53A7D2, 0x5B17B282), LIMB_PAIR(0x2070F209, 0xE15AF19E),
+          LIMB_PAIR(0xDC178326, 0x800540EC), LIMB_PAIR(0x8A9691E5, 0x13D38AAC),
+          LIMB_PARTIAL(0x04E)}},
+        {{LIMB_PAIR(0x285F37AD, 0x3B8CF734), LIMB_PAIR(0xA37C1F2F, 0x9C65B1F8),
+          LIMB_PAIR(0x996231F0, 0x6D946DF3), LIMB_PAIR(0xF3574FEB, 0x201EACBC),
+          LIMB_PAIR(0xFA5BEC75, 0x2C6287F9), LIMB_PAIR(0xB736EA2A, 0x0BF3E245),
+          LIMB_PAIR(0x0C02BCBF, 0x8915EDB1), LIMB_PAIR(0xCFB7E1CF, 0xEE1762B6),
+          LIMB_PARTIAL(0x0E2)},
+         {LIMB_PAIR(0x7E9B5EBB, 0x75DF9F82), LIMB_PAIR(0x75856008, 0x212082C2),
+          LIMB_PAIR(0xCFA5D8C1, 0x6F396D2A), LIMB_PAIR(0x6BCBDFE9, 0x08311CAF),
+          LIMB_PAIR(0xA0BB9F1C, 0x388B553B), LIMB_PAIR(0x020D8CEB, 0x8C674F9B),
+          LIMB_PAIR(0x9709618D, 0x2C668AD2), LIMB_PAIR(0x1FE83DCF, 0x119B437B),
+          LIMB_PARTIAL(0x12F)}},
+        {{LIMB_PAIR(0x373055FD, 0x28B3C1E7), LIMB_PAIR(0x066CC9BF, 0x8B5A5FDE),
+          LIMB_PAIR(0x4C213824, 0xF1F38698), LIMB_PAIR(0xE7069ACA, 0xD3F812F6),
+          LIMB_PAIR(0x410B8E51, 0x7AF66243), LIMB_PAIR(0xCCDBEB09, 0xB0B2C6CA),
+          LIMB_PAIR(0xF5EB1DAA, 0x3C31D93A), LIMB_PAIR(0x8FCFD3FA, 0x487DA2D2),
+          LIMB_PARTIAL(0x03B)},
+         {LIMB_PAIR(0xD1091BCE, 0x111B77E8), LIMB_PAIR(0x8F9A76F9, 0x12FD3BAE),
+          LIMB_PAIR(0x100340A2, 0x737049CE), LIMB_PAIR(0x577FED17, 0xF514BE2E),
+          LIMB_PAIR(0xBAA6A384, 0x40E9F3E8), LIMB_PAIR(0x4DF98480, 0xCB4AF017),
+          LIMB_PAIR(0xA9C0A1AF, 0x3A5E3983), LIMB_PAIR(0x05B9D797, 0x7CA6BDAF),
+          LIMB_PARTIAL(0x05F)}},
+        {{LIMB_PAIR(0x2D7E7BE5, 0x5ABD7021), LIMB_PAIR(0xB01CCA76, 0x5AE72DD6),
+          LIMB_PAIR(0x99FA6345, 0xBA2A1794), LIMB_PAIR(0xB5D0CB9B, 0xBD22D699),
+          LIMB_PAIR(0xFCE9C6B9, 0xDE336ADF), LIMB_PAIR(0xFB816436, 0x602DC43C),
+          LIMB_PAIR(0x33B17E66, 0x9D86318F), LIMB_PAIR(0xDCDD628D, 0x43F8EE75),
+          LIMB_PARTIAL(0x0E6)},
+         {LIMB_PAIR(0x3D223930, 0x1BF13BBA), LIMB_PAIR(0x3B6B0034, 0xD77BBB12),
+          LIMB_PAIR(0xBE34BAC8, 0xA4EA21C4), LIMB_PAIR(0xAAB61589, 0x95E5F221),
+          LIMB_PAIR(0x9D411C28, 0xB4494EB7), LIMB_PAIR(0xCBE6FAA1, 0xA423C6F5),
+          LIMB_PAIR(0xA6E4E735, 0xAB882EE7), LIMB_PAIR(0x546545B3, 0xB36EACDB),
+          LIMB_PARTIAL(0x0C2)}}
+    },
+    {   // (1..8) * 2^(16 * 31) * G
+        {{LIMB_PAIR(0x945039AC, 0x0CE1F2D1), LIMB_PAIR(0xFDF94D41, 0x1D1E6504),
+          LIMB_PAIR(0x8752D630, 0xF36EAFD5), LIMB_PAIR(0xEFBF0132, 0x24477F7F),
+          LIMB_PAIR(0xC02BF85B, 0xAE8FBA2C), LIMB_PAIR(0xEB510E61, 0x53A24CA8),
+          LIMB_PAIR(0x9C2C453D, 0xEADBC7F7), LIMB_PAIR(0x310EDA46, 0xCFDBC9DC),
+          LIMB_PARTIAL(0x1A9)},
+         {LIMB_PAIR(0xD8F82B51, 0xFBF287C8), LIMB_PAIR(0x7F0ECADA, 0xB7CA6096),
+          LIMB_PAIR(0x15242666, 0x1DC411B7), LIMB_PAIR(0x3DC6ED96, 0xEBF82D6C),
+          LIMB_PAIR(0xD0A92B49, 0x8F82229D), LIMB_PAIR(0x9DAC585A, 0x75A6A4A7),
+          LIMB_PAIR(0xC839248A, 0x443AE75E), LIMB_PAIR(0x1BA7C9C3, 0x4DEFB89F),
+          LIMB_PARTIAL(0x1B5)}},
+        {{LIMB_PAIR(0x72925756, 0x20E2FE19), LIMB_PAIR(0x32CE7832, 0x4815AE33),
+          LIMB_PAIR(0xEB8F4EB7, 0x183D90C3), LIMB_PAIR(0x2A8045D9, 0x0E088AF5),
+          LIMB_PAIR(0xDA04790F, 0xF8232956), LIMB_PAIR(0xEA0118C0, 0xC24661B5),
+          LIMB_PAIR(0xA72924A6, 0xE4152695), LIMB_PAIR(0x40AB56B7, 0xFFCB2778),
+          LIMB_PARTIAL(0x120)},
+         {LIMB_PAIR(0xAAE9AF57, 0x1C766208), LIMB_PAIR(0x239689E7, 0x21769DDA),
+          LIMB_PAIR(0x235ECF56, 0x9DC2194A), LIMB_PAIR(0xCF83A067, 0x930E993F),
+          LIMB_PAIR(0x32913E2A, 0xB6725AD3), LIMB_PAIR(0xFC942B50, 0x09BD9FF9),
+          LIMB_PAIR(0x600D426D, 0xDFB47D67), LIMB_PAIR(0x9DEF7175, 0x4CC06C58),
+          LIMB_PARTIAL(0x03B)}},
+        {{LIMB_PAIR(0x065D6929, 0x68205CA5), LIMB_PAIR(0x039168C3, 0x15F79567),
+          LIMB_PAIR(0x74DD0EFE, 0x055D11E3), LIMB_PAIR(0x980ED709, 0x13D65191),
+          LIMB_PAIR(0x91CB9DAE, 0xC819A8BF), LIMB_PAIR(0xC7A39E18, 0xD1EF1626),
+          LIMB_PAIR(0x274C7AD7, 0x1CFED493), LIMB_PAIR(0xAA0280F5, 0xB2FF9CC1),
+          LIMB_PARTIAL(0x1A0)},
+         {LIMB_PAIR(0x82BBE037, 0xAFEE1166), LIMB_PAIR(0x5DD65916, 0xF54D3BF0),
+          LIMB_PAIR(0x47DA6A80, 0xCF8D694E), LIMB_PAIR(0x787E892E, 0xC350309B),
+          LIMB_PAIR(0xF87D2CA5, 0x13A4BDBF), LIMB_PAIR(0x0ABC535B, 0xE5C927D1),
+          LIMB_PAIR(0x8D2B5113, 0x5532B565), LIMB_PAIR(0xD904BB5C, 0xC0F0222F),
+          LIMB_PARTIAL(0x1F5)}},
+        {{LIMB_PAIR(0x39926493, 0x9C3F0829), LIMB_PAIR(0xE3D0F530, 0x6BF1089E),
+          LIMB_PAIR(0x7D7D5B4C, 0x3E91285D), LIMB_PAIR(0x02BB958A, 0xD8D70F1B),
+          LIMB_PAIR(0xBDBD2B6E, 0xE4B0E8C1), LIMB_PAIR(0x9239F187, 0xEA70F107),
+          LIMB_PAIR(0x27D37CA6, 0xD30F4ADA), LIMB_PAIR(0xC88EDA99, 0x0358F6B3),
+          LIMB_PARTIAL(0x10C)},
+         {LIMB_PAIR(0xE385AC45, 0x8957EA97), LIMB_PAIR(0xB4FF3D17, 0x707E7445),
+          LIMB_PAIR(0x40A361CF, 0x4A6D4DC8), LIMB_PAIR(0x13AAE7DB, 0xD086353B),
+          LIMB_PAIR(0xA478B479, 0xD856F4C9), LIMB_PAIR(0x4D7CF67D, 0xF687400F),
+          LIMB_PAIR(0xCE52336B, 0xFA3000B6), LIMB_PAIR(0xD0B88A94, 0x805459D7),
+          LIMB_PARTIAL(0x1EC)}},
+        {{LIMB_PAIR(0x48237525, 0x532BD215), LIMB_PAIR(0xF826B4E5, 0xBB14742D),
+          LIMB_PAIR(0x4D9F4791, 0xDDADBE44), LIMB_PAIR(0x6344CDDF, 0xCDD681D7),
+          LIMB_PAIR(0xB5AF617C, 0x721F15A2), LIMB_PAIR(0x7433253C, 0x2740BC18),
+          LIMB_PAIR(0xA3C6809A, 0x727759A2), LIMB_PAIR(0xE802EB9E, 0x2128A7A5),
+          LIMB_PARTIAL(0x07D)},
+         {LIMB_PAIR(0xD9C2052A, 0x41B7109E), LIMB_PAIR(0x71A26434, 0xA0CB7262),
+          LIMB_PAIR(0xACA51897, 0x50F1DC72), LIMB_PAIR(0x67067A10, 0x28CACA35),
+          LIMB_PAIR(0xCD61B985, 0xAB969C93), LIMB_PAIR(0x491A61D2, 0xD3986E20),
+          LIMB_PAIR(0xDC034A35, 0xCFD5713C), LIMB_PAIR(0x0525F8AA, 0x6FAD3626),
+          LIMB_PARTIAL(0x1B3)}},
+        {{LIMB_PAIR(0xABE029FD, 0x96632B75), LIMB_PAIR(0x57AAA853, 0x38280DBD),
+          LIMB_PAIR(0x56556BF7, 0x2A49FF19), LIMB_PAIR(0x017AD9E7, 0x76AF8029),
+          LIMB_PAIR(0x65EA6EDF, 0xE2319792), LIMB_PAIR(0x9CBB4069, 0x71B0793C),
+          LIMB_PAIR(0xF62D86DD, 0x1F89D54D), LIMB_PAIR(0x52809190, 0x48601CBD),
+          LIMB_PARTIAL(0x116)},
+         {LIMB_PAIR(0x95F5317C, 0x825A9EC2), LIMB_PAIR(0x5B568F34, 0x9AF04499),
+          LIMB_PAIR(0x70C96172, 0x0A74E926), LIMB_PAIR(0x9CBE4CA2, 0xA87FCC84),
+          LIMB_PAIR(0x17B5587B, 0x409E58C0), LIMB_PAIR(0x686599F1, 0xAE221D81),
+          LIMB_PAIR(0x9B04AE84, 0xDB87C25E), LIMB_PAIR(0xF9A49CB1, 0x2A847873),
+          LIMB_PARTIAL(0x19A)}},
+        {{LIMB_PAIR(0x0ADFEE2F, 0x8104E371), LIMB_PAIR(0x3A0AAF8B, 0x021A434F),
+          LIMB_PAIR(0xA2908065, 0xD2A2E82C), LIMB_PAIR(0x1E0D4B4D, 0x770F059D),
+          LIMB_PAIR(0x962BA072, 0x7B4DEFE2), LIMB_PAIR(0x31DD59BE, 0x81835947),
+          LIMB_PAIR(0xD6638F80, 0xDA69E9A5), LIMB_PAIR(0x114759D3, 0x58F0BCA6),
+          LIMB_PARTIAL(0x154)},
+         {LIMB_PAIR(0x9EF7A0C7, 0x0DB1AA52), LIMB_PAIR(0x16F4ABF3, 0xB2450BD8),
+          LIMB_PAIR(0xAD0D02AA, 0x0670492C), LIMB_PAIR(0xE2C5C42B, 0x6CDB3460),
+          LIMB_PAIR(0xDDF42A06, 0x663BD232), LIMB_PAIR(0xF76EBEF0, 0x23550ED5),
+          LIMB_PAIR(0x8D9CCB9C, 0x0FC63284), LIMB_PAIR(0xD425EF44, 0xEB0B313F),
+          LIMB_PARTIAL(0x01A)}},
+        {{LIMB_PAIR(0xBEB4F9F1, 0xE862A17B), LIMB_PAIR(0x310C4B65, 0x5E701369),
+          LIMB_PAIR(0x3377F678, 0x01EF6625), LIMB_PAIR(0xDA8BEB61, 0x56157709),
+          LIMB_PAIR(0x9EF7DA41, 0x7CA21B04), LIMB_PAIR(0x88E486A6, 0x9F776DAC),
+          LIMB_PAIR(0x8AED6F6C, 0x53DD04CF), LIMB_PAIR(0x953C2D95, 0x4A7DF43E),
+          LIMB_PARTIAL(0x158)},
+         {LIMB_PAIR(0x1FCC4484, 0xE5BC0DED), LIMB_PAIR(0xEF6D0E8A, 0xB337EB4E),
+          LIMB_PAIR(0xDABF0D9E, 0x02208B42), LIMB_PAIR(0x467BFC55, 0xE64C8529),
+          LIMB_PAIR(0x2E141810, 0x0CF40959), LIMB_PAIR(0x56FA0BAD, 0xA34AF9D6),
+          LIMB_PAIR(0x5345141C, 0xF3471D5A), LIMB_PAIR(0x1FF7597E, 0x89A7A82C),
+          LIMB_PARTIAL(0x14E)}}
+    },
+    {   // (1..8) * 2^(16 * 32) * G
+        {{LIMB_PAIR(0x56B092A2, 0x22B8ECCB), LIMB_PAIR(0x736EA9AA, 0x0A47D70E),
+          LIMB_PAIR(0xD64A7D08, 0x3EEFC772), LIMB_PAIR(0xBB2E0F14, 0x85408CEC),
+          LIMB_PAIR(0x285CB70E, 0x73047AFD), LIMB_PAIR(0x63297A2A, 0x1732F016),
+          LIMB_PAIR(0x4CF37EAC, 0x4DFE656A), LIMB_PAIR(0xC0EC357B, 0x147D6D66),
+          LIMB_PARTIAL(0x0C7)},
+         {LIMB_PAIR(0x3C115125, 0x1F3E5910), LIMB_PAIR(0xBFB07241, 0x0D2D18FC),
+          LIMB_PAIR(0xBA4B009D, 0x5D6AA860), LIMB_PAIR(0x806FF8ED, 0x8D0D9368),
+          LIMB_PAIR(0x1A05C049, 0xCC5CA370), LIMB_PAIR(0xE9AB4C41, 0x7BF21CAE),
+          LIMB_PAIR(0x001D5CCA, 0x6632C3E0), LIMB_PAIR(0xB60E5593, 0x3A4F99B6),
+          LIMB_PARTIAL(0x008)}},
+        {{LIMB_PAIR(0xE6B2853F, 0xAED7666A), LIMB_PAIR(0xBE96140B, 0xA1FC0332),
+          LIMB_PAIR(0x1C1E38B1, 0xB99A5DC8), LIMB_PAIR(0xF38C5243, 0x56194675),
+          LIMB_PAIR(0x80D38681, 0x16C6F80E), LIMB_PAIR(0x14205F46, 0x11178413),
+          LIMB_PAIR(0x6EE03089, 0xD2DC67BC), LIMB_PAIR(0xD3DAD965, 0x5E18245E),
+          LIMB_PARTIAL(0x1E3)},
+         {LIMB_PAIR(0xFDA7741E, 0x389E59CA), LIMB_PAIR(0x259E4DCB, 0xF341D649),
+          LIMB_PAIR(0x260B32B0, 0xEC15D27A), LIMB_PAIR(0x07640CEA, 0xF3A1A082),
+          LIMB_PAIR(0x6E811313, 0x15AC3145), LIMB_PAIR(0x7CF68896, 0xB9027CE4),
+          LIMB_PAIR(0x7008A356, 0xB43E4FD7), LIMB_PAIR(0x640C2C60, 0x541AA5B4),
+          LIMB_PARTIAL(0x1C3)}},
+        {{LIMB_PAIR(0x4CB99695, 0x3C32F4E3), LIMB_PAIR(0xC1241E0C, 0x0DB56646),
+          LIMB_PAIR(0x28515D66, 0xA4CEA13B), LIMB_PAIR(0x5F3AB5DC, 0x1C8F6397),
+          LIMB_PAIR(0x4DEFD3EB, 0xD466A1B3), LIMB_PAIR(0xE6D860D2, 0xCDBB66B5),
+          LIMB_PAIR(0xFE87183E, 0x26FC2FD5), LIMB_PAIR(0xD18233A9, 0x02D81A03),
+          LIMB_PARTIAL(0x0D2)},
+         {LIMB_PAIR(0xCAA08959, 0xDC570644), LIMB_PAIR(0xCF763C20, 0x7791CC35),
+          LIMB_PAIR(0x272A1068, 0x3C0DC132), LIMB_PAIR(0xC8A74578, 0xD7AD702C),
+          LIMB_PAIR(0xADA1D72C, 0x7689C46E), LIMB_PAIR(0x2B8B4369, 0xBFC2E06F),
+          LIMB_PAIR(0xC0BBD6C4, 0xDE85E36E), LIMB_PAIR(0xF9849084, 0xD879E086),
+          LIMB_PARTIAL(0x077)}},
+        {{LIMB_PAIR(0xDBA16581, 0xEF192AED), LIMB_PAIR(0x2E8DB0FD, 0xFF134211),
+          LIMB_PAIR(0xBDCA8D0D, 0x32551C61), LIMB_PAIR(0xC55B9AA3, 0x96E1FF06),
+          LIMB_PAIR(0x7E4C635F, 0xA211B110), LIMB_PAIR(0x7C4B6B4A, 0x2708E542),
+          LIMB_PAIR(0xA6575526, 0x70FF7C3F), LIMB_PAIR(0x36092EC8, 0xD26E2DB6),
+          LIMB_PARTIAL(0x1AE)},
+         {LIMB_PAIR(0x533251D0, 0x1FAFD3C2), LIMB_PAIR(0x8A9A439D, 0x1602462D),
+          LIMB_PAIR(0x1CC5AF27, 0xC057595A), LIMB_PAIR(0xBE839C9A, 0xA27197F3),
+          LIMB_PAIR(0xBFC1318A, 0x03C1CC4B), LIMB_PAIR(0x34D0A378, 0xB78C7B7F),
+          LIMB_PAIR(0x161B4257, 0x0F9D754E), LIMB_PAIR(0xF355D916, 0x8DCF43CB),
+          LIMB_PARTIAL(0x194)}},
+        {{LIMB_PAIR(0xDC3577EC, 0x51DF490D), LIMB_PAIR(0x7E28BE3E, 0x6D8A70E9),
+          LIMB_PAIR(0x1DE95E73, 0xD87A7ED3), LIMB_PAIR(0xA6C7086E, 0xF97C968D),
+          LIMB_PAIR(0x6B4AFE00, 0xC47B64DC), LIMB_PAIR(0x8B432676, 0x489F1D98),
+          LIMB_PAIR(0xF72C2153, 0x9F2B7996), LIMB_PAIR(0xF820AF70, 0x4ACD5AE8),
+          LIMB_PARTIAL(0x1A9)},
+         {LIMB_PAIR(0xD7263FCF, 0xA5CC854B), LIMB_PAIR(0x864FEBF7, 0x7BD94B2F),
+          LIMB_PAIR(0x9460C5D4, 0xB3DEF0FF), LIMB_PAIR(0x042D47B5, 0x5F0766B5),
+          LIMB_PAIR(0x8AE51B32, 0x9E8484F2), LIMB_PAIR(0xF8C729E7, 0x26EC4EA6),
+          LIMB_PAIR(0x6C2AD315, 0xF279D733), LIMB_PAIR(0xDAC3E8D0, 0xB2D22E6E),
+          LIMB_PARTIAL(0x0F6)}},
+        {{LIMB_PAIR(0x5967B43C, 0xB2B4D408), LIMB_PAIR(0xF35923D2, 0xC660C6C1),
+          LIMB_PAIR(0xA27FDE01, 0x696D9140), LIMB_PAIR(0x259432A9, 0xFCD766EB),
+          LIMB_PAIR(0xCAD2A4E0, 0x6831FDE1), LIMB_PAIR(0x928838EA, 0xA157BE88),
+          LIMB_PAIR(0x791D2740, 0x4B31C1D6), LIMB_PAIR(0x850A1760, 0xF1958BBA),
+          LIMB_PARTIAL(0x085)},
+         {LIMB_PAIR(0xD777E0D8, 0x23A6800E), LIMB_PAIR(0x71CB04D2, 0x84D2780D),
+          LIMB_PAIR(0xD7A8F688, 0x691076F7), LIMB_PAIR(0xE2237B7F, 0xCFF1A453),
+          LIMB_PAIR(0x0A9037D4, 0xB1D9DD8F), LIMB_PAIR(0xD9199814, 0xFACE3A31),
+          LIMB_PAIR(0xDA563993, 0xFF7BFC81), LIMB_PAIR(0xC61DD36E, 0xA0F655AB),
+          LIMB_PARTIAL(0x111)}},
+        {{LIMB_PAIR(0x5D73ED9A, 0x43C5BDF1), LIMB_PAIR(0xE71C6E7F, 0xE3766738),
+          LIMB_PAIR(0x3947EA97, 0x625CB8C4), LIMB_PAIR(0x82241BA7, 0xADF7CCC0),
+          LIMB_PAIR(0x07329130, 0x629F45B3), LIMB_PAIR(0x8D0C281A, 0x9CFAC174),
+          LIMB_PAIR(0x7D14CA06, 0x92069E57), LIMB_PAIR(0xDC9F83A5, 0xCA121495),
+          LIMB_PARTIAL(0x0CF)},
+         {LIMB_PAIR(0x7DE97FCC, 0xF4E6DA37), LIMB_PAIR(0x025D39DF, 0xD3A271B7),
+          LIMB_PAIR(0x389E12EA, 0xBF2EBFE8), LIMB_PAIR(0x32F184F2, 0xF434F299),
+          LIMB_PAIR(0x366EF539, 0xFBC3CCB9), LIMB_PAIR(0xCDEF4A8F, 0x4E159CDA),
+          LIMB_PAIR(0xB0F0BB8E, 0xC311BD82), LIMB_PAIR(0x779669AD, 0x380B2EB1),
+          LIMB_PARTIAL(0x0B8)}},
+        {{LIMB_PAIR(0x1C2DF559, 0x9A0062D3), LIMB_PAIR(0x2D4E9996, 0xC130A85D),
+          LIMB_PAIR(0x370A02F6, 0xB226E6CF), LIMB_PAIR(0x7386B10F, 0x3FA94ADE),
+          LIMB_PAIR(0xD4576547, 0xDDEC1E75), LIMB_PAIR(0x1DBA7F8F, 0x0251109D),
+          LIMB_PAIR(0xC3A003A9, 0x9A3F5313), LIMB_PAIR(0xAB26E65E, 0x4742778B),
+          LIMB_PARTIAL(0x094)},
+         {LIMB_PAIR(0xFB997E14, 0x828CA5AD), LIMB_PAIR(0x65001ED7, 0x3826B0BE),
+          LIMB_PAIR(0xCFEC55A5, 0x53FB9CD3), LIMB_PAIR(0x31A1B7E7, 0x53E96D28),
+          LIMB_PAIR(0x24F2DFB5, 0xB5CBFDE9), LIMB_PAIR(0xE944F4A4, 0x3A26A665),
+          LIMB_PAIR(0x34E527B2, 0xD6376398), LIMB_PAIR(0xEDADF5B8, 0x709E156D),
+          LIMB_PARTIAL(0x18A)}}
+    }
+};
+
+// Odd multiples (2 * i + 1) * G for i = 0..31, for variable-time
+// double-scalar multiplication with a width-7 NAF.
+
+static limb_t const p521_odd[32][2][NUM_LIMBS_BITS(521)] PROGMEM = {
+    {{LIMB_PAIR(0xC2E5BD66, 0xF97E7E31), LIMB_PAIR(0x856A429B, 0x3348B3C1),
+      LIMB_PAIR(0xA2FFA8DE, 0xFE1DC127), LIMB_PAIR(0xEFE75928, 0xA14B5E77),
+      LIMB_PAIR(0x6B4D3DBA, 0xF828AF60), LIMB_PAIR(0x053FB521, 0x9C648139),
+      LIMB_PAIR(0x2395B442, 0x9E3ECB66), LIMB_PAIR(0x0404E9CD, 0x858E06B7),
+      LIMB_PARTIAL(0x0C6)},
+     {LIMB_PAIR(0x9FD16650, 0x88BE9476), LIMB_PAIR(0xA272C240, 0x353C7086),
+      LIMB_PAIR(0x3FAD0761, 0xC550B901), LIMB_PAIR(0x5EF42640, 0x97EE7299),
+      LIMB_PAIR(0x273E662C, 0x17AFBD17), LIMB_PAIR(0x579B4468, 0x98F54449),
+      LIMB_PAIR(0x2C7D1BD9, 0x5C8A5FB4), LIMB_PAIR(0x9A3BC004, 0x39296A78),
+      LIMB_PARTIAL(0x118)}},
+    {{LIMB_PAIR(0xDE37AD7D, 0xA5919D2E), LIMB_PAIR(0x2C32EA05, 0xAEB49086),
+      LIMB_PAIR(0xB59FE21B, 0x1DA6BD16), LIMB_PAIR(0x3A483205, 0xAD3F164A),
+      LIMB_PAIR(0x2D7A8DD1, 0xE5AD7A11), LIMB_PAIR(0x123D9AB9, 0xB52A6E5B),
+      LIMB_PAIR(0xB5959479, 0xD91D6A64), LIMB_PAIR(0xDE29195D, 0x3D352443),
+      LIMB_PARTIAL(0x1A7)},
+     {LIMB_PAIR(0xEE86C0E5, 0x5F588CA1), LIMB_PAIR(0x93A59042, 0xF105C9BC),
+      LIMB_PAIR(0xDEC3C70C, 0x2D5ACED1), LIMB_PAIR(0x8DC575B0, 0x2E2DD4CF),
+      LIMB_PAIR(0xA355CEEC, 0xD2F8AB1F), LIMB_PAIR(0x2A9D0317, 0xF1557FA8),
+      LIMB_PAIR(0xCAB814F2, 0x979F86C6), LIMB_PAIR(0xFA62DDD9, 0x9B03B97D),
+      LIMB_PARTIAL(0x13E)}},
+    {{LIMB_PAIR(0xEC8F3078, 0xD5AB5096), LIMB_PAIR(0xD8931738, 0x29D7E1E6),
+      LIMB_PAIR(0x137E79A3, 0x7112FEAF), LIMB_PAIR(0x5E301423, 0x383C0C6D),
+      LIMB_PAIR(0xF177ACE4, 0xCF03DAB8), LIMB_PAIR(0xB53F0D24, 0x7A596EFD),
+      LIMB_PAIR(0xC04EB0BF, 0x3DBC3391), LIMB_PAIR(0x27A432C7, 0x2BF3C529),
+      LIMB_PARTIAL(0x065)},
+     {LIMB_PAIR(0xDEB090CB, 0x173CC3E8), LIMB_PAIR(0x7354F7F8, 0xD1F00725),
+      LIMB_PAIR(0x1CF5FF79, 0x31154021), LIMB_PAIR(0x072CF374, 0xBB6897C9),
+      LIMB_PAIR(0xA0347087, 0xEDD817C9), LIMB_PAIR(0x872E0051, 0x1CD8FE8E),
+      LIMB_PAIR(0x4A811291, 0x8A2B7311), LIMB_PAIR(0x6601D6EC, 0xE6EF1BDD),
+      LIMB_PARTIAL(0x15B)}},
+    {{LIMB_PAIR(0x2816ECD4, 0x01CEAD88), LIMB_PAIR(0xFDC2619A, 0x6F953F50),
+      LIMB_PAIR(0xDCE3BBC4, 0xC9A6DF30), LIMB_PAIR(0xBFC698D8, 0x8C308D0A),
+      LIMB_PAIR(0xF7114C5D, 0xF018D2C2), LIMB_PAIR(0xF5483228, 0x5F22E0E8),
+      LIMB_PAIR(0x0B073A0C, 0xEEB65FDA), LIMB_PAIR(0x5B7F6346, 0xD5D1D99D),
+      LIMB_PARTIAL(0x056)},
+     {LIMB_PAIR(0x0525251B, 0x5C6B8BC9), LIMB_PAIR(0x5DDEFC7B, 0x9E76712A),
+      LIMB_PAIR(0x91CE1A5F, 0x9523A345), LIMB_PAIR(0xCDEC9E2B, 0x6BD0F293),
+      LIMB_PAIR(0x26CBDE55, 0x71DBD98A), LIMB_PAIR(0x2824F0DD, 0xB5C582D0),
+      LIMB_PAIR(0x39D68478, 0xD1D8317A), LIMB_PAIR(0xAAA2A110, 0x2D1B7D9B),
+      LIMB_PARTIAL(0x03D)}},
+    {{LIMB_PAIR(0x67CBE207, 0x1F456279), LIMB_PAIR(0x85CD2866, 0x4F50BABD),
+      LIMB_PAIR(0x725A318F, 0xF3C556DF), LIMB_PAIR(0x6134DA35, 0x7429E139),
+      LIMB_PAIR(0xB8C6B665, 0x2C4AB145), LIMB_PAIR(0x98874699, 0xED34541B),
+      LIMB_PAIR(0x7156D488, 0xA2F5BF15), LIMB_PAIR(0xE1E21826, 0x5389E359),
+      LIMB_PARTIAL(0x158)},
+     {LIMB_PAIR(0xB9AD2A4E, 0x3AA0EA86), LIMB_PAIR(0x28880F34, 0x736C2AE9),
+      LIMB_PAIR(0x4ABFD87D, 0x0FF56ECF), LIMB_PAIR(0x6057AC84, 0x0D69E575),
+      LIMB_PAIR(0x3DDB446E, 0xC825BA26), LIMB_PAIR(0xEE1CEBB6, 0x3088A654),
+      LIMB_PAIR(0x27AE938E, 0x0B55557A), LIMB_PAIR(0x8AEDF39F, 0x2E618C9A),
+      LIMB_PARTIAL(0x02A)}},
+    {{LIMB_PAIR(0xDA0CDB9A, 0xECC0E02D), LIMB_PAIR(0xA4C9A902, 0x015C024F),
+      LIMB_PAIR(0xE3191085, 0xD19B1AEB), LIMB_PAIR(0x2663DA1B, 0xF3DBC533),
+      LIMB_PAIR(0xF2991652, 0x43EF2C54), LIMB_PAIR(0x7C178495, 0xED5DC7ED),
+      LIMB_PAIR(0x3B4315CF, 0x6F1A3957), LIMB_PAIR(0xFDEDFF54, 0x75841259),
+      LIMB_PARTIAL(0x08A)},
+     {LIMB_PAIR(0xCE48C808, 0x58874F92), LIMB_PAIR(0xF4819B5D, 0xDCAC80E3),
+      LIMB_PAIR(0x14A95336, 0x38923319), LIMB_PAIR(0x8B42A4AB, 0x1BC8A90E),
+      LIMB_PAIR(0xE0B9B82B, 0xED2E95D4), LIMB_PAIR(0x10BD0493, 0x3ADD5662),
+      LIMB_PAIR(0x054FB229, 0x9D0CA877), LIMB_PAIR(0xBA212984, 0xFB303FCB),
+      LIMB_PARTIAL(0x096)}},
+    {{LIMB_PAIR(0x32FBCDA7, 0x1887848D), LIMB_PAIR(0xAB38EFF8, 0x4BEC3B00),
+      LIMB_PAIR(0x9AB88EE9, 0x3550A5E7), LIMB_PAIR(0xE03C996A, 0x32C45908),
+      LIMB_PAIR(0xAF5B8661, 0x4EEDD2BE), LIMB_PAIR(0xE1B4C238, 0x93F736CD),
+      LIMB_PAIR(0x4924861A, 0xD7865D2B), LIMB_PAIR(0xC396AD9C, 0x3E98F984),
+      LIMB_PARTIAL(0x07E)},
+     {LIMB_PAIR(0x022A71C9, 0x291A01FB), LIMB_PAIR(0x9117E9F7, 0x6199EAAF),
+      LIMB_PAIR(0x1CBFBBC3, 0x26DFDD35), LIMB_PAIR(0x38BC763F, 0xC1BD5D58),
+      LIMB_PAIR(0x5C1E212A, 0x9C7A67AE), LIMB_PAIR(0x6D5421C6, 0xCED50A38),
+      LIMB_PAIR(0xA3ED5A08, 0x1A1926DA), LIMB_PAIR(0x781FEDA9, 0xEE58EB6D),
+      LIMB_PARTIAL(0x108)}},
+    {{LIMB_PAIR(0xBCB8DB55, 0xE9AFE337), LIMB_PAIR(0x1E3F92BD, 0x9B8D9698),
+      LIMB_PAIR(0x8FC0331D, 0x7875BD1C), LIMB_PAIR(0xDBD00FFE, 0xB91CCE27),
+      LIMB_PAIR(0xDF128E11, 0xD697B532), LIMB_PAIR(0xB40A0852, 0xB8FBCC30),
+      LIMB_PAIR(0x46D4300F, 0x41558FC5), LIMB_PAIR(0xB92465F0, 0x6AD89ABC),
+      LIMB_PARTIAL(0x06B)},
+     {LIMB_PAIR(0xA1475465, 0x56343480), LIMB_PAIR(0x446ABDD9, 0x46FD90CC),
+      LIMB_PAIR(0x2C96C992, 0x2148E223), LIMB_PAIR(0x99470A80, 0x7E9062C8),
+      LIMB_PAIR(0x97485ED5, 0x4B621069), LIMB_PAIR(0xBAD20CBA, 0xDF0496A9),
+      LIMB_PAIR(0x33EDBF63, 0x7CE64D23), LIMB_PAIR(0x71391D6A, 0x68DA2715),
+      LIMB_PARTIAL(0x1B4)}},
+    {{LIMB_PAIR(0x53110AE0, 0x76F817A8), LIMB_PAIR(0xF0D1A410, 0xF8C3042A),
+      LIMB_PAIR(0x5681380F, 0xDF4E799B), LIMB_PAIR(0x74FE0287, 0x760A69E6),
+      LIMB_PAIR(0x69250858, 0xD66524F2), LIMB_PAIR(0x9FA2B3B4, 0x99EE9E26),
+      LIMB_PAIR(0x5923906A, 0xA0B87464), LIMB_PAIR(0x130EDA13, 0x0DDB707F),
+      LIMB_PARTIAL(0x1B0)},
+     {LIMB_PAIR(0x70E64647, 0x35B9CB7C), LIMB_PAIR(0xC2B755F5, 0xE6905594),
+      LIMB_PAIR(0x16ADF420, 0xD2F6757F), LIMB_PAIR(0xF6DD0BF0, 0xF9DA564E),
+      LIMB_PAIR(0x22A1323D, 0x8D68AC2B), LIMB_PAIR(0xF69910A9, 0xB799534C),
+      LIMB_PAIR(0xAEDDD106, 0xC111D4E4), LIMB_PAIR(0xB16576DB, 0x683F1D7D),
+      LIMB_PARTIAL(0x085)}},
+    {{LIMB_PAIR(0x18D6A19B, 0x78FF0B24), LIMB_PAIR(0x725BBDE4, 0xFECF431E),
+      LIMB_PAIR(0x7A45970D, 0x9232557D), LIMB_PAIR(0x36266967, 0xFA3B3096),
+      LIMB_PAIR(0x3790E7F1, 0xFFF0ACDB), LIMB_PAIR(0x55DF547E, 0x45B77E07),
+      LIMB_PAIR(0xD5A1A072, 0xC0F948C2), LIMB_PAIR(0x419C3487, 0x8DCCE486),
+      LIMB_PARTIAL(0x099)},
+     {LIMB_PAIR(0x5BFD0575, 0xA9091A69), LIMB_PAIR(0xA9FBFE44, 0xF5A4D89E),
+      LIMB_PAIR(0x1631C377, 0xB0EC3999), LIMB_PAIR(0xF2EB8CF9, 0x73AD963F),
+      LIMB_PAIR(0x65457727, 0xCC50EEE3), LIMB_PAIR(0x2B7BCF4A, 0x67D28AEE),
+      LIMB_PAIR(0x535B245D, 0xC3942497), LIMB_PAIR(0xA021ED5C, 0xD5DA0626),
+      LIMB_PARTIAL(0x137)}},
+    {{LIMB_PAIR(0x93C8C9ED, 0x42EF3996), LIMB_PAIR(0x93A46D2D, 0x37AC9203),
+      LIMB_PAIR(0xD827D75B, 0xD9497EAE), LIMB_PAIR(0x4D62A309, 0x46257EAE),
+      LIMB_PAIR(0x9C467FA9, 0x19523E75), LIMB_PAIR(0x2ED15E98, 0x268BB98C),
+      LIMB_PAIR(0x59ED3B10, 0x3CC85508), LIMB_PAIR(0x742BD2FB, 0xCBB2C11A),
+      LIMB_PARTIAL(0x1A1)},
+     {LIMB_PAIR(0x9CBA4DF5, 0xE60BC43C), LIMB_PAIR(0x649CCB61, 0x7C9B0F17),
+      LIMB_PAIR(0x2C63EEC5, 0xBEB43A37), LIMB_PAIR(0xDA483295, 0xDF741A53),
+      LIMB_PAIR(0x6BAFA7F7, 0x180A296F), LIMB_PAIR(0xC5193E6C, 0xE83C0059),
+      LIMB_PAIR(0x5E40CE62, 0x2C12DA7C), LIMB_PAIR(0x8EEB3D48, 0x209D7D4F),
+      LIMB_PARTIAL(0x11A)}},
+    {{LIMB_PAIR(0xE2AF535C, 0xA1C6A5EC), LIMB_PAIR(0x26AE5806, 0x07E1F1AC),
+      LIMB_PAIR(0xA5EC53E2, 0xE9E3F8E9), LIMB_PAIR(0x9AF5B0AF, 0x1F6F83FC),
+      LIMB_PAIR(0x0CDD4510, 0x490D234D), LIMB_PAIR(0x785FB282, 0xEE7A39BA),
+      LIMB_PAIR(0x5F547B8E, 0xDB1CACEC), LIMB_PAIR(0x90159376, 0x0B275D72),
+      LIMB_PARTIAL(0x1AE)},
+     {LIMB_PAIR(0x6FA0D000, 0xD815C353), LIMB_PAIR(0xA8D23856, 0x213B4450),
+      LIMB_PAIR(0xB07DD0C2, 0x3C27B27B), LIMB_PAIR(0xEE97FCF4, 0x10843361),
+      LIMB_PAIR(0x44C2DC0E, 0xB4316478), LIMB_PAIR(0x90D05832, 0x7D759FF8),
+      LIMB_PAIR(0xC068471C, 0x68A2858F), LIMB_PAIR(0x53853806, 0xC97A825E),
+      LIMB_PARTIAL(0x0F2)}},
+    {{LIMB_PAIR(0xBF70ACE0, 0x3F8C2460), LIMB_PAIR(0xC25D3FB1, 0xE41E0EB1),
+      LIMB_PAIR(0xA648FF27, 0x56E87E2A), LIMB_PAIR(0x7C36EE4D, 0xA9185691),
+      LIMB_PAIR(0x5499994A, 0x1C772C8C), LIMB_PAIR(0x51B107B1, 0x00731026),
+      LIMB_PAIR(0xF5DFF9D2, 0xA35874A6), LIMB_PAIR(0x5A9A1834, 0xE84C6D5C),
+      LIMB_PARTIAL(0x154)},
+     {LIMB_PAIR(0x04C78230, 0x4325BCE4), LIMB_PAIR(0x672E6B6D, 0xEEDE2A54),
+      LIMB_PAIR(0x6A5972F5, 0xD1E2370A), LIMB_PAIR(0x72FBC1A0, 0xDEE35435),
+      LIMB_PAIR(0x151666A6, 0xF66C2888), LIMB_PAIR(0x0022A0C7, 0x15A923EB),
+      LIMB_PAIR(0x0BB60D3F, 0xE22A28F8), LIMB_PAIR(0x1910473A, 0x0FDCE917),
+      LIMB_PARTIAL(0x0CD)}},
+    {{LIMB_PAIR(0x7002D68B, 0x35764301), LIMB_PAIR(0x92EC4568, 0xB2156044),
+      LIMB_PAIR(0xA0D3163C, 0x51353AED), LIMB_PAIR(0xA719D483, 0x80B2123D),
+      LIMB_PAIR(0xE135854D, 0x33F35187), LIMB_PAIR(0x0E4F862C, 0x8739535D),
+      LIMB_PAIR(0x889E646F, 0x62A4D4EB), LIMB_PAIR(0x18F9B6A7, 0x373EDF82),
+      LIMB_PARTIAL(0x160)},
+     {LIMB_PAIR(0x5D90B740, 0xF3E6AECA), LIMB_PAIR(0x9D45ACB3, 0x463FFE70),
+      LIMB_PAIR(0xA8BB572E, 0x13B874F4), LIMB_PAIR(0xD92EBC54, 0x1EFA491E),
+      LIMB_PAIR(0x1A1B2201, 0x4A56F78E), LIMB_PAIR(0xCF52C3BB, 0x9FD193C5),
+      LIMB_PAIR(0xAC06A3FA, 0xE5828401), LIMB_PAIR(0x4DCFE1C5, 0x59705001),
+      LIMB_PARTIAL(0x0F1)}},
+    {{LIMB_PAIR(0x8EDA25DC, 0x2C392761), LIMB_PAIR(0xD51F6D96, 0xF33D8595),
+      LIMB_PAIR(0x847FFB9E, 0x4003AB8E), LIMB_PAIR(0x876D7291, 0x5CA9BC06),
+      LIMB_PAIR(0x7664A130, 0x28BEF38F), LIMB_PAIR(0xE86265EC, 0xF9F45131),
+      LIMB_PAIR(0xB65A085F, 0xB3C1FBFC), LIMB_PAIR(0x4B68287D, 0xC644D6C9),
+      LIMB_PARTIAL(0x174)},
+     {LIMB_PAIR(0x821A0C30, 0x187BBBC4), LIMB_PAIR(0x26EBBFBD, 0x0679927C),
+      LIMB_PAIR(0x706D303F, 0x50C2732D), LIMB_PAIR(0x2CE0D90B, 0xBE0E2195),
+      LIMB_PAIR(0x95AD34B7, 0xB5CF5EB7), LIMB_PAIR(0xCB6441FC, 0x0233EF8F),
+      LIMB_PAIR(0x41B7B782, 0x05ACC95B), LIMB_PAIR(0x7F419E68, 0xF3A7C2F8),
+      LIMB_PARTIAL(0x11A)}},
+    {{LIMB_PAIR(0xC16A8803, 0x2257D0E0), LIMB_PAIR(0x88E24812, 0x0DCFB5E4),
+      LIMB_PAIR(0x09CD6B22, 0xFC14C1AC), LIMB_PAIR(0x04C9D429, 0xD65543A9),
+      LIMB_PAIR(0xA5E7726C, 0x7260A83C), LIMB_PAIR(0x57C2A661, 0xB5745896),
+      LIMB_PAIR(0xB7307B7D, 0x006A58CD), LIMB_PAIR(0x0F0C6615, 0xE9920CF3),
+      LIMB_PARTIAL(0x0D8)},
+     {LIMB_PAIR(0x39792D19, 0xCA4677C7), LIMB_PAIR(0x7B54318A, 0xAA1BD97C),
+      LIMB_PAIR(0xAE4CC263, 0x139A868C), LIMB_PAIR(0x44D14790, 0xF76B8C32),
+      LIMB_PAIR(0xBED1AA30, 0x0AEFB72C), LIMB_PAIR(0x8F10C806, 0x8B540632),
+      LIMB_PAIR(0x214A30EC, 0xDF09C13A), LIMB_PAIR(0x4A663987, 0xB023B545),
+      LIMB_PARTIAL(0x127)}},
+    {{LIMB_PAIR(0x649F308D, 0x5EA2E1FC), LIMB_PAIR(0x6B2ED12D, 0xA5EC5918),
+      LIMB_PAIR(0x7AA53AC2, 0xE9A519A5), LIMB_PAIR(0x2B77EF1A, 0xABDBEA7E),
+      LIMB_PAIR(0x74236DF0, 0xF381421A), LIMB_PAIR(0x2BE92613, 0x52086D48),
+      LIMB_PAIR(0x3C76F58E, 0x8C76EB4E), LIMB_PAIR(0x8FB969E6, 0x4195F097),
+      LIMB_PARTIAL(0x028)},
+     {LIMB_PAIR(0xD3E11C4D, 0x6BE95A3D), LIMB_PAIR(0x228B58F3, 0x88EFFD5C),
+      LIMB_PAIR(0xC16DEB3A, 0x00BD7216), LIMB_PAIR(0xF3D138BF, 0xE7656ECB),
+      LIMB_PAIR(0x614AC5F2, 0x9E016769), LIMB_PAIR(0xE063C663, 0x24D513AB),
+      LIMB_PAIR(0x69056D3A, 0x7B7A3BC8), LIMB_PAIR(0x56DC636B, 0x43EB08C6),
+      LIMB_PARTIAL(0x07E)}},
+    {{LIMB_PAIR(0xCCD7D718, 0xDC1039C9), LIMB_PAIR(0xB5DCC8D8, 0xA92FF614),
+      LIMB_PAIR(0x08F6B2CE, 0xEE4A6186), LIMB_PAIR(0xFDA74023, 0xB4806C84),
+      LIMB_PAIR(0x6F97392B, 0xC4A780B5), LIMB_PAIR(0xB593E0BF, 0xA267A642),
+      LIMB_PAIR(0x9E0BA392, 0x398B6206), LIMB_PAIR(0x49630A78, 0xC3007575),
+      LIMB_PARTIAL(0x0DD)},
+     {LIMB_PAIR(0x241E07F4, 0x3EB1D3EF), LIMB_PAIR(0x22640A4D, 0xDEBA4DB4),
+      LIMB_PAIR(0xEE69E797, 0x5C212522), LIMB_PAIR(0xD2C70142, 0x9AB1178B),
+      LIMB_PAIR(0x1A31DB50, 0x46279659), LIMB_PAIR(0xB5D85BCF, 0xA510936C),
+      LIMB_PAIR(0x0C30DBBF, 0x1B83431F), LIMB_PAIR(0xAC7FC5CC, 0xBD2D07F6),
+      LIMB_PARTIAL(0x0C1)}},
+    {{LIMB_PAIR(0xB557A36F, 0xF1AC4D59), LIMB_PAIR(0xE4780273, 0x8C64E76A),
+      LIMB_PAIR(0xE0980DF2, 0x0E58E26E), LIMB_PAIR(0xA2885604, 0xBD445763),
+      LIMB_PAIR(0xAF9D5749, 0x29ED0AE6), LIMB_PAIR(0xC1D59E42, 0xC35C5D56),
+      LIMB_PAIR(0x2DED5867, 0x39E79835), LIMB_PAIR(0x1832B671, 0x4F64A6C2),
+      LIMB_PARTIAL(0x094)},
+     {LIMB_PAIR(0x94FB2A03, 0x312BF983), LIMB_PAIR(0x56988296, 0x31A4BE40),
+      LIMB_PAIR(0x95A057C3, 0xB85C5649), LIMB_PAIR(0x71C83F81, 0xDCBDBC24),
+      LIMB_PAIR(0xB7991305, 0x26317DA6), LIMB_PAIR(0x1865F859, 0xFE4E6FF2),
+      LIMB_PAIR(0xF26CB192, 0x0C4B9624), LIMB_PAIR(0x028AB741, 0xB7EE1B02),
+      LIMB_PARTIAL(0x150)}},
+    {{LIMB_PAIR(0xEE33B77C, 0x0B704119), LIMB_PAIR(0x8083AF67, 0x5B4FA1D4),
+      LIMB_PAIR(0xE5FA3179, 0xAC0BF434), LIMB_PAIR(0x8626A1E2, 0x256B0CC5),
+      LIMB_PAIR(0x359C6EA7, 0x38D9FD62), LIMB_PAIR(0x9B5B9072, 0x9E9661A4),
+      LIMB_PAIR(0x56A49902, 0x52641263), LIMB_PAIR(0xFBAD6075, 0xA0B8F411),
+      LIMB_PARTIAL(0x124)},
+     {LIMB_PAIR(0x228B61A6, 0xD8DCDC61), LIMB_PAIR(0x698E40AB, 0xF212E74B),
+      LIMB_PAIR(0x5944E762, 0xA3CAF241), LIMB_PAIR(0xB96825AA, 0x18DC59FE),
+      LIMB_PAIR(0xC690DB48, 0xDC0B1240), LIMB_PAIR(0x8796154C, 0x68937BAA),
+      LIMB_PAIR(0x6BBD399C, 0x602A9A40), LIMB_PAIR(0x7335DCE3, 0x29616EDC),
+      LIMB_PARTIAL(0x010)}},
+    {{LIMB_PAIR(0x2624381E, 0x8E00CE95), LIMB_PAIR(0x22CC2AF6, 0xDDFDA1A5),
+      LIMB_PAIR(0xC8297BFA, 0x4C08C3DD), LIMB_PAIR(0xF495CCCE, 0x16B931EA),
+      LIMB_PAIR(0x864A60C8, 0x85B85F23), LIMB_PAIR(0xB28998A6, 0x52A523E4),
+      LIMB_PAIR(0x28830825, 0x63EBFD9D), LIMB_PAIR(0xE85E24A7, 0xA140ED79),
+      LIMB_PARTIAL(0x175)},
+     {LIMB_PAIR(0xC1028ECF, 0xEBEB760E), LIMB_PAIR(0xE7F3A3EC, 0xF75DD758),
+      LIMB_PAIR(0x1FA28EBD, 0x052A6E55), LIMB_PAIR(0xECF327DA, 0xB39E0E11),
+      LIMB_PAIR(0x22C82111, 0x23DE821B), LIMB_PAIR(0xE9EE5632, 0xAB59E580),
+      LIMB_PAIR(0xCA399BE7, 0x36F21343), LIMB_PAIR(0x55E2D4ED, 0x9696D718),
+      LIMB_PARTIAL(0x1B0)}},
+    {{LIMB_PAIR(0x224F497E, 0x713E3083), LIMB_PAIR(0xDEE07D20, 0x51F0B62F),
+      LIMB_PAIR(0x9B3D85CA, 0xA3A74E7A), LIMB_PAIR(0xED7D37DD, 0xFC66AD7A),
+      LIMB_PAIR(0x38FEA396, 0x8EF0F944), LIMB_PAIR(0xEC1419AF, 0x70678AA2),
+      LIMB_PAIR(0x0544D8A0, 0xD55022D9), LIMB_PAIR(0xEC58E4FE, 0x0148A165),
+      LIMB_PARTIAL(0x18C)},
+     {LIMB_PAIR(0x7683ADBF, 0x89582906), LIMB_PAIR(0x76B688D2, 0x94EDB92F),
+      LIMB_PAIR(0x547CE17A, 0x932D602B), LIMB_PAIR(0x879B1CF1, 0x67FD6098),
+      LIMB_PAIR(0x9F1A0BEC, 0x7A303781), LIMB_PAIR(0xB1D144CD, 0x2677E91D),
+      LIMB_PAIR(0x7AA3BF24, 0xEBF7A83C), LIMB_PAIR(0x9E78869A, 0xBBAA1F09),
+      LIMB_PARTIAL(0x10A)}},
+    {{LIMB_PAIR(0x0FC95C1A, 0xA32DEC60), LIMB_PAIR(0xB66B70C4, 0xC2954607),
+      LIMB_PAIR(0xE5703F0F, 0xDC8EA1AC), LIMB_PAIR(0xF8A1F2D9, 0x79189B7D),
+      LIMB_PAIR(0xF1972867, 0x7B2DF5E3), LIMB_PAIR(0x8C147CC0, 0x7A58F7F2),
+      LIMB_PAIR(0xFF2BC020, 0x79596B8F), LIMB_PAIR(0xA09E53B8, 0x69D186AC),
+      LIMB_PARTIAL(0x049)},
+     {LIMB_PAIR(0x000903A9, 0x9498A7CD), LIMB_PAIR(0x0B37564F, 0x3463F5D9),
+      LIMB_PAIR(0x9BE328E1, 0xE6ED9E87), LIMB_PAIR(0x2EADAE85, 0xB8D5B280),
+      LIMB_PAIR(0xBCDB40A9, 0x35584A1B), LIMB_PAIR(0x32708841, 0x15862A42),
+      LIMB_PAIR(0x3149FC7B, 0x4D6AC21F), LIMB_PAIR(0xD8D3847D, 0x1EC9B50C),
+      LIMB_PARTIAL(0x1E8)}},
+    {{LIMB_PAIR(0xABD59D11, 0x2FDA63C9), LIMB_PAIR(0xD1ECBB67, 0x0A56A130),
+      LIMB_PAIR(0xA9C4DD66, 0x9CEE75A3), LIMB_PAIR(0xB9E922AC, 0x381864A0),
+      LIMB_PAIR(0xC71DD0B2, 0x97233106), LIMB_PAIR(0x14033FF8, 0xE4E4FE27),
+      LIMB_PAIR(0xCC35882C, 0x9CF5083E), LIMB_PAIR(0x048AFD5F, 0xE31F8907),
+      LIMB_PARTIAL(0x0AF)},
+     {LIMB_PAIR(0x1D90E1D6, 0xD3065D2F), LIMB_PAIR(0x9F10673B, 0x11CA4159),
+      LIMB_PAIR(0x78D825E7, 0xEBB760F4), LIMB_PAIR(0x904982A6, 0x9276080B),
+      LIMB_PAIR(0x76F06497, 0xECEA7F32), LIMB_PAIR(0x49209F88, 0x605F0793),
+      LIMB_PAIR(0xB54FF69A, 0xB4290CBB), LIMB_PAIR(0x7275FE9D, 0xF95DC865),
+      LIMB_PARTIAL(0x012)}},
+    {{LIMB_PAIR(0x49EFC0AD, 0x0C8CB450), LIMB_PAIR(0xAC4C04CA, 0x7258DAB1),
+      LIMB_PAIR(0x2E345FA8, 0x91D8C84E), LIMB_PAIR(0x52F62842, 0x6BC2A2DF),
+      LIMB_PAIR(0x11DEA9EB, 0xF581B8B1), LIMB_PAIR(0xAE499839, 0x9D45C347),
+      LIMB_PAIR(0xBBABA0D3, 0xCBA40A63), LIMB_PAIR(0x0B8C1D57, 0xCB98FA3C),
+      LIMB_PARTIAL(0x0A5)},
+     {LIMB_PAIR(0x2C8884B4, 0x0B9BF46A), LIMB_PAIR(0xB0B88B1D, 0x4B963FBF),
+      LIMB_PAIR(0xEBB72BB4, 0x0C10F2CE), LIMB_PAIR(0x43D575C2, 0x5DD97755),
+      LIMB_PAIR(0x9DA8BF83, 0xB072C39D), LIMB_PAIR(0x877E5B7E, 0x749EE467),
+      LIMB_PAIR(0xF72E151B, 0x1409B01B), LIMB_PAIR(0x90D77B97, 0xDC956540),
+      LIMB_PARTIAL(0x015)}},
+    {{LIMB_PAIR(0xFBCC9504, 0xA8D916FF), LIMB_PAIR(0x1D7BE2DD, 0xFBA689EF),
+      LIMB_PAIR(0x1054CBC0, 0x1321AE1B), LIMB_PAIR(0xF07390DF, 0xC2EDFE6A),
+      LIMB_PAIR(0xF9BEEA26, 0x3BA316CB), LIMB_PAIR(0xE34FE9BA, 0xFDF9F5BD),
+      LIMB_PAIR(0x8145F3CC, 0x025D93B6), LIMB_PAIR(0x278415A2, 0x395BA51E),
+      LIMB_PARTIAL(0x168)},
+     {LIMB_PAIR(0xDD5C087B, 0x8EB9C45E), LIMB_PAIR(0xD3A89E18, 0x0600AABE),
+      LIMB_PAIR(0x6E3AEBA5, 0x849C3609), LIMB_PAIR(0xBADB600C, 0x97BC2B68),
+      LIMB_PAIR(0xADEB9B3C, 0x24E5B174), LIMB_PAIR(0x21C480CE, 0x52DD878F),
+      LIMB_PAIR(0x42D3F579, 0x39D95319), LIMB_PAIR(0x041A2456, 0xCC10F3CA),
+      LIMB_PARTIAL(0x071)}},
+    {{LIMB_PAIR(0xCCB69906, 0x6285684C), LIMB_PAIR(0xC9880816, 0x08153DA9),
+      LIMB_PAIR(0xBA4FE12B, 0xD3AF581F), LIMB_PAIR(0x7209A78E, 0x4E210E63),
+      LIMB_PAIR(0x948100C4, 0x27E82F6F), LIMB_PAIR(0x16895FB7, 0xF8688BE9),
+      LIMB_PAIR(0x310306DF, 0x7B3D0FFD), LIMB_PAIR(0x5EE693F7, 0xF6E24919),
+      LIMB_PARTIAL(0x143)},
+     {LIMB_PAIR(0xD40C7861, 0xFD6DDADD), LIMB_PAIR(0xC4ABEE6A, 0x040A3DFB),
+      LIMB_PAIR(0xE3B4CF8C, 0x0F6A7A9D), LIMB_PAIR(0x03CF3BB3, 0x4FDF64F5),
+      LIMB_PAIR(0x53D10CB1, 0x35437E80), LIMB_PAIR(0xE42C2169, 0x7DC73FDD),
+      LIMB_PAIR(0x57510987, 0xC5611A02), LIMB_PAIR(0x18EB2A74, 0x3E8FCC96),
+      LIMB_PARTIAL(0x105)}},
+    {{LIMB_PAIR(0xBD470F5E, 0x84AD7CCE), LIMB_PAIR(0xDA96AC4E, 0x7FE9AB4B),
+      LIMB_PAIR(0x1E0B549A, 0xBE17486B), LIMB_PAIR(0x7CAD27E6, 0x8CCA9391),
+      LIMB_PAIR(0x8E8DA1A1, 0x6472D402), LIMB_PAIR(0xD9D0A79D, 0x7CB03E9F),
+      LIMB_PAIR(0x5C6DACA9, 0xB551E415), LIMB_PAIR(0x310CE7C4, 0x52FC4B6D),
+      LIMB_PARTIAL(0x04B)},
+     {LIMB_PAIR(0x30A36EF2, 0x7A196CD2), LIMB_PAIR(0x06A096EA, 0xFA03A230),
+      LIMB_PAIR(0x45B53586, 0xD69609E3), LIMB_PAIR(0x5C5A084C, 0x10AA8589),
+      LIMB_PAIR(0x7DBAE155, 0x00FB114A), LIMB_PAIR(0x1A16A0B6, 0x619F4431),
+      LIMB_PAIR(0x7A1A7B2E, 0x385EA790), LIMB_PAIR(0x1461AE21, 0x85E54FE8),
+      LIMB_PARTIAL(0x035)}},
+    {{LIMB_PAIR(0x4E9A13E2, 0x3475330A), LIMB_PAIR(0xF95C8450, 0x8372C8FF),
+      LIMB_PAIR(0x64B8A520, 0xF66FD5BC), LIMB_PAIR(0xDE9118B2, 0x4AF300BB),
+      LIMB_PAIR(0xA521B9F8, 0xEF3C6D77), LIMB_PAIR(0x2E6DBF85, 0x5A8DEFE7),
+      LIMB_PAIR(0xEFB25FFA, 0x4463DA75), LIMB_PAIR(0xF3C902E0, 0x53C3E7FC),
+      LIMB_PARTIAL(0x0DC)},
+     {LIMB_PAIR(0xD9C4248F, 0x33AD7F7F), LIMB_PAIR(0xC62A5532, 0xA9493190),
+      LIMB_PAIR(0x6A929F73, 0x4A3F8205), LIMB_PAIR(0x0D3BD86A, 0x3482530D),
+      LIMB_PAIR(0x90DFF3EA, 0xB62E7EB3), LIMB_PAIR(0xCAF9D989, 0xB13D0DD2),
+      LIMB_PAIR(0xC4D4F8F7, 0x68073EE6), LIMB_PAIR(0xFDBD992B, 0xE88FCCD4),
+      LIMB_PARTIAL(0x074)}},
+    {{LIMB_PAIR(0xEB16686B, 0x63BE8A26), LIMB_PAIR(0xC3472088, 0xCBA8524E),
+      LIMB_PAIR(0x64373A8A, 0x1A90342D), LIMB_PAIR(0xB1344C69, 0x055693C9),
+      LIMB_PAIR(0x4C222920, 0xAAE5C293), LIMB_PAIR(0x98901999, 0xC7223C5D),
+      LIMB_PAIR(0x2DF29EAD, 0x063C6034), LIMB_PAIR(0x31876773, 0xAEB454AD),
+      LIMB_PARTIAL(0x035)},
+     {LIMB_PAIR(0x5381FA2E, 0xCF4AA03C), LIMB_PAIR(0xFAFFE51A, 0xFD82C38C),
+      LIMB_PAIR(0xD64FFEC3, 0xC9FD5FDD), LIMB_PAIR(0xBC83D0B8, 0xB8CF8C44),
+      LIMB_PAIR(0xCB6EFD45, 0xE22F2EF3), LIMB_PAIR(0x660903F4, 0x15A48DB3),
+      LIMB_PAIR(0xAFF1BA7F, 0xDB0B0CA0), LIMB_PAIR(0x7E7E43B4, 0x7ECBEC14),
+      LIMB_PARTIAL(0x018)}},
+    {{LIMB_PAIR(0xCFC376A1, 0xCB53D8CF), LIMB_PAIR(0x71543C41, 0x952BAD16),
+      LIMB_PAIR(0x9A7B32D7, 0xA5E7FCE5), LIMB_PAIR(0x77DC0B39, 0x7193C11A),
+      LIMB_PAIR(0xBE8B1717, 0x4CD724B1), LIMB_PAIR(0x5B660D1A, 0x8B6CD17D),
+      LIMB_PAIR(0x2A1C7D8F, 0x92CA7C73), LIMB_PAIR(0x1407425C, 0x544C4A01),
+      LIMB_PARTIAL(0x115)},
+     {LIMB_PAIR(0x4A17604B, 0xB8EFF8CD), LIMB_PAIR(0xC3FE5E24, 0x56F22EE9),
+      LIMB_PAIR(0x3AFA032B, 0xA834FF60), LIMB_PAIR(0xB7F553A8, 0x03F78D54),
+      LIMB_PAIR(0xED58C6A0, 0xEC097A3A), LIMB_PAIR(0xEF422CBF, 0x79AF485F),
+      LIMB_PAIR(0x399C872C, 0x07996D2A), LIMB_PAIR(0xAC6485B3, 0x3DF9C6C0),
+      LIMB_PARTIAL(0x115)}},
+    {{LIMB_PAIR(0xCE8888E5, 0x0F5BEB6F), LIMB_PAIR(0x5770AC8D, 0x75AF7D02),
+      LIMB_PAIR(0x7586265E, 0xC6399684), LIMB_PAIR(0x308E125E, 0x3AE99661),
+      LIMB_PAIR(0xD51B0845, 0xE7F54FE4), LIMB_PAIR(0xFFA0DDC1, 0x1CA21B5A),
+      LIMB_PAIR(0xCB0A6E8E, 0xE82F799A), LIMB_PAIR(0x640C457F, 0x32753B64),
+      LIMB_PARTIAL(0x1C1)},
+     {LIMB_PAIR(0xA03DBA15, 0xE9D15AD2), LIMB_PAIR(0xF664A2AC, 0xAF657B5B),
+      LIMB_PAIR(0xF0071283, 0x13F78F82), LIMB_PAIR(0xEC1896BC, 0x05D3DBDC),
+      LIMB_PAIR(0x3AA22380, 0x595E8C35), LIMB_PAIR(0x86414006, 0x1A9E0932),
+      LIMB_PAIR(0xB205D796, 0x6D81AC89), LIMB_PAIR(0x7A053817, 0x47E18419),
+      LIMB_PARTIAL(0x153)}}
+};
+
+#endif
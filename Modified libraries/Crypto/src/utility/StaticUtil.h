@@ -0,0 +1,45 @@
+/*
+ * Copyright (C) 2026 PIR-Based Intruder Alert System contributors
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a
+ * copy of this software and associated documentation files (the "Software"),
+ * to deal in the Software without restriction, including without limitation
+ * the rights to use, copy, modify, merge, publish, distribute, sublicense,
+ * and/or sell copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included
+ * in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS
+ * OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+ * FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE
+ * AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+ * LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER
+ * DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef CRYPTO_STATICUTIL_H
+#define CRYPTO_STATICUTIL_H
+
+// The loops behind the Static mode templates such as StaticCTR and
+// StaticHKDF are defined in the library's .cpp files rather than in the
+// headers, and are explicitly instantiated for the block ciphers and hash
+// algorithms in these lists.  The .cpp file must include the headers for
+// the algorithms before this file.
+
+#if defined(CRYPTO_AES_DEFAULT)
+#define CRYPTO_STATIC_BLOCK_CIPHERS(X) \
+    X(AES128) X(AES192) X(AES256) \
+    X(AESTiny128) X(AESTiny256) X(AESSmall128) X(AESSmall256)
+#else
+#define CRYPTO_STATIC_BLOCK_CIPHERS(X) \
+    X(AES128) X(AES192) X(AES256)
+#endif
+
+#define CRYPTO_STATIC_HASHES(X) \
+    X(SHA224) X(SHA256) X(SHA384) X(SHA512) X(SHA3_256) X(SHA3_512) \
+    X(BLAKE2s) X(BLAKE2b) X(BLAKE2sp) X(BLAKE2bp)
+
+#endif